@@ -293,6 +293,48 @@ int scalar_diffusivity_prev;
 */
 int scalar_time_scheme;
 
+/*!
+  \var scalar_explicit_rk_stages
+  For each transported scalar, number of stages of the explicit low-storage
+  Runge-Kutta scheme used for time integration instead of the implicit
+  \f$ \theta \f$-scheme.
+  - 0: implicit \f$ \theta \f$-scheme (default)
+  - 3: 3-stage, 2-register Runge-Kutta scheme of Williamson.\n
+  Convection, diffusion and source terms are then explicit, and no
+  linear system is solved, so the time step must satisfy the convective
+  and diffusive stability limits. Only useful for unsteady computations
+  at small Courant and Fourier numbers, such as LES or DNS.\n
+  This option only applies to scalars: velocity and pressure always use
+  the \f$ \theta \f$-scheme, and it is not compatible with the second
+  order time scheme (\ref cs_time_scheme_t::time_order = 2).
+*/
+int scalar_explicit_rk_stages;
+
+/*!
+  \var solve_skip_threshold
+  Adaptive scheduling of the solution of a transported scalar or
+  turbulence equation.
+  When strictly positive, the assembly and solution of the equation
+  are skipped for the current time step if the normalized initial residual
+  of its previous solution (residual before the first sweep divided by
+  the right-hand side normalization norm) is lower than
+  \ref solve_skip_threshold. Useful for passive scalars in steady or
+  quasi-steady phases.
+  For turbulence models, the equations are skipped only if all turbulence
+  variables meet this criterion.\n
+  Skipped solves are reported in the convergence log.
+  Negative by default (no skipping).
+*/
+double solve_skip_threshold;
+
+/*!
+  \var solve_skip_interval
+  Maximum number of consecutive time steps for which the solution of an
+  equation may be skipped (see \ref solve_skip_threshold) before a
+  solution is forced. 10 by default.
+*/
+int solve_skip_interval;
+
 /*!
   \var st_exp_extrapolated
   \f$ \theta \f$-scheme for the extrapolation of the nonlinear
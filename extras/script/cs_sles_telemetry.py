@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+
+#------------------------------------------------------------------------------
+# This file is part of code_saturne, a general-purpose CFD tool.
+#
+# Copyright (C) 1998-2025 EDF S.A.
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 2 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+# Street, Fifth Floor, Boston, MA 02110-1301, USA.
+#-------------------------------------------------------------------------------
+
+"""
+Summarize per-call linear solver telemetry (sles_telemetry.csv file written
+when the CS_SLES_TELEMETRY environment variable is set), ranking linear
+systems by their total cost over the run.
+"""
+
+import csv
+import sys
+
+from argparse import ArgumentParser
+
+#-------------------------------------------------------------------------------
+
+def read_telemetry(file_name, t_min=None, t_max=None):
+    """
+    Read telemetry records, optionally filtering by time step range.
+    """
+
+    records = []
+
+    with open(file_name) as f:
+        reader = csv.reader(f, skipinitialspace=True)
+        header = next(reader)
+        for row in reader:
+            r = dict(zip(header, row))
+            nt = int(r["time_step"])
+            if t_min is not None and nt < t_min:
+                continue
+            if t_max is not None and nt > t_max:
+                continue
+            records.append(r)
+
+    return records
+
+#-------------------------------------------------------------------------------
+
+def summarize(records):
+    """
+    Aggregate telemetry records by linear system.
+    """
+
+    systems = {}
+
+    for r in records:
+        name = r["system"]
+        s = systems.get(name)
+        if s is None:
+            s = {"type": r["type"],
+                 "n_calls": 0, "n_iter": 0, "n_iter_max": 0,
+                 "n_reused": 0, "n_failed": 0,
+                 "setup_time": 0., "solve_time": 0.}
+            systems[name] = s
+        n_iter = int(r["n_iter"])
+        s["n_calls"] += 1
+        s["n_iter"] += n_iter
+        s["n_iter_max"] = max(s["n_iter_max"], n_iter)
+        s["n_reused"] += int(r["setup_reused"])
+        if int(r["state"]) < 0:
+            s["n_failed"] += 1
+        s["setup_time"] += float(r["setup_time"])
+        s["solve_time"] += float(r["solve_time"])
+
+    return systems
+
+#-------------------------------------------------------------------------------
+
+def main():
+
+    parser = ArgumentParser(description=__doc__)
+
+    parser.add_argument("file", nargs="?", default="sles_telemetry.csv",
+                        help="telemetry file (default: sles_telemetry.csv)")
+    parser.add_argument("-n", "--n-top", type=int, default=20,
+                        help="number of systems to list (default: 20)")
+    parser.add_argument("--t-min", type=int, default=None,
+                        help="only use records from this time step on")
+    parser.add_argument("--t-max", type=int, default=None,
+                        help="only use records up to this time step")
+
+    args = parser.parse_args()
+
+    records = read_telemetry(args.file, args.t_min, args.t_max)
+    if not records:
+        print("No telemetry records found.", file=sys.stderr)
+        return 1
+
+    systems = summarize(records)
+
+    t_tot = sum(s["setup_time"] + s["solve_time"] for s in systems.values())
+    ranked = sorted(systems.items(),
+                    key=lambda i: i[1]["setup_time"] + i[1]["solve_time"],
+                    reverse=True)
+
+    print("%-28s %-14s %7s %8s %6s %8s %7s %10s %10s %6s"
+          % ("system", "type", "calls", "it. mean", "max",
+             "reused", "failed", "setup (s)", "solve (s)", "%"))
+
+    for name, s in ranked[:args.n_top]:
+        t = s["setup_time"] + s["solve_time"]
+        print("%-28.28s %-14.14s %7d %8.1f %6d %8d %7d %10.4g %10.4g %6.1f"
+              % (name, s["type"], s["n_calls"], s["n_iter"]/s["n_calls"],
+                 s["n_iter_max"], s["n_reused"], s["n_failed"],
+                 s["setup_time"], s["solve_time"],
+                 100.*t/t_tot if t_tot > 0 else 0.))
+
+    return 0
+
+#-------------------------------------------------------------------------------
+
+if __name__ == "__main__":
+    sys.exit(main())
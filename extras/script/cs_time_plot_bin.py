@@ -0,0 +1,262 @@
+#!/usr/bin/env python3
+
+#------------------------------------------------------------------------------
+# This file is part of code_saturne, a general-purpose CFD tool.
+#
+# Copyright (C) 1998-2025 EDF S.A.
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 2 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+# Street, Fifth Floor, Boston, MA 02110-1301, USA.
+#-------------------------------------------------------------------------------
+
+"""
+Read binary time plot (.ctp) files, written by time plot writers using the
+"binary" option, and convert them to CSV, optionally selecting columns
+and time step ranges.
+"""
+
+import bisect
+import mmap
+import struct
+import sys
+import zlib
+
+from argparse import ArgumentParser
+
+#-------------------------------------------------------------------------------
+
+class time_plot_file:
+    """
+    Binary time plot file reader.
+    """
+
+    def __init__(self, file_name):
+
+        # Map file rather than reading it, so that only chunks
+        # actually used are loaded
+
+        with open(file_name, 'rb') as f:
+            try:
+                self.data = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+            except ValueError:  # empty file
+                self.data = b''
+
+        self.file_name = file_name
+        self.__read_header()
+        self.__read_index()
+
+    #---------------------------------------------------------------------------
+
+    def __unpack(self, fmt, pos):
+        """
+        Unpack values at a given position, using the file's byte order.
+        """
+        s = struct.Struct(self.bo + fmt)
+        return s.unpack_from(self.data, pos), pos + s.size
+
+    #---------------------------------------------------------------------------
+
+    def __read_header(self):
+
+        if self.data[0:8] != b'CS_TPLOT':
+            raise ValueError(self.file_name + ': not a binary time plot file.')
+
+        self.bo = '<'
+        if struct.unpack_from('<I', self.data, 12)[0] != 0x01020304:
+            self.bo = '>'
+
+        vals, pos = self.__unpack('6I', 8)
+        self.version, bo, flags, l_title, self.n_cols, has_coords = vals
+        self.use_iteration = (flags & 1) != 0
+
+        self.title = self.data[pos:pos+l_title].decode('utf-8', 'replace')
+        pos += l_title
+
+        (l_labels,), pos = self.__unpack('Q', pos)
+        labels = self.data[pos:pos+l_labels].split(b'\0')[:self.n_cols]
+        self.labels = [l.decode('utf-8', 'replace') for l in labels]
+        pos += l_labels
+
+        self.coords = None
+        if has_coords:
+            c, pos = self.__unpack(str(3*self.n_cols) + 'd', pos)
+            self.coords = [c[i*3:i*3+3] for i in range(self.n_cols)]
+
+        self.data_start = pos
+
+    #---------------------------------------------------------------------------
+
+    def __read_index(self):
+        """
+        Read chunk index from file footer if present, or scan chunks
+        otherwise (for example for a computation which is still running
+        or was interrupted).
+        """
+
+        self.chunks = []
+        self.chunks_tn_0 = []
+
+        if len(self.data) >= self.data_start + 24 and self.data[-4:] == b'CEND':
+            (idx_pos,), pos = self.__unpack('Q', len(self.data) - 12)
+            if self.data[idx_pos:idx_pos+4] == b'CIDX':
+                (n_chunks,), pos = self.__unpack('Q', idx_pos + 4)
+                for i in range(n_chunks):
+                    (offset, n_rows, tn_0, t_0), pos \
+                        = self.__unpack('QIid', pos)
+                    self.chunks.append(offset)
+                    self.chunks_tn_0.append(tn_0)
+                return
+
+        # Without index, only the first time step number of each
+        # chunk is decompressed.
+
+        pos = self.data_start
+        while pos + 32 <= len(self.data) and self.data[pos:pos+4] == b'CHNK':
+            (n_rows, n_cols, codec, raw_size, stored_size), p_end \
+                = self.__unpack('3I2Q', pos + 4)
+            if p_end + stored_size > len(self.data):
+                break
+            raw = memoryview(self.data)[p_end:p_end+stored_size]
+            if codec == 1:
+                raw = zlib.decompressobj().decompress(raw, 4)
+            self.chunks.append(pos)
+            self.chunks_tn_0.append(struct.unpack_from(self.bo + 'i', raw)[0])
+            pos = p_end + stored_size
+
+    #---------------------------------------------------------------------------
+
+    def read_chunk(self, chunk_id):
+        """
+        Return time step numbers, time values, and value columns of a chunk.
+        """
+
+        pos = self.chunks[chunk_id]
+        (n_rows, n_cols, codec, raw_size, stored_size), pos \
+            = self.__unpack('3I2Q', pos + 4)
+
+        raw = self.data[pos:pos+stored_size]
+        if codec == 1:
+            raw = zlib.decompress(raw)
+
+        tn = struct.unpack_from(self.bo + str(n_rows) + 'i', raw, 0)
+
+        # Unshuffle bytes of floating-point columns
+
+        n_d = n_rows*(n_cols + 1)
+        s = raw[4*n_rows:]
+        b = bytearray(8*n_d)
+        for k in range(8):
+            b[k::8] = s[k*n_d:(k+1)*n_d]
+        d = struct.unpack(self.bo + str(n_d) + 'd', bytes(b))
+
+        t = d[0:n_rows]
+        cols = [d[(j+1)*n_rows:(j+2)*n_rows] for j in range(n_cols)]
+
+        return tn, t, cols
+
+    #---------------------------------------------------------------------------
+
+    def rows(self, t_min=None, t_max=None):
+        """
+        Iterate over rows (time step number, time value, values).
+
+        Time step numbers are assumed to increase, so chunks preceding
+        the one containing t_min or following t_max are not read.
+        """
+
+        c_start = 0
+        if t_min is not None:
+            c_start = max(bisect.bisect_right(self.chunks_tn_0, t_min) - 1, 0)
+
+        for chunk_id in range(c_start, len(self.chunks)):
+            if t_max is not None and self.chunks_tn_0[chunk_id] > t_max:
+                break
+            tn, t, cols = self.read_chunk(chunk_id)
+            for i in range(len(tn)):
+                if t_min is not None and tn[i] < t_min:
+                    continue
+                if t_max is not None and tn[i] > t_max:
+                    continue
+                yield tn[i], t[i], [c[i] for c in cols]
+
+#-------------------------------------------------------------------------------
+
+def main():
+
+    parser = ArgumentParser(description=__doc__)
+
+    parser.add_argument("file", help="binary time plot file (.ctp)")
+    parser.add_argument("-o", "--output", default=None,
+                        help="output CSV file (default: standard output)")
+    parser.add_argument("-c", "--columns", default=None,
+                        help="comma-separated list of column ids (0 to n-1)"
+                        " or labels to output (default: all)")
+    parser.add_argument("--t-min", type=int, default=None,
+                        help="only output rows from this time step on")
+    parser.add_argument("--t-max", type=int, default=None,
+                        help="only output rows up to this time step")
+    parser.add_argument("--info", action="store_true",
+                        help="only print file information")
+
+    args = parser.parse_args()
+
+    tp = time_plot_file(args.file)
+
+    if args.info:
+        print("title:    " + tp.title)
+        print("columns:  " + str(tp.n_cols))
+        print("chunks:   " + str(len(tp.chunks)))
+        for i, l in enumerate(tp.labels):
+            if tp.coords:
+                print("  %6d %s [%g, %g, %g]" % ((i, l) + tuple(tp.coords[i])))
+            else:
+                print("  %6d %s" % (i, l))
+        return 0
+
+    col_ids = list(range(tp.n_cols))
+    if args.columns:
+        col_ids = []
+        for c in args.columns.split(','):
+            c = c.strip()
+            if c in tp.labels:
+                col_ids.append(tp.labels.index(c))
+            else:
+                col_ids.append(int(c))
+
+    f = sys.stdout
+    if args.output:
+        f = open(args.output, 'w')
+
+    if tp.use_iteration:
+        header = ["iteration"]
+    else:
+        header = ["t"]
+    f.write(", ".join(header + [tp.labels[j] for j in col_ids]) + "\n")
+
+    for tn, t, vals in tp.rows(args.t_min, args.t_max):
+        if tp.use_iteration:
+            s = "%8d" % tn
+        else:
+            s = "%14.7e" % t
+        f.write(s + "".join([", %14.7e" % vals[j] for j in col_ids]) + "\n")
+
+    if f != sys.stdout:
+        f.close()
+
+    return 0
+
+#-------------------------------------------------------------------------------
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+
+#------------------------------------------------------------------------------
+# This file is part of code_saturne, a general-purpose CFD tool.
+#
+# Copyright (C) 1998-2025 EDF S.A.
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 2 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+# Street, Fifth Floor, Boston, MA 02110-1301, USA.
+#-------------------------------------------------------------------------------
+
+"""
+Merge per-rank timeline traces (trace_r*.json files written when the
+CS_TRACE environment variable is set) into a single Chrome trace file,
+which may be viewed with https://ui.perfetto.dev or chrome://tracing.
+"""
+
+import glob
+import json
+import os.path
+import sys
+
+from argparse import ArgumentParser
+
+#-------------------------------------------------------------------------------
+
+def merge_traces(file_names, categories=None, t_min=None, t_max=None):
+    """
+    Merge trace files, optionally filtering events by category
+    and time range (in seconds).
+    """
+
+    events = []
+    n_dropped = 0
+    n_ranks = 0
+
+    for f_name in file_names:
+        with open(f_name) as f:
+            trace = json.load(f)
+        for e in trace["traceEvents"]:
+            if e["ph"] == "X":
+                if categories and e.get("cat") not in categories:
+                    continue
+                if t_min is not None and e["ts"] + e["dur"] < t_min*1e6:
+                    continue
+                if t_max is not None and e["ts"] > t_max*1e6:
+                    continue
+            events.append(e)
+        other = trace.get("otherData", {})
+        n_dropped += other.get("n_dropped", 0)
+        n_ranks = max(n_ranks, other.get("n_ranks", 1))
+
+    if n_dropped > 0:
+        print("Warning: %d events were dropped during the run." % n_dropped,
+              file=sys.stderr)
+
+    return {"traceEvents": events,
+            "displayTimeUnit": "ms",
+            "otherData": {"n_ranks": n_ranks,
+                          "n_files": len(file_names),
+                          "n_dropped": n_dropped}}
+
+#-------------------------------------------------------------------------------
+
+def main():
+
+    parser = ArgumentParser(description=__doc__)
+
+    parser.add_argument("files", nargs="*",
+                        help="trace files to merge (default: trace_r*.json "
+                        + "in the current directory)")
+    parser.add_argument("-o", "--output", default="trace_merged.json",
+                        help="output file name (default: trace_merged.json)")
+    parser.add_argument("-c", "--category", action="append", default=None,
+                        help="only keep events of the given category "
+                        + "(timer_stats, sles_setup, sles_solve, halo, "
+                        + "all_to_all, post; may be repeated)")
+    parser.add_argument("--t-min", type=float, default=None,
+                        help="only keep events ending after this time (s)")
+    parser.add_argument("--t-max", type=float, default=None,
+                        help="only keep events starting before this time (s)")
+
+    args = parser.parse_args()
+
+    file_names = args.files
+    if not file_names:
+        file_names = sorted(glob.glob("trace_r*.json"))
+        if not file_names and os.path.isfile("trace.json"):
+            file_names = ["trace.json"]
+    if not file_names:
+        print("No trace files found.", file=sys.stderr)
+        return 1
+
+    merged = merge_traces(file_names, args.category, args.t_min, args.t_max)
+
+    with open(args.output, "w") as f:
+        json.dump(merged, f, separators=(",", ":"))
+
+    print("Merged %d files (%d events) into %s."
+          % (len(file_names), len(merged["traceEvents"]), args.output))
+
+    return 0
+
+#-------------------------------------------------------------------------------
+
+if __name__ == "__main__":
+    sys.exit(main())
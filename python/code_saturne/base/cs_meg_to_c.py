@@ -306,6 +306,38 @@ _base_tokens = {'dt':'const cs_real_t dt = cs_glob_time_step->dt[0];',
                 'gy':'const cs_real_t gy = cs_glob_physical_constants->gravity[1];',
                 'gz':'const cs_real_t gz = cs_glob_physical_constants->gravity[2];'}
 
+# Properties whose formulas over a same zone may be evaluated in a single
+# loop; the order must match that used in cs_gui_physical_variable.
+
+_vol_batch_fields = ['density',
+                     'molecular_viscosity',
+                     'specific_heat',
+                     'thermal_conductivity',
+                     'volume_viscosity']
+
+# Fallback for grouped volume function requests with no matching block
+
+_vol_group_fallback = \
+"""
+  /* Grouped request with no matching block: evaluate fields one by one */
+
+  if (strchr(fields_names, '+') != nullptr) {
+    char f_name[128];
+    const char *s = fields_names;
+    for (int f_id = 0; s != nullptr; f_id++) {
+      const char *e = strchr(s, '+');
+      size_t l = (e != nullptr) ? (size_t)(e - s) : strlen(s);
+      if (l > 127)
+        l = 127;
+      strncpy(f_name, s, l);
+      f_name[l] = '\\0';
+      cs_meg_volume_function(zone_name, n_elts, elt_ids, xyz,
+                             f_name, fvals + f_id);
+      s = (e != nullptr) ? e + 1 : nullptr;
+    }
+  }
+"""
+
 # ---------------------------------------------------------------------------
 
 def _error_and_exit(msg):
@@ -526,7 +558,10 @@ class meg_to_c_interpreter:
 
     # ---------------------------------------------------------------------------
 
-    def write_cell_block(self, func_key):
+    def write_cell_block_parts(self, func_key):
+        """
+        Return hoisted definitions and loop body code for a volume formula.
+        """
 
         func_params = self.funcs['vol'][func_key]
 
@@ -641,8 +676,18 @@ class meg_to_c_interpreter:
         if parsed_exp[1] != '':
             usr_defs += parsed_exp[1]
 
+        return usr_defs, usr_code
+
+    # ---------------------------------------------------------------------------
+
+    def write_cell_block(self, func_key):
+
+        zone, name = func_key.split('::')
+        usr_defs, usr_code = self.write_cell_block_parts(func_key)
+
+        tab = "  "
+
         # Write the block
-        nsplit = name.split('+')
         usr_blck = tab + 'if (strcmp(fields_names, "%s") == 0 &&\n' % (name)
         usr_blck += tab + '    strcmp(zone_name, "%s") == 0) {\n' % (zone)
 
@@ -654,12 +699,89 @@ class meg_to_c_interpreter:
         usr_blck += usr_code
 
         usr_blck += 2*tab + '}\n'
+        usr_blck += 2*tab + 'return;\n'
         usr_blck += tab + '}\n'
 
         return usr_blck
 
     # ---------------------------------------------------------------------------
 
+    def write_cell_group_block(self, zone, names):
+        """
+        Write a block evaluating several single-field formulas over a
+        same zone in a single loop, with definitions hoisted only once.
+        """
+
+        tab = "  "
+
+        group_defs = []
+        group_code = ''
+
+        for i, name in enumerate(names):
+            usr_defs, usr_code = \
+                self.write_cell_block_parts('::'.join([zone, name]))
+
+            # Identical definitions (time, constants, field pointers...)
+            # are shared by all formulas
+            for l in usr_defs.split('\n'):
+                if l.strip() != '' and l not in group_defs:
+                    group_defs.append(l)
+
+            # Each formula uses its own scope in the shared loop
+            group_code += 3*tab + '{ /* %s */\n' % (name)
+            for l in usr_code.replace('fvals[0]', 'fvals[%d]' % i).split('\n'):
+                if l.strip() != '':
+                    group_code += tab + l + '\n'
+            group_code += 3*tab + '}\n'
+
+        usr_blck = tab + 'if (strcmp(fields_names, "%s") == 0 &&\n' \
+            % ('+'.join(names))
+        usr_blck += tab + '    strcmp(zone_name, "%s") == 0) {\n' % (zone)
+
+        for l in group_defs:
+            usr_blck += l + '\n'
+        usr_blck += '\n'
+
+        usr_blck += 2*tab + 'for (cs_lnum_t e_id = 0; e_id < n_elts; e_id++) {\n'
+        usr_blck += 3*tab + 'cs_lnum_t c_id = (elt_ids != nullptr) ? elt_ids[e_id] : e_id;\n'
+
+        usr_blck += group_code
+
+        usr_blck += 2*tab + '}\n'
+        usr_blck += 2*tab + 'return;\n'
+        usr_blck += tab + '}\n'
+
+        return usr_blck
+
+    # ---------------------------------------------------------------------------
+
+    def get_cell_groups(self):
+        """
+        Return (zone, names) tuples for zones with several single-field
+        formulas which may be evaluated together.
+
+        Properties not defined by a formula end a group on the calling
+        side, so every run of consecutive formulas is provided.
+        """
+
+        groups = []
+        zones = []
+        for key in self.funcs['vol'].keys():
+            zone = key.split('::')[0]
+            if zone not in zones:
+                zones.append(zone)
+
+        for zone in zones:
+            names = [n for n in _vol_batch_fields
+                     if '::'.join([zone, n]) in self.funcs['vol']]
+            for n in range(len(names), 1, -1):
+                for i in range(0, len(names) - n + 1):
+                    groups.append((zone, names[i:i+n]))
+
+        return groups
+
+    # ---------------------------------------------------------------------------
+
     def write_bnd_block(self, func_key):
 
         if func_key not in self.funcs['bnd'].keys():
@@ -2860,6 +2982,19 @@ class meg_to_c_interpreter:
 
                 k_count += 1
 
+            if func_type == 'vol':
+                for zone_name, names in self.get_cell_groups():
+                    m1 = _block_comments[func_type] \
+                        % (', '.join(names), zone_name) + ' (single loop)'
+                    m2 = '  -' + '-'*len(m1) + ' */\n\n'
+                    m1 = '/* ' + m1 + '\n'
+                    code_to_write += '\n  ' + m1
+                    code_to_write += '  ' + m2
+                    code_to_write += self.write_cell_group_block(zone_name,
+                                                                 names)
+
+                code_to_write += _vol_group_fallback
+
             code_to_write += _file_footer
 
         # Write the C file if necessary
@@ -65,6 +65,7 @@
 #include "base/cs_parameters.h"
 #include "base/cs_post.h"
 #include "base/cs_prototypes.h"
+#include "base/cs_time_plot.h"
 #include "base/cs_time_step.h"
 #include "base/cs_turbomachinery.h"
 #include "base/cs_selector.h"
@@ -91,6 +92,51 @@ BEGIN_C_DECLS
 
 */
 
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Time plots for balances on multiple zones (on rank 0 only) */
+
+static int               _n_plots = 0;
+static char            **_plot_names = nullptr;
+static int              *_plot_n_vals = nullptr;
+static cs_time_plot_t  **_plots = nullptr;
+
+/* Short names of balance terms, for time plot labels */
+
+static const char *_balance_term_name[] = {"volume",
+                                           "div",
+                                           "unsteady",
+                                           "mass",
+                                           "mass_in",
+                                           "mass_out",
+                                           "interior_in",
+                                           "interior_out",
+                                           "boundary_in",
+                                           "boundary_out",
+                                           "sym",
+                                           "wall",
+                                           "wall_s",
+                                           "wall_r",
+                                           "coupled",
+                                           "coupled_e",
+                                           "coupled_i",
+                                           "other",
+                                           "total",
+                                           "total_normalized"};
+
+static const char *_balance_p_term_name[] = {"p_in",
+                                             "p_out",
+                                             "u2_in",
+                                             "u2_out",
+                                             "rhogx_in",
+                                             "rhogx_out",
+                                             "u_in",
+                                             "u_out",
+                                             "rhou_in",
+                                             "rhou_out"};
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -726,51 +772,351 @@ _balance_internal_faces(int               iupwin,
 
 }
 
-/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+/*----------------------------------------------------------------------------
+ * Build cell to zone tags for a set of possibly overlapping zones.
+ *
+ * Zones are distributed in layers of disjoint zones, so that a single
+ * sweep over faces per layer is sufficient. The distribution is identical
+ * on all ranks, and tags are synchronized on ghost cells.
+ *
+ * parameters:
+ *   n_zones       <-- number of zones
+ *   n_cells_sel   <-- number of selected cells for each zone
+ *   cell_sel_ids  <-- ids of selected cells for each zone
+ *   n_layers      --> number of layers
+ *
+ * returns:
+ *   zone id (or -1) for each cell with ghosts, for each layer
+ *   (size: n_layers*n_cells_with_ghosts), to be freed by the caller
+ *----------------------------------------------------------------------------*/
 
-/*=============================================================================
- * Local Macro Definitions
- *============================================================================*/
+static cs_lnum_t *
+_zone_tags(int                     n_zones,
+           const cs_lnum_t         n_cells_sel[],
+           const cs_lnum_t *const  cell_sel_ids[],
+           int                    *n_layers)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
 
-/*============================================================================
- * Public function definitions
- *============================================================================*/
+  int _n_layers = 0;
+  cs_lnum_t *zone_tag = nullptr;
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Compute the different terms of the balance of a given scalar,
- *        on a volume zone defined by selected cell ids/
+  int *conflict;
+  CS_MALLOC(conflict, n_zones, int);
+
+  for (int z_id = 0; z_id < n_zones; z_id++) {
+
+    const cs_lnum_t *sel_ids = cell_sel_ids[z_id];
+
+    /* Check for overlap with zones already assigned to each layer */
+
+    for (int l_id = 0; l_id < _n_layers; l_id++) {
+      const cs_lnum_t *l_tag = zone_tag + (size_t)l_id*n_cells_ext;
+      conflict[l_id] = 0;
+      for (cs_lnum_t i = 0; i < n_cells_sel[z_id]; i++) {
+        if (l_tag[sel_ids[i]] > -1) {
+          conflict[l_id] = 1;
+          break;
+        }
+      }
+    }
+
+    cs_parall_max(_n_layers, CS_INT_TYPE, conflict);
+
+    int l_id = 0;
+    while (l_id < _n_layers && conflict[l_id] != 0)
+      l_id++;
+
+    if (l_id == _n_layers) {
+      _n_layers += 1;
+      CS_REALLOC(zone_tag, (size_t)_n_layers*n_cells_ext, cs_lnum_t);
+      cs_lnum_t *l_tag = zone_tag + (size_t)l_id*n_cells_ext;
+      for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+        l_tag[c_id] = -1;
+    }
+
+    cs_lnum_t *l_tag = zone_tag + (size_t)l_id*n_cells_ext;
+    for (cs_lnum_t i = 0; i < n_cells_sel[z_id]; i++)
+      l_tag[sel_ids[i]] = z_id;
+
+  }
+
+  CS_FREE(conflict);
+
+  /* Synchronization for parallelism */
+
+  if (m->halo != nullptr) {
+    for (int l_id = 0; l_id < _n_layers; l_id++)
+      cs_halo_sync_num(m->halo,
+                       CS_HALO_STANDARD,
+                       zone_tag + (size_t)l_id*n_cells_ext);
+  }
+
+  *n_layers = _n_layers;
+
+  return zone_tag;
+}
+
+/*----------------------------------------------------------------------------
+ * Select cells for a list of zones defined by selection criteria.
  *
- * This function computes the balance relative to a given scalar
- * on a selected zone of the mesh.
- * We assume that we want to compute balances (convective and diffusive)
- * at the boundaries of the calculation domain represented below
- * (with different boundary types).
+ * parameters:
+ *   n_zones         <-- number of zones
+ *   selection_crit  <-- selection criterion for each zone
+ *   n_cells_sel     --> number of selected cells for each zone
+ *   cell_sel_ids    --> ids of selected cells for each zone
+ *                       (each array to be freed by the caller)
+ *----------------------------------------------------------------------------*/
+
+static void
+_select_zone_cells(int          n_zones,
+                   const char  *selection_crit[],
+                   cs_lnum_t    n_cells_sel[],
+                   cs_lnum_t   *cell_sel_ids[])
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  for (int z_id = 0; z_id < n_zones; z_id++) {
+    n_cells_sel[z_id] = 0;
+    CS_MALLOC(cell_sel_ids[z_id], n_cells, cs_lnum_t);
+    cs_selector_get_cell_list(selection_crit[z_id],
+                              &(n_cells_sel[z_id]),
+                              cell_sel_ids[z_id]);
+    CS_REALLOC(cell_sel_ids[z_id], n_cells_sel[z_id], cs_lnum_t);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Write values of balance terms for a list of zones to a time plot.
  *
- * In the case of the temperature, the energy balance in Joules will be
- * computed by multiplying by the specific heat.
+ * Plots are created on first use and identified by their name, so the
+ * number of zones associated with a given plot name may not change.
  *
- * \param[in]     scalar_name         scalar name
- * \param[in]     n_cells_sel         number of selected cells
- * \param[in]     cell_sel_ids        ids of selected cells
- * \param[out]    balance             array of computed balance terms
- *                                    (see \ref cs_balance_term_t)
- */
-/*----------------------------------------------------------------------------*/
+ * parameters:
+ *   plot_name  <-- time plot name
+ *   n_zones    <-- number of zones
+ *   n_terms    <-- number of balance terms per zone
+ *   term_name  <-- short name of each balance term
+ *   vals       <-- balance term values (size: n_zones*n_terms)
+ *----------------------------------------------------------------------------*/
 
-void
-cs_balance_by_zone_compute(const char      *scalar_name,
-                           cs_lnum_t        n_cells_sel,
-                           const cs_lnum_t  cell_sel_ids[],
-                           cs_real_t        balance[CS_BALANCE_N_TERMS])
+static void
+_time_plot_write(const char       *plot_name,
+                 int               n_zones,
+                 int               n_terms,
+                 const char       *term_name[],
+                 const cs_real_t   vals[])
+{
+  if (cs_glob_rank_id > 0)
+    return;
+
+  const cs_time_step_t *ts = cs_glob_time_step;
+  const int n_vals = n_zones*n_terms;
+
+  int p_id = 0;
+  while (p_id < _n_plots && strcmp(_plot_names[p_id], plot_name) != 0)
+    p_id++;
+
+  if (p_id == _n_plots) {
+
+    /* Labels are of the form "z<zone index>_<term name>" */
+
+    const size_t l_size = 32;
+    char *label_buf;
+    const char **labels;
+    CS_MALLOC(label_buf, n_vals*l_size, char);
+    CS_MALLOC(labels, n_vals, const char *);
+    for (int z_id = 0; z_id < n_zones; z_id++) {
+      for (int t_id = 0; t_id < n_terms; t_id++) {
+        char *l = label_buf + (z_id*n_terms + t_id)*l_size;
+        snprintf(l, l_size, "z%d_%s", z_id, term_name[t_id]);
+        labels[z_id*n_terms + t_id] = l;
+      }
+    }
+
+    _n_plots += 1;
+    CS_REALLOC(_plot_names, _n_plots, char *);
+    CS_REALLOC(_plot_n_vals, _n_plots, int);
+    CS_REALLOC(_plots, _n_plots, cs_time_plot_t *);
+
+    CS_MALLOC(_plot_names[p_id], strlen(plot_name) + 1, char);
+    strcpy(_plot_names[p_id], plot_name);
+    _plot_n_vals[p_id] = n_vals;
+    _plots[p_id] = cs_time_plot_init_probe(plot_name,
+                                           "",
+                                           CS_TIME_PLOT_CSV,
+                                           ts->is_local,
+                                           3600,  /* flush_wtime */
+                                           -1,    /* n_buffer_steps */
+                                           n_vals,
+                                           nullptr,
+                                           nullptr,
+                                           labels);
+
+    CS_FREE(labels);
+    CS_FREE(label_buf);
+
+  }
+  else if (_plot_n_vals[p_id] != n_vals)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Balance time plot \"%s\" was defined with %d values,\n"
+                "but %d values are now provided (zone lists may not change\n"
+                "between calls)."),
+              plot_name, _plot_n_vals[p_id], n_vals);
+
+  cs_time_plot_vals_write(_plots[p_id],
+                          ts->nt_cur,
+                          ts->t_cur,
+                          n_vals,
+                          vals);
+}
+
+/*----------------------------------------------------------------------------
+ * Log the different terms of the balance of a given scalar on a zone.
+ *
+ * parameters:
+ *   scalar_name     <-- scalar name
+ *   selection_crit  <-- zone selection criterion
+ *   balance         <-- balance terms (see cs_balance_term_t)
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_balance(const char       *scalar_name,
+             const char       *selection_crit,
+             const cs_real_t   balance[CS_BALANCE_N_TERMS])
+{
+  const int nt_cur = cs_glob_time_step->nt_cur;
+
+  bft_printf
+    (_("   ** SCALAR BALANCE BY ZONE at iteration %6i\n"
+       "   ---------------------------------------------\n"
+       "------------------------------------------------------------\n"
+       "   SCALAR: %s\n"
+       "   ZONE SELECTION CRITERIA: \"%s\"\n"
+       "------------------------------------------------------------\n"
+       "   Unst. term   Inj. Mass.   Suc. Mass.\n"
+       "  %12.4e %12.4e %12.4e\n"
+       "------------------------------------------------------------\n"
+       "   IB inlet     IB outlet\n"
+       "  %12.4e %12.4e\n"
+       "------------------------------------------------------------\n"
+       "   Inlet        Outlet\n"
+       "  %12.4e %12.4e\n"
+       "------------------------------------------------------------\n"
+       "   Sym.         Smooth W.    Rough W.\n"
+       "  %12.4e %12.4e %12.4e\n"
+       "------------------------------------------------------------\n"
+       "   Coupled      Int. Coupling    Undef. BC\n"
+       "  %12.4e %12.4e     %12.4e\n"
+       "------------------------------------------------------------\n"
+       "   Total        Instant. norm. total\n"
+       "  %12.4e %12.4e\n"
+       "------------------------------------------------------------\n\n"),
+     nt_cur, scalar_name, selection_crit,
+     balance[CS_BALANCE_UNSTEADY],
+     balance[CS_BALANCE_MASS_IN], balance[CS_BALANCE_MASS_OUT],
+     balance[CS_BALANCE_INTERIOR_IN], balance[CS_BALANCE_INTERIOR_OUT],
+     balance[CS_BALANCE_BOUNDARY_IN], balance[CS_BALANCE_BOUNDARY_OUT],
+     balance[CS_BALANCE_BOUNDARY_SYM],
+     balance[CS_BALANCE_BOUNDARY_WALL_S], balance[CS_BALANCE_BOUNDARY_WALL_R],
+     balance[CS_BALANCE_BOUNDARY_COUPLED_E],
+     balance[CS_BALANCE_BOUNDARY_COUPLED_I],
+     balance[CS_BALANCE_BOUNDARY_OTHER],
+     balance[CS_BALANCE_TOTAL], balance[CS_BALANCE_TOTAL_NORMALIZED]);
+}
+
+/*----------------------------------------------------------------------------
+ * Log the different terms of the pressure drop on a zone.
+ *
+ * parameters:
+ *   selection_crit  <-- zone selection criterion
+ *   balance         <-- balance terms (see cs_balance_p_term_t)
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_pressure_drop(const char       *selection_crit,
+                   const cs_real_t   balance[CS_BALANCE_P_N_TERMS])
+{
+  const int nt_cur = cs_glob_time_step->nt_cur;
+
+  bft_printf(_("   ** PRESSURE DROP BY ZONE at iteration %6i\n"
+               "   ---------------------------------------------\n"
+               "------------------------------------------------------------\n"
+               "   ZONE SELECTION CRITERIA: \"%s\"\n"
+               "------------------------------------------------------------\n"
+               "  |                 |\n"
+               "  | p u . dS        | p u . dS\n"
+               "  |   -    -        |   -    -\n"
+               "  |                 |\n"
+               "  | inlet           | outlet\n"
+               "  %12.4e      %12.4e\n"
+               "------------------------------------------------------------\n"
+               "  |                 |\n"
+               "  | u^2/2 rho u . dS| u^2/2 rho u . dS\n"
+               "  | -         -    -| -         -    -\n"
+               "  |                 |\n"
+               "  | inlet           | outlet\n"
+               "  %12.4e      %12.4e\n"
+               "------------------------------------------------------------\n"
+               "  |                 |\n"
+               "  |-rho(g . x)u . dS|-rho(g . x)u . dS\n"
+               "  |     -   - -    -|     -   - -    -\n"
+               "  |                 |\n"
+               "  | inlet           | outlet\n"
+               "  %12.4e      %12.4e\n"
+               "------------------------------------------------------------\n"
+               "  |                 |\n"
+               "  | u . dS          | u . dS\n"
+               "  | -    -          | -    -\n"
+               "  |                 |\n"
+               "  | inlet           | outlet\n"
+               "  %12.4e      %12.4e\n"
+               "------------------------------------------------------------\n"
+               "  |                 |\n"
+               "  | rho u . dS      | rho u . dS\n"
+               "  |     -    -      |     -    -\n"
+               "  |                 |\n"
+               "  | inlet           | outlet\n"
+               "  %12.4e      %12.4e\n"
+               "------------------------------------------------------------\n\n"),
+             nt_cur, selection_crit,
+             balance[CS_BALANCE_P_IN], balance[CS_BALANCE_P_OUT],
+             balance[CS_BALANCE_P_U2_IN], balance[CS_BALANCE_P_U2_OUT],
+             balance[CS_BALANCE_P_RHOGX_IN], balance[CS_BALANCE_P_RHOGX_OUT],
+             balance[CS_BALANCE_P_U_IN], balance[CS_BALANCE_P_U_OUT],
+             balance[CS_BALANCE_P_RHOU_IN], balance[CS_BALANCE_P_RHOU_OUT]);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the different terms of the balance of a given scalar on
+ * a set of volume zones defined by cell tags.
+ *
+ * Gradients and face viscosities are computed once, and the contributions
+ * of all zones of a given layer are accumulated in a single sweep over
+ * faces.
+ *
+ * parameters:
+ *   f         <-- pointer to scalar field
+ *   n_layers  <-- number of layers of disjoint zones
+ *   zone_tag  <-- zone id (or -1) for each cell with ghosts, for each layer
+ *   n_zones   <-- number of zones
+ *   balance   --> computed balance terms for each zone
+ *                 (size: n_zones*CS_BALANCE_N_TERMS)
+ *----------------------------------------------------------------------------*/
+
+static void
+_balance_by_zones(const cs_field_t  *f,
+                  int                n_layers,
+                  const cs_lnum_t    zone_tag[],
+                  int                n_zones,
+                  cs_real_t          balance[])
 {
   int idtvar = cs_glob_time_step_options->idtvar;
 
   const cs_mesh_t *m = cs_glob_mesh;
   cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
 
-  const cs_halo_t  *halo = m->halo;
-
   const cs_lnum_t n_cells = m->n_cells;
   const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
   const cs_lnum_t n_i_faces = m->n_i_faces;
@@ -797,7 +1143,7 @@ cs_balance_by_zone_compute(const char      *scalar_name,
 
   /* initialize output */
 
-  for (int i = 0; i < CS_BALANCE_N_TERMS; i++)
+  for (cs_lnum_t i = 0; i < n_zones*CS_BALANCE_N_TERMS; i++)
     balance[i] = 0;
 
   /* all boundary convective fluxes are upwind */
@@ -807,14 +1153,7 @@ cs_balance_by_zone_compute(const char      *scalar_name,
   /* Get physical fields */
   const cs_real_t *dt = CS_F_(dt)->val;
   const cs_real_t *rho = CS_F_(rho)->val;
-  const cs_field_t *f = cs_field_by_name_try(scalar_name);
-  const int field_id = cs_field_id_by_name(scalar_name);
-
-  /* If the requested scalar field is not computed, return */
-  if (field_id == -1) {
-    bft_printf("Scalar field does not exist. Balance will not be computed.\n");
-    return;
-  }
+  const int field_id = f->id;
 
   /* Get the calculation option from the field */
   const cs_equation_param_t *eqp = cs_field_get_equation_param_const(f);
@@ -857,7 +1196,7 @@ cs_balance_by_zone_compute(const char      *scalar_name,
 
   /* Internal coupling initialization*/
   if (eqp->icoupl > 0) {
-    const int coupling_key_id = cs_field_key_id("coupling_entity");
+    static const int coupling_key_id = cs_field_key_id("coupling_entity");
     const int coupling_id = cs_field_get_key_int(f, coupling_key_id);
     cpl = cs_internal_coupling_by_id(coupling_id);
     cs_internal_coupling_coupled_faces(cpl,
@@ -867,16 +1206,6 @@ cs_balance_by_zone_compute(const char      *scalar_name,
                                        &faces_distant);
   }
 
-  /* Zone cells selection variables*/
-  cs_lnum_t n_i_faces_sel = 0;
-  cs_lnum_t *i_face_sel_ids = nullptr;
-  cs_lnum_t n_bb_faces_sel = 0;
-  cs_lnum_t *bb_face_sel_ids = nullptr;
-  cs_lnum_t n_bi_faces_sel = 0;
-  cs_lnum_t *bi_face_sel_ids = nullptr;
-  cs_lnum_2_t *bi_face_cells = nullptr;
-  cs_lnum_t *cells_tag_ids = nullptr;
-
   cs_real_t *local_min = nullptr;
   cs_real_t *local_max = nullptr;
   cs_real_t *courant = nullptr;
@@ -886,42 +1215,31 @@ cs_balance_by_zone_compute(const char      *scalar_name,
 
   const int key_lim_choice = cs_field_key_id("limiter_choice");
 
-  /* Initialize balance contributions
-    ---------------------------------
-
-    vol_balance   : volume contribution of unsteady terms
-    div_balance   : volume contribution due to to term in div(rho u)
-    mass_i_balance: contribution from mass injections
-    mass_o_balance: contribution from mass suctions
-    bi_i_balance  : contribution from inlet boundary faces of the selected zone
-                    which are internal in the total mesh
-    bi_o_balance  : contribution from outlet boundary faces of the selected zone
-                    which are internal in the total mesh
-    in_balance    : contribution from inlets
-    out_balance   : contribution from outlets
-    sym_balance   : contribution from symmetry boundaries
-    s_wall_balance: contribution from smooth walls
-    r_wall_balance: contribution from rough walls
-    cpl_balance   : contribution from coupled faces
-    i_cpl_balance : contribution from internal coupled faces
-    ndef_balance  : contribution from undefined faces
-    tot_balance   : total balance */
-
-  double vol_balance = 0.;
-  double tot_vol_balance2 = 0.;
-  double div_balance = 0.;
-  double mass_i_balance = 0.;
-  double mass_o_balance = 0.;
-  double bi_i_balance = 0.;
-  double bi_o_balance = 0.;
-  double in_balance = 0.;
-  double out_balance = 0.;
-  double sym_balance = 0.;
-  double s_wall_balance = 0.;
-  double r_wall_balance = 0.;
-  double cpl_balance = 0.;
-  double i_cpl_balance = 0.;
-  double ndef_balance = 0.;
+  /* Balance contributions are accumulated directly in the balance array
+     of each zone:
+
+    CS_BALANCE_VOLUME           : volume contribution of unsteady terms
+    CS_BALANCE_DIV              : volume contribution due to to term
+                                  in div(rho u)
+    CS_BALANCE_MASS_IN          : contribution from mass injections
+    CS_BALANCE_MASS_OUT         : contribution from mass suctions
+    CS_BALANCE_INTERIOR_IN      : contribution from inlet boundary faces
+                                  of the selected zone which are internal
+                                  in the total mesh
+    CS_BALANCE_INTERIOR_OUT     : contribution from outlet boundary faces
+                                  of the selected zone which are internal
+                                  in the total mesh
+    CS_BALANCE_BOUNDARY_IN      : contribution from inlets
+    CS_BALANCE_BOUNDARY_OUT     : contribution from outlets
+    CS_BALANCE_BOUNDARY_SYM     : contribution from symmetry boundaries
+    CS_BALANCE_BOUNDARY_WALL_S  : contribution from smooth walls
+    CS_BALANCE_BOUNDARY_WALL_R  : contribution from rough walls
+    CS_BALANCE_BOUNDARY_COUPLED_E : contribution from coupled faces
+    CS_BALANCE_BOUNDARY_COUPLED_I : contribution from internal coupled faces
+    CS_BALANCE_BOUNDARY_OTHER   : contribution from undefined faces
+
+    The CS_BALANCE_TOTAL_NORMALIZED term is used temporarily for the
+    sum of squares of the volume term. */
 
   /* Boundary condition coefficient for h */
   const cs_real_t *a_F = f->bc_coeffs->a;
@@ -950,38 +1268,31 @@ cs_balance_by_zone_compute(const char      *scalar_name,
 
   int limiter_choice = -1;
   int ischcp = eqp->ischcv;
-  if (field_id != -1) {
-    f = cs_field_by_id(field_id);
 
-    /* NVD/TVD limiters */
-    if (ischcp == 4) {
-      limiter_choice = cs_field_get_key_int(f, key_lim_choice);
-      CS_MALLOC(local_max, n_cells_ext, cs_real_t);
-      CS_MALLOC(local_min, n_cells_ext, cs_real_t);
-      cs_field_local_extrema_scalar(field_id,
-                                    halo_type,
-                                    local_max,
-                                    local_min);
-      if (limiter_choice >= CS_NVD_VOF_HRIC) {
-        CS_MALLOC(courant, n_cells_ext, cs_real_t);
-        cs_cell_courant_number(f, ctx, courant);
-      }
+  /* NVD/TVD limiters */
+  if (ischcp == 4) {
+    limiter_choice = cs_field_get_key_int(f, key_lim_choice);
+    CS_MALLOC(local_max, n_cells_ext, cs_real_t);
+    CS_MALLOC(local_min, n_cells_ext, cs_real_t);
+    cs_field_local_extrema_scalar(field_id,
+                                  halo_type,
+                                  local_max,
+                                  local_min);
+    if (limiter_choice >= CS_NVD_VOF_HRIC) {
+      CS_MALLOC(courant, n_cells_ext, cs_real_t);
+      cs_cell_courant_number(f, ctx, courant);
     }
-
-    int cv_limiter_id =
-      cs_field_get_key_int(f, cs_field_key_id("convection_limiter_id"));
-    if (cv_limiter_id > -1)
-      cv_limiter = cs_field_by_id(cv_limiter_id)->val;
-
-    int df_limiter_id =
-      cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
-    if (df_limiter_id > -1)
-      df_limiter = cs_field_by_id(df_limiter_id)->val;
   }
 
-  /* Allocate temporary array */
-  cs_real_t *f_reconstructed;
-  CS_MALLOC(f_reconstructed, n_b_faces, cs_real_t);
+  int cv_limiter_id =
+    cs_field_get_key_int(f, cs_field_key_id("convection_limiter_id"));
+  if (cv_limiter_id > -1)
+    cv_limiter = cs_field_by_id(cv_limiter_id)->val;
+
+  static const int kdflim = cs_field_key_id("diffusion_limiter_id");
+  int df_limiter_id = cs_field_get_key_int(f, kdflim);
+  if (df_limiter_id > -1)
+    df_limiter = cs_field_by_id(df_limiter_id)->val;
 
   /* Reconstructed value */
   cs_real_3_t *grad;
@@ -993,26 +1304,6 @@ cs_balance_by_zone_compute(const char      *scalar_name,
                            1, /* inc */
                            grad);
 
-  if (false) { //FIXME
-    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-      /* Associated boundary cell */
-      cs_lnum_t c_id = b_face_cells[f_id];
-      f_reconstructed[f_id] = f->val[c_id]
-                               + grad[c_id][0]*diipb[f_id][0]
-                               + grad[c_id][1]*diipb[f_id][1]
-                               + grad[c_id][2]*diipb[f_id][2];
-    }
-
-  /* Non-reconstructed value */
-  }
-  else {
-    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-      /* Associated boundary cell */
-      cs_lnum_t c_id = b_face_cells[f_id];
-      f_reconstructed[f_id] = f->val[c_id];
-    }
-  }
-
   int inc = 1;
 
   /* Compute the gradient for convective scheme
@@ -1100,688 +1391,483 @@ cs_balance_by_zone_compute(const char      *scalar_name,
 
   cs_face_viscosity(m, fvq, imvisf, c_visc, i_visc, b_visc);
 
-  /* Get user-selected zone
-     ====================== */
-
-  /* Initialize arrays */
-
-  /* Internal faces of the selected zone */
-  CS_MALLOC(i_face_sel_ids, n_i_faces, cs_lnum_t);
-  /* Boundary faces of the selected zone,
-     which are internal faces of the global mesh.
-     Faces -> cells connectivity */
-  CS_MALLOC(bi_face_sel_ids, n_i_faces, cs_lnum_t);
-  CS_MALLOC(bi_face_cells, n_i_faces, cs_lnum_2_t);
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
-    i_face_sel_ids[f_id] = -1;
-    bi_face_sel_ids[f_id] = -1;
-    bi_face_cells[f_id][0] = -999;
-    bi_face_cells[f_id][1] = -999;
-  }
+  /* Mass source terms and mass accumulation term.
+     In case of a mass source term, add contribution from Gamma*Tn+1 */
 
-  /* Boundary faces of the selected zone,
-     which are also boundary faces of the global mesh */
-  CS_MALLOC(bb_face_sel_ids, n_b_faces, cs_lnum_t);
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-    bb_face_sel_ids[f_id] = -1;
-  }
+  cs_lnum_t ncesmp = 0;
+  const cs_lnum_t *icetsm = nullptr;
+  int *itpsmp = nullptr;
+  cs_real_t *smcelp, *gamma = nullptr;
 
-  /* Synchronization for parallelism */
-  CS_MALLOC(cells_tag_ids, n_cells_ext, cs_lnum_t);
-  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-    cells_tag_ids[c_id] = 0;
-  }
-  for (cs_lnum_t c_id = 0; c_id < n_cells_sel; c_id++) {
-    cs_lnum_t c_id_sel = cell_sel_ids[c_id];
-    cells_tag_ids[c_id_sel] = 1;
-  }
-  if (halo != nullptr) {
-    cs_halo_sync_num(halo, halo_type, cells_tag_ids);
-  }
-
-  /* Classify mesh faces with respect to the selected zone */
-
-  /* Check boundary faces:
-     if they are in the selected zone, they are boundary as well */
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+  cs_volume_mass_injection_get_arrays(f, &ncesmp, &icetsm, &itpsmp,
+                                      &smcelp, &gamma);
 
-    cs_lnum_t c_id = b_face_cells[f_id];
+  const double cp0 = cs_glob_fluid_properties->cp0;
 
-    if (cells_tag_ids[c_id] == 1) {
-      n_bb_faces_sel++;
-      bb_face_sel_ids[n_bb_faces_sel-1] = f_id;
-    }
-  }
+  int iconvp = eqp->iconv;
+  int idiffp = eqp->idiff;
+  int ircflp = eqp->ircflu;
+  double relaxp = eqp->relaxv;
 
-  /* Check internal faces:
-     if they are in the selected zone, they can be either
-     internal or boundary faces */
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+  int isstpp = eqp->isstpc;
+  double blencp = eqp->blencv;
+  double blend_st = eqp->blend_st;
+  int iupwin = (blencp > 0.) ? 0 : 1;
 
-    cs_lnum_t c_id1 = i_face_cells[f_id][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id][1];
+  /* Values at distant coupled faces are exchanged once for all zones */
 
-    bool indic1 = false;
-    bool indic2 = false;
+  if (eqp->icoupl > 0) {
 
-    if (cells_tag_ids[c_id1] == 1)
-      indic1 = true;
-    if (cells_tag_ids[c_id2] == 1)
-      indic2 = true;
+    /* Prepare data for sending from distant */
+    CS_MALLOC(pvar_distant, n_distant, cs_real_t);
 
-    if (indic1 && indic2) {
-      n_i_faces_sel++;
-      i_face_sel_ids[n_i_faces_sel-1] = f_id;
-    }
-    else if (indic1 || indic2) {
-      bi_face_sel_ids[n_bi_faces_sel] = f_id;
-      n_bi_faces_sel++;
-      /* Build the faces -> cells connectivity as done in
-         i_face_cells */
-      if (indic1)
-        bi_face_cells[f_id][0] = c_id1;
-      else
-        bi_face_cells[f_id][1] = c_id2;
+    for (cs_lnum_t ii = 0; ii < n_distant; ii++) {
+      cs_lnum_t f_id = faces_distant[ii];
+      cs_lnum_t c_id = b_face_cells[f_id];
+      cs_real_t pip;
+      cs_b_cd_unsteady(ircflp,
+                       diipb[f_id],
+                       grad[c_id],
+                       f->val[c_id],
+                       &pip);
+      pvar_distant[ii] = pip;
     }
 
+    /* Receive data */
+    CS_MALLOC(pvar_local, n_local, cs_real_t);
+    cs_internal_coupling_exchange_var(cpl,
+                                      1, /* Dimension */
+                                      pvar_distant,
+                                      pvar_local);
+
   }
 
-  /* Compute the balance at time step n
-    ===================================
+  /* Compute the balance at time step n for each layer of disjoint zones
+     =================================================================== */
 
-    --> Balance on interior volumes and
-        total quantity on interior volumes
-        ---------------------------------- */
+  for (int l_id = 0; l_id < n_layers; l_id++) {
 
-  for (cs_lnum_t c_id = 0; c_id < n_cells_sel; c_id++) {
+    const cs_lnum_t *c_zone_id = zone_tag + (size_t)l_id*n_cells_ext;
 
-    cs_lnum_t c_id_sel = cell_sel_ids[c_id];
+    /* Balance on interior volumes and
+       total quantity on interior volumes
+       ---------------------------------- */
 
-    vol_balance += cell_vol[c_id_sel] * rho[c_id_sel]
-                 * cpro_cp[c_id_sel]
-                 * (f->val_pre[c_id_sel] - f->val[c_id_sel]);
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
 
-    cs_real_t rho_y_dt =  rho[c_id_sel] * cpro_cp[c_id_sel]
-                        * f->val_pre[c_id_sel] * dt[c_id_sel];
-    tot_vol_balance2 += cell_vol[c_id_sel] * rho_y_dt * rho_y_dt;
-  }
+      const cs_lnum_t z_id = c_zone_id[c_id];
+      if (z_id < 0)
+        continue;
 
-  /* Balance on all faces (interior and boundary), for div(rho u)
-     ------------------------------------------------------------ */
+      cs_real_t *z_balance = balance + z_id*CS_BALANCE_N_TERMS;
 
-  /* Interior faces */
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces_sel; f_id++) {
+      z_balance[CS_BALANCE_VOLUME]
+        += cell_vol[c_id] * rho[c_id] * cpro_cp[c_id]
+           * (f->val_pre[c_id] - f->val[c_id]);
 
-    cs_lnum_t f_id_sel = i_face_sel_ids[f_id];
-    /* Associated internal cells */
-    cs_lnum_t c_id1 = i_face_cells[f_id_sel][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id_sel][1];
+      cs_real_t rho_y_dt =  rho[c_id] * cpro_cp[c_id]
+                          * f->val_pre[c_id] * dt[c_id];
+      z_balance[CS_BALANCE_TOTAL_NORMALIZED]
+        += cell_vol[c_id] * rho_y_dt * rho_y_dt;
+    }
 
-    /* Contribution to flux from the two cells of the current face
-      (The cell is counted only once in parallel by checking that
-       the c_id is not in the halo) */
+    /* Mass source terms */
 
-    if (c_id1 < n_cells)
-      div_balance += i_mass_flux[f_id_sel] * dt[c_id1] * f->val[c_id1]
-                   * cpro_cp[c_id1];
+    for (cs_lnum_t c_idx = 0; c_idx < ncesmp; c_idx++) {
+      cs_lnum_t c_id_sel = icetsm[c_idx];
 
-    if (c_id2 < n_cells)
-      div_balance -= i_mass_flux[f_id_sel] * dt[c_id2] * f->val[c_id2]
-                   * cpro_cp[c_id2];
+      const cs_lnum_t z_id = c_zone_id[c_id_sel];
+      if (z_id < 0)
+        continue;
 
-  }
+      cs_real_t vg = gamma[c_idx];
+      cs_real_t v;
+      if (itpsmp[c_idx] == 0 || vg < 0)
+        v = f->val[c_id_sel];
+      else
+        v = smcelp[c_idx];
 
-  /* Boundary faces which are internal in the total mesh */
-  for (cs_lnum_t f_id = 0; f_id < n_bi_faces_sel; f_id++) {
+      cs_real_t c_st = cell_vol[c_id_sel] * dt[c_id_sel]* vg * v;
 
-    cs_lnum_t f_id_sel = bi_face_sel_ids[f_id];
-    /* Associated boundary-internal cells */
-    cs_lnum_t c_id1 = bi_face_cells[f_id_sel][0];
-    cs_lnum_t c_id2 = bi_face_cells[f_id_sel][1];
+      if (itemperature) {
+        if (icp >= 0)
+          c_st *= cpro_cp[c_id_sel];
+        else
+          c_st *= cp0;
+      }
 
-    /* Contribution to flux from the only cell of the current face
-       lying inside the selected zone
-      (The cell is counted only once in parallel by checking that
-       the c_id is not in the halo) */
+      if (vg < 0)
+        balance[z_id*CS_BALANCE_N_TERMS + CS_BALANCE_MASS_OUT] += c_st;
+      else
+        balance[z_id*CS_BALANCE_N_TERMS + CS_BALANCE_MASS_IN] += c_st;
+    }
 
-    if (c_id1 >= 0) {
+    /* Balance on boundary faces
+       -------------------------
 
-      if (c_id1 < n_cells)
-        div_balance += i_mass_flux[f_id_sel] * dt[c_id1] * f->val[c_id1]
-                     * cpro_cp[c_id1];
-    }
+       We handle different types of boundary faces separately to better
+       analyze the information, but this is not mandatory. */
 
-    else {
+    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
 
-      if (c_id2 < n_cells)
-        div_balance -= i_mass_flux[f_id_sel] * dt[c_id2] * f->val[c_id2]
-                     * cpro_cp[c_id2];
-    }
+      /* Associated boundary cell */
+      cs_lnum_t c_id = b_face_cells[f_id];
 
-  }
+      const cs_lnum_t z_id = c_zone_id[c_id];
+      if (z_id < 0)
+        continue;
 
-  /* Boundary faces which are also boundary in the total mesh */
-  for (cs_lnum_t f_id = 0; f_id < n_bb_faces_sel; f_id++) {
+      cs_real_t *z_balance = balance + z_id*CS_BALANCE_N_TERMS;
 
-    cs_lnum_t f_id_sel = bb_face_sel_ids[f_id];
-    /* Associated boundary cell */
-    cs_lnum_t c_id = b_face_cells[f_id_sel];
+      /* Contribution to div(rho u) from the current face */
+      z_balance[CS_BALANCE_DIV]
+        += b_mass_flux[f_id] * dt[c_id] * f->val[c_id] * cpro_cp[c_id];
 
-    /* Contribution to flux from the current face */
-      div_balance += b_mass_flux[f_id_sel] * dt[c_id] * f->val[c_id]
-                   * cpro_cp[c_id];
+      cs_real_t term_balance = 0.;
 
-  }
+      cs_real_t ac_F = 0.;
+      cs_real_t bc_F = 0.;
 
-  /* Mass source terms and mass accumulation term.
-     In case of a mass source term, add contribution from Gamma*Tn+1 */
+      if (icvflb == 1) {
+        ac_F = f->bc_coeffs->ac[f_id];
+        bc_F = f->bc_coeffs->bc[f_id];
+        icvflf = 0; /* = icvfli */
+      }
 
-  cs_lnum_t ncesmp = 0;
-  const cs_lnum_t *icetsm = nullptr;
-  int *itpsmp = nullptr;
-  cs_real_t *smcelp, *gamma = nullptr;
+      _balance_boundary_faces(icvflf,
+                              idtvar,
+                              iconvp,
+                              idiffp,
+                              ircflp,
+                              relaxp,
+                              diipb[f_id],
+                              grad[c_id],
+                              f->val[c_id],
+                              f->val_pre[c_id],
+                              bc_type[f_id],
+                              b_visc[f_id],
+                              a_F[f_id],
+                              b_F[f_id],
+                              af_F[f_id],
+                              bf_F[f_id],
+                              ac_F,
+                              bc_F,
+                              b_mass_flux[f_id],
+                              cpro_cp[c_id],
+                              &term_balance);
 
-  cs_volume_mass_injection_get_arrays(f, &ncesmp, &icetsm, &itpsmp,
-                                      &smcelp, &gamma);
+      int t_id = CS_BALANCE_BOUNDARY_OTHER;
+      if (bc_type[f_id] == CS_INLET ||
+          bc_type[f_id] == CS_CONVECTIVE_INLET ||
+          bc_type[f_id] == CS_FREE_INLET ||
+          bc_type[f_id] == CS_ESICF ||
+          bc_type[f_id] == CS_EPHCF)
+        t_id = CS_BALANCE_BOUNDARY_IN;
+      else if (bc_type[f_id] == CS_OUTLET ||
+               bc_type[f_id] == CS_SSPCF ||
+               bc_type[f_id] == CS_SOPCF)
+        t_id = CS_BALANCE_BOUNDARY_OUT;
+      else if (bc_type[f_id] == CS_SYMMETRY)
+        t_id = CS_BALANCE_BOUNDARY_SYM;
+      else if (bc_type[f_id] == CS_SMOOTHWALL)
+        t_id = CS_BALANCE_BOUNDARY_WALL_S;
+      else if (bc_type[f_id] == CS_ROUGHWALL)
+        t_id = CS_BALANCE_BOUNDARY_WALL_R;
+      else if (   bc_type[f_id] == CS_COUPLED
+               || bc_type[f_id] == CS_COUPLED_FD)
+        t_id = CS_BALANCE_BOUNDARY_COUPLED_E;
+
+      z_balance[t_id] -= term_balance*dt[c_id];
 
-  if (ncesmp > 0) {
+    }
 
-    const double cp0 = cs_glob_fluid_properties->cp0;
+    /* Balance on coupled faces
+       ------------------------ */
 
-    for (cs_lnum_t c_idx = 0; c_idx < ncesmp; c_idx++) {
-      cs_lnum_t c_id_sel = icetsm[c_idx];
+    for (cs_lnum_t ii = 0; ii < n_local; ii++) {
+      cs_lnum_t f_id = faces_local[ii];
+      cs_lnum_t c_id = b_face_cells[f_id];
+
+      const cs_lnum_t z_id = c_zone_id[c_id];
+      if (z_id < 0)
+        continue;
 
-      if (cells_tag_ids[c_id_sel]) {
+      cs_real_t surf = b_face_surf[f_id];
+      cs_real_t pip, pjp;
+      cs_real_t term_balance = 0.;
 
-        cs_real_t vg = gamma[c_idx];
-        cs_real_t v;
-        if (itpsmp[c_idx] == 0 || vg < 0)
-          v = f->val[c_id_sel];
-        else
-          v = smcelp[c_idx];
+      cs_b_cd_unsteady(ircflp,
+                       diipb[f_id],
+                       grad[c_id],
+                       f->val[c_id],
+                       &pip);
 
-        cs_real_t c_st = cell_vol[c_id_sel] * dt[c_id_sel]* vg * v;
+      pjp = pvar_local[ii];
 
-        if (itemperature) {
-          if (icp >= 0)
-            c_st *= cpro_cp[c_id_sel];
-          else
-            c_st *= cp0;
-        }
+      hint = f->bc_coeffs->hint[f_id];
+      rcodcl2 = f->bc_coeffs->rcodcl2[f_id];
+      heq = surf * hint * rcodcl2 / (hint + rcodcl2);
 
-        if (vg < 0)
-          mass_o_balance += c_st;
-        else
-          mass_i_balance += c_st;
-      }
+      cs_b_diff_flux_coupling(idiffp,
+                              pip,
+                              pjp,
+                              heq,
+                              &term_balance);
 
+      balance[z_id*CS_BALANCE_N_TERMS + CS_BALANCE_BOUNDARY_COUPLED_I]
+        -= term_balance*dt[c_id];
     }
-  }
-
-  int iconvp = eqp->iconv;
-  int idiffp = eqp->idiff;
-  int ircflp = eqp->ircflu;
-  double relaxp = eqp->relaxv;
 
-  /* Balance on boundary faces
-     -------------------------
+    /* Balance on interior faces
+       -------------------------
 
-     We handle different types of boundary faces separately to better
-     analyze the information, but this is not mandatory. */
+       Faces inside a zone only contribute to div(rho u); faces on the
+       boundary of a zone also contribute to the interior in/out terms
+       of the zones on either side. */
 
-  for (cs_lnum_t f_id = 0; f_id < n_bb_faces_sel; f_id++) {
+    for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
 
-    cs_lnum_t f_id_sel = bb_face_sel_ids[f_id];
-    /* Associated boundary cell */
-    cs_lnum_t c_id = b_face_cells[f_id_sel];
+      /* Associated internal cells */
+      cs_lnum_t c_id1 = i_face_cells[f_id][0];
+      cs_lnum_t c_id2 = i_face_cells[f_id][1];
 
-    cs_real_t term_balance = 0.;
+      const cs_lnum_t z_id1 = c_zone_id[c_id1];
+      const cs_lnum_t z_id2 = c_zone_id[c_id2];
 
-    cs_real_t ac_F = 0.;
-    cs_real_t bc_F = 0.;
+      if (z_id1 < 0 && z_id2 < 0)
+        continue;
 
-    if (icvflb == 1) {
-      ac_F = f->bc_coeffs->ac[f_id_sel];
-      bc_F = f->bc_coeffs->bc[f_id_sel];
-      icvflf = 0; /* = icvfli */
-    }
+      /* Contribution to div(rho u) from the cells of the current face
+         lying inside a selected zone
+        (The cell is counted only once in parallel by checking that
+         the c_id is not in the halo) */
 
-    _balance_boundary_faces(icvflf,
-                            idtvar,
-                            iconvp,
-                            idiffp,
-                            ircflp,
-                            relaxp,
-                            diipb[f_id_sel],
-                            grad[c_id],
-                            f->val[c_id],
-                            f->val_pre[c_id],
-                            bc_type[f_id_sel],
-                            b_visc[f_id_sel],
-                            a_F[f_id_sel],
-                            b_F[f_id_sel],
-                            af_F[f_id_sel],
-                            bf_F[f_id_sel],
-                            ac_F,
-                            bc_F,
-                            b_mass_flux[f_id_sel],
-                            cpro_cp[c_id],
-                            &term_balance);
+      if (z_id1 > -1 && c_id1 < n_cells)
+        balance[z_id1*CS_BALANCE_N_TERMS + CS_BALANCE_DIV]
+          += i_mass_flux[f_id] * dt[c_id1] * f->val[c_id1] * cpro_cp[c_id1];
 
-    if (bc_type[f_id_sel] == CS_INLET ||
-        bc_type[f_id_sel] == CS_CONVECTIVE_INLET ||
-        bc_type[f_id_sel] == CS_FREE_INLET ||
-        bc_type[f_id_sel] == CS_ESICF ||
-        bc_type[f_id_sel] == CS_EPHCF)
-      in_balance -= term_balance*dt[c_id];
-    else if (bc_type[f_id_sel] == CS_OUTLET ||
-             bc_type[f_id_sel] == CS_SSPCF ||
-             bc_type[f_id_sel] == CS_SOPCF)
-      out_balance -= term_balance*dt[c_id];
-    else if (bc_type[f_id_sel] == CS_SYMMETRY)
-      sym_balance -= term_balance*dt[c_id];
-    else if (bc_type[f_id_sel] == CS_SMOOTHWALL)
-      s_wall_balance -= term_balance*dt[c_id];
-    else if (bc_type[f_id_sel] == CS_ROUGHWALL)
-      r_wall_balance -= term_balance*dt[c_id];
-    else if (   bc_type[f_id_sel] == CS_COUPLED
-             || bc_type[f_id_sel] == CS_COUPLED_FD)
-      cpl_balance -= term_balance*dt[c_id];
-    else
-      ndef_balance -= term_balance*dt[c_id];
+      if (z_id2 > -1 && c_id2 < n_cells)
+        balance[z_id2*CS_BALANCE_N_TERMS + CS_BALANCE_DIV]
+          -= i_mass_flux[f_id] * dt[c_id2] * f->val[c_id2] * cpro_cp[c_id2];
 
-  }
+      if (z_id1 == z_id2)
+        continue;
 
-  /* Balance on coupled faces
-     ------------------------
+      cs_real_t beta = blencp;
+      /* Beta blending coefficient ensuring positivity of the scalar */
+      if (isstpp == 2) {
+        beta = cs::max(cs::min(cv_limiter[c_id1], cv_limiter[c_id2]), 0.);
+      }
 
-     We handle different types of boundary faces separately to better
-     analyze the information, but this is not mandatory. */
+      int bldfrp = ircflp;
+      /* Local limitation of the reconstruction */
+      if (df_limiter != nullptr && ircflp > 0) {
+        cs_real_t _bldfrp = fmax(fmin(df_limiter[c_id1],
+                                      df_limiter[c_id2]), 0.);
+        bldfrp = (int)_bldfrp;
+      }
 
-  if (eqp->icoupl > 0) {
+      cs_real_t hybrid_coef_ii, hybrid_coef_jj;
+      cs_lnum_t ic = -1, id = -1;
+      cs_real_t courant_c = -1., _local_max = 0., _local_min = 0.;
+      if (ischcp == 3) {
+        hybrid_coef_ii = CS_F_(hybrid_blend)->val[c_id1];
+        hybrid_coef_jj = CS_F_(hybrid_blend)->val[c_id2];
+      }
+      else if (ischcp == 4) {
+        hybrid_coef_ii = 0.;
+        hybrid_coef_jj = 0.;
+        /* Determine central and downwind sides w.r.t. current face */
+        cs_central_downwind_cells(c_id1,
+                                  c_id2,
+                                  i_mass_flux[f_id],
+                                  &ic,  /* central cell id */
+                                  &id); /* downwind cell id */
+
+        if (courant != nullptr)
+          courant_c = courant[ic];
+
+        if (local_max != nullptr) {
+          _local_max = local_max[ic];
+          _local_min = local_min[ic];
+        }
+      }
+      else {
+        hybrid_coef_ii = 0.;
+        hybrid_coef_jj = 0.;
+      }
 
-    /* Prepare data for sending from distant */
-    CS_MALLOC(pvar_distant, n_distant, cs_real_t);
+      cs_real_2_t bi_bterms = {0., 0.};
+
+      _balance_internal_faces(iupwin,
+                              idtvar,
+                              iconvp,
+                              idiffp,
+                              bldfrp,
+                              ischcp,
+                              isstpp,
+                              (cs_nvd_type_t)limiter_choice,
+                              relaxp,
+                              beta,
+                              blend_st,
+                              weight[f_id],
+                              i_dist[f_id],
+                              cell_cen[c_id1],
+                              cell_cen[c_id2],
+                              cell_cen[ic],
+                              cell_cen[id],
+                              i_face_u_normal[f_id],
+                              i_face_cog[f_id],
+                              hybrid_coef_ii,
+                              hybrid_coef_jj,
+                              diipf[f_id],
+                              djjpf[f_id],
+                              grad[c_id1],
+                              grad[c_id2],
+                              grad[ic],
+                              gradup[c_id1],
+                              gradup[c_id2],
+                              gradst[c_id1],
+                              gradst[c_id2],
+                              f->val[c_id1],
+                              f->val[c_id2],
+                              f->val[ic],
+                              f->val[id],
+                              f->val_pre[c_id1],
+                              f->val_pre[c_id2],
+                              i_visc[f_id],
+                              i_mass_flux[f_id],
+                              cpro_cp[c_id1],
+                              cpro_cp[c_id2],
+                              _local_max,
+                              _local_min,
+                              courant_c,
+                              bi_bterms);
+
+      /* (The cell is counted only once in parallel by checking that
+         the c_id is not in the halo) */
+      /* Face normal well oriented for zone of first cell */
+      if (z_id1 > -1 && c_id1 < n_cells) {
+        cs_real_t *z_balance = balance + z_id1*CS_BALANCE_N_TERMS;
+        if (i_mass_flux[f_id] > 0)
+          z_balance[CS_BALANCE_INTERIOR_OUT] -= bi_bterms[0]*dt[c_id1];
+        else
+          z_balance[CS_BALANCE_INTERIOR_IN] -= bi_bterms[0]*dt[c_id1];
+      }
+      /* Face normal direction reversed for zone of second cell */
+      if (z_id2 > -1 && c_id2 < n_cells) {
+        cs_real_t *z_balance = balance + z_id2*CS_BALANCE_N_TERMS;
+        if (i_mass_flux[f_id] > 0)
+          z_balance[CS_BALANCE_INTERIOR_IN] += bi_bterms[1]*dt[c_id2];
+        else
+          z_balance[CS_BALANCE_INTERIOR_OUT] += bi_bterms[1]*dt[c_id2];
+      }
 
-    for (cs_lnum_t ii = 0; ii < n_distant; ii++) {
-      cs_lnum_t f_id = faces_distant[ii];
-      cs_lnum_t c_id = b_face_cells[f_id];
-      cs_real_t pip;
-      cs_b_cd_unsteady(ircflp,
-                       diipb[f_id],
-                       grad[c_id],
-                       f->val[c_id],
-                       &pip);
-      pvar_distant[ii] = pip;
     }
 
-    /* Receive data */
-    CS_MALLOC(pvar_local, n_local, cs_real_t);
-    cs_internal_coupling_exchange_var(cpl,
-                                      1, /* Dimension */
-                                      pvar_distant,
-                                      pvar_local);
+  } /* End of loop on layers */
 
-    /* flux contribution */
-    for (cs_lnum_t ii = 0; ii < n_local; ii++) {
-      cs_lnum_t f_id = faces_local[ii];
-      cs_lnum_t c_id = b_face_cells[f_id];
-      cs_real_t surf = b_face_surf[f_id];
+  /* Free memory */
 
-      if (cells_tag_ids[c_id] == 1) {
-        cs_real_t pip, pjp;
-        cs_real_t term_balance = 0.;
+  CS_FREE(pvar_local);
+  CS_FREE(pvar_distant);
 
-        cs_b_cd_unsteady(ircflp,
-                         diipb[f_id],
-                         grad[c_id],
-                         f->val[c_id],
-                         &pip);
+  CS_FREE(grad);
+  CS_FREE(gradup);
+  CS_FREE(gradst);
+  CS_FREE(local_max);
+  CS_FREE(local_min);
+  CS_FREE(courant);
 
-        pjp = pvar_local[ii];
+  if (!itemperature || icp == -1)
+    CS_FREE(cpro_cp);
+  CS_FREE(c_visc);
+  CS_FREE(i_visc);
+  CS_FREE(b_visc);
 
-        hint = f->bc_coeffs->hint[f_id];
-        rcodcl2 = f->bc_coeffs->rcodcl2[f_id];
-        heq = surf * hint * rcodcl2 / (hint + rcodcl2);
+  /* Sum of values on all ranks (parallel calculations) */
 
-        cs_b_diff_flux_coupling(idiffp,
-                                pip,
-                                pjp,
-                                heq,
-                                &term_balance);
+  for (int z_id = 0; z_id < n_zones; z_id++) {
+    cs_real_t *z_balance = balance + z_id*CS_BALANCE_N_TERMS;
+    z_balance[CS_BALANCE_UNSTEADY]
+      = z_balance[CS_BALANCE_VOLUME] + z_balance[CS_BALANCE_DIV];
+    z_balance[CS_BALANCE_MASS]
+      = z_balance[CS_BALANCE_MASS_IN] + z_balance[CS_BALANCE_MASS_OUT];
+    z_balance[CS_BALANCE_BOUNDARY_WALL]
+      =   z_balance[CS_BALANCE_BOUNDARY_WALL_S]
+        + z_balance[CS_BALANCE_BOUNDARY_WALL_R];
+    z_balance[CS_BALANCE_BOUNDARY_COUPLED]
+      =   z_balance[CS_BALANCE_BOUNDARY_COUPLED_E]
+        + z_balance[CS_BALANCE_BOUNDARY_COUPLED_I];
+  }
 
-        i_cpl_balance -= term_balance*dt[c_id];
-      }
-    }
+  cs_parall_sum(n_zones*CS_BALANCE_N_TERMS, CS_REAL_TYPE, balance);
 
-    CS_FREE(pvar_local);
-    CS_FREE(pvar_distant);
+  /* Total balance: add the different contributions calculated above */
 
+  for (int z_id = 0; z_id < n_zones; z_id++) {
+    cs_real_t *z_balance = balance + z_id*CS_BALANCE_N_TERMS;
+
+    z_balance[CS_BALANCE_TOTAL]
+      =   z_balance[CS_BALANCE_UNSTEADY] + z_balance[CS_BALANCE_MASS]
+        + z_balance[CS_BALANCE_INTERIOR_IN]
+        + z_balance[CS_BALANCE_INTERIOR_OUT]
+        + z_balance[CS_BALANCE_BOUNDARY_IN]
+        + z_balance[CS_BALANCE_BOUNDARY_OUT]
+        + z_balance[CS_BALANCE_BOUNDARY_SYM]
+        + z_balance[CS_BALANCE_BOUNDARY_WALL]
+        + z_balance[CS_BALANCE_BOUNDARY_COUPLED]
+        + z_balance[CS_BALANCE_BOUNDARY_OTHER];
+
+    /* sum of squares from temporary above */
+    cs_real_t tot_vol_balance2 = z_balance[CS_BALANCE_TOTAL_NORMALIZED];
+    z_balance[CS_BALANCE_TOTAL_NORMALIZED] = z_balance[CS_BALANCE_TOTAL];
+
+    if (tot_vol_balance2 > 0.)
+      z_balance[CS_BALANCE_TOTAL_NORMALIZED] /= sqrt(tot_vol_balance2);
   }
+}
 
-  /* Balance on boundary faces of the selected zone
-     that are interior to the total mesh
-     ---------------------------------------------- */
+/*----------------------------------------------------------------------------
+ * Compute the head loss balance (pressure drop) terms on a set of
+ * volume zones defined by cell tags, in a single sweep over faces
+ * for each layer of disjoint zones.
+ *
+ * parameters:
+ *   n_layers  <-- number of layers of disjoint zones
+ *   zone_tag  <-- zone id (or -1) for each cell with ghosts, for each layer
+ *   n_zones   <-- number of zones
+ *   balance   --> computed balance terms for each zone
+ *                 (size: n_zones*CS_BALANCE_P_N_TERMS)
+ *----------------------------------------------------------------------------*/
 
-  int isstpp = eqp->isstpc;
-  double blencp = eqp->blencv;
-  double blend_st = eqp->blend_st;
-  int iupwin = (blencp > 0.) ? 0 : 1;
+static void
+_pressure_drop_by_zones(int              n_layers,
+                        const cs_lnum_t  zone_tag[],
+                        int              n_zones,
+                        cs_real_t        balance[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
 
-  for (cs_lnum_t f_id = 0; f_id < n_bi_faces_sel; f_id++) {
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
 
-    cs_lnum_t f_id_sel = bi_face_sel_ids[f_id];
-    /* Associated boundary-internal cells */
-    cs_lnum_t c_id1 = i_face_cells[f_id_sel][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id_sel][1];
+  const cs_lnum_2_t *restrict i_face_cells = m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells = m->b_face_cells;
+  const cs_real_3_t *restrict i_face_cog = fvq->i_face_cog;
+  const cs_real_3_t *restrict b_face_cog = fvq->b_face_cog;
+  const cs_rreal_3_t *restrict diipf = fvq->diipf;
+  const cs_rreal_3_t *restrict djjpf = fvq->djjpf;
+  const cs_rreal_3_t *restrict diipb = fvq->diipb;
 
-    cs_real_t beta = blencp;
-    /* Beta blending coefficient ensuring positivity of the scalar */
-    if (isstpp == 2) {
-      beta = cs::max(cs::min(cv_limiter[c_id1], cv_limiter[c_id2]), 0.);
-    }
-
-    int bldfrp = ircflp;
-    /* Local limitation of the reconstruction */
-    if (df_limiter != nullptr && ircflp > 0) {
-      cs_real_t _bldfrp = fmax(fmin(df_limiter[c_id1],
-                                    df_limiter[c_id2]), 0.);
-      bldfrp = (int)_bldfrp;
-    }
-
-    cs_real_t hybrid_coef_ii, hybrid_coef_jj;
-    cs_lnum_t ic = -1, id = -1;
-    cs_real_t courant_c = -1., _local_max = 0., _local_min = 0.;
-    if (ischcp == 3) {
-      hybrid_coef_ii = CS_F_(hybrid_blend)->val[c_id1];
-      hybrid_coef_jj = CS_F_(hybrid_blend)->val[c_id2];
-    }
-    else if (ischcp == 4) {
-      hybrid_coef_ii = 0.;
-      hybrid_coef_jj = 0.;
-      /* Determine central and downwind sides w.r.t. current face */
-      cs_central_downwind_cells(c_id1,
-                                c_id2,
-                                i_mass_flux[f_id_sel],
-                                &ic,  /* central cell id */
-                                &id); /* downwind cell id */
-
-      if (courant != nullptr)
-        courant_c = courant[ic];
-
-      if (local_max != nullptr) {
-        _local_max = local_max[ic];
-        _local_min = local_min[ic];
-      }
-    }
-    else {
-      hybrid_coef_ii = 0.;
-      hybrid_coef_jj = 0.;
-    }
-
-    cs_real_2_t bi_bterms = {0., 0.};
-
-    _balance_internal_faces(iupwin,
-                            idtvar,
-                            iconvp,
-                            idiffp,
-                            bldfrp,
-                            ischcp,
-                            isstpp,
-                            (cs_nvd_type_t)limiter_choice,
-                            relaxp,
-                            beta,
-                            blend_st,
-                            weight[f_id_sel],
-                            i_dist[f_id_sel],
-                            cell_cen[c_id1],
-                            cell_cen[c_id2],
-                            cell_cen[ic],
-                            cell_cen[id],
-                            i_face_u_normal[f_id_sel],
-                            i_face_cog[f_id_sel],
-                            hybrid_coef_ii,
-                            hybrid_coef_jj,
-                            diipf[f_id_sel],
-                            djjpf[f_id_sel],
-                            grad[c_id1],
-                            grad[c_id2],
-                            grad[ic],
-                            gradup[c_id1],
-                            gradup[c_id2],
-                            gradst[c_id1],
-                            gradst[c_id2],
-                            f->val[c_id1],
-                            f->val[c_id2],
-                            f->val[ic],
-                            f->val[id],
-                            f->val_pre[c_id1],
-                            f->val_pre[c_id2],
-                            i_visc[f_id_sel],
-                            i_mass_flux[f_id_sel],
-                            cpro_cp[c_id1],
-                            cpro_cp[c_id2],
-                            _local_max,
-                            _local_min,
-                            courant_c,
-                            bi_bterms);
-
-    /* (The cell is counted only once in parallel by checking that
-       the c_id is not in the halo) */
-    /* Face normal well oriented (check bi_face_cells array) */
-    if (bi_face_cells[f_id_sel][0] >= 0) {
-      if (c_id1 < n_cells) {
-        if (i_mass_flux[f_id_sel] > 0)
-          bi_o_balance -= bi_bterms[0]*dt[c_id1];
-        else
-          bi_i_balance -= bi_bterms[0]*dt[c_id1];
-      }
-    }
-    /* Face normal direction reversed */
-    else {
-      if (c_id2 < n_cells) {
-        if (i_mass_flux[f_id_sel] > 0)
-          bi_i_balance += bi_bterms[1]*dt[c_id2];
-        else
-          bi_o_balance += bi_bterms[1]*dt[c_id2];
-      }
-    }
-
-  }
-
-  /* Free memory */
-
-  CS_FREE(grad);
-  CS_FREE(gradup);
-  CS_FREE(gradst);
-  CS_FREE(f_reconstructed);
-  CS_FREE(local_max);
-  CS_FREE(local_min);
-  CS_FREE(courant);
-
-  if (!itemperature || icp == -1)
-    CS_FREE(cpro_cp);
-  CS_FREE(c_visc);
-  CS_FREE(i_visc);
-  CS_FREE(b_visc);
-
-  CS_FREE(cells_tag_ids);
-  CS_FREE(bi_face_cells);
-  CS_FREE(i_face_sel_ids);
-  CS_FREE(bb_face_sel_ids);
-  CS_FREE(bi_face_sel_ids);
-
-  /* Sum of values on all ranks (parallel calculations) */
-
-  balance[CS_BALANCE_TOTAL_NORMALIZED] = tot_vol_balance2; /* temporary */
-
-  balance[CS_BALANCE_VOLUME] = vol_balance;
-  balance[CS_BALANCE_DIV] = div_balance;
-  balance[CS_BALANCE_UNSTEADY] = vol_balance + div_balance;
-  balance[CS_BALANCE_MASS] = mass_i_balance + mass_o_balance;
-  balance[CS_BALANCE_MASS_IN] = mass_i_balance;
-  balance[CS_BALANCE_MASS_OUT] = mass_o_balance;
-  balance[CS_BALANCE_INTERIOR_IN] = bi_i_balance;
-  balance[CS_BALANCE_INTERIOR_OUT] = bi_o_balance;
-  balance[CS_BALANCE_BOUNDARY_IN] = in_balance;
-  balance[CS_BALANCE_BOUNDARY_OUT] = out_balance;
-  balance[CS_BALANCE_BOUNDARY_SYM] = sym_balance;
-  balance[CS_BALANCE_BOUNDARY_WALL] = s_wall_balance + r_wall_balance;
-  balance[CS_BALANCE_BOUNDARY_WALL_S] = s_wall_balance;
-  balance[CS_BALANCE_BOUNDARY_WALL_R] = r_wall_balance;
-  balance[CS_BALANCE_BOUNDARY_COUPLED] = cpl_balance + i_cpl_balance;
-  balance[CS_BALANCE_BOUNDARY_COUPLED_E] = cpl_balance;
-  balance[CS_BALANCE_BOUNDARY_COUPLED_I] = i_cpl_balance;
-  balance[CS_BALANCE_BOUNDARY_OTHER] = ndef_balance;
-
-  cs_parall_sum(CS_BALANCE_N_TERMS, CS_REAL_TYPE, balance);
-
-  /* Total balance: add the different contributions calculated above */
-
-  balance[CS_BALANCE_TOTAL]
-    =   balance[CS_BALANCE_UNSTEADY] + balance[CS_BALANCE_MASS]
-      + balance[CS_BALANCE_INTERIOR_IN] + balance[CS_BALANCE_INTERIOR_OUT]
-      + balance[CS_BALANCE_BOUNDARY_IN] + balance[CS_BALANCE_BOUNDARY_OUT]
-      + balance[CS_BALANCE_BOUNDARY_SYM] + balance[CS_BALANCE_BOUNDARY_WALL]
-      + balance[CS_BALANCE_BOUNDARY_COUPLED]
-      + balance[CS_BALANCE_BOUNDARY_OTHER];
-
-  tot_vol_balance2 = balance[CS_BALANCE_TOTAL_NORMALIZED]; /* from temporary above */
-  balance[CS_BALANCE_TOTAL_NORMALIZED] = balance[CS_BALANCE_TOTAL];
-
-  if (tot_vol_balance2 > 0.)
-    balance[CS_BALANCE_TOTAL_NORMALIZED] /= sqrt(tot_vol_balance2);
-}
-
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Compute and log the different terms of the balance of a given scalar,
- *        on a volumic zone defined by selection criteria.
- *        The different contributions to the balance are printed in the
- *        run_solver.log.
- *
- * This function computes the balance relative to a given scalar
- * on a selected zone of the mesh.
- * We assume that we want to compute balances (convective and diffusive)
- * at the boundaries of the calculation domain represented below
- * (with different boundary types).
- *
- * The scalar and the zone are selected at the top of the routine
- * by the user.
- * In the case of the temperature, the energy balance in Joules will be
- * computed by multiplying by the specific heat.
- *
- * \param[in]     selection_crit      zone selection criterion
- * \param[in]     scalar_name         scalar name
- */
-/*----------------------------------------------------------------------------*/
-
-void
-cs_balance_by_zone(const char  *selection_crit,
-                   const char  *scalar_name)
-{
-  cs_real_t balance[CS_BALANCE_N_TERMS];
-
-  const cs_mesh_t *m = cs_glob_mesh;
-  const int nt_cur = cs_glob_time_step->nt_cur;
-
-  /* Select cells */
-
-  cs_lnum_t n_cells_sel = 0;
-  cs_lnum_t *cells_sel_ids = nullptr;
-
-  CS_MALLOC(cells_sel_ids, m->n_cells, cs_lnum_t);
-  cs_selector_get_cell_list(selection_crit, &n_cells_sel, cells_sel_ids);
-
-  /* Compute balance */
-
-  cs_balance_by_zone_compute(scalar_name,
-                             n_cells_sel,
-                             cells_sel_ids,
-                             balance);
-
-  CS_FREE(cells_sel_ids);
-
-  /* Log results at time step n */
-
-  bft_printf
-    (_("   ** SCALAR BALANCE BY ZONE at iteration %6i\n"
-       "   ---------------------------------------------\n"
-       "------------------------------------------------------------\n"
-       "   SCALAR: %s\n"
-       "   ZONE SELECTION CRITERIA: \"%s\"\n"
-       "------------------------------------------------------------\n"
-       "   Unst. term   Inj. Mass.   Suc. Mass.\n"
-       "  %12.4e %12.4e %12.4e\n"
-       "------------------------------------------------------------\n"
-       "   IB inlet     IB outlet\n"
-       "  %12.4e %12.4e\n"
-       "------------------------------------------------------------\n"
-       "   Inlet        Outlet\n"
-       "  %12.4e %12.4e\n"
-       "------------------------------------------------------------\n"
-       "   Sym.         Smooth W.    Rough W.\n"
-       "  %12.4e %12.4e %12.4e\n"
-       "------------------------------------------------------------\n"
-       "   Coupled      Int. Coupling    Undef. BC\n"
-       "  %12.4e %12.4e     %12.4e\n"
-       "------------------------------------------------------------\n"
-       "   Total        Instant. norm. total\n"
-       "  %12.4e %12.4e\n"
-       "------------------------------------------------------------\n\n"),
-     nt_cur, scalar_name, selection_crit,
-     balance[CS_BALANCE_UNSTEADY],
-     balance[CS_BALANCE_MASS_IN], balance[CS_BALANCE_MASS_OUT],
-     balance[CS_BALANCE_INTERIOR_IN], balance[CS_BALANCE_INTERIOR_OUT],
-     balance[CS_BALANCE_BOUNDARY_IN], balance[CS_BALANCE_BOUNDARY_OUT],
-     balance[CS_BALANCE_BOUNDARY_SYM],
-     balance[CS_BALANCE_BOUNDARY_WALL_S], balance[CS_BALANCE_BOUNDARY_WALL_R],
-     balance[CS_BALANCE_BOUNDARY_COUPLED_E],
-     balance[CS_BALANCE_BOUNDARY_COUPLED_I],
-     balance[CS_BALANCE_BOUNDARY_OTHER],
-     balance[CS_BALANCE_TOTAL], balance[CS_BALANCE_TOTAL_NORMALIZED]);
-}
-
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Computes one term of the head loss balance (pressure drop) on a
- *        on a volume zone defined by selected cell ids/
- *
- * \param[in]     n_cells_sel         number of selected cells
- * \param[in]     cell_sel_ids        ids of selected cells
- * \param[out]    balance             array of computed balance terms
- *                                    (see \ref cs_balance_p_term_t)
- */
-/*----------------------------------------------------------------------------*/
-
-void
-cs_pressure_drop_by_zone_compute(cs_lnum_t        n_cells_sel,
-                                 const cs_lnum_t  cell_sel_ids[],
-                                 cs_real_t        balance[CS_BALANCE_P_N_TERMS])
-{
-  const cs_mesh_t *m = cs_glob_mesh;
-  cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
-
-  const cs_halo_t  *halo = m->halo;
-
-  const cs_lnum_t n_cells = m->n_cells;
-  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
-  const cs_lnum_t n_i_faces = m->n_i_faces;
-  const cs_lnum_t n_b_faces = m->n_b_faces;
-
-  const cs_lnum_2_t *restrict i_face_cells = m->i_face_cells;
-  const cs_lnum_t *restrict b_face_cells = m->b_face_cells;
-  const cs_real_3_t *restrict i_face_cog = fvq->i_face_cog;
-  const cs_real_3_t *restrict b_face_cog = fvq->b_face_cog;
-  const cs_rreal_3_t *restrict diipf = fvq->diipf;
-  const cs_rreal_3_t *restrict djjpf = fvq->djjpf;
-  const cs_rreal_3_t *restrict diipb = fvq->diipb;
-
-  const int *bc_type = cs_glob_bc_type;
+  const int *bc_type = cs_glob_bc_type;
 
   /* initialize output */
 
-  for (int i = 0; i < CS_BALANCE_P_N_TERMS; i++)
+  for (cs_lnum_t i = 0; i < n_zones*CS_BALANCE_P_N_TERMS; i++)
     balance[i] = 0;
 
   /* Get physical fields */
@@ -1794,43 +1880,16 @@ cs_pressure_drop_by_zone_compute(cs_lnum_t        n_cells_sel,
                                 cs_glob_physical_constants->gravity[1],
                                 cs_glob_physical_constants->gravity[2]};
 
-  /* Zone cells selection variables*/
-  cs_lnum_t n_i_faces_sel = 0;
-  cs_lnum_t *i_face_sel_ids = nullptr;
-  cs_lnum_t n_bb_faces_sel = 0;
-  cs_lnum_t *bb_face_sel_ids = nullptr;
-  cs_lnum_t n_bi_faces_sel = 0;
-  cs_lnum_t *bi_face_sel_ids = nullptr;
-  cs_lnum_2_t *bi_face_cells = nullptr;
-  cs_lnum_t *cells_tag_ids = nullptr;
-
-  /* Initialization of balance contributions
-     ---------------------------------------
-
-    in_pressure   : contribution from inlets
-    out_pressure  : contribution from outlets
-    in_u2         : contribution from inlets
-    out_u2        : contribution from outlets
-    in_rhogx      : contribution from inlets
-    out_rhogx     : contribution from outlets
-    in_debit      : debit from inlets
-    out_debit     : debit from outlets
-    in_m_debit    : mass flow from inlets
-    out_m_debit   : mass flow from outlets
+  /* Balance contributions (see cs_balance_p_term_t) are accumulated
+     directly in the balance array of each zone:
 
+    CS_BALANCE_P_IN, CS_BALANCE_P_OUT            : pressure
+    CS_BALANCE_P_U2_IN, CS_BALANCE_P_U2_OUT      : kinetic energy
+    CS_BALANCE_P_RHOGX_IN, CS_BALANCE_P_RHOGX_OUT: gravity potential
+    CS_BALANCE_P_U_IN, CS_BALANCE_P_U_OUT        : debit
+    CS_BALANCE_P_RHOU_IN, CS_BALANCE_P_RHOU_OUT  : mass flow
   */
 
-  double in_pressure= 0.;
-  double out_pressure= 0.;
-  double in_u2 = 0.;
-  double out_u2 = 0.;
-  double in_rhogx = 0.;
-  double out_rhogx = 0.;
-  double in_debit = 0.;
-  double out_debit = 0.;
-  double in_m_debit = 0.;
-  double out_m_debit = 0.;
-
   /* Boundary condition coefficient for p */
   const cs_real_t *a_p = f_pres->bc_coeffs->a;
   const cs_real_t *b_p = f_pres->bc_coeffs->b;
@@ -1848,440 +1907,520 @@ cs_pressure_drop_by_zone_compute(cs_lnum_t        n_cells_sel,
 
   int inc = 1;
 
-  /* Get user-selected zone
-     ====================== */
-
-  /* Initialize arrays */
-
-  /* Internal faces of the selected zone */
-  CS_MALLOC(i_face_sel_ids, n_i_faces, cs_lnum_t);
-  /* Boundary faces of the selected zone,
-     which are internal faces of the global mesh.
-     Faces -> cells connectivity */
-  CS_MALLOC(bi_face_sel_ids, n_i_faces, cs_lnum_t);
-  CS_MALLOC(bi_face_cells, n_i_faces, cs_lnum_2_t);
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
-    i_face_sel_ids[f_id] = -1;
-    bi_face_sel_ids[f_id] = -1;
-    bi_face_cells[f_id][0] = -999;
-    bi_face_cells[f_id][1] = -999;
-  }
+  /* Compute the balance at time step n */
 
-  /* Boundary faces of the selected zone,
-     which are also boundary faces of the global mesh */
-  CS_MALLOC(bb_face_sel_ids, n_b_faces, cs_lnum_t);
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-    bb_face_sel_ids[f_id] = -1;
-  }
+  int iconvp = 1;
+  int ircflp = 0; /* No reconstruction */
 
+  const cs_real_3_t grad = {0, 0, 0};
 
-  /* Synchronization for parallelism */
-  CS_MALLOC(cells_tag_ids, n_cells_ext, cs_lnum_t);
-  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-    cells_tag_ids[c_id] = 0;
-  }
-  for (cs_lnum_t c_id = 0; c_id < n_cells_sel; c_id++) {
-    cs_lnum_t c_id_sel = cell_sel_ids[c_id];
-    cells_tag_ids[c_id_sel] = 1;
-  }
-  if (halo != nullptr) {
-    cs_halo_sync_num(halo, CS_HALO_STANDARD, cells_tag_ids);
-  }
+  for (int l_id = 0; l_id < n_layers; l_id++) {
 
-  /* Classify mesh faces with respect to the selected zone */
+    const cs_lnum_t *c_zone_id = zone_tag + (size_t)l_id*n_cells_ext;
 
-  /* Check boundary faces:
-     if they are in the selected zone, they are boundary as well */
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    /* Balance on boundary faces
+       ------------------------- */
 
-    cs_lnum_t c_id = b_face_cells[f_id];
+    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
 
-    if (cells_tag_ids[c_id] == 1) {
-      n_bb_faces_sel++;
-      bb_face_sel_ids[n_bb_faces_sel-1] = f_id;
-    }
-  }
+      /* Associated boundary cell */
+      cs_lnum_t c_id = b_face_cells[f_id];
+
+      const cs_lnum_t z_id = c_zone_id[c_id];
+      if (z_id < 0)
+        continue;
 
-  /* Check internal faces:
-     if they are in the selected zone, they can be either
-     internal or boundary faces */
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+      /* Values of pressure, kinematic and gravity terms and
+         associated boundary coefficients */
 
-    cs_lnum_t c_id1 = i_face_cells[f_id][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id][1];
+      cs_real_t v[3], a_v[3], b_v[3];
 
-    bool indic1 = false;
-    bool indic2 = false;
+      /* Pressure term FIXME rho0*gravity*(X-X0) should be added */
+      v[0] = pressure[c_id] / rho[c_id];
+      a_v[0] = a_p[f_id] / rho[c_id];
+      b_v[0] = b_p[f_id];
 
-    if (cells_tag_ids[c_id1] == 1)
-      indic1 = true;
-    if (cells_tag_ids[c_id2] == 1)
-      indic2 = true;
+      /* Kinematic term */
+      v[1] = 0.5 * cs_math_3_square_norm(velocity[c_id]);
+      a_v[1] = 0.5 * cs_math_3_square_norm(a_u[f_id]);
+      /* Approximation of u^2 BC */
+      b_v[1] = 1./6.*( b_u[f_id][0][0] * b_u[f_id][0][0]
+                     + b_u[f_id][1][1] * b_u[f_id][1][1]
+                     + b_u[f_id][2][2] * b_u[f_id][2][2]);
+
+      /* Gravity term (trivial BCs) */
+      v[2] = - cs_math_3_dot_product(gravity, b_face_cog[f_id]);
+      a_v[2] = v[2];
+      b_v[2] = 0.;
+
+      cs_real_t term_balance[3];
+
+      for (int k = 0; k < 3; k++) {
+        cs_real_t pip;
+        cs_b_cd_unsteady(ircflp,
+                         diipb[f_id],
+                         grad,
+                         v[k],
+                         &pip);
+
+        term_balance[k] = 0.;
+
+        cs_b_upwind_flux(iconvp,
+                         1., /* thetap */
+                         0, /* Conservative formulation,
+                               no mass accumulation */
+                         inc,
+                         bc_type[f_id],
+                         v[k],
+                         v[k], /* no relaxation */
+                         pip,
+                         a_v[k],
+                         b_v[k],
+                         b_mass_flux[f_id],
+                         1.,
+                         &term_balance[k]);
+      }
+
+      cs_real_t *z_balance = balance + z_id*CS_BALANCE_P_N_TERMS;
+
+      if (b_mass_flux[f_id] > 0) {
+        z_balance[CS_BALANCE_P_U_OUT] += b_mass_flux[f_id]/rho[c_id];
+        z_balance[CS_BALANCE_P_RHOU_OUT] += b_mass_flux[f_id];
+        z_balance[CS_BALANCE_P_OUT] += term_balance[0];
+        z_balance[CS_BALANCE_P_U2_OUT] += term_balance[1];
+        z_balance[CS_BALANCE_P_RHOGX_OUT] += term_balance[2];
+      } else {
+        z_balance[CS_BALANCE_P_U_IN] += b_mass_flux[f_id]/rho[c_id];
+        z_balance[CS_BALANCE_P_RHOU_IN] += b_mass_flux[f_id];
+        z_balance[CS_BALANCE_P_IN] += term_balance[0];
+        z_balance[CS_BALANCE_P_U2_IN] += term_balance[1];
+        z_balance[CS_BALANCE_P_RHOGX_IN] += term_balance[2];
+      }
 
-    if (indic1 && indic2) {
-      n_i_faces_sel++;
-      i_face_sel_ids[n_i_faces_sel-1] = f_id;
-    }
-    else if (indic1 || indic2) {
-      n_bi_faces_sel++;
-      bi_face_sel_ids[n_bi_faces_sel-1] = f_id;
-      /* Build the faces -> cells connectivity as done in
-         i_face_cells */
-      if (indic1)
-        bi_face_cells[f_id][0] = c_id1;
-      else
-        bi_face_cells[f_id][1] = c_id2;
     }
 
-  }
+    /* Balance on boundary faces of the selected zones
+       that are internal of the total mesh
+       ----------------------------------------------- */
 
-  /* Balance computation
-     =================== */
+    for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
 
-  /* Compute the balance at time step n */
+      /* Associated boundary-internal cells */
+      cs_lnum_t c_id1 = i_face_cells[f_id][0];
+      cs_lnum_t c_id2 = i_face_cells[f_id][1];
 
-  int iconvp = 1;
-  int ircflp = 0; /* No reconstruction */
+      const cs_lnum_t z_id1 = c_zone_id[c_id1];
+      const cs_lnum_t z_id2 = c_zone_id[c_id2];
 
-  /* Balance on boundary faces
-     -------------------------
+      if (z_id1 == z_id2)
+        continue;
 
-     We handle different types of boundary faces separately to better
-     analyze the information, but this is not mandatory. */
+      /* Pressure, kinematic and gravity terms */
 
-  for (cs_lnum_t f_id = 0; f_id < n_bb_faces_sel; f_id++) {
+      cs_real_t v1[3], v2[3];
 
-    cs_lnum_t f_id_sel = bb_face_sel_ids[f_id];
-    /* Associated boundary cell */
-    cs_lnum_t c_id = b_face_cells[f_id_sel];
+      v1[0] = pressure[c_id1] / rho[c_id1];
+      v2[0] = pressure[c_id2] / rho[c_id2];
 
-    cs_real_t pip;
+      v1[1] = 0.5 * cs_math_3_square_norm(velocity[c_id1]);
+      v2[1] = 0.5 * cs_math_3_square_norm(velocity[c_id2]);
 
-    /* Pressure term FIXME rho0*gravity*(X-X0) should be added */
-    cs_real_t p_rho = pressure[c_id] / rho[c_id];
-    cs_real_t a_p_rho = a_p[f_id_sel] / rho[c_id];
-    cs_real_t b_p_rho = b_p[f_id_sel];
+      v1[2] = - cs_math_3_dot_product(gravity, i_face_cog[f_id]);
+      v2[2] = v1[2];
 
-    cs_real_3_t grad = {0, 0, 0};
+      cs_real_2_t bi_bterms[3];
 
-    cs_b_cd_unsteady(ircflp,
-                     diipb[f_id_sel],
-                     grad,
-                     p_rho,
-                     &pip);
+      for (int k = 0; k < 3; k++) {
+        cs_real_t pip, pjp;
+        cs_real_t pif, pjf;
+
+        bi_bterms[k][0] = 0.;
+        bi_bterms[k][1] = 0.;
+
+        cs_i_cd_unsteady_upwind(ircflp,
+                                diipf[f_id],
+                                djjpf[f_id],
+                                grad,
+                                grad,
+                                v1[k],
+                                v2[k],
+                                &pif,
+                                &pjf,
+                                &pip,
+                                &pjp);
 
-    cs_real_t term_balance = 0.;
+        cs_i_conv_flux(iconvp,
+                       1.,
+                       0, /* Conservative formulation, no mass accumulation */
+                       v1[k],
+                       v2[k],
+                       pif,
+                       pif, /* no relaxation */
+                       pjf,
+                       pjf, /* no relaxation */
+                       i_mass_flux[f_id],
+                       1.,
+                       1.,
+                       bi_bterms[k]);
+      }
 
-    cs_b_upwind_flux(iconvp,
-                     1., /* thetap */
-                     0, /* Conservative formulation, no mass accumulation */
-                     inc,
-                     bc_type[f_id_sel],
-                     p_rho,
-                     p_rho, /* no relaxation */
-                     pip,
-                     a_p_rho,
-                     b_p_rho,
-                     b_mass_flux[f_id_sel],
-                     1.,
-                     &term_balance);
+      /* (The cell is counted only once in parallel by checking that
+         the c_id is not in the halo) */
+      /* Face normal well oriented for zone of first cell */
+      if (z_id1 > -1 && c_id1 < n_cells) {
+        cs_real_t *z_balance = balance + z_id1*CS_BALANCE_P_N_TERMS;
+        if (i_mass_flux[f_id] > 0) {
+          z_balance[CS_BALANCE_P_OUT] += bi_bterms[0][0];
+          z_balance[CS_BALANCE_P_U2_OUT] += bi_bterms[1][0];
+          z_balance[CS_BALANCE_P_RHOGX_OUT] += bi_bterms[2][0];
+          z_balance[CS_BALANCE_P_U_OUT] += i_mass_flux[f_id] / rho[c_id1];
+          z_balance[CS_BALANCE_P_RHOU_OUT] += i_mass_flux[f_id];
+        } else {
+          z_balance[CS_BALANCE_P_IN] += bi_bterms[0][0];
+          z_balance[CS_BALANCE_P_U2_IN] += bi_bterms[1][0];
+          z_balance[CS_BALANCE_P_RHOGX_IN] += bi_bterms[2][0];
+          z_balance[CS_BALANCE_P_U_IN] += i_mass_flux[f_id] / rho[c_id1];
+          z_balance[CS_BALANCE_P_RHOU_IN] += i_mass_flux[f_id];
+        }
+      }
+      /* Face normal direction reversed for zone of second cell */
+      if (z_id2 > -1 && c_id2 < n_cells) {
+        cs_real_t *z_balance = balance + z_id2*CS_BALANCE_P_N_TERMS;
+        if (i_mass_flux[f_id] > 0) {
+          z_balance[CS_BALANCE_P_IN] -= bi_bterms[0][1];
+          z_balance[CS_BALANCE_P_U2_IN] -= bi_bterms[1][1];
+          z_balance[CS_BALANCE_P_RHOGX_IN] -= bi_bterms[2][1];
+          z_balance[CS_BALANCE_P_U_IN] -= i_mass_flux[f_id] / rho[c_id2];
+          z_balance[CS_BALANCE_P_RHOU_IN] -= i_mass_flux[f_id];
+        } else {
+          z_balance[CS_BALANCE_P_OUT] -= bi_bterms[0][1];
+          z_balance[CS_BALANCE_P_U2_OUT] -= bi_bterms[1][1];
+          z_balance[CS_BALANCE_P_RHOGX_OUT] -= bi_bterms[2][1];
+          z_balance[CS_BALANCE_P_U_OUT] -= i_mass_flux[f_id] / rho[c_id2];
+          z_balance[CS_BALANCE_P_RHOU_OUT] -= i_mass_flux[f_id];
+        }
+      }
 
-    if (b_mass_flux[f_id_sel] > 0) {
-      out_debit += b_mass_flux[f_id_sel]/rho[c_id];
-      out_m_debit += b_mass_flux[f_id_sel];
-      out_pressure += term_balance;
-    } else {
-      in_debit += b_mass_flux[f_id_sel]/rho[c_id];
-      in_m_debit += b_mass_flux[f_id_sel];
-      in_pressure += term_balance;
     }
 
-    /* Kinematic term */
-    cs_real_t u2 = 0.5 * cs_math_3_square_norm(velocity[c_id]);
-    cs_real_t a_u2 = 0.5 * cs_math_3_square_norm(a_u[f_id_sel]);
-    /* Approximation of u^2 BC */
-    cs_real_t b_u2 = 1./6.*( b_u[f_id_sel][0][0] * b_u[f_id_sel][0][0]
-                           + b_u[f_id_sel][1][1] * b_u[f_id_sel][1][1]
-                           + b_u[f_id_sel][2][2] * b_u[f_id_sel][2][2]);
+  } /* End of loop on layers */
+
+  /* Sum of values on all ranks (parallel calculations) */
+
+  cs_parall_sum(n_zones*CS_BALANCE_P_N_TERMS, CS_REAL_TYPE, balance);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the different terms of the balance of a given scalar,
+ *        on a volume zone defined by selected cell ids/
+ *
+ * This function computes the balance relative to a given scalar
+ * on a selected zone of the mesh.
+ * We assume that we want to compute balances (convective and diffusive)
+ * at the boundaries of the calculation domain represented below
+ * (with different boundary types).
+ *
+ * In the case of the temperature, the energy balance in Joules will be
+ * computed by multiplying by the specific heat.
+ *
+ * \param[in]     scalar_name         scalar name
+ * \param[in]     n_cells_sel         number of selected cells
+ * \param[in]     cell_sel_ids        ids of selected cells
+ * \param[out]    balance             array of computed balance terms
+ *                                    (see \ref cs_balance_term_t)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_by_zone_compute(const char      *scalar_name,
+                           cs_lnum_t        n_cells_sel,
+                           const cs_lnum_t  cell_sel_ids[],
+                           cs_real_t        balance[CS_BALANCE_N_TERMS])
+{
+  const char *scalar_names[] = {scalar_name};
+  const cs_lnum_t *zone_cell_sel_ids[] = {cell_sel_ids};
+
+  cs_balance_by_zones_compute(1,
+                              scalar_names,
+                              1,
+                              &n_cells_sel,
+                              zone_cell_sel_ids,
+                              balance);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the different terms of the balance of a list of scalars,
+ *        on a list of volume zones defined by selected cell ids.
+ *
+ * Gradients are computed only once per scalar, and the contributions
+ * of all zones are accumulated in a single sweep over faces (or one sweep
+ * per group of disjoint zones when zones overlap).
+ *
+ * Balance terms for scalar s and zone z are stored in
+ * balance[(s*n_zones + z)*CS_BALANCE_N_TERMS + t], where t is a
+ * \ref cs_balance_term_t value.
+ *
+ * \param[in]     n_scalars           number of scalars
+ * \param[in]     scalar_names        scalar names
+ * \param[in]     n_zones             number of zones
+ * \param[in]     n_cells_sel         number of selected cells for each zone
+ * \param[in]     cell_sel_ids        ids of selected cells for each zone
+ * \param[out]    balance             array of computed balance terms
+ *                                    (size: n_scalars*n_zones
+ *                                    *CS_BALANCE_N_TERMS)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_by_zones_compute(int                     n_scalars,
+                            const char             *scalar_names[],
+                            int                     n_zones,
+                            const cs_lnum_t         n_cells_sel[],
+                            const cs_lnum_t *const  cell_sel_ids[],
+                            cs_real_t               balance[])
+{
+  int n_layers = 0;
+  cs_lnum_t *zone_tag = _zone_tags(n_zones,
+                                   n_cells_sel,
+                                   cell_sel_ids,
+                                   &n_layers);
+
+  for (int s_id = 0; s_id < n_scalars; s_id++) {
+
+    cs_real_t *s_balance = balance + (size_t)s_id*n_zones*CS_BALANCE_N_TERMS;
+
+    const cs_field_t *f = cs_field_by_name_try(scalar_names[s_id]);
+
+    /* If the requested scalar field is not computed, skip it */
+    if (f == nullptr) {
+      for (cs_lnum_t i = 0; i < n_zones*CS_BALANCE_N_TERMS; i++)
+        s_balance[i] = 0;
+      bft_printf(_("Scalar field \"%s\" does not exist. "
+                   "Balance will not be computed.\n"),
+                 scalar_names[s_id]);
+      continue;
+    }
+
+    _balance_by_zones(f, n_layers, zone_tag, n_zones, s_balance);
 
-    cs_b_cd_unsteady(ircflp,
-                     diipb[f_id_sel],
-                     grad,
-                     u2,
-                     &pip);
+  }
 
-    term_balance = 0.;
+  CS_FREE(zone_tag);
+}
 
-    cs_b_upwind_flux(iconvp,
-                     1., /* thetap */
-                     0, /* Conservative formulation, no mass accumulation */
-                     inc,
-                     bc_type[f_id_sel],
-                     u2,
-                     u2, /* no relaxation */
-                     pip,
-                     a_u2,
-                     b_u2,
-                     b_mass_flux[f_id_sel],
-                     1.,
-                     &term_balance);
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute and log the different terms of the balance of a given scalar,
+ *        on a volumic zone defined by selection criteria.
+ *        The different contributions to the balance are printed in the
+ *        run_solver.log.
+ *
+ * This function computes the balance relative to a given scalar
+ * on a selected zone of the mesh.
+ * We assume that we want to compute balances (convective and diffusive)
+ * at the boundaries of the calculation domain represented below
+ * (with different boundary types).
+ *
+ * The scalar and the zone are selected at the top of the routine
+ * by the user.
+ * In the case of the temperature, the energy balance in Joules will be
+ * computed by multiplying by the specific heat.
+ *
+ * \param[in]     selection_crit      zone selection criterion
+ * \param[in]     scalar_name         scalar name
+ */
+/*----------------------------------------------------------------------------*/
 
-    if (b_mass_flux[f_id_sel] > 0) {
-      out_u2 += term_balance;
-    } else {
-      in_u2 += term_balance;
-    }
+void
+cs_balance_by_zone(const char  *selection_crit,
+                   const char  *scalar_name)
+{
+  cs_real_t balance[CS_BALANCE_N_TERMS];
 
-    /* Gravity term */
-    cs_real_t gx = - cs_math_3_dot_product(gravity, b_face_cog[f_id_sel]);
-    /* Trivial BCs */
-    cs_real_t a_gx = gx;
-    cs_real_t b_gx = 0.;
+  const cs_mesh_t *m = cs_glob_mesh;
 
-    cs_b_cd_unsteady(ircflp,
-                     diipb[f_id_sel],
-                     grad,
-                     gx,
-                     &pip);
+  /* Select cells */
 
-    term_balance = 0.;
+  cs_lnum_t n_cells_sel = 0;
+  cs_lnum_t *cells_sel_ids = nullptr;
 
-    cs_b_upwind_flux(iconvp,
-                     1., /* thetap */
-                     0, /* Conservative formulation, no mass accumulation */
-                     inc,
-                     bc_type[f_id_sel],
-                     gx,
-                     gx, /* no relaxation */
-                     pip,
-                     a_gx,
-                     b_gx,
-                     b_mass_flux[f_id_sel],
-                     1.,
-                     &term_balance);
+  CS_MALLOC(cells_sel_ids, m->n_cells, cs_lnum_t);
+  cs_selector_get_cell_list(selection_crit, &n_cells_sel, cells_sel_ids);
 
-    if (b_mass_flux[f_id_sel] > 0) {
-      out_rhogx += term_balance;
-    } else {
-      in_rhogx += term_balance;
-    }
+  /* Compute balance */
 
-  }
+  cs_balance_by_zone_compute(scalar_name,
+                             n_cells_sel,
+                             cells_sel_ids,
+                             balance);
 
-  /* Balance on boundary faces of the selected zone
-     that are internal of the total mesh
-     ---------------------------------------------- */
+  CS_FREE(cells_sel_ids);
 
-  for (cs_lnum_t f_id = 0; f_id < n_bi_faces_sel; f_id++) {
+  /* Log results at time step n */
 
-    cs_lnum_t f_id_sel = bi_face_sel_ids[f_id];
-    /* Associated boundary-internal cells */
-    cs_lnum_t c_id1 = i_face_cells[f_id_sel][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id_sel][1];
+  _log_balance(scalar_name, selection_crit, balance);
+}
 
-    cs_real_2_t bi_bterms = {0.,0.};
-    cs_real_3_t grad = {0, 0, 0};
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute and log the different terms of the balance of a list of
+ *        scalars, on a list of volumic zones defined by selection criteria.
+ *
+ * This is equivalent to calling \ref cs_balance_by_zone for each scalar
+ * and zone, but gradients are computed only once per scalar, and all
+ * zones are handled in a single sweep over faces.
+ *
+ * If requested, balance terms of all zones are also written to a time plot
+ * for each scalar (named "balance_by_zone_<scalar_name>"), with columns
+ * named "z<zone index>_<term>". The list of zones should then remain
+ * the same across calls for a given scalar.
+ *
+ * \param[in]     n_zones             number of zones
+ * \param[in]     selection_crit      selection criterion for each zone
+ * \param[in]     n_scalars           number of scalars
+ * \param[in]     scalar_names        scalar names
+ * \param[in]     time_plot           if true, also output time plots
+ */
+/*----------------------------------------------------------------------------*/
 
-    cs_real_t pip, pjp;
-    cs_real_t pif, pjf;
+void
+cs_balance_by_zones(int          n_zones,
+                    const char  *selection_crit[],
+                    int          n_scalars,
+                    const char  *scalar_names[],
+                    bool         time_plot)
+{
+  /* Select cells */
 
-    /* Pressure term */
-    cs_real_t p_rho_id1 = pressure[c_id1] / rho[c_id1];
-    cs_real_t p_rho_id2 = pressure[c_id2] / rho[c_id2];
+  cs_lnum_t *n_cells_sel;
+  cs_lnum_t **cells_sel_ids;
+  CS_MALLOC(n_cells_sel, n_zones, cs_lnum_t);
+  CS_MALLOC(cells_sel_ids, n_zones, cs_lnum_t *);
 
-    cs_i_cd_unsteady_upwind(ircflp,
-                            diipf[f_id_sel],
-                            djjpf[f_id_sel],
-                            grad,
-                            grad,
-                            p_rho_id1,
-                            p_rho_id2,
-                            &pif,
-                            &pjf,
-                            &pip,
-                            &pjp);
+  _select_zone_cells(n_zones, selection_crit, n_cells_sel, cells_sel_ids);
 
-    cs_i_conv_flux(iconvp,
-                   1.,
-                   0, /* Conservative formulation, no mass accumulation */
-                   p_rho_id1,
-                   p_rho_id2,
-                   pif,
-                   pif, /* no relaxation */
-                   pjf,
-                   pjf, /* no relaxation */
-                   i_mass_flux[f_id_sel],
-                   1.,
-                   1.,
-                   bi_bterms);
+  /* Compute balance */
 
-    /* (The cell is counted only once in parallel by checking that
-       the c_id is not in the halo) */
-    /* Face normal well oriented (check bi_face_cells array) */
-    if (bi_face_cells[f_id_sel][0] >= 0) {
-      if (c_id1 < n_cells) {
-        if (i_mass_flux[f_id_sel] > 0) {
-          out_pressure += bi_bterms[0];
-          out_debit += i_mass_flux[f_id_sel] / rho[c_id1];
-          out_m_debit += i_mass_flux[f_id_sel];
-        } else {
-          in_pressure += bi_bterms[0];
-          in_debit += i_mass_flux[f_id_sel] / rho[c_id1];
-          in_m_debit += i_mass_flux[f_id_sel];
-        }
-      }
-    }
-    /* Face normal direction reversed */
-    else {
-      if (c_id2 < n_cells) {
-        if (i_mass_flux[f_id_sel] > 0) {
-          in_pressure -= bi_bterms[1];
-          in_debit -= i_mass_flux[f_id_sel] / rho[c_id2];
-          in_m_debit -= i_mass_flux[f_id_sel];
-        } else {
-          out_pressure -= bi_bterms[1];
-          out_debit -= i_mass_flux[f_id_sel] / rho[c_id2];
-          out_m_debit -= i_mass_flux[f_id_sel];
-        }
-      }
-    }
+  cs_real_t *balance;
+  CS_MALLOC(balance, (size_t)n_scalars*n_zones*CS_BALANCE_N_TERMS, cs_real_t);
 
-    /* Kinematic term */
-    bi_bterms[0] = 0.;
-    bi_bterms[1] = 0.;
+  cs_balance_by_zones_compute(n_scalars,
+                              scalar_names,
+                              n_zones,
+                              n_cells_sel,
+                              cells_sel_ids,
+                              balance);
 
-    cs_real_t u2_id1 = 0.5 * cs_math_3_square_norm(velocity[c_id1]);
-    cs_real_t u2_id2 = 0.5 * cs_math_3_square_norm(velocity[c_id2]);
+  for (int z_id = 0; z_id < n_zones; z_id++)
+    CS_FREE(cells_sel_ids[z_id]);
+  CS_FREE(cells_sel_ids);
+  CS_FREE(n_cells_sel);
 
-    cs_i_cd_unsteady_upwind(ircflp,
-                            diipf[f_id_sel],
-                            djjpf[f_id_sel],
-                            grad,
-                            grad,
-                            u2_id1,
-                            u2_id2,
-                            &pif,
-                            &pjf,
-                            &pip,
-                            &pjp);
+  /* Log results at time step n */
 
-    cs_i_conv_flux(iconvp,
-                   1.,
-                   0, /* Conservative formulation, no mass accumulation */
-                   u2_id1,
-                   u2_id2,
-                   pif,
-                   pif, /* no relaxation */
-                   pjf,
-                   pjf, /* no relaxation */
-                   i_mass_flux[f_id_sel],
-                   1.,
-                   1.,
-                   bi_bterms);
+  for (int s_id = 0; s_id < n_scalars; s_id++) {
 
-    /* (The cell is counted only once in parallel by checking that
-       the c_id is not in the halo) */
-    /* Face normal well oriented (check bi_face_cells array) */
-    if (bi_face_cells[f_id_sel][0] >= 0) {
-      if (c_id1 < n_cells) {
-        if (i_mass_flux[f_id_sel] > 0) {
-          out_u2 += bi_bterms[0];
-        } else {
-          in_u2 += bi_bterms[0];
-        }
-      }
-    }
-    /* Face normal direction reversed */
-    else {
-      if (c_id2 < n_cells) {
-        if (i_mass_flux[f_id_sel] > 0) {
-          in_u2 -= bi_bterms[1];
-        } else {
-          out_u2 -= bi_bterms[1];
-        }
-      }
-    }
+    if (cs_field_by_name_try(scalar_names[s_id]) == nullptr)
+      continue;
 
-    /* Gravity term */
-    bi_bterms[0] = 0.;
-    bi_bterms[1] = 0.;
+    const cs_real_t *s_balance
+      = balance + (size_t)s_id*n_zones*CS_BALANCE_N_TERMS;
 
-    cs_real_t gx_id1 = - cs_math_3_dot_product(gravity, i_face_cog[f_id_sel]);
-    cs_real_t gx_id2 = - cs_math_3_dot_product(gravity, i_face_cog[f_id_sel]);
+    for (int z_id = 0; z_id < n_zones; z_id++)
+      _log_balance(scalar_names[s_id],
+                   selection_crit[z_id],
+                   s_balance + z_id*CS_BALANCE_N_TERMS);
 
-    cs_i_cd_unsteady_upwind(ircflp,
-                            diipf[f_id_sel],
-                            djjpf[f_id_sel],
-                            grad,
-                            grad,
-                            gx_id1,
-                            gx_id2,
-                            &pif,
-                            &pjf,
-                            &pip,
-                            &pjp);
+    if (time_plot) {
+      char *plot_name;
+      size_t l = strlen("balance_by_zone_") + strlen(scalar_names[s_id]) + 1;
+      CS_MALLOC(plot_name, l, char);
+      snprintf(plot_name, l, "balance_by_zone_%s", scalar_names[s_id]);
 
-    cs_i_conv_flux(iconvp,
-                   1.,
-                   0, /* Conservative formulation, no mass accumulation */
-                   gx_id1,
-                   gx_id2,
-                   pif,
-                   pif, /* no relaxation */
-                   pjf,
-                   pjf, /* no relaxation */
-                   i_mass_flux[f_id_sel],
-                   1.,
-                   1.,
-                   bi_bterms);
+      _time_plot_write(plot_name,
+                       n_zones,
+                       CS_BALANCE_N_TERMS,
+                       _balance_term_name,
+                       s_balance);
 
-    /* (The cell is counted only once in parallel by checking that
-       the c_id is not in the halo) */
-    /* Face normal well oriented (check bi_face_cells array) */
-    if (bi_face_cells[f_id_sel][0] >= 0) {
-      if (c_id1 < n_cells) {
-        if (i_mass_flux[f_id_sel] > 0) {
-          out_rhogx += bi_bterms[0];
-        } else {
-          in_rhogx += bi_bterms[0];
-        }
-      }
-    }
-    /* Face normal direction reversed */
-    else {
-      if (c_id2 < n_cells) {
-        if (i_mass_flux[f_id_sel] > 0) {
-          in_rhogx -= bi_bterms[1];
-        } else {
-          out_rhogx -= bi_bterms[1];
-        }
-      }
+      CS_FREE(plot_name);
     }
 
   }
 
-  /* Free memory */
+  CS_FREE(balance);
+}
 
-  CS_FREE(cells_tag_ids);
-  CS_FREE(bi_face_cells);
-  CS_FREE(i_face_sel_ids);
-  CS_FREE(bb_face_sel_ids);
-  CS_FREE(bi_face_sel_ids);
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Computes one term of the head loss balance (pressure drop) on a
+ *        on a volume zone defined by selected cell ids/
+ *
+ * \param[in]     n_cells_sel         number of selected cells
+ * \param[in]     cell_sel_ids        ids of selected cells
+ * \param[out]    balance             array of computed balance terms
+ *                                    (see \ref cs_balance_p_term_t)
+ */
+/*----------------------------------------------------------------------------*/
 
-  /* Sum of values on all ranks (parallel calculations) */
+void
+cs_pressure_drop_by_zone_compute(cs_lnum_t        n_cells_sel,
+                                 const cs_lnum_t  cell_sel_ids[],
+                                 cs_real_t        balance[CS_BALANCE_P_N_TERMS])
+{
+  const cs_lnum_t *zone_cell_sel_ids[] = {cell_sel_ids};
+
+  cs_pressure_drop_by_zones_compute(1,
+                                    &n_cells_sel,
+                                    zone_cell_sel_ids,
+                                    balance);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Computes the head loss balance (pressure drop) terms on a list
+ *        of volume zones defined by selected cell ids, in a single sweep
+ *        over faces.
+ *
+ * Balance terms for zone z are stored in
+ * balance[z*CS_BALANCE_P_N_TERMS + t], where t is a
+ * \ref cs_balance_p_term_t value.
+ *
+ * \param[in]     n_zones             number of zones
+ * \param[in]     n_cells_sel         number of selected cells for each zone
+ * \param[in]     cell_sel_ids        ids of selected cells for each zone
+ * \param[out]    balance             array of computed balance terms
+ *                                    (size: n_zones*CS_BALANCE_P_N_TERMS)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_pressure_drop_by_zones_compute(int                     n_zones,
+                                  const cs_lnum_t         n_cells_sel[],
+                                  const cs_lnum_t *const  cell_sel_ids[],
+                                  cs_real_t               balance[])
+{
+  int n_layers = 0;
+  cs_lnum_t *zone_tag = _zone_tags(n_zones,
+                                   n_cells_sel,
+                                   cell_sel_ids,
+                                   &n_layers);
 
-  balance[CS_BALANCE_P_IN] = in_pressure;
-  balance[CS_BALANCE_P_OUT] = out_pressure;
-  balance[CS_BALANCE_P_U2_IN] = in_u2;
-  balance[CS_BALANCE_P_U2_OUT] = out_u2;
-  balance[CS_BALANCE_P_RHOGX_IN] = in_rhogx;
-  balance[CS_BALANCE_P_RHOGX_OUT] = out_rhogx;
-  balance[CS_BALANCE_P_U_IN] = in_debit;
-  balance[CS_BALANCE_P_U_OUT] = out_debit;
-  balance[CS_BALANCE_P_RHOU_IN] = in_m_debit;
-  balance[CS_BALANCE_P_RHOU_OUT] = out_m_debit;
-
-  cs_parall_sum(CS_BALANCE_P_N_TERMS, CS_REAL_TYPE, balance);
+  _pressure_drop_by_zones(n_layers, zone_tag, n_zones, balance);
+
+  CS_FREE(zone_tag);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2300,7 +2439,6 @@ cs_pressure_drop_by_zone(const char * selection_crit)
   cs_real_t balance[CS_BALANCE_P_N_TERMS];
 
   const cs_mesh_t *m = cs_glob_mesh;
-  const int nt_cur = cs_glob_time_step->nt_cur;
 
   /* Select cells */
 
@@ -2320,52 +2458,88 @@ cs_pressure_drop_by_zone(const char * selection_crit)
 
   /* Log results at time step n */
 
-  bft_printf(_("   ** PRESSURE DROP BY ZONE at iteration %6i\n"
-               "   ---------------------------------------------\n"
-               "------------------------------------------------------------\n"
-               "   ZONE SELECTION CRITERIA: \"%s\"\n"
-               "------------------------------------------------------------\n"
-               "  |                 |\n"
-               "  | p u . dS        | p u . dS\n"
-               "  |   -    -        |   -    -\n"
-               "  |                 |\n"
-               "  | inlet           | outlet\n"
-               "  %12.4e      %12.4e\n"
-               "------------------------------------------------------------\n"
-               "  |                 |\n"
-               "  | u^2/2 rho u . dS| u^2/2 rho u . dS\n"
-               "  | -         -    -| -         -    -\n"
-               "  |                 |\n"
-               "  | inlet           | outlet\n"
-               "  %12.4e      %12.4e\n"
-               "------------------------------------------------------------\n"
-               "  |                 |\n"
-               "  |-rho(g . x)u . dS|-rho(g . x)u . dS\n"
-               "  |     -   - -    -|     -   - -    -\n"
-               "  |                 |\n"
-               "  | inlet           | outlet\n"
-               "  %12.4e      %12.4e\n"
-               "------------------------------------------------------------\n"
-               "  |                 |\n"
-               "  | u . dS          | u . dS\n"
-               "  | -    -          | -    -\n"
-               "  |                 |\n"
-               "  | inlet           | outlet\n"
-               "  %12.4e      %12.4e\n"
-               "------------------------------------------------------------\n"
-               "  |                 |\n"
-               "  | rho u . dS      | rho u . dS\n"
-               "  |     -    -      |     -    -\n"
-               "  |                 |\n"
-               "  | inlet           | outlet\n"
-               "  %12.4e      %12.4e\n"
-               "------------------------------------------------------------\n\n"),
-             nt_cur, selection_crit,
-             balance[CS_BALANCE_P_IN], balance[CS_BALANCE_P_OUT],
-             balance[CS_BALANCE_P_U2_IN], balance[CS_BALANCE_P_U2_OUT],
-             balance[CS_BALANCE_P_RHOGX_IN], balance[CS_BALANCE_P_RHOGX_OUT],
-             balance[CS_BALANCE_P_U_IN], balance[CS_BALANCE_P_U_OUT],
-             balance[CS_BALANCE_P_RHOU_IN], balance[CS_BALANCE_P_RHOU_OUT]);
+  _log_pressure_drop(selection_crit, balance);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Computes and logs the head loss balance (pressure drop) terms on a
+ *        list of volumic zones defined by selection criteria, in a single
+ *        sweep over faces.
+ *
+ * If requested, balance terms of all zones are also written to a time plot
+ * named "pressure_drop_by_zone", with columns named "z<zone index>_<term>".
+ * The list of zones should then remain the same across calls.
+ *
+ * \param[in]     n_zones             number of zones
+ * \param[in]     selection_crit      selection criterion for each zone
+ * \param[in]     time_plot           if true, also output time plots
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_pressure_drop_by_zones(int          n_zones,
+                          const char  *selection_crit[],
+                          bool         time_plot)
+{
+  /* Select cells */
+
+  cs_lnum_t *n_cells_sel;
+  cs_lnum_t **cells_sel_ids;
+  CS_MALLOC(n_cells_sel, n_zones, cs_lnum_t);
+  CS_MALLOC(cells_sel_ids, n_zones, cs_lnum_t *);
+
+  _select_zone_cells(n_zones, selection_crit, n_cells_sel, cells_sel_ids);
+
+  /* Compute pressure drop terms */
+
+  cs_real_t *balance;
+  CS_MALLOC(balance, (size_t)n_zones*CS_BALANCE_P_N_TERMS, cs_real_t);
+
+  cs_pressure_drop_by_zones_compute(n_zones,
+                                    n_cells_sel,
+                                    cells_sel_ids,
+                                    balance);
+
+  for (int z_id = 0; z_id < n_zones; z_id++)
+    CS_FREE(cells_sel_ids[z_id]);
+  CS_FREE(cells_sel_ids);
+  CS_FREE(n_cells_sel);
+
+  /* Log results at time step n */
+
+  for (int z_id = 0; z_id < n_zones; z_id++)
+    _log_pressure_drop(selection_crit[z_id],
+                       balance + z_id*CS_BALANCE_P_N_TERMS);
+
+  if (time_plot)
+    _time_plot_write("pressure_drop_by_zone",
+                     n_zones,
+                     CS_BALANCE_P_N_TERMS,
+                     _balance_p_term_name,
+                     balance);
+
+  CS_FREE(balance);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free time plots associated with balances by zone.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_by_zone_finalize(void)
+{
+  for (int p_id = 0; p_id < _n_plots; p_id++) {
+    cs_time_plot_finalize(&(_plots[p_id]));
+    CS_FREE(_plot_names[p_id]);
+  }
+
+  CS_FREE(_plots);
+  CS_FREE(_plot_n_vals);
+  CS_FREE(_plot_names);
+  _n_plots = 0;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2665,7 +2839,7 @@ cs_flux_through_surface(const char         *scalar_name,
   /* Internal coupling*/
 
   if (eqp->icoupl > 0) {
-    const int coupling_key_id = cs_field_key_id("coupling_entity");
+    static const int coupling_key_id = cs_field_key_id("coupling_entity");
     const int coupling_id = cs_field_get_key_int(f, coupling_key_id);
     cpl = cs_internal_coupling_by_id(coupling_id);
     cs_internal_coupling_coupled_faces(cpl,
@@ -2712,8 +2886,8 @@ cs_flux_through_surface(const char         *scalar_name,
     if (cv_limiter_id > -1)
       cv_limiter = cs_field_by_id(cv_limiter_id)->val;
 
-    int df_limiter_id =
-      cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+    static const int kdflim = cs_field_key_id("diffusion_limiter_id");
+    int df_limiter_id = cs_field_get_key_int(f, kdflim);
     if (df_limiter_id > -1)
       df_limiter = cs_field_by_id(df_limiter_id)->val;
   }
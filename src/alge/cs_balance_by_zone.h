@@ -131,6 +131,38 @@ cs_balance_by_zone_compute(const char      *scalar_name,
                            const cs_lnum_t  cell_sel_ids[],
                            cs_real_t        balance[CS_BALANCE_N_TERMS]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the different terms of the balance of a list of scalars,
+ *        on a list of volume zones defined by selected cell ids.
+ *
+ * Gradients are computed only once per scalar, and the contributions
+ * of all zones are accumulated in a single sweep over faces (or one sweep
+ * per group of disjoint zones when zones overlap).
+ *
+ * Balance terms for scalar s and zone z are stored in
+ * balance[(s*n_zones + z)*CS_BALANCE_N_TERMS + t], where t is a
+ * \ref cs_balance_term_t value.
+ *
+ * \param[in]     n_scalars           number of scalars
+ * \param[in]     scalar_names        scalar names
+ * \param[in]     n_zones             number of zones
+ * \param[in]     n_cells_sel         number of selected cells for each zone
+ * \param[in]     cell_sel_ids        ids of selected cells for each zone
+ * \param[out]    balance             array of computed balance terms
+ *                                    (size: n_scalars*n_zones
+ *                                    *CS_BALANCE_N_TERMS)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_by_zones_compute(int                     n_scalars,
+                            const char             *scalar_names[],
+                            int                     n_zones,
+                            const cs_lnum_t         n_cells_sel[],
+                            const cs_lnum_t *const  cell_sel_ids[],
+                            cs_real_t               balance[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute and log the different terms of the balance of a given scalar,
@@ -158,6 +190,35 @@ void
 cs_balance_by_zone(const char  *selection_crit,
                    const char  *scalar_name);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute and log the different terms of the balance of a list of
+ *        scalars, on a list of volumic zones defined by selection criteria.
+ *
+ * This is equivalent to calling \ref cs_balance_by_zone for each scalar
+ * and zone, but gradients are computed only once per scalar, and all
+ * zones are handled in a single sweep over faces.
+ *
+ * If requested, balance terms of all zones are also written to a time plot
+ * for each scalar (named "balance_by_zone_<scalar_name>"), with columns
+ * named "z<zone index>_<term>". The list of zones should then remain
+ * the same across calls for a given scalar.
+ *
+ * \param[in]     n_zones             number of zones
+ * \param[in]     selection_crit      selection criterion for each zone
+ * \param[in]     n_scalars           number of scalars
+ * \param[in]     scalar_names        scalar names
+ * \param[in]     time_plot           if true, also output time plots
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_by_zones(int          n_zones,
+                    const char  *selection_crit[],
+                    int          n_scalars,
+                    const char  *scalar_names[],
+                    bool         time_plot);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Computes one term of the head loss balance (pressure drop) on a
@@ -175,6 +236,30 @@ cs_pressure_drop_by_zone_compute(cs_lnum_t        n_cells_sel,
                                  const cs_lnum_t  cell_sel_ids[],
                                  cs_real_t        balance[CS_BALANCE_P_N_TERMS]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Computes the head loss balance (pressure drop) terms on a list
+ *        of volume zones defined by selected cell ids, in a single sweep
+ *        over faces.
+ *
+ * Balance terms for zone z are stored in
+ * balance[z*CS_BALANCE_P_N_TERMS + t], where t is a
+ * \ref cs_balance_p_term_t value.
+ *
+ * \param[in]     n_zones             number of zones
+ * \param[in]     n_cells_sel         number of selected cells for each zone
+ * \param[in]     cell_sel_ids        ids of selected cells for each zone
+ * \param[out]    balance             array of computed balance terms
+ *                                    (size: n_zones*CS_BALANCE_P_N_TERMS)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_pressure_drop_by_zones_compute(int                     n_zones,
+                                  const cs_lnum_t         n_cells_sel[],
+                                  const cs_lnum_t *const  cell_sel_ids[],
+                                  cs_real_t               balance[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Computes one term of the head loss balance (pressure drop) on a
@@ -188,6 +273,36 @@ cs_pressure_drop_by_zone_compute(cs_lnum_t        n_cells_sel,
 void
 cs_pressure_drop_by_zone(const char  *selection_crit);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Computes and logs the head loss balance (pressure drop) terms on a
+ *        list of volumic zones defined by selection criteria, in a single
+ *        sweep over faces.
+ *
+ * If requested, balance terms of all zones are also written to a time plot
+ * named "pressure_drop_by_zone", with columns named "z<zone index>_<term>".
+ * The list of zones should then remain the same across calls.
+ *
+ * \param[in]     n_zones             number of zones
+ * \param[in]     selection_crit      selection criterion for each zone
+ * \param[in]     time_plot           if true, also output time plots
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_pressure_drop_by_zones(int          n_zones,
+                          const char  *selection_crit[],
+                          bool         time_plot);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free time plots associated with balances by zone.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_by_zone_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute the surface balance of a given scalar.
@@ -90,6 +90,7 @@
  *----------------------------------------------------------------------------*/
 
 #include "alge/cs_benchmark.h"
+#include "alge/cs_benchmark_kernels.h"
 #include "alge/cs_benchmark_matrix.h"
 
 #if defined(HAVE_CUDA)
@@ -1267,6 +1268,11 @@ cs_benchmark(int  mpi_trace_mode)
                            x,
                            y);
 
+  /* Time other operators */
+  /*----------------------*/
+
+  cs_benchmark_kernels(n_time_runs);
+
   cs_matrix_finalize();
 
   cs_mesh_adjacencies_finalize();
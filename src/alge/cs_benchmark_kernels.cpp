@@ -0,0 +1,1104 @@
+/*============================================================================
+ * Benchmarking of finite volume operators and other hot kernels.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2025 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "base/cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C and C++ library headers
+ *----------------------------------------------------------------------------*/
+
+#include <chrono>
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft/bft_error.h"
+#include "bft/bft_printf.h"
+
+#include "base/cs_base.h"
+#include "base/cs_boundary_conditions.h"
+#include "base/cs_boundary_conditions_set_coeffs.h"
+#include "alge/cs_convection_diffusion.h"
+#include "base/cs_dispatch.h"
+#include "base/cs_field.h"
+#include "base/cs_field_pointer.h"
+#include "alge/cs_gradient.h"
+#include "base/cs_halo.h"
+#include "base/cs_log.h"
+#include "base/cs_math.h"
+#include "base/cs_mem.h"
+#include "mesh/cs_mesh.h"
+#include "mesh/cs_mesh_adjacencies.h"
+#include "mesh/cs_mesh_quantities.h"
+#include "alge/cs_matrix.h"
+#include "alge/cs_matrix_default.h"
+#include "alge/cs_multigrid.h"
+#include "base/cs_parall.h"
+#include "base/cs_parameters.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "alge/cs_benchmark_kernels.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/*=============================================================================
+ * Local Structure Definitions
+ *============================================================================*/
+
+/*============================================================================
+ *  Global variables
+ *============================================================================*/
+
+/* Reference (STREAM triad) bandwidth, in GB/s, summed over ranks */
+
+static double _stream_gbs = 0.;
+
+/* Short gradient type names, for compact logging */
+
+static const char *_gradient_type_short_name[]
+  = {"Green-Gauss iter.",
+     "LSQ",
+     "Green-Gauss LSQ",
+     "Green-Gauss vertex",
+     "Green-Gauss renorm."};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Synchronize ranks before or after a timed section.
+ *----------------------------------------------------------------------------*/
+
+static void
+_barrier(void)
+{
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Barrier(cs_glob_mpi_comm);
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Return elapsed wall-clock time since a given time point, in seconds.
+ *
+ * parameters:
+ *   wt0 <-- start time point
+ *
+ * returns:
+ *   elapsed time
+ *----------------------------------------------------------------------------*/
+
+static double
+_elapsed(std::chrono::high_resolution_clock::time_point  wt0)
+{
+  std::chrono::high_resolution_clock::time_point
+    wt1 = std::chrono::high_resolution_clock::now();
+  std::chrono::microseconds wt_m
+    = std::chrono::duration_cast<std::chrono::microseconds>(wt1 - wt0);
+  return wt_m.count() * 1.e-6;
+}
+
+/*----------------------------------------------------------------------------
+ * Estimate memory traffic of a face-based finite volume operator.
+ *
+ * parameters:
+ *   c_vals <-- number of real values accessed per cell (with ghosts)
+ *   i_vals <-- number of real values accessed per interior face
+ *   b_vals <-- number of real values accessed per boundary face
+ *
+ * returns:
+ *   estimated number of bytes moved per call
+ *----------------------------------------------------------------------------*/
+
+static double
+_fv_bytes(int  c_vals,
+          int  i_vals,
+          int  b_vals)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  double c_bytes = (double)m->n_cells_with_ghosts * c_vals * sizeof(cs_real_t);
+  double i_bytes = (double)m->n_i_faces * (  2*sizeof(cs_lnum_t)
+                                           + i_vals*sizeof(cs_real_t));
+  double b_bytes = (double)m->n_b_faces * (  sizeof(cs_lnum_t)
+                                           + b_vals*sizeof(cs_real_t));
+
+  return c_bytes + i_bytes + b_bytes;
+}
+
+/*----------------------------------------------------------------------------
+ * Log kernel timing.
+ *
+ * The reported time is the maximum over ranks, and the bandwidth
+ * is based on the sum of local byte counts over ranks.
+ *
+ * parameters:
+ *   name    <-- kernel name
+ *   n_runs  <-- number of runs
+ *   bytes   <-- local estimated number of bytes moved per run
+ *   wt      <-- local wall-clock time for all runs
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_kernel(const char  *name,
+            int          n_runs,
+            double       bytes,
+            double       wt)
+{
+  double loc[2] = {wt, bytes};
+  double glob[2] = {wt, bytes};
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    MPI_Allreduce(loc, glob, 1, MPI_DOUBLE, MPI_MAX, cs_glob_mpi_comm);
+    MPI_Allreduce(loc + 1, glob + 1, 1, MPI_DOUBLE, MPI_SUM,
+                  cs_glob_mpi_comm);
+  }
+#endif
+
+  double t_call = glob[0] / cs::max(n_runs, 1);
+  double gbs = (t_call > 0) ? glob[1] / (t_call*1.e9) : 0.;
+  double s_frac = (_stream_gbs > 0) ? gbs / _stream_gbs * 100. : 0.;
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "  %-56s %12.5e %10.3f %8.1f\n",
+                name, t_call, gbs, s_frac);
+}
+
+/*----------------------------------------------------------------------------
+ * Log kernel section header.
+ *
+ * parameters:
+ *   title <-- section title
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_section(const char  *title)
+{
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "\n"
+                "%s\n\n"
+                "  %-56s %12s %10s %8s\n",
+                title, "kernel", "time/call", "GB/s", "% STREAM");
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "  --------------------------------------------------------"
+                " ------------ ---------- --------\n");
+}
+
+/*----------------------------------------------------------------------------
+ * Measure reference STREAM triad bandwidth (a = b + s.c).
+ *
+ * As in the STREAM benchmark, the best time over all runs is used,
+ * and write-allocate traffic is not counted.
+ *
+ * parameters:
+ *   n_time_runs <-- number of timing runs
+ *----------------------------------------------------------------------------*/
+
+static void
+_stream_triad(int  n_time_runs)
+{
+  /* Use arrays large enough not to fit in caches */
+
+  const cs_lnum_t n = cs::max(cs_glob_mesh->n_cells_with_ghosts,
+                              (cs_lnum_t)(1 << 22));
+
+  cs_real_t *a, *b, *c;
+  CS_MALLOC(a, n, cs_real_t);
+  CS_MALLOC(b, n, cs_real_t);
+  CS_MALLOC(c, n, cs_real_t);
+
+  cs_dispatch_context ctx;
+  ctx.set_use_gpu(false);
+
+  /* Initialize with the same access pattern as the kernel (first touch) */
+
+  ctx.parallel_for(n, [=] CS_F_HOST (cs_lnum_t i) {
+    a[i] = 0.;
+    b[i] = 1.;
+    c[i] = 2.;
+  });
+  ctx.wait();
+
+  const cs_real_t s = 3.;
+  double wt_best = HUGE_VAL;
+
+  for (int run_id = 0; run_id < cs::max(n_time_runs, 2); run_id++) {
+    _barrier();
+    std::chrono::high_resolution_clock::time_point
+      wt0 = std::chrono::high_resolution_clock::now();
+    ctx.parallel_for(n, [=] CS_F_HOST (cs_lnum_t i) {
+      a[i] = b[i] + s*c[i];
+    });
+    ctx.wait();
+    _barrier();
+    wt_best = cs::min(wt_best, _elapsed(wt0));
+  }
+
+  double bytes = 3. * n * sizeof(cs_real_t);
+
+  /* Set reference */
+
+  double glob[2] = {wt_best, bytes};
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    MPI_Allreduce(&wt_best, glob, 1, MPI_DOUBLE, MPI_MAX, cs_glob_mpi_comm);
+    MPI_Allreduce(&bytes, glob + 1, 1, MPI_DOUBLE, MPI_SUM, cs_glob_mpi_comm);
+  }
+#endif
+
+  _stream_gbs = (glob[0] > 0) ? glob[1] / (glob[0]*1.e9) : 0.;
+
+  _log_kernel("STREAM triad (reference)", 1, bytes, wt_best);
+
+  CS_FREE(c);
+  CS_FREE(b);
+  CS_FREE(a);
+}
+
+/*----------------------------------------------------------------------------
+ * Time scalar and vector gradient reconstruction for each gradient type,
+ * with homogeneous Neumann boundary conditions.
+ *
+ * parameters:
+ *   n_time_runs <-- number of timing runs
+ *----------------------------------------------------------------------------*/
+
+static void
+_gradient_test(int  n_time_runs)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_real_3_t *cell_cen = mq->cell_cen;
+
+  const cs_equation_param_t eqp = cs_parameters_equation_param_default();
+
+  cs_real_t *var;
+  cs_real_3_t *var_v, *grad;
+  cs_real_33_t *grad_v;
+  CS_MALLOC_HD(var, n_cells_ext, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(var_v, n_cells_ext, cs_real_3_t, cs_alloc_mode);
+  CS_MALLOC_HD(grad, n_cells_ext, cs_real_3_t, cs_alloc_mode);
+  CS_MALLOC_HD(grad_v, n_cells_ext, cs_real_33_t, cs_alloc_mode);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+    var[c_id] = cell_cen[c_id][0] + 2.*cell_cen[c_id][1] - cell_cen[c_id][2];
+    var_v[c_id][0] = cell_cen[c_id][1];
+    var_v[c_id][1] = cell_cen[c_id][2];
+    var_v[c_id][2] = cell_cen[c_id][0];
+  }
+
+  char name[64];
+
+  /* Rough traffic model: values, gradient, geometric weights
+     (6 values per cell for the lsq covariance or renormalization),
+     and 8 geometric values per interior face */
+
+  for (int g_type = CS_GRADIENT_GREEN_ITER;
+       g_type <= CS_GRADIENT_GREEN_R;
+       g_type++) {
+
+    cs_gradient_type_t gradient_type = (cs_gradient_type_t)g_type;
+    int n_r_sweeps = (gradient_type == CS_GRADIENT_GREEN_ITER) ?
+      eqp.nswrgr : 1;
+
+    /* Scalar; the first call is not timed as it builds the
+       geometric quantities associated with the gradient type */
+
+    std::chrono::high_resolution_clock::time_point wt0;
+    for (int run_id = -1; run_id < n_time_runs; run_id++) {
+      if (run_id == 0) {
+        _barrier();
+        wt0 = std::chrono::high_resolution_clock::now();
+      }
+      cs_gradient_scalar("benchmark",
+                         gradient_type,
+                         CS_HALO_STANDARD,
+                         1,             /* inc */
+                         n_r_sweeps,
+                         0,             /* hyd_p_flag */
+                         1,             /* w_stride */
+                         0,             /* verbosity */
+                         CS_GRADIENT_LIMIT_NONE,
+                         eqp.epsrgr,
+                         eqp.climgr,
+                         nullptr,       /* f_ext */
+                         nullptr,       /* bc_coeffs */
+                         var,
+                         nullptr,       /* c_weight */
+                         nullptr,       /* cpl */
+                         grad);
+    }
+    _barrier();
+    snprintf(name, 63, "gradient (scalar), %s",
+             _gradient_type_short_name[g_type]);
+    name[63] = '\0';
+    _log_kernel(name, n_time_runs, _fv_bytes(1+3+6, 8, 6), _elapsed(wt0));
+
+    /* Vector (renormalization is available for scalars only) */
+
+    if (gradient_type == CS_GRADIENT_GREEN_R)
+      continue;
+
+    for (int run_id = -1; run_id < n_time_runs; run_id++) {
+      if (run_id == 0) {
+        _barrier();
+        wt0 = std::chrono::high_resolution_clock::now();
+      }
+      cs_gradient_vector("benchmark_v",
+                         gradient_type,
+                         CS_HALO_STANDARD,
+                         1,             /* inc */
+                         n_r_sweeps,
+                         0,             /* verbosity */
+                         CS_GRADIENT_LIMIT_NONE,
+                         eqp.epsrgr,
+                         eqp.climgr,
+                         nullptr,       /* bc_coeffs_v */
+                         var_v,
+                         nullptr,       /* c_weight */
+                         nullptr,       /* cpl */
+                         grad_v);
+    }
+    _barrier();
+    snprintf(name, 63, "gradient (vector), %s",
+             _gradient_type_short_name[g_type]);
+    name[63] = '\0';
+    _log_kernel(name, n_time_runs, _fv_bytes(3+9+6, 8, 6), _elapsed(wt0));
+  }
+
+  CS_FREE_HD(grad_v);
+  CS_FREE_HD(grad);
+  CS_FREE_HD(var_v);
+  CS_FREE_HD(var);
+}
+
+/*----------------------------------------------------------------------------
+ * Time explicit convection-diffusion balance for scalar and vector
+ * variables with each convection scheme and slope test option.
+ *
+ * A uniform velocity based mass flux and a constant viscosity are used,
+ * with homogeneous Neumann boundary conditions.
+ *
+ * parameters:
+ *   n_time_runs <-- number of timing runs
+ *----------------------------------------------------------------------------*/
+
+static void
+_convection_diffusion_test(int  n_time_runs)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+  const cs_real_3_t *cell_cen = mq->cell_cen;
+
+  /* Operator coefficients */
+
+  const cs_real_t u_ref[3] = {1., 0.5, 0.25};
+  const cs_real_t mu = 1.e-3;
+
+  cs_real_t *i_massflux, *b_massflux, *i_visc, *b_visc;
+  CS_MALLOC_HD(i_massflux, n_i_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(i_visc, n_i_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(b_massflux, n_b_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(b_visc, n_b_faces, cs_real_t, cs_alloc_mode);
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    i_massflux[f_id] = cs_math_3_dot_product(u_ref, mq->i_face_u_normal[f_id])
+                       * mq->i_face_surf[f_id];
+    i_visc[f_id] = mu * mq->i_face_surf[f_id] / mq->i_dist[f_id];
+  }
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    b_massflux[f_id] = 0.;
+    b_visc[f_id] = mu * mq->b_face_surf[f_id] / mq->b_dist[f_id];
+  }
+
+  /* Homogeneous Neumann boundary conditions */
+
+  cs_field_bc_coeffs_t bc_coeffs, bc_coeffs_v;
+  cs_field_bc_coeffs_init(&bc_coeffs);
+  cs_field_bc_coeffs_init(&bc_coeffs_v);
+
+  CS_MALLOC_HD(bc_coeffs.a, n_b_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(bc_coeffs.b, n_b_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(bc_coeffs.af, n_b_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(bc_coeffs.bf, n_b_faces, cs_real_t, cs_alloc_mode);
+
+  CS_MALLOC_HD(bc_coeffs_v.a, 3*n_b_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(bc_coeffs_v.b, 9*n_b_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(bc_coeffs_v.af, 3*n_b_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(bc_coeffs_v.bf, 9*n_b_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(bc_coeffs_v.val_f, 3*n_b_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(bc_coeffs_v.val_f_lim, 3*n_b_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(bc_coeffs_v.val_f_d, 3*n_b_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(bc_coeffs_v.val_f_d_lim, 3*n_b_faces, cs_real_t,
+               cs_alloc_mode);
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    bc_coeffs.a[f_id] = 0.;
+    bc_coeffs.b[f_id] = 1.;
+    bc_coeffs.af[f_id] = 0.;
+    bc_coeffs.bf[f_id] = 0.;
+    for (cs_lnum_t i = 0; i < 3; i++) {
+      bc_coeffs_v.a[f_id*3 + i] = 0.;
+      bc_coeffs_v.af[f_id*3 + i] = 0.;
+      for (cs_lnum_t j = 0; j < 3; j++) {
+        bc_coeffs_v.b[f_id*9 + i*3 + j] = (i == j) ? 1. : 0.;
+        bc_coeffs_v.bf[f_id*9 + i*3 + j] = 0.;
+      }
+    }
+  }
+
+  /* Variables */
+
+  cs_real_t *pvar, *rhs;
+  cs_real_3_t *pvar_v, *rhs_v, *val_ip;
+  CS_MALLOC_HD(pvar, n_cells_ext, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(rhs, n_cells_ext, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(pvar_v, n_cells_ext, cs_real_3_t, cs_alloc_mode);
+  CS_MALLOC_HD(rhs_v, n_cells_ext, cs_real_3_t, cs_alloc_mode);
+  CS_MALLOC_HD(val_ip, n_b_faces, cs_real_3_t, cs_alloc_mode);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+    const cs_real_t *x = cell_cen[c_id];
+    pvar[c_id] = sin(x[0]) + cos(2.*x[1]) + x[2]*x[2];
+    pvar_v[c_id][0] = sin(x[1]);
+    pvar_v[c_id][1] = cos(x[2]);
+    pvar_v[c_id][2] = x[0]*x[1];
+    rhs[c_id] = 0.;
+    for (cs_lnum_t i = 0; i < 3; i++)
+      rhs_v[c_id][i] = 0.;
+  }
+
+  /* Convection schemes and slope test options which do not require
+     field-based keywords (NVD schemes and the beta limiter do) */
+
+  /* Hybrid (3) and NVD/TVD (4) schemes require field keywords */
+
+  const int n_schemes = 3;
+  const char *scheme_name[] = {"SOLU", "centered", "SOLU (upwind grad.)"};
+  const int n_slope_tests = 2;
+  const char *slope_test_name[] = {"slope test", "no slope test"};
+
+  char name[64];
+
+  cs_equation_param_t eqp = cs_parameters_equation_param_default();
+  eqp.iconv = 1;
+  eqp.idiff = 1;
+  eqp.blencv = 1.;
+  eqp.verbosity = 0;
+
+  cs_dispatch_context ctx;
+
+  cs_boundary_conditions_update_bc_coeff_face_values<3>
+    (ctx, nullptr, &bc_coeffs_v, 1, &eqp, pvar_v, val_ip,
+     (cs_real_3_t *)bc_coeffs_v.val_f,
+     (cs_real_3_t *)bc_coeffs_v.val_f_lim,
+     (cs_real_3_t *)bc_coeffs_v.val_f_d,
+     (cs_real_3_t *)bc_coeffs_v.val_f_d_lim);
+  ctx.wait();
+
+  for (int ischcv = 0; ischcv < n_schemes; ischcv++) {
+    for (int isstpc = 0; isstpc < n_slope_tests; isstpc++) {
+
+      eqp.ischcv = ischcv;
+      eqp.isstpc = isstpc;
+
+      /* Scalar */
+
+      std::chrono::high_resolution_clock::time_point wt0;
+      for (int run_id = -1; run_id < n_time_runs; run_id++) {
+        if (run_id == 0) {
+          _barrier();
+          wt0 = std::chrono::high_resolution_clock::now();
+        }
+        cs_convection_diffusion_scalar(0,        /* idtvar */
+                                       -1,       /* f_id */
+                                       eqp,
+                                       0,        /* icvflb */
+                                       1,        /* inc */
+                                       1,        /* imasac */
+                                       pvar,
+                                       pvar,
+                                       nullptr,  /* icvfli */
+                                       &bc_coeffs,
+                                       i_massflux,
+                                       b_massflux,
+                                       i_visc,
+                                       b_visc,
+                                       rhs,
+                                       nullptr,
+                                       nullptr);
+      }
+      _barrier();
+      snprintf(name, 63, "conv.-diff. (scalar), %s, %s",
+               scheme_name[ischcv], slope_test_name[isstpc]);
+      name[63] = '\0';
+      _log_kernel(name, n_time_runs,
+                  _fv_bytes(1+1+3+6+1, 2+3+3+3+1, 8), _elapsed(wt0));
+
+      /* Vector (fewer schemes are available) */
+
+      if (ischcv == 2)
+        continue;
+
+      for (int run_id = -1; run_id < n_time_runs; run_id++) {
+        if (run_id == 0) {
+          _barrier();
+          wt0 = std::chrono::high_resolution_clock::now();
+        }
+        cs_convection_diffusion_vector(0,        /* idtvar */
+                                       -1,       /* f_id */
+                                       eqp,
+                                       0,        /* icvflb */
+                                       1,        /* inc */
+                                       0,        /* ivisep */
+                                       1,        /* imasac */
+                                       pvar_v,
+                                       pvar_v,
+                                       nullptr,  /* icvfli */
+                                       &bc_coeffs_v,
+                                       nullptr,  /* bc_coeffs_solve_v */
+                                       i_massflux,
+                                       b_massflux,
+                                       i_visc,
+                                       b_visc,
+                                       nullptr,  /* i_secvis */
+                                       nullptr,  /* b_secvis */
+                                       nullptr,  /* i_pvar */
+                                       nullptr,  /* b_pvar */
+                                       rhs_v);
+      }
+      _barrier();
+      snprintf(name, 63, "conv.-diff. (vector), %s, %s",
+               scheme_name[ischcv], slope_test_name[isstpc]);
+      name[63] = '\0';
+      _log_kernel(name, n_time_runs,
+                  _fv_bytes(3+3+9+6+3, 2+3+3+3+1, 8+6), _elapsed(wt0));
+    }
+  }
+
+  CS_FREE_HD(val_ip);
+  CS_FREE_HD(rhs_v);
+  CS_FREE_HD(pvar_v);
+  CS_FREE_HD(rhs);
+  CS_FREE_HD(pvar);
+
+  CS_FREE_HD(bc_coeffs_v.val_f_d_lim);
+  CS_FREE_HD(bc_coeffs_v.val_f_d);
+  CS_FREE_HD(bc_coeffs_v.val_f_lim);
+  CS_FREE_HD(bc_coeffs_v.val_f);
+  CS_FREE_HD(bc_coeffs_v.bf);
+  CS_FREE_HD(bc_coeffs_v.af);
+  CS_FREE_HD(bc_coeffs_v.b);
+  CS_FREE_HD(bc_coeffs_v.a);
+
+  CS_FREE_HD(bc_coeffs.bf);
+  CS_FREE_HD(bc_coeffs.af);
+  CS_FREE_HD(bc_coeffs.b);
+  CS_FREE_HD(bc_coeffs.a);
+
+  CS_FREE_HD(b_visc);
+  CS_FREE_HD(b_massflux);
+  CS_FREE_HD(i_visc);
+  CS_FREE_HD(i_massflux);
+}
+
+/*----------------------------------------------------------------------------
+ * Time halo synchronization for standard and extended halos,
+ * with several strides, using the current communication mode.
+ *
+ * parameters:
+ *   n_time_runs <-- number of timing runs
+ *----------------------------------------------------------------------------*/
+
+static void
+_halo_test(int  n_time_runs)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_halo_t *halo = m->halo;
+
+  if (halo == nullptr)
+    return;
+
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+
+  const int n_strides = 3;
+  const int strides[] = {1, 3, 6};
+  const char *sync_mode_name[] = {"standard", "extended"};
+
+  const char *comm_mode_name
+    = (cs_halo_get_comm_mode() == CS_HALO_COMM_RMA_GET) ?
+      "RMA get" : "P2P";
+
+  cs_real_t *val;
+  CS_MALLOC_HD(val, n_cells_ext*6, cs_real_t, cs_alloc_mode);
+  for (cs_lnum_t i = 0; i < n_cells_ext*6; i++)
+    val[i] = i;
+
+  char name[64];
+
+  int n_sync_modes = (m->halo_type == CS_HALO_EXTENDED) ? 2 : 1;
+
+  for (int sync_mode = 0; sync_mode < n_sync_modes; sync_mode++) {
+    for (int s_id = 0; s_id < n_strides; s_id++) {
+
+      const int stride = strides[s_id];
+
+      /* Packing, send, receive (cell values to ghost values) */
+
+      double bytes = 3. * (double)halo->n_send_elts[sync_mode]
+                        * stride * sizeof(cs_real_t);
+
+      std::chrono::high_resolution_clock::time_point wt0;
+      for (int run_id = -1; run_id < n_time_runs; run_id++) {
+        if (run_id == 0) {
+          _barrier();
+          wt0 = std::chrono::high_resolution_clock::now();
+        }
+        cs_halo_sync(halo,
+                     (cs_halo_type_t)sync_mode,
+                     CS_REAL_TYPE,
+                     stride,
+                     val);
+      }
+      _barrier();
+      snprintf(name, 63, "halo sync (%s), %s, stride %d",
+               comm_mode_name, sync_mode_name[sync_mode], stride);
+      name[63] = '\0';
+      _log_kernel(name, n_time_runs, bytes, _elapsed(wt0));
+    }
+  }
+
+  CS_FREE_HD(val);
+}
+
+/*----------------------------------------------------------------------------
+ * Time multigrid setup and solution for a Poisson operator
+ * (two-point flux approximation, homogeneous Dirichlet conditions
+ * on all boundary faces).
+ *
+ * parameters:
+ *   n_time_runs <-- number of timing runs
+ *----------------------------------------------------------------------------*/
+
+static void
+_multigrid_test(int  n_time_runs)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+  const cs_lnum_2_t *i_face_cells = m->i_face_cells;
+  const cs_lnum_t *b_face_cells = m->b_face_cells;
+
+  /* Build matrix coefficients */
+
+  cs_real_t *da, *xa, *rhs, *vx;
+  CS_MALLOC_HD(da, n_cells_ext, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(xa, n_i_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(rhs, n_cells_ext, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(vx, n_cells_ext, cs_real_t, cs_alloc_mode);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+    da[c_id] = 0.;
+    rhs[c_id] = mq->cell_vol[c_id];
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    cs_real_t c = mq->i_face_surf[f_id] / mq->i_dist[f_id];
+    xa[f_id] = -c;
+    da[i_face_cells[f_id][0]] += c;
+    da[i_face_cells[f_id][1]] += c;
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++)
+    da[b_face_cells[f_id]] += mq->b_face_surf[f_id] / mq->b_dist[f_id];
+
+  cs_matrix_t *a = cs_matrix_default(true, 1, 1);
+
+  cs_matrix_set_coefficients(a, true, 1, 1,
+                             n_i_faces, i_face_cells, da, xa);
+
+  if (ma->cell_i_faces == nullptr)
+    cs_mesh_adjacencies_update_cell_i_faces();
+
+  cs_matrix_set_mesh_association(a,
+                                 ma->cell_cells_idx,
+                                 ma->cell_i_faces,
+                                 ma->cell_i_faces_sgn,
+                                 mq->cell_cen,
+                                 mq->cell_vol,
+                                 mq->i_face_u_normal,
+                                 mq->i_face_surf);
+
+  /* Use a reduced number of runs, as each run is a full solve */
+
+  const int n_runs = cs::max(n_time_runs / 10, 1);
+  const double precision = 1.e-8;
+
+  double r_norm = 0.;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    r_norm += rhs[c_id]*rhs[c_id];
+  cs_parall_sum(1, CS_DOUBLE, &r_norm);
+  r_norm = sqrt(r_norm);
+
+  double wt_setup = 0., wt_solve = 0.;
+  int n_iter_tot = 0;
+
+  for (int run_id = 0; run_id < n_runs; run_id++) {
+
+    cs_multigrid_t *mg = cs_multigrid_create(CS_MULTIGRID_V_CYCLE);
+
+    _barrier();
+    std::chrono::high_resolution_clock::time_point
+      wt0 = std::chrono::high_resolution_clock::now();
+
+    cs_multigrid_setup(mg, "benchmark_poisson", a, 0);
+
+    _barrier();
+    wt_setup += _elapsed(wt0);
+
+    for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+      vx[c_id] = 0.;
+
+    int n_iter = 0;
+    double residual = 0.;
+
+    _barrier();
+    wt0 = std::chrono::high_resolution_clock::now();
+
+    cs_multigrid_solve(mg, "benchmark_poisson", a, 0,
+                       precision, r_norm,
+                       &n_iter, &residual,
+                       rhs, nullptr, vx,
+                       0, nullptr);
+
+    _barrier();
+    wt_solve += _elapsed(wt0);
+
+    n_iter_tot += n_iter;
+
+    cs_multigrid_free(mg);
+    cs_multigrid_destroy((void **)&mg);
+  }
+
+  /* Traffic estimates based on fine-grid matrix accesses only:
+     setup reads the matrix and mesh association data a few times,
+     while each cycle is counted as 4 fine-grid matrix-vector products
+     (pre and post smoothing, residual, and correction) */
+
+  double spmv_bytes
+    =   (double)n_i_faces * (2*sizeof(cs_lnum_t) + sizeof(cs_real_t))
+      + (double)n_cells_ext * 3 * sizeof(cs_real_t);
+
+  _log_kernel("multigrid setup (Poisson)", n_runs, 3.*spmv_bytes, wt_setup);
+
+  char name[64];
+  snprintf(name, 63, "multigrid solve (Poisson, %d it.)",
+           n_iter_tot / n_runs);
+  name[63] = '\0';
+  _log_kernel(name, n_runs,
+              4. * spmv_bytes * n_iter_tot / n_runs, wt_solve);
+
+  cs_matrix_release_coefficients(a);
+
+  CS_FREE_HD(vx);
+  CS_FREE_HD(rhs);
+  CS_FREE_HD(xa);
+  CS_FREE_HD(da);
+}
+
+/*----------------------------------------------------------------------------
+ * Time particle tracking through the local mesh.
+ *
+ * Synthetic particles start at cell centers, with a pseudo-random
+ * displacement of a few cell sizes, and are tracked face by face
+ * (crossing of planes through the face centers) until their displacement
+ * is complete or they reach a boundary or parallel/periodic ghost cell.
+ * This reproduces the memory access pattern of the Lagrangian module's
+ * trajectory tracking, without the particle data structures and
+ * boundary interactions.
+ *
+ * parameters:
+ *   n_time_runs <-- number of timing runs
+ *----------------------------------------------------------------------------*/
+
+static void
+_particle_tracking_test(int  n_time_runs)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_2_t *i_face_cells = m->i_face_cells;
+
+  if (ma->cell_i_faces == nullptr)
+    cs_mesh_adjacencies_update_cell_i_faces();
+
+  const cs_lnum_t *c2c_idx = ma->cell_cells_idx;
+  const cs_lnum_t *c2i = ma->cell_i_faces;
+  const short int *c2i_sgn = ma->cell_i_faces_sgn;
+  const cs_lnum_t *c2b_idx = ma->cell_b_faces_idx;
+  const cs_lnum_t *c2b = ma->cell_b_faces;
+
+  const cs_real_3_t *cell_cen = mq->cell_cen;
+  const cs_real_t *cell_vol = mq->cell_vol;
+  const cs_nreal_3_t *i_face_u_normal = mq->i_face_u_normal;
+  const cs_nreal_3_t *b_face_u_normal = mq->b_face_u_normal;
+  const cs_real_3_t *i_face_cog = mq->i_face_cog;
+  const cs_real_3_t *b_face_cog = mq->b_face_cog;
+
+  const int max_steps = 100;
+
+  /* Displacements */
+
+  cs_real_3_t *disp;
+  CS_MALLOC(disp, n_cells, cs_real_3_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    /* Simple deterministic hash for reproducible directions */
+    unsigned int h = (unsigned int)c_id * 2654435761u;
+    cs_real_t theta = (h % 3600) * (cs_math_pi / 1800.);
+    cs_real_t phi = ((h / 3600) % 1800) * (cs_math_pi / 1800.);
+    cs_real_t l = 3. * cbrt(cell_vol[c_id]);
+    disp[c_id][0] = l * sin(phi) * cos(theta);
+    disp[c_id][1] = l * sin(phi) * sin(theta);
+    disp[c_id][2] = l * cos(phi);
+  }
+
+  cs_gnum_t n_faces_visited = 0;
+
+  std::chrono::high_resolution_clock::time_point wt0;
+  for (int run_id = -1; run_id < n_time_runs; run_id++) {
+
+    if (run_id == 0) {
+      _barrier();
+      wt0 = std::chrono::high_resolution_clock::now();
+    }
+
+    cs_gnum_t n_visited = 0;
+
+    #pragma omp parallel for reduction(+:n_visited) \
+      if (n_cells > CS_THR_MIN) schedule(dynamic, 256)
+    for (cs_lnum_t p_id = 0; p_id < n_cells; p_id++) {
+
+      cs_lnum_t c_id = p_id;
+      cs_real_t p[3], e[3];
+      for (int k = 0; k < 3; k++) {
+        p[k] = cell_cen[c_id][k];
+        e[k] = p[k] + disp[p_id][k];
+      }
+
+      for (int step = 0; step < max_steps; step++) {
+
+        cs_real_t d[3] = {e[0]-p[0], e[1]-p[1], e[2]-p[2]};
+        cs_real_t t_min = 1.;
+        cs_lnum_t c_next = -1;
+        bool exit_found = false;
+
+        /* Interior faces */
+
+        for (cs_lnum_t i = c2c_idx[c_id]; i < c2c_idx[c_id+1]; i++) {
+          const cs_lnum_t f_id = c2i[i];
+          const cs_real_t sgn = c2i_sgn[i];
+          const cs_nreal_t *n = i_face_u_normal[f_id];
+          cs_real_t den = sgn * cs_math_3_dot_product(n, d);
+          if (den > 0.) {
+            cs_real_t num = sgn * (  n[0]*(i_face_cog[f_id][0] - p[0])
+                                   + n[1]*(i_face_cog[f_id][1] - p[1])
+                                   + n[2]*(i_face_cog[f_id][2] - p[2]));
+            cs_real_t t = num / den;
+            if (t < t_min) {
+              t_min = cs::max(t, 0.);
+              exit_found = true;
+              c_next = (i_face_cells[f_id][0] == c_id) ?
+                i_face_cells[f_id][1] : i_face_cells[f_id][0];
+            }
+          }
+        }
+        n_visited += c2c_idx[c_id+1] - c2c_idx[c_id];
+
+        /* Boundary faces */
+
+        for (cs_lnum_t i = c2b_idx[c_id]; i < c2b_idx[c_id+1]; i++) {
+          const cs_lnum_t f_id = c2b[i];
+          const cs_nreal_t *n = b_face_u_normal[f_id];
+          cs_real_t den = cs_math_3_dot_product(n, d);
+          if (den > 0.) {
+            cs_real_t num = (  n[0]*(b_face_cog[f_id][0] - p[0])
+                             + n[1]*(b_face_cog[f_id][1] - p[1])
+                             + n[2]*(b_face_cog[f_id][2] - p[2]));
+            cs_real_t t = num / den;
+            if (t < t_min) {
+              t_min = cs::max(t, 0.);
+              exit_found = true;
+              c_next = -1;
+            }
+          }
+        }
+        n_visited += c2b_idx[c_id+1] - c2b_idx[c_id];
+
+        /* Displacement complete, boundary, or ghost cell reached */
+
+        if (exit_found == false || c_next < 0 || c_next >= n_cells)
+          break;
+
+        for (int k = 0; k < 3; k++)
+          p[k] += t_min * d[k];
+        c_id = c_next;
+      }
+    }
+
+    if (run_id == 0)
+      n_faces_visited = n_visited;
+  }
+
+  _barrier();
+  double wt = _elapsed(wt0);
+
+  /* Per visited face: id, sign or cell ids, normal and center */
+
+  double bytes = (double)n_faces_visited
+                 * (2*sizeof(cs_lnum_t) + 6*sizeof(cs_real_t));
+
+  _log_kernel("particle tracking (1 particle/cell)", n_time_runs, bytes, wt);
+
+  CS_FREE(disp);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Time finite volume operators and other hot kernels on the current mesh.
+ *
+ * For each kernel, the wall-clock time per call, the estimated memory
+ * bandwidth, and the fraction of the measured STREAM triad bandwidth
+ * are logged to the performance log.
+ *
+ * parameters:
+ *   n_time_runs <-- number of timing runs for each measure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_benchmark_kernels(int  n_time_runs)
+{
+  /* Timers are started at the first timed run, so at least one is needed */
+
+  n_time_runs = cs::max(n_time_runs, 1);
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "\n"
+                "Timing for finite volume operators and other kernels\n"
+                "====================================================\n"
+                "\n"
+                "  Bandwidths are based on estimated minimal memory traffic,\n"
+                "  summed over all ranks; times are maxima over ranks.\n");
+
+  _log_section("Reference bandwidth");
+
+  _stream_triad(n_time_runs);
+
+  /* Some operators use legacy boundary condition types and
+     field pointers, which are not yet defined in benchmark mode */
+
+  cs_field_pointer_ensure_init();
+
+  bool bc_type_owner = false;
+  if (cs_glob_bc_type == nullptr) {
+    cs_boundary_conditions_create();
+    bc_type_owner = true;
+  }
+
+  cs_gradient_initialize();
+
+  _log_section("Gradient reconstruction");
+
+  _gradient_test(n_time_runs);
+
+  _log_section("Convection-diffusion balance");
+
+  _convection_diffusion_test(n_time_runs);
+
+  if (cs_glob_mesh->halo != nullptr) {
+    _log_section("Halo synchronization");
+    _halo_test(n_time_runs);
+  }
+
+  _log_section("Linear solvers");
+
+  _multigrid_test(n_time_runs);
+
+  _log_section("Particle tracking");
+
+  _particle_tracking_test(n_time_runs);
+
+  cs_gradient_finalize();
+
+  if (bc_type_owner)
+    cs_boundary_conditions_free();
+
+  cs_log_printf_flush(CS_LOG_PERFORMANCE);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
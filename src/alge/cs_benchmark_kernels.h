@@ -0,0 +1,74 @@
+#ifndef __CS_BENCHMARK_KERNELS_H__
+#define __CS_BENCHMARK_KERNELS_H__
+
+/*============================================================================
+ * Benchmarking of finite volume operators and other hot kernels
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2025 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "base/cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*============================================================================
+ *  Global variables
+ *============================================================================*/
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Time finite volume operators and other hot kernels on the current mesh.
+ *
+ * For each kernel, the wall-clock time per call, the estimated memory
+ * bandwidth, and the fraction of the measured STREAM triad bandwidth
+ * are logged to the performance log.
+ *
+ * parameters:
+ *   n_time_runs <-- number of timing runs for each measure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_benchmark_kernels(int  n_time_runs);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_BENCHMARK_KERNELS_H__ */
@@ -109,6 +109,15 @@
  * Local type definitions
  *============================================================================*/
 
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Handles to optional porosity fields */
+
+static cs_field_handle_t  _h_poro = CS_FIELD_HANDLE("porosity");
+static cs_field_handle_t  _h_t_poro = CS_FIELD_HANDLE("tensorial_porosity");
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -235,8 +244,8 @@ _beta_limiter_denom(cs_field_t                 *f,
   }
 
   cs_real_t *df_limiter = nullptr;
-  int df_limiter_id =
-    cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+  static const int kdflim = cs_field_key_id("diffusion_limiter_id");
+  int df_limiter_id = cs_field_get_key_int(f, kdflim);
   if (df_limiter_id > -1)
     df_limiter = cs_field_by_id(df_limiter_id)->val;
 
@@ -1414,8 +1423,8 @@ _convection_diffusion_scalar_steady(const cs_field_t           *f,
   if (f_id != -1) {
     f = cs_field_by_id(f_id);
 
-    int df_limiter_id =
-      cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+    static const int kdflim = cs_field_key_id("diffusion_limiter_id");
+    int df_limiter_id = cs_field_get_key_int(f, kdflim);
     if (df_limiter_id > -1)
       df_limiter = cs_field_by_id(df_limiter_id)->val;
 
@@ -1447,7 +1456,7 @@ _convection_diffusion_scalar_steady(const cs_field_t           *f,
 
   if (icoupl > 0) {
     assert(f_id != -1);
-    const int coupling_key_id = cs_field_key_id("coupling_entity");
+    static const int coupling_key_id = cs_field_key_id("coupling_entity");
     coupling_id = cs_field_get_key_int(f, coupling_key_id);
     cpl = cs_internal_coupling_by_id(coupling_id);
     cs_internal_coupling_coupled_faces(cpl,
@@ -2292,8 +2301,8 @@ _face_convection_scalar_steady(const cs_field_t           *f,
                                     local_min);
     }
 
-    int df_limiter_id =
-      cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+    static const int kdflim = cs_field_key_id("diffusion_limiter_id");
+    int df_limiter_id = cs_field_get_key_int(f, kdflim);
     if (df_limiter_id > -1)
       df_limiter = cs_field_by_id(df_limiter_id)->val;
 
@@ -2325,7 +2334,7 @@ _face_convection_scalar_steady(const cs_field_t           *f,
 
   if (icoupl > 0) {
     assert(f_id != -1);
-    const int coupling_key_id = cs_field_key_id("coupling_entity");
+    static const int coupling_key_id = cs_field_key_id("coupling_entity");
     coupling_id = cs_field_get_key_int(f, coupling_key_id);
     cpl = cs_internal_coupling_by_id(coupling_id);
   }
@@ -3026,8 +3035,8 @@ _convection_diffusion_scalar_unsteady
     if (cv_limiter_id > -1)
       cv_limiter = cs_field_by_id(cv_limiter_id)->val;
 
-    int df_limiter_id =
-      cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+    static const int kdflim = cs_field_key_id("diffusion_limiter_id");
+    int df_limiter_id = cs_field_get_key_int(f, kdflim);
     if (df_limiter_id > -1)
       df_limiter = cs_field_by_id(df_limiter_id)->val;
 
@@ -3057,7 +3066,7 @@ _convection_diffusion_scalar_unsteady
 
   if (icoupl > 0) {
     assert(f_id != -1);
-    const int coupling_key_id = cs_field_key_id("coupling_entity");
+    static const int coupling_key_id = cs_field_key_id("coupling_entity");
     coupling_id = cs_field_get_key_int(f, coupling_key_id);
     cpl = cs_internal_coupling_by_id(coupling_id);
     cs_internal_coupling_coupled_faces(cpl,
@@ -4191,8 +4200,8 @@ _face_convection_scalar_unsteady(const cs_field_t           *f,
     if (cv_limiter_id > -1)
       cv_limiter = cs_field_by_id(cv_limiter_id)->val;
 
-    int df_limiter_id =
-      cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+    static const int kdflim = cs_field_key_id("diffusion_limiter_id");
+    int df_limiter_id = cs_field_get_key_int(f, kdflim);
     if (df_limiter_id > -1)
       df_limiter = cs_field_by_id(df_limiter_id)->val;
 
@@ -4224,7 +4233,7 @@ _face_convection_scalar_unsteady(const cs_field_t           *f,
 
   if (icoupl > 0) {
     assert(f_id != -1);
-    const int coupling_key_id = cs_field_key_id("coupling_entity");
+    static const int coupling_key_id = cs_field_key_id("coupling_entity");
     coupling_id = cs_field_get_key_int(f, coupling_key_id);
     cpl = cs_internal_coupling_by_id(coupling_id);
   }
@@ -5008,8 +5017,8 @@ _convection_diffusion_vector_steady(cs_field_t                 *f,
   /* Flux limiter */
   cs_real_t *df_limiter = nullptr;
   if (f != nullptr) {
-    int df_limiter_id
-      = cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+    static const int kdflim = cs_field_key_id("diffusion_limiter_id");
+    int df_limiter_id = cs_field_get_key_int(f, kdflim);
     if (df_limiter_id > -1)
       df_limiter = cs_field_by_id(df_limiter_id)->val;
   }
@@ -5744,8 +5753,8 @@ _convection_diffusion_tensor_steady
   /* Flux limiter */
   cs_real_t *df_limiter = nullptr;
   if (f != nullptr) {
-    int df_limiter_id
-      = cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+    static const int kdflim = cs_field_key_id("diffusion_limiter_id");
+    int df_limiter_id = cs_field_get_key_int(f, kdflim);
     if (df_limiter_id > -1)
       df_limiter = cs_field_by_id(df_limiter_id)->val;
   }
@@ -6322,8 +6331,8 @@ _convection_diffusion_unsteady_strided
   cs_real_t *df_limiter = nullptr;
 
   if (f != nullptr) {
-    int df_limiter_id
-      = cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+    static const int kdflim = cs_field_key_id("diffusion_limiter_id");
+    int df_limiter_id = cs_field_get_key_int(f, kdflim);
     if (df_limiter_id > -1)
       df_limiter = cs_field_by_id(df_limiter_id)->val;
   }
@@ -8332,8 +8341,8 @@ cs_anisotropic_diffusion_scalar(int                         idtvar,
   if (f_id != -1) {
     f = cs_field_by_id(f_id);
 
-    int df_limiter_id =
-      cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+    static const int kdflim = cs_field_key_id("diffusion_limiter_id");
+    int df_limiter_id = cs_field_get_key_int(f, kdflim);
     if (df_limiter_id > -1)
       df_limiter = cs_field_by_id(df_limiter_id)->val;
 
@@ -8344,8 +8353,8 @@ cs_anisotropic_diffusion_scalar(int                         idtvar,
   var_name[63] = '\0';
 
   /* Porosity fields */
-  cs_field_t *fporo = cs_field_by_name_try("porosity");
-  cs_field_t *ftporo = cs_field_by_name_try("tensorial_porosity");
+  cs_field_t *fporo = cs_field_by_handle_try(&_h_poro);
+  cs_field_t *ftporo = cs_field_by_handle_try(&_h_t_poro);
 
   cs_real_t *porosi = nullptr;
   cs_real_6_t *porosf = nullptr;
@@ -8393,7 +8402,7 @@ cs_anisotropic_diffusion_scalar(int                         idtvar,
 
   if (icoupl > 0) {
     assert(f_id != -1);
-    const int coupling_key_id = cs_field_key_id("coupling_entity");
+    static const int coupling_key_id = cs_field_key_id("coupling_entity");
     coupling_id = cs_field_get_key_int(f, coupling_key_id);
     cpl = cs_internal_coupling_by_id(coupling_id);
     cs_internal_coupling_coupled_faces(cpl,
@@ -9049,8 +9058,8 @@ cs_anisotropic_left_diffusion_vector
   if (f_id != -1) {
     f = cs_field_by_id(f_id);
 
-    int df_limiter_id =
-      cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+    static const int kdflim = cs_field_key_id("diffusion_limiter_id");
+    int df_limiter_id = cs_field_get_key_int(f, kdflim);
     if (df_limiter_id > -1)
       df_limiter = cs_field_by_id(df_limiter_id)->val;
 
@@ -9062,7 +9071,7 @@ cs_anisotropic_left_diffusion_vector
 
   if (icoupl > 0) {
     assert(f_id != -1);
-    const int coupling_key_id = cs_field_key_id("coupling_entity");
+    static const int coupling_key_id = cs_field_key_id("coupling_entity");
     coupling_id = cs_field_get_key_int(f, coupling_key_id);
     cpl = cs_internal_coupling_by_id(coupling_id);
     cs_internal_coupling_coupled_faces(cpl,
@@ -9562,8 +9571,8 @@ cs_anisotropic_right_diffusion_vector
   if (f_id != -1) {
     f = cs_field_by_id(f_id);
 
-    int df_limiter_id =
-      cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+    static const int kdflim = cs_field_key_id("diffusion_limiter_id");
+    int df_limiter_id = cs_field_get_key_int(f, kdflim);
     if (df_limiter_id > -1)
       df_limiter = cs_field_by_id(df_limiter_id)->val;
 
@@ -9577,7 +9586,7 @@ cs_anisotropic_right_diffusion_vector
 
   if (icoupl > 0) {
     assert(f_id != -1);
-    const int coupling_key_id = cs_field_key_id("coupling_entity");
+    static const int coupling_key_id = cs_field_key_id("coupling_entity");
     coupling_id = cs_field_get_key_int(f, coupling_key_id);
     cpl = cs_internal_coupling_by_id(coupling_id);
     cs_internal_coupling_coupled_faces(cpl,
@@ -10247,8 +10256,8 @@ cs_anisotropic_diffusion_tensor(int                          idtvar,
   if (f_id != -1) {
     f = cs_field_by_id(f_id);
 
-    int df_limiter_id
-      = cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+    static const int kdflim = cs_field_key_id("diffusion_limiter_id");
+    int df_limiter_id = cs_field_get_key_int(f, kdflim);
     if (df_limiter_id > -1)
       df_limiter = cs_field_by_id(df_limiter_id)->val;
 
@@ -10259,8 +10268,8 @@ cs_anisotropic_diffusion_tensor(int                          idtvar,
   var_name[63] = '\0';
 
   /* Porosity fields */
-  cs_field_t *fporo = cs_field_by_name_try("porosity");
-  cs_field_t *ftporo = cs_field_by_name_try("tensorial_porosity");
+  cs_field_t *fporo = cs_field_by_handle_try(&_h_poro);
+  cs_field_t *ftporo = cs_field_by_handle_try(&_h_t_poro);
 
   cs_real_t *porosi = nullptr;
   cs_real_6_t *porosf = nullptr;
@@ -11137,8 +11146,8 @@ cs_face_anisotropic_diffusion_potential(const int                   f_id,
   if (f_id > -1) {
     f = cs_field_by_id(f_id);
 
-    int df_limiter_id =
-      cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+    static const int kdflim = cs_field_key_id("diffusion_limiter_id");
+    int df_limiter_id = cs_field_get_key_int(f, kdflim);
     if (df_limiter_id > -1)
       df_limiter = cs_field_by_id(df_limiter_id)->val;
 
@@ -11149,8 +11158,8 @@ cs_face_anisotropic_diffusion_potential(const int                   f_id,
   var_name[63] = '\0';
 
   /* Porosity fields */
-  cs_field_t *fporo = cs_field_by_name_try("porosity");
-  cs_field_t *ftporo = cs_field_by_name_try("tensorial_porosity");
+  cs_field_t *fporo = cs_field_by_handle_try(&_h_poro);
+  cs_field_t *ftporo = cs_field_by_handle_try(&_h_t_poro);
 
   cs_real_t *porosi = nullptr;
   cs_real_6_t *porosf = nullptr;
@@ -11877,8 +11886,8 @@ cs_anisotropic_diffusion_potential(const int                   f_id,
   if (f_id != -1) {
     f = cs_field_by_id(f_id);
 
-    int df_limiter_id
-      = cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+    static const int kdflim = cs_field_key_id("diffusion_limiter_id");
+    int df_limiter_id = cs_field_get_key_int(f, kdflim);
     if (df_limiter_id > -1)
       df_limiter = cs_field_by_id(df_limiter_id)->val;
 
@@ -11890,8 +11899,8 @@ cs_anisotropic_diffusion_potential(const int                   f_id,
   var_name[63] = '\0';
 
   /* Porosity fields */
-  cs_field_t *fporo = cs_field_by_name_try("porosity");
-  cs_field_t *ftporo = cs_field_by_name_try("tensorial_porosity");
+  cs_field_t *fporo = cs_field_by_handle_try(&_h_poro);
+  cs_field_t *ftporo = cs_field_by_handle_try(&_h_t_poro);
 
   cs_real_t *porosi = nullptr;
   cs_real_6_t *porosf = nullptr;
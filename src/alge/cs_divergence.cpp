@@ -81,6 +81,15 @@ BEGIN_C_DECLS
  * Local type definitions
  *============================================================================*/
 
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Handles to optional porosity fields */
+
+static cs_field_handle_t  _h_poro = CS_FIELD_HANDLE("porosity");
+static cs_field_handle_t  _h_t_poro = CS_FIELD_HANDLE("tensorial_porosity");
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -284,8 +293,8 @@ cs_mass_flux(const cs_mesh_t             *m,
   }
 
   /* Porosity fields */
-  cs_field_t *fporo = cs_field_by_name_try("porosity");
-  cs_field_t *ftporo = cs_field_by_name_try("tensorial_porosity");
+  cs_field_t *fporo = cs_field_by_handle_try(&_h_poro);
+  cs_field_t *ftporo = cs_field_by_handle_try(&_h_t_poro);
 
   cs_real_t *porosi = nullptr;
   cs_real_6_t *porosf = nullptr;
@@ -790,8 +799,8 @@ cs_tensor_face_flux(const cs_mesh_t             *m,
   }
 
   /* Porosity fields */
-  cs_field_t *fporo = cs_field_by_name_try("porosity");
-  cs_field_t *ftporo = cs_field_by_name_try("tensorial_porosity");
+  cs_field_t *fporo = cs_field_by_handle_try(&_h_poro);
+  cs_field_t *ftporo = cs_field_by_handle_try(&_h_t_poro);
 
   cs_real_t *porosi = nullptr;
   cs_real_6_t *porosf = nullptr;
@@ -1611,8 +1620,8 @@ cs_ext_force_anisotropic_flux(const cs_mesh_t          *m,
   const cs_real_3_t *restrict i_face_cog = fvq->i_face_cog;
 
   /* Porosity fields */
-  cs_field_t *fporo = cs_field_by_name_try("porosity");
-  cs_field_t *ftporo = cs_field_by_name_try("tensorial_porosity");
+  cs_field_t *fporo = cs_field_by_handle_try(&_h_poro);
+  cs_field_t *ftporo = cs_field_by_handle_try(&_h_t_poro);
 
   cs_real_t *porosi = nullptr;
   cs_real_6_t *porosf = nullptr;
@@ -96,6 +96,15 @@ BEGIN_C_DECLS
  * Local type definitions
  *============================================================================*/
 
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Handles to optional porosity fields */
+
+static cs_field_handle_t  _h_poro = CS_FIELD_HANDLE("porosity");
+static cs_field_handle_t  _h_t_poro = CS_FIELD_HANDLE("tensorial_porosity");
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -349,7 +358,7 @@ cs_face_viscosity(const cs_mesh_t               *m,
 #endif
 
   /* Porosity field */
-  cs_field_t *fporo = cs_field_by_name_try("porosity");
+  cs_field_t *fporo = cs_field_by_handle_try(&_h_poro);
 
   cs_real_t *porosi = nullptr;
 
@@ -523,8 +532,8 @@ cs_face_anisotropic_viscosity_vector(const cs_mesh_t             *m,
   cs_real_6_t *w2 = nullptr;
 
   /* Porosity fields */
-  cs_field_t *fporo = cs_field_by_name_try("porosity");
-  cs_field_t *ftporo = cs_field_by_name_try("tensorial_porosity");
+  cs_field_t *fporo = cs_field_by_handle_try(&_h_poro);
+  cs_field_t *ftporo = cs_field_by_handle_try(&_h_t_poro);
 
   cs_real_t *porosi = nullptr;
   cs_real_6_t *porosf = nullptr;
@@ -774,8 +783,8 @@ cs_face_anisotropic_viscosity_scalar(const cs_mesh_t               *m,
   cs_real_6_t *w2 = nullptr;
 
   /* Porosity fields */
-  cs_field_t *fporo = cs_field_by_name_try("porosity");
-  cs_field_t *ftporo = cs_field_by_name_try("tensorial_porosity");
+  cs_field_t *fporo = cs_field_by_handle_try(&_h_poro);
+  cs_field_t *ftporo = cs_field_by_handle_try(&_h_t_poro);
 
   cs_real_t *porosi = nullptr;
   cs_real_6_t *porosf = nullptr;
@@ -58,6 +58,7 @@
 #include "alge/cs_blas.h"
 #include "base/cs_boundary_conditions.h"
 #include "alge/cs_cell_to_vertex.h"
+#include "base/cs_comm_profile.h"
 #include "base/cs_dispatch.h"
 #include "base/cs_ext_neighborhood.h"
 #include "base/cs_field.h"
@@ -73,6 +74,7 @@
 #include "mesh/cs_mesh_adjacencies.h"
 #include "mesh/cs_mesh_quantities.h"
 #include "base/cs_parall.h"
+#include "base/cs_perf_report.h"
 #include "base/cs_porous_model.h"
 #include "base/cs_prototypes.h"
 #include "base/cs_timer.h"
@@ -186,6 +188,14 @@ static int _gradient_stat_id = -1;
 static int                        _n_gradient_quantities = 0;
 static cs_gradient_quantities_t  *_gradient_quantities = nullptr;
 
+/* Handles to optional porosity-related fields */
+
+static cs_field_handle_t  _h_i_poro_duq_0 = CS_FIELD_HANDLE("i_poro_duq_0");
+static cs_field_handle_t  _h_i_poro_duq_1 = CS_FIELD_HANDLE("i_poro_duq_1");
+static cs_field_handle_t  _h_b_poro_duq = CS_FIELD_HANDLE("b_poro_duq");
+static cs_field_handle_t  _h_b_poro_duq_0 = CS_FIELD_HANDLE("b_poro_duq_0");
+static cs_field_handle_t  _h_poro_div_duq = CS_FIELD_HANDLE("poro_div_duq");
+
 /*! Block size for loops on sub-blocks (use size 1 on GPU, as
   threads are already grouped by blocks in that case) */
 
@@ -420,6 +430,21 @@ _gradient_info_dump(cs_gradient_info_t *this_info)
   cs_log_printf(CS_LOG_PERFORMANCE,
                 _("  Total elapsed time:    %.3f\n"),
                 this_info->t_tot.nsec*1e-9);
+
+  /* Add to performance report */
+
+  char name[128];
+  snprintf(name, 127, "%s [%s]",
+           this_info->name, cs_gradient_type_name[this_info->type]);
+  name[127] = '\0';
+
+  const char *keys[] = {"n_calls", "n_iterations", "max_iterations",
+                        "wall_time"};
+  double vals[] = {(double)n_calls,
+                   (double)this_info->n_iter_tot,
+                   (double)this_info->n_iter_max,
+                   this_info->t_tot.nsec*1e-9};
+  cs_perf_report_add("gradients", name, 4, keys, vals);
 }
 
 /*----------------------------------------------------------------------------
@@ -1081,7 +1106,7 @@ _initialize_scalar_gradient(const cs_mesh_t                *m,
   cs_dispatch_sum_type_t b_sum_type = ctx.get_parallel_for_b_faces_sum_type(m);
 
   /* Additional terms due to porosity */
-  cs_field_t *f_i_poro_duq_0 = cs_field_by_name_try("i_poro_duq_0");
+  cs_field_t *f_i_poro_duq_0 = cs_field_by_handle_try(&_h_i_poro_duq_0);
 
   cs_real_t *i_poro_duq_0;
   cs_real_t *i_poro_duq_1;
@@ -1092,8 +1117,8 @@ _initialize_scalar_gradient(const cs_mesh_t                *m,
   if (f_i_poro_duq_0 != nullptr) {
     is_porous = 1;
     i_poro_duq_0 = f_i_poro_duq_0->val;
-    i_poro_duq_1 = cs_field_by_name("i_poro_duq_1")->val;
-    b_poro_duq = cs_field_by_name("b_poro_duq")->val;
+    i_poro_duq_1 = cs_field_by_handle(&_h_i_poro_duq_1)->val;
+    b_poro_duq = cs_field_by_handle(&_h_b_poro_duq)->val;
   }
   else {
     i_poro_duq_0 = &_f_ext;
@@ -1713,7 +1738,7 @@ _iterative_scalar_gradient(const cs_mesh_t                *m,
   cs_dispatch_sum_type_t b_sum_type = ctx.get_parallel_for_b_faces_sum_type(m);
 
   /*Additional terms due to porosity */
-  cs_field_t *f_i_poro_duq_0 = cs_field_by_name_try("i_poro_duq_0");
+  cs_field_t *f_i_poro_duq_0 = cs_field_by_handle_try(&_h_i_poro_duq_0);
 
   cs_real_t *i_poro_duq_0;
   cs_real_t *i_poro_duq_1;
@@ -1724,8 +1749,8 @@ _iterative_scalar_gradient(const cs_mesh_t                *m,
   if (f_i_poro_duq_0 != nullptr) {
     is_porous = 1;
     i_poro_duq_0 = f_i_poro_duq_0->val;
-    i_poro_duq_1 = cs_field_by_name("i_poro_duq_1")->val;
-    b_poro_duq = cs_field_by_name("b_poro_duq")->val;
+    i_poro_duq_1 = cs_field_by_handle(&_h_i_poro_duq_1)->val;
+    b_poro_duq = cs_field_by_handle(&_h_b_poro_duq)->val;
   }
   else {
     i_poro_duq_0 = &_f_ext;
@@ -2791,7 +2816,7 @@ _lsq_scalar_gradient_hyd_p(const cs_mesh_t                *m,
   cs_cocg_6_t  *restrict cocg = nullptr;
 
   /* Additional terms due to porosity */
-  cs_field_t *f_i_poro_duq_0 = cs_field_by_name_try("i_poro_duq_0");
+  cs_field_t *f_i_poro_duq_0 = cs_field_by_handle_try(&_h_i_poro_duq_0);
 
   cs_real_t *i_poro_duq_0 = nullptr;
   cs_real_t *i_poro_duq_1 = nullptr;
@@ -2801,8 +2826,8 @@ _lsq_scalar_gradient_hyd_p(const cs_mesh_t                *m,
   if (f_i_poro_duq_0 != nullptr) {
     is_porous = 1;
     i_poro_duq_0 = f_i_poro_duq_0->val;
-    i_poro_duq_1 = cs_field_by_name("i_poro_duq_1")->val;
-    b_poro_duq = cs_field_by_name("b_poro_duq")->val;
+    i_poro_duq_1 = cs_field_by_handle(&_h_i_poro_duq_1)->val;
+    b_poro_duq = cs_field_by_handle(&_h_b_poro_duq)->val;
   }
 
   _get_cell_cocg_lsq(m,
@@ -3183,7 +3208,7 @@ _lsq_scalar_gradient_hyd_p_gather(const cs_mesh_t                *m,
   cs_dispatch_context ctx;
 
   /* Additional terms due to porosity */
-  cs_field_t *f_i_poro_duq_0 = cs_field_by_name_try("i_poro_duq_0");
+  cs_field_t *f_i_poro_duq_0 = cs_field_by_handle_try(&_h_i_poro_duq_0);
 
   cs_real_t *i_poro_duq_0 = nullptr;
   cs_real_t *i_poro_duq_1 = nullptr;
@@ -3193,8 +3218,8 @@ _lsq_scalar_gradient_hyd_p_gather(const cs_mesh_t                *m,
   if (f_i_poro_duq_0 != nullptr) {
     is_porous = true;
     i_poro_duq_0 = f_i_poro_duq_0->val;
-    i_poro_duq_1 = cs_field_by_name("i_poro_duq_1")->val;
-    b_poro_duq = cs_field_by_name("b_poro_duq")->val;
+    i_poro_duq_1 = cs_field_by_handle(&_h_i_poro_duq_1)->val;
+    b_poro_duq = cs_field_by_handle(&_h_b_poro_duq)->val;
   }
 
   cs_cocg_6_t  *restrict cocgb = nullptr;
@@ -3723,7 +3748,7 @@ _reconstruct_scalar_gradient(const cs_mesh_t                 *m,
   }
 
   /*Additional terms due to porosity */
-  cs_field_t *f_i_poro_duq_0 = cs_field_by_name_try("i_poro_duq_0");
+  cs_field_t *f_i_poro_duq_0 = cs_field_by_handle_try(&_h_i_poro_duq_0);
 
   cs_real_t *i_poro_duq_0 = nullptr;
   cs_real_t *i_poro_duq_1 = nullptr;
@@ -3733,8 +3758,8 @@ _reconstruct_scalar_gradient(const cs_mesh_t                 *m,
   if (f_i_poro_duq_0 != nullptr) {
     is_porous = 1;
     i_poro_duq_0 = f_i_poro_duq_0->val;
-    i_poro_duq_1 = cs_field_by_name("i_poro_duq_1")->val;
-    b_poro_duq = cs_field_by_name("b_poro_duq")->val;
+    i_poro_duq_1 = cs_field_by_handle(&_h_i_poro_duq_1)->val;
+    b_poro_duq = cs_field_by_handle(&_h_b_poro_duq)->val;
   }
 
   bool warped_correction = (  cs_glob_mesh_quantities_flag
@@ -4269,7 +4294,7 @@ _lsq_scalar_b_face_val_phyd(const cs_mesh_t             *m,
 
   /*Additional terms due to porosity */
 
-  cs_field_t *f_b_poro_duq_0 = cs_field_by_name_try("b_poro_duq_0");
+  cs_field_t *f_b_poro_duq_0 = cs_field_by_handle_try(&_h_b_poro_duq_0);
 
   cs_real_t *b_poro_duq = nullptr;
   cs_lnum_t is_porous = false;
@@ -4529,7 +4554,7 @@ _fv_vtx_based_scalar_gradient(const cs_mesh_t                *m,
 
   /* Additional terms due to porosity */
 
-  cs_field_t *f_i_poro_duq_0 = cs_field_by_name_try("i_poro_duq_0");
+  cs_field_t *f_i_poro_duq_0 = cs_field_by_handle_try(&_h_i_poro_duq_0);
 
   cs_real_t *i_poro_duq_0;
   cs_real_t *i_poro_duq_1;
@@ -4540,8 +4565,8 @@ _fv_vtx_based_scalar_gradient(const cs_mesh_t                *m,
   if (f_i_poro_duq_0 != nullptr) {
     is_porous = 1;
     i_poro_duq_0 = f_i_poro_duq_0->val;
-    i_poro_duq_1 = cs_field_by_name_try("i_poro_duq_1")->val;
-    b_poro_duq = cs_field_by_name_try("b_poro_duq")->val;
+    i_poro_duq_1 = cs_field_by_handle(&_h_i_poro_duq_1)->val;
+    b_poro_duq = cs_field_by_handle(&_h_b_poro_duq)->val;
   }
   else {
     i_poro_duq_0 = &_f_ext;
@@ -7788,6 +7813,8 @@ cs_gradient_scalar(const char                    *var_name,
                    const cs_internal_coupling_t  *cpl,
                    cs_real_t           (*restrict grad)[3])
 {
+  cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_GRADIENT);
+
   const cs_mesh_t  *mesh = cs_glob_mesh;
   cs_gradient_info_t *gradient_info = nullptr;
   cs_timer_t t0, t1;
@@ -7894,6 +7921,8 @@ cs_gradient_vector(const char                    *var_name,
                    const cs_internal_coupling_t  *cpl,
                    cs_real_t                      gradv[][3][3])
 {
+  cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_GRADIENT);
+
   const cs_mesh_t  *mesh = cs_glob_mesh;
   const cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
   const cs_lnum_t n_b_faces = mesh->n_b_faces;
@@ -8176,6 +8205,8 @@ cs_gradient_tensor(const char                  *var_name,
                    cs_real_6_t        *restrict var,
                    cs_real_63_t       *restrict grad)
 {
+  cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_GRADIENT);
+
   const cs_mesh_t *mesh = cs_glob_mesh;
   const cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
   const cs_lnum_t n_b_faces = mesh->n_b_faces;
@@ -8393,6 +8424,8 @@ cs_gradient_scalar_synced_input(const char                 *var_name,
                                 const cs_internal_coupling_t  *cpl,
                                 cs_real_t                   grad[][3])
 {
+  cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_GRADIENT);
+
   cs_gradient_info_t *gradient_info = nullptr;
   cs_timer_t t0, t1;
 
@@ -8488,6 +8521,8 @@ cs_gradient_vector_synced_input(const char                 *var_name,
                                 const cs_real_t             c_weight[],
                                 cs_real_t                   grad[][3][3])
 {
+  cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_GRADIENT);
+
   cs_gradient_info_t *gradient_info = nullptr;
   cs_timer_t t0, t1;
 
@@ -8569,6 +8604,8 @@ cs_gradient_tensor_synced_input(const char                  *var_name,
                                 const cs_real_t              val_f[][6],
                                 cs_real_63_t                *grad)
 {
+  cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_GRADIENT);
+
   cs_gradient_info_t *gradient_info = nullptr;
   cs_timer_t t0, t1;
 
@@ -9019,8 +9056,6 @@ cs_gradient_porosity_balance(int inc)
   const cs_real_t *restrict cell_vol = mq->cell_vol;
   cs_real_2_t *i_f_face_factor = mq->i_f_face_factor;
   cs_real_t *b_f_face_factor = mq->b_f_face_factor;
-  cs_real_t *i_massflux = cs_field_by_name("inner_mass_flux")->val;
-  cs_real_t *b_massflux = cs_field_by_name("boundary_mass_flux")->val;
   const cs_nreal_3_t *restrict i_face_u_normal = mq_g->i_face_u_normal;
   const cs_nreal_3_t *restrict b_face_u_normal = mq_g->b_face_u_normal;
   const cs_lnum_2_t *restrict i_face_cells = m->i_face_cells;
@@ -9039,16 +9074,18 @@ cs_gradient_porosity_balance(int inc)
   const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
 
   /*Additional terms due to porosity */
-  cs_field_t *f_i_poro_duq_0 = cs_field_by_name_try("i_poro_duq_0");
+  cs_field_t *f_i_poro_duq_0 = cs_field_by_handle_try(&_h_i_poro_duq_0);
 
   if (f_i_poro_duq_0 == nullptr)
     return;
 
   cs_real_t *i_poro_duq_0 = f_i_poro_duq_0->val;
-  cs_real_t *i_poro_duq_1 = cs_field_by_name("i_poro_duq_1")->val;
-  cs_real_t *b_poro_duq = cs_field_by_name("b_poro_duq")->val;
+  cs_real_t *i_poro_duq_1 = cs_field_by_handle(&_h_i_poro_duq_1)->val;
+  cs_real_t *b_poro_duq = cs_field_by_handle(&_h_b_poro_duq)->val;
   cs_real_3_t *c_poro_div_duq
-    = (cs_real_3_t *)cs_field_by_name("poro_div_duq")->val;
+    = (cs_real_3_t *)cs_field_by_handle(&_h_poro_div_duq)->val;
+  cs_real_t *i_massflux = cs_field_by_name("inner_mass_flux")->val;
+  cs_real_t *b_massflux = cs_field_by_name("boundary_mass_flux")->val;
 
 # pragma omp parallel for
   for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
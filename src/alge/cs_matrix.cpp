@@ -102,6 +102,7 @@
 
 #include "base/cs_base.h"
 #include "alge/cs_blas.h"
+#include "base/cs_comm_profile.h"
 #include "base/cs_dispatch.h"
 #include "base/cs_halo.h"
 #include "base/cs_halo_perio.h"
@@ -4132,6 +4133,8 @@ cs_matrix_vector_multiply([[maybe_unused]] cs_dispatch_context  &ctx,
                           cs_real_t                              x[],
                           cs_real_t                              y[])
 {
+  cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_SPMV, -1, true);
+
   auto nocst_matrix = const_cast<cs_matrix_t *>(matrix);
 
   cs_matrix_vector_product_t  *spmv_func;
@@ -4224,6 +4227,8 @@ cs_matrix_structure_create(cs_matrix_type_t       type,
                            const cs_halo_t       *halo,
                            const cs_numbering_t  *numbering)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_MATRICES, true);
+
   cs_matrix_structure_t *ms;
 
   CS_MALLOC(ms, 1, cs_matrix_structure_t);
@@ -4326,6 +4331,8 @@ cs_matrix_structure_create_msr(cs_matrix_type_t        type,
                                const cs_halo_t        *halo,
                                const cs_numbering_t   *numbering)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_MATRICES, true);
+
   cs_matrix_structure_t *ms = nullptr;
 
   CS_MALLOC(ms, 1, cs_matrix_structure_t);
@@ -4414,6 +4421,8 @@ cs_matrix_structure_create_msr_shared(bool                    direct_assembly,
                                       const cs_halo_t        *halo,
                                       const cs_numbering_t   *numbering)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_MATRICES, true);
+
   cs_matrix_structure_t *ms = nullptr;
 
   CS_MALLOC(ms, 1, cs_matrix_structure_t);
@@ -4459,6 +4468,8 @@ cs_matrix_structure_t *
 cs_matrix_structure_create_from_assembler(cs_matrix_type_t        type,
                                           cs_matrix_assembler_t  *ma)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_MATRICES, true);
+
   cs_matrix_structure_t *ms = nullptr;
 
   CS_MALLOC(ms, 1, cs_matrix_structure_t);
@@ -4572,6 +4583,8 @@ cs_matrix_structure_release_msr_arrays(cs_matrix_structure_t   *ms,
 cs_matrix_t *
 cs_matrix_create(const cs_matrix_structure_t  *ms)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_MATRICES, true);
+
   assert(ms != nullptr); /* Sanity check */
 
   cs_matrix_t *m = _matrix_create(ms->type, ms->alloc_mode);
@@ -4607,6 +4620,8 @@ cs_matrix_t *
 cs_matrix_create_from_assembler(cs_matrix_type_t        type,
                                 cs_matrix_assembler_t  *ma)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_MATRICES, true);
+
   cs_matrix_t *m = _matrix_create(type, cs_alloc_mode);
 
   m->assembler = ma;
@@ -4653,6 +4668,8 @@ cs_matrix_create_from_assembler(cs_matrix_type_t        type,
 cs_matrix_t *
 cs_matrix_create_by_copy(cs_matrix_t   *src)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_MATRICES, true);
+
   cs_matrix_t *m;
 
   CS_MALLOC(m, 1, cs_matrix_t);
@@ -4691,6 +4708,8 @@ cs_matrix_create_by_copy(cs_matrix_t   *src)
 cs_matrix_t *
 cs_matrix_create_by_local_restrict(const cs_matrix_t  *src)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_MATRICES, true);
+
   cs_matrix_t *m = nullptr;
 
   const cs_lnum_t n_rows = src->n_rows;
@@ -5182,6 +5201,8 @@ cs_matrix_set_coefficients(cs_matrix_t        *matrix,
                            const cs_real_t    *da,
                            const cs_real_t    *xa)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_MATRICES, true);
+
   std::chrono::high_resolution_clock::time_point t_start;
   if (cs_glob_timer_kernels_flag > 0)
     t_start = std::chrono::high_resolution_clock::now();
@@ -5252,6 +5273,8 @@ cs_matrix_transfer_coefficients(cs_matrix_t         *matrix,
                                 cs_real_t          **d_val,
                                 cs_real_t          **x_val)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_MATRICES, true);
+
   cs_matrix_set_coefficients(matrix,
                              symmetric,
                              diag_block_size,
@@ -5318,6 +5341,8 @@ cs_matrix_transfer_coefficients_msr(cs_matrix_t         *matrix,
                                     cs_real_t          **d_val,
                                     cs_real_t          **x_val)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_MATRICES, true);
+
   const cs_real_t  *d_val_p = (d_val != nullptr) ? *d_val : nullptr;
   const cs_real_t  *x_val_p = (x_val != nullptr) ? *x_val : nullptr;
 
@@ -6267,6 +6292,8 @@ cs_matrix_vector_multiply(const cs_matrix_t   *matrix,
                           cs_real_t           *restrict x,
                           cs_real_t           *restrict y)
 {
+  cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_SPMV, -1, true);
+
   assert(matrix != nullptr);
 
   if (matrix->vector_multiply[matrix->fill_type][0] != nullptr) {
@@ -6339,6 +6366,8 @@ cs_matrix_vector_multiply_d(const cs_matrix_t   *matrix,
                             cs_real_t           *restrict x,
                             cs_real_t           *restrict y)
 {
+  cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_SPMV, -1, true);
+
   assert(matrix != nullptr);
 
   if (matrix->vector_multiply_d[matrix->fill_type][0] != nullptr) {
@@ -6450,6 +6479,8 @@ cs_matrix_vector_multiply_partial(const cs_matrix_t      *matrix,
                                   cs_real_t              *restrict x,
                                   cs_real_t              *restrict y)
 {
+  cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_SPMV, -1, true);
+
   assert(matrix != nullptr);
 
   if (matrix->vector_multiply[matrix->fill_type][op_type] != nullptr) {
@@ -6525,6 +6556,8 @@ cs_matrix_vector_multiply_partial_d(const cs_matrix_t      *matrix,
                                     cs_real_t              *restrict x,
                                     cs_real_t              *restrict y)
 {
+  cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_SPMV, -1, true);
+
   assert(matrix != nullptr);
 
   if (matrix->vector_multiply_d[matrix->fill_type][op_type] != nullptr) {
@@ -6788,7 +6821,7 @@ cs_matrix_variant_build_list(const cs_matrix_t       *m,
 
 #if defined(HAVE_OPENMP)
 
-    if (omp_get_num_threads() > 1) {
+    if (omp_get_max_threads() > 1) {
       _variant_add(_("MSR, OpenMP scheduling"),
                    m->type,
                    m->fill_type,
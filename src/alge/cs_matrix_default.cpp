@@ -987,6 +987,8 @@ cs_matrix_set_coefficients_by_assembler(const cs_field_t  *f,
                                         const cs_real_t   *da,
                                         const cs_real_t   *xa)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_MATRICES, true);
+
   int coupling_id = cs_field_get_key_int(f,
                                          cs_field_key_id("coupling_entity"));
 
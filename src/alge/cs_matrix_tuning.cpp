@@ -54,6 +54,7 @@
  * Standard C library headers
  *----------------------------------------------------------------------------*/
 
+#include <errno.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -61,6 +62,10 @@
 #include <assert.h>
 #include <math.h>
 
+#if defined(HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
+
 #if defined(HAVE_MPI)
 #include <mpi.h>
 #endif
@@ -80,6 +85,7 @@
 #include "base/cs_mem.h"
 #include "base/cs_numbering.h"
 #include "base/cs_prototypes.h"
+#include "base/cs_system_info.h"
 #include "base/cs_timer.h"
 
 /*----------------------------------------------------------------------------
@@ -101,6 +107,11 @@ BEGIN_C_DECLS
  * Local Macro Definitions
  *============================================================================*/
 
+/* Maximum length of tuning cache keys and lines */
+
+#define CS_MATRIX_TUNING_CACHE_KEY_LEN 256
+#define CS_MATRIX_TUNING_CACHE_LINE_LEN 640
+
 /*=============================================================================
  * Local Type Definitions
  *============================================================================*/
@@ -112,6 +123,12 @@ BEGIN_C_DECLS
  *  Global variables
  *============================================================================*/
 
+/* Persistent tuning cache */
+
+static bool   _cache_initialized = false;
+static bool   _cache_refresh = false;
+static char  *_cache_file_name = nullptr;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -360,12 +377,343 @@ _matrix_tune_spmv_select(const cs_matrix_t    *m,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Initialize tuning cache settings from the environment if not set
+ * explicitly using cs_matrix_tuning_set_cache.
+ *----------------------------------------------------------------------------*/
+
+static void
+_cache_initialize(void)
+{
+  if (_cache_initialized)
+    return;
+
+  _cache_initialized = true;
+
+  const char *s = getenv("CS_MATRIX_TUNING_CACHE");
+  if (s != nullptr) {
+    if (strlen(s) > 0) {
+      CS_MALLOC(_cache_file_name, strlen(s) + 1, char);
+      strcpy(_cache_file_name, s);
+    }
+  }
+
+  s = getenv("CS_MATRIX_TUNING_CACHE_REFRESH");
+  if (s != nullptr) {
+    if (atoi(s) > 0)
+      _cache_refresh = true;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build the tuning cache key for a given matrix.
+ *
+ * The key combines a hardware fingerprint (CPU model, threads per rank,
+ * and device if present) with matrix characteristics (type, fill type,
+ * block sizes, order of magnitude of the mean number of rows per rank,
+ * and mean number of entries per row). It is the same on all ranks.
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   m   <-- associated matrix
+ *   key --> key string (size: CS_MATRIX_TUNING_CACHE_KEY_LEN)
+ *----------------------------------------------------------------------------*/
+
+static void
+_cache_key(const cs_matrix_t  *m,
+           char                key[])
+{
+  double n_vals[2] = {(double)cs_matrix_get_n_rows(m),
+                      (double)cs_matrix_get_n_entries(m)};
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    double n_vals_l[2] = {n_vals[0], n_vals[1]};
+    MPI_Allreduce(n_vals_l, n_vals, 2, MPI_DOUBLE, MPI_SUM, cs_glob_mpi_comm);
+  }
+#endif
+
+  double n_rows_mean = n_vals[0] / cs_glob_n_ranks;
+  int rows_log2 = (n_rows_mean >= 1) ? (int)log2(n_rows_mean) : 0;
+  double nnz_row = (n_vals[0] > 0) ? n_vals[1] / n_vals[0] : 0;
+
+  char cpu_str[81];
+  cs_system_info_cpu(cpu_str, 81);
+  for (char *c = cpu_str; *c != '\0'; c++) {
+    if (*c == '\t' || *c == ';')
+      *c = ' ';
+  }
+
+  snprintf(key, CS_MATRIX_TUNING_CACHE_KEY_LEN,
+           "%s;threads=%d;device=%d;type=%s;fill=%s;db=%d;eb=%d;"
+           "rows_log2=%d;nnz_row=%.0f",
+           cpu_str, cs_glob_n_threads, cs_get_device_id(),
+           cs_matrix_get_type_name(m),
+           cs_matrix_fill_type_name[m->fill_type],
+           (int)m->db_size, (int)m->eb_size,
+           rows_log2, nnz_row);
+  key[CS_MATRIX_TUNING_CACHE_KEY_LEN - 1] = '\0';
+}
+
+/*----------------------------------------------------------------------------
+ * Look for a key in the tuning cache file.
+ *
+ * The cache file is read on rank 0, and the matching values broadcast
+ * to other ranks. This function is collective.
+ *
+ * parameters:
+ *   key  <-- key string
+ *   vals --> values matching key (tab-separated variant names), or empty
+ *            string if not found (size: CS_MATRIX_TUNING_CACHE_LINE_LEN)
+ *----------------------------------------------------------------------------*/
+
+static void
+_cache_lookup(const char  *key,
+              char         vals[])
+{
+  size_t key_len = strlen(key);
+
+  vals[0] = '\0';
+
+  if (cs_glob_rank_id < 1) {
+    FILE *f = fopen(_cache_file_name, "r");
+    if (f != nullptr) {
+      char line[CS_MATRIX_TUNING_CACHE_LINE_LEN];
+      while (fgets(line, CS_MATRIX_TUNING_CACHE_LINE_LEN, f) != nullptr) {
+        if (   strncmp(line, key, key_len) == 0
+            && line[key_len] == '\t') {
+          strcpy(vals, line + key_len + 1);
+          size_t l = strlen(vals);
+          while (l > 0 && (vals[l-1] == '\n' || vals[l-1] == '\r'))
+            vals[--l] = '\0';
+        }
+      }
+      fclose(f);
+    }
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Bcast(vals, CS_MATRIX_TUNING_CACHE_LINE_LEN, MPI_CHAR, 0,
+              cs_glob_mpi_comm);
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Add or replace an entry in the tuning cache file (on rank 0).
+ *
+ * The file is rewritten to a temporary file, then renamed, so that
+ * concurrent runs sharing a cache do not see partially written files.
+ *
+ * parameters:
+ *   key  <-- key string
+ *   vals <-- values matching key
+ *----------------------------------------------------------------------------*/
+
+static void
+_cache_update(const char  *key,
+              const char  *vals)
+{
+  if (cs_glob_rank_id > 0)
+    return;
+
+  size_t key_len = strlen(key);
+  size_t tmp_len = strlen(_cache_file_name) + 32;
+
+  char *tmp_name;
+  CS_MALLOC(tmp_name, tmp_len, char);
+#if defined(HAVE_UNISTD_H)
+  snprintf(tmp_name, tmp_len, "%s.tmp%ld",
+           _cache_file_name, (long)getpid());
+#else
+  snprintf(tmp_name, tmp_len, "%s.tmp", _cache_file_name);
+#endif
+
+  FILE *f_out = fopen(tmp_name, "w");
+
+  if (f_out == nullptr) {
+    bft_printf(_("\n"
+                 "Warning: matrix tuning cache file \"%s\" could not be\n"
+                 "         opened: %s\n"),
+               tmp_name, strerror(errno));
+    CS_FREE(tmp_name);
+    return;
+  }
+
+  FILE *f_in = fopen(_cache_file_name, "r");
+
+  if (f_in != nullptr) {
+    char line[CS_MATRIX_TUNING_CACHE_LINE_LEN];
+    while (fgets(line, CS_MATRIX_TUNING_CACHE_LINE_LEN, f_in) != nullptr) {
+      if (   strncmp(line, key, key_len) == 0
+          && line[key_len] == '\t')
+        continue;
+      fputs(line, f_out);
+    }
+    fclose(f_in);
+  }
+  else
+    fprintf(f_out,
+            "# code_saturne SpMV variant tuning cache\n"
+            "# key<TAB>selected variant names (y <= A.x, y <= (A-D).x)\n");
+
+  fprintf(f_out, "%s\t%s\n", key, vals);
+
+  int retval = fclose(f_out);
+  if (retval == 0)
+    retval = rename(tmp_name, _cache_file_name);
+
+  if (retval != 0) {
+    bft_printf(_("\n"
+                 "Warning: error updating matrix tuning cache file \"%s\":\n"
+                 "         %s\n"),
+               _cache_file_name, strerror(errno));
+    remove(tmp_name);
+  }
+
+  CS_FREE(tmp_name);
+}
+
+/*----------------------------------------------------------------------------
+ * Serialize selected variant names for the tuning cache.
+ *
+ * parameters:
+ *   n_r_variants <-- number of selected variants
+ *   r_variant    <-- array of selected variants
+ *   vals         --> tab-separated variant names ("-" if undefined)
+ *                    (size: CS_MATRIX_TUNING_CACHE_LINE_LEN)
+ *----------------------------------------------------------------------------*/
+
+static void
+_cache_vals_from_variants(int                         n_r_variants,
+                          const cs_matrix_variant_t  *r_variant,
+                          char                        vals[])
+{
+  vals[0] = '\0';
+
+  for (int k = 0; k < n_r_variants; k++) {
+    for (int j = 0; j < CS_MATRIX_SPMV_N_TYPES; j++) {
+      const cs_matrix_variant_t *v = r_variant + k;
+      const char *name = (   v->vector_multiply[j] != nullptr
+                          && strlen(v->name[j]) > 0) ? v->name[j] : "-";
+      if (k + j > 0)
+        strcat(vals, "\t");
+      strcat(vals, name);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Select variants based on names read from the tuning cache.
+ *
+ * parameters:
+ *   m            <-- associated matrix
+ *   vals         <-- tab-separated variant names
+ *   n_variants   <-- number of candidate variants
+ *   n_r_variants <-- number of return variants
+ *   m_variant    <-- array of candidate variants
+ *   r_variant    --> array of selected variants
+ *
+ * returns:
+ *   true if all cached variants were found, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_cache_select(const cs_matrix_t          *m,
+              const char                 *vals,
+              int                         n_variants,
+              int                         n_r_variants,
+              const cs_matrix_variant_t  *m_variant,
+              cs_matrix_variant_t        *r_variant)
+{
+  const char *s = vals;
+
+  for (int k = 0; k < n_r_variants; k++) {
+
+    cs_matrix_variant_t *o_variant = r_variant + k;
+    memcpy(o_variant, m_variant, sizeof(cs_matrix_variant_t));
+    o_variant->fill_type = m->fill_type;
+
+    for (int j = 0; j < CS_MATRIX_SPMV_N_TYPES; j++) {
+
+      if (*s == '\0')
+        return false;
+
+      size_t l = strcspn(s, "\t");
+      if (l == 0 || l >= sizeof(o_variant->name[j]))
+        return false;
+
+      if (!(l == 1 && s[0] == '-')) {
+        int i;
+        for (i = 0; i < n_variants; i++) {
+          const cs_matrix_variant_t *mv = m_variant + i;
+          if (   mv->vector_multiply[j] != nullptr
+              && strncmp(mv->name[j], s, l) == 0
+              && mv->name[j][l] == '\0')
+            break;
+        }
+        if (i >= n_variants)
+          return false;
+        strcpy(o_variant->name[j], m_variant[i].name[j]);
+        o_variant->vector_multiply[j] = m_variant[i].vector_multiply[j];
+        o_variant->vector_multiply_xy_hd[j]
+          = m_variant[i].vector_multiply_xy_hd[j];
+      }
+
+      s += l;
+      if (*s == '\t')
+        s++;
+    }
+
+  }
+
+  return true;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
  * Public function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a persistent cache for matrix.vector product tuning.
+ *
+ * When a cache file is defined, the variants selected by
+ * \ref cs_matrix_variant_tuned are stored in that file, using a key
+ * based on the CPU model, number of threads per rank, and matrix
+ * characteristics (type, fill type, block sizes, order of magnitude of the
+ * number of rows per rank, and mean number of entries per row).
+ * Later runs with a matching key reuse those variants instead of timing
+ * all candidates, which also avoids run-to-run variations in the selection.
+ *
+ * If this function is not called, the CS_MATRIX_TUNING_CACHE environment
+ * variable may be used to define the file name, and setting the
+ * CS_MATRIX_TUNING_CACHE_REFRESH variable to 1 forces refreshing.
+ *
+ * \param[in]  file_name  name of cache file, or nullptr to disable caching
+ * \param[in]  refresh    if true, always re-run tuning and update the cache
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_tuning_set_cache(const char  *file_name,
+                           bool         refresh)
+{
+  _cache_initialized = true;
+
+  CS_FREE(_cache_file_name);
+
+  if (file_name != nullptr) {
+    CS_MALLOC(_cache_file_name, strlen(file_name) + 1, char);
+    strcpy(_cache_file_name, file_name);
+  }
+
+  _cache_refresh = refresh;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Build a matrix variant tuned matrix.vector product operations.
@@ -389,6 +737,8 @@ cs_matrix_variant_tuned(const cs_matrix_t  *m,
                         int                 verbosity,
                         int                 n_measure)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_MATRICES, true);
+
   int  n_variants = 0, n_r_variants = 1;
   cs_matrix_variant_t  *r_variant = nullptr;
   cs_matrix_variant_t  *m_variant = nullptr;
@@ -400,7 +750,50 @@ cs_matrix_variant_tuned(const cs_matrix_t  *m,
 
   cs_matrix_variant_build_list(m, &n_variants, &m_variant);
 
-  if (n_variants > 1) {
+  /* Check for previous tuning results */
+
+  _cache_initialize();
+
+  char cache_key[CS_MATRIX_TUNING_CACHE_KEY_LEN] = "";
+  bool from_cache = false;
+
+  if (n_variants > 1 && _cache_file_name != nullptr) {
+
+    _cache_key(m, cache_key);
+
+    if (_cache_refresh == false) {
+      char vals[CS_MATRIX_TUNING_CACHE_LINE_LEN];
+      _cache_lookup(cache_key, vals);
+      if (vals[0] != '\0')
+        from_cache = _cache_select(m, vals, n_variants, n_r_variants,
+                                   m_variant, r_variant);
+    }
+
+    if (from_cache && verbosity > 0) {
+      const char* hd_type[] = {"", "host ", "device "};
+      for (int k = 0; k < n_r_variants; k++) {
+        cs_log_printf
+          (CS_LOG_PERFORMANCE,
+           _("\n"
+             "Cached %sSpMV variant for matrix of type %s and fill %s:\n"
+             "  %32s for y <= A.x\n"
+             "  %32s for y <= (A-D).x\n"),
+           hd_type[k],
+           _(cs_matrix_get_type_name(m)),
+           _(cs_matrix_fill_type_name[m->fill_type]),
+           r_variant[k].name[0], r_variant[k].name[1]);
+      }
+      cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+      cs_log_separator(CS_LOG_PERFORMANCE);
+    }
+
+  }
+
+  if (from_cache) {
+    /* Variants already selected */
+  }
+
+  else if (n_variants > 1) {
 
     if (verbosity > 0)
       cs_log_printf(CS_LOG_PERFORMANCE,
@@ -429,6 +822,12 @@ cs_matrix_variant_tuned(const cs_matrix_t  *m,
 
     CS_FREE(spmv_cost);
 
+    if (_cache_file_name != nullptr) {
+      char vals[CS_MATRIX_TUNING_CACHE_LINE_LEN];
+      _cache_vals_from_variants(n_r_variants, r_variant, vals);
+      _cache_update(cache_key, vals);
+    }
+
     cs_log_printf(CS_LOG_PERFORMANCE, "\n");
     cs_log_separator(CS_LOG_PERFORMANCE);
 
@@ -57,6 +57,27 @@ BEGIN_C_DECLS
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Define a persistent cache for matrix.vector product tuning.
+ *
+ * When a cache file is defined, the variants selected by
+ * \ref cs_matrix_variant_tuned are stored in that file, and reused by
+ * later runs on matching hardware and matrix characteristics.
+ *
+ * If this function is not called, the CS_MATRIX_TUNING_CACHE environment
+ * variable may be used to define the file name, and setting the
+ * CS_MATRIX_TUNING_CACHE_REFRESH variable to 1 forces refreshing.
+ *
+ * \param[in]  file_name  name of cache file, or nullptr to disable caching
+ * \param[in]  refresh    if true, always re-run tuning and update the cache
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_tuning_set_cache(const char  *file_name,
+                           bool         refresh);
+
 /*----------------------------------------------------------------------------*/
 /*
  * \brief Build a matrix variant tuned matrix.vector product operations.
@@ -58,6 +58,7 @@
 #include "base/cs_base.h"
 #include "base/cs_base_accel.h"
 #include "alge/cs_blas.h"
+#include "base/cs_comm_profile.h"
 #include "base/cs_dispatch.h"
 #include "base/cs_file.h"
 #include "alge/cs_grid.h"
@@ -3204,6 +3205,7 @@ _multigrid_v_cycle(cs_multigrid_t       *mg,
   for (level = 0; level < coarsest_level; level++) {
 
     lv_info = mg->lv_info + level;
+    cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_MULTIGRID, level);
     t0 = cs_timer_time();
 
     rhs_lv = (level == 0) ? rhs : mgd->rhs_vx[level*2];
@@ -3367,6 +3369,7 @@ _multigrid_v_cycle(cs_multigrid_t       *mg,
     _initial_residual = _residual;
 
     lv_info = mg->lv_info + level;
+    cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_MULTIGRID, level);
 
     t0 = cs_timer_time();
 
@@ -3416,6 +3419,7 @@ _multigrid_v_cycle(cs_multigrid_t       *mg,
       vx_lv = mgd->rhs_vx[level*2 + 1];
 
       lv_info = mg->lv_info + level;
+      cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_MULTIGRID, level);
 
       c = mgd->grid_hierarchy[level+1];
       f = mgd->grid_hierarchy[level];
@@ -3633,6 +3637,7 @@ _multigrid_v_cycle_pc(cs_multigrid_t        *mg,
   for (level = 0; level < coarsest_level; level++) {
 
     lv_info = mg->lv_info + level;
+    cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_MULTIGRID, level);
     t0 = cs_timer_time();
 
     rhs_lv = (level == 0) ? rhs : mgd->rhs_vx[level*2];
@@ -3816,6 +3821,7 @@ _multigrid_v_cycle_pc(cs_multigrid_t        *mg,
     _initial_residual = _residual;
 
     lv_info = mg->lv_info + level;
+    cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_MULTIGRID, level);
 
     t0 = cs_timer_time();
 
@@ -3868,6 +3874,7 @@ _multigrid_v_cycle_pc(cs_multigrid_t        *mg,
       vx_lv = mgd->rhs_vx[level*2 + 1];
 
       lv_info = mg->lv_info + level;
+      cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_MULTIGRID, level);
 
       c = mgd->grid_hierarchy[level+1];
       f = mgd->grid_hierarchy[level];
@@ -4051,6 +4058,8 @@ _multigrid_k_cycle(cs_multigrid_t       *mg,
                    size_t                aux_size,
                    void                 *aux_vectors)
 {
+  cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_MULTIGRID, level);
+
   cs_timer_t t0, t1;
 
   bool end_cycle = false;
@@ -5175,6 +5184,8 @@ cs_multigrid_setup_conv_diff(void               *context,
                              int                 verbosity)
 
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_MULTIGRID);
+
   cs_multigrid_t  *mg = (cs_multigrid_t *)context;
 
   const cs_mesh_t  *mesh = cs_glob_mesh;
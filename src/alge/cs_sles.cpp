@@ -63,9 +63,11 @@
 #include "alge/cs_matrix_default.h"
 #include "alge/cs_matrix_util.h"
 #include "base/cs_parall.h"
+#include "base/cs_perf_report.h"
 #include "base/cs_post.h"
 #include "base/cs_timer.h"
 #include "base/cs_timer_stats.h"
+#include "base/cs_trace.h"
 #include "base/cs_time_step.h"
 
 /*----------------------------------------------------------------------------
@@ -311,6 +313,17 @@ struct _cs_sles_t {
 
   int                       n_no_op;       /* Number of solves with immediate
                                               exit */
+
+  int                       n_setups;      /* Number of setup calls */
+  int                       n_solves;      /* Number of solve calls */
+  int                       n_iter_max;    /* Maximum iterations per solve */
+  unsigned long long        n_iter_tot;    /* Total number of iterations */
+
+  cs_timer_counter_t        t_setup;       /* Total setup time */
+  cs_timer_counter_t        t_solve;       /* Total solve time */
+  cs_timer_counter_t        t_setup_cur;   /* Setup time since last solve */
+  int                       setup_state;   /* 0: not set up, 1: set up,
+                                              2: set up and used */
   bool                      allow_no_op;   /* Allow immediate exit if RHS
                                               small relative to residual norm */
 
@@ -342,6 +355,26 @@ struct _cs_sles_t {
 
 };
 
+/* Per-call telemetry record */
+/*---------------------------*/
+
+typedef struct {
+
+  int                       time_step;     /* time step number */
+  int                       system_id;     /* system id in telemetry map */
+  int                       type_id;       /* id of solver type */
+  int                       n_iter;        /* number of iterations */
+  int                       state;         /* convergence state */
+  int                       setup_reused;  /* 1 if previous setup reused */
+
+  double                    precision;     /* solver precision */
+  double                    r_norm;        /* residual normalization */
+  double                    residual;      /* final residual */
+  double                    setup_time;    /* setup time since last solve */
+  double                    solve_time;    /* solve time */
+
+} cs_sles_telemetry_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -373,6 +406,14 @@ static int _sles_stat_id = -1;
 
 static double _cs_sles_epzero = 1e-12;
 
+/* Per-call telemetry (ring buffer flushed to file when full) */
+
+static int                   _telemetry_size = 0;
+static int                   _telemetry_n = 0;
+static cs_sles_telemetry_t  *_telemetry = nullptr;
+static cs_map_name_to_id_t  *_telemetry_names = nullptr;
+static FILE                 *_telemetry_f = nullptr;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -427,6 +468,16 @@ _sles_create(int          f_id,
 
   sles->n_calls = 0;
   sles->n_no_op = 0;
+
+  sles->n_setups = 0;
+  sles->n_solves = 0;
+  sles->n_iter_max = 0;
+  sles->n_iter_tot = 0;
+
+  CS_TIMER_COUNTER_INIT(sles->t_setup);
+  CS_TIMER_COUNTER_INIT(sles->t_solve);
+  CS_TIMER_COUNTER_INIT(sles->t_setup_cur);
+  sles->setup_state = 0;
   sles->allow_no_op = false;
 
   sles->post_info = nullptr;
@@ -926,6 +977,108 @@ _post_function(void                  *sles_p,
   CS_FREE(sp->row_residual);
 }
 
+/*----------------------------------------------------------------------------
+ * Write buffered telemetry records to file and empty buffer.
+ *
+ * Records are identical on all ranks except for timings, so only rank 0
+ * writes them.
+ *----------------------------------------------------------------------------*/
+
+static void
+_telemetry_flush(void)
+{
+  if (_telemetry_n < 1)
+    return;
+
+  if (cs_glob_rank_id < 1) {
+
+    if (_telemetry_f == nullptr) {
+      _telemetry_f = fopen("sles_telemetry.csv", "w");
+      if (_telemetry_f == nullptr) {
+        bft_printf(_("\nWarning: unable to open file \"%s\"\n"
+                     "         for linear solver telemetry output.\n"),
+                   "sles_telemetry.csv");
+        _telemetry_size = 0;
+        _telemetry_n = 0;
+        CS_FREE(_telemetry);
+        return;
+      }
+      fprintf(_telemetry_f,
+              "time_step, system, type, n_iter, state, setup_reused, "
+              "precision, r_norm, residual, setup_time, solve_time\n");
+    }
+
+    for (int i = 0; i < _telemetry_n; i++) {
+      const cs_sles_telemetry_t *r = _telemetry + i;
+      fprintf(_telemetry_f,
+              "%d, %s, %s, %d, %d, %d, %.6g, %.6g, %.6g, %.6g, %.6g\n",
+              r->time_step,
+              cs_map_name_to_id_reverse(_telemetry_names, r->system_id),
+              cs_map_name_to_id_reverse(_type_name_map, r->type_id),
+              r->n_iter, r->state, r->setup_reused,
+              r->precision, r->r_norm, r->residual,
+              r->setup_time, r->solve_time);
+    }
+
+    fflush(_telemetry_f);
+
+  }
+
+  _telemetry_n = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Add a telemetry record for a solve call.
+ *
+ * parameters:
+ *   sles       <-- pointer to solver object
+ *   sles_name  <-- system name
+ *   state      <-- convergence state
+ *   n_iter     <-- number of iterations
+ *   precision  <-- solver precision
+ *   r_norm     <-- residual normalization
+ *   residual   <-- final residual
+ *   reused     <-- true if a previous setup was reused
+ *   t_solve    <-- solve time
+ *----------------------------------------------------------------------------*/
+
+static void
+_telemetry_add(const cs_sles_t              *sles,
+               const char                   *sles_name,
+               cs_sles_convergence_state_t   state,
+               int                           n_iter,
+               double                        precision,
+               double                        r_norm,
+               double                        residual,
+               bool                          reused,
+               const cs_timer_counter_t     *t_solve)
+{
+  if (_telemetry_n >= _telemetry_size)
+    _telemetry_flush();
+
+  if (_telemetry_size < 1)
+    return;
+
+  if (_telemetry_names == nullptr)
+    _telemetry_names = cs_map_name_to_id_create();
+
+  cs_sles_telemetry_t *r = _telemetry + _telemetry_n;
+
+  r->time_step = (cs_glob_time_step != nullptr) ? cs_glob_time_step->nt_cur : 0;
+  r->system_id = cs_map_name_to_id(_telemetry_names, sles_name);
+  r->type_id = sles->type_id;
+  r->n_iter = n_iter;
+  r->state = state;
+  r->setup_reused = (reused) ? 1 : 0;
+  r->precision = precision;
+  r->r_norm = r_norm;
+  r->residual = residual;
+  r->setup_time = sles->t_setup_cur.nsec*1e-9;
+  r->solve_time = t_solve->nsec*1e-9;
+
+  _telemetry_n += 1;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -963,6 +1116,34 @@ cs_sles_get_epzero(void)
   return _cs_sles_epzero;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate per-call linear solver telemetry.
+ *
+ * When active, each call to \ref cs_sles_solve is recorded (time step,
+ * system name, solver type, iterations, convergence state, whether a
+ * previous setup was reused, precision, residual normalization, final
+ * residual, and setup and solve times). Records are buffered and appended
+ * to the "sles_telemetry.csv" file when the buffer is full, and at
+ * finalization.
+ *
+ * Telemetry may also be activated by setting the CS_SLES_TELEMETRY
+ * environment variable (whose value, if > 0, defines the buffer size).
+ *
+ * \param[in]  n_records  number of records buffered before output,
+ *                        or 0 to deactivate telemetry
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_telemetry(int  n_records)
+{
+  _telemetry_flush();
+
+  _telemetry_size = (n_records > 0) ? n_records : 0;
+  CS_REALLOC(_telemetry, _telemetry_size, cs_sles_telemetry_t);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Initialize sparse linear equation solver API.
@@ -974,6 +1155,12 @@ cs_sles_initialize(void)
 {
   CS_TIMER_COUNTER_INIT(_sles_t_tot);
 
+  const char *p = getenv("CS_SLES_TELEMETRY");
+  if (p != nullptr && _telemetry_size == 0) {
+    int n = atoi(p);
+    cs_sles_set_telemetry((n > 0) ? n : 1024);
+  }
+
   int stats_root = cs_timer_stats_id_by_name("operations");
 
   if (stats_root > -1) {
@@ -992,6 +1179,43 @@ cs_sles_initialize(void)
 void
 cs_sles_finalize(void)
 {
+  /* Flush and close telemetry */
+
+  _telemetry_flush();
+  if (_telemetry_f != nullptr) {
+    fclose(_telemetry_f);
+    _telemetry_f = nullptr;
+  }
+  CS_FREE(_telemetry);
+  _telemetry_size = 0;
+  cs_map_name_to_id_destroy(&_telemetry_names);
+
+  /* Add current systems to performance report
+     (counts include those of previous options for each system) */
+
+  for (int i = 0; i < 2; i++) {
+    for (int j = 0; j < _cs_sles_n_max_systems[i]; j++) {
+      const cs_sles_t *sles = _cs_sles_systems[i][j];
+      if (sles == nullptr)
+        continue;
+      if (sles->n_calls < 1)
+        continue;
+      const char *keys[] = {"n_setups", "n_solves", "n_no_op",
+                            "n_iterations", "max_iterations",
+                            "setup_time", "solve_time"};
+      double vals[] = {(double)sles->n_setups,
+                       (double)sles->n_solves,
+                       (double)sles->n_no_op,
+                       (double)sles->n_iter_tot,
+                       (double)sles->n_iter_max,
+                       sles->t_setup.nsec*1e-9,
+                       sles->t_solve.nsec*1e-9};
+      cs_perf_report_add("linear_solvers",
+                         cs_sles_base_name(sles->f_id, sles->name),
+                         7, keys, vals);
+    }
+  }
+
   for (int i = 0; i < 3; i++) {
 
     for (int j = 0; j < _cs_sles_n_max_systems[i]; j++) {
@@ -1664,6 +1888,8 @@ void
 cs_sles_setup(cs_sles_t          *sles,
               const cs_matrix_t  *a)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_LINEAR_SOLVERS);
+
   cs_timer_t t0 = cs_timer_time();
 
   if (sles->context == nullptr)
@@ -1675,7 +1901,9 @@ cs_sles_setup(cs_sles_t          *sles,
 
   if (sles->setup_func != nullptr) {
     const char  *sles_name = cs_sles_base_name(sles->f_id, sles->name);
+    cs_trace_begin("sles_setup", sles_name);
     sles->setup_func(sles->context, sles_name, a, sles->verbosity);
+    cs_trace_end();
   }
 
   /* Prepare residual postprocessing if required */
@@ -1694,6 +1922,11 @@ cs_sles_setup(cs_sles_t          *sles,
 
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(&_sles_t_tot, &t0, &t1);
+
+  sles->n_setups += 1;
+  sles->setup_state = 1;
+  cs_timer_counter_add_diff(&(sles->t_setup), &t0, &t1);
+  cs_timer_counter_add_diff(&(sles->t_setup_cur), &t0, &t1);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1759,6 +1992,8 @@ cs_sles_solve(cs_sles_t           *sles,
 
   const char  *sles_name = cs_sles_base_name(sles->f_id, sles->name);
 
+  cs_trace_begin("sles_solve", sles_name);
+
 #if 0
   /* Dump linear system to file (for experimenting with external tools) */
   cs_matrix_dump_linear_system(a, rhs, sles_name);
@@ -1860,11 +2095,26 @@ cs_sles_solve(cs_sles_t           *sles,
     CS_FREE(resr);
   }
 
+  cs_trace_end();
+
   cs_timer_stats_switch(t_top_id);
 
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(&_sles_t_tot, &t0, &t1);
 
+  sles->n_solves += 1;
+  sles->n_iter_max = cs::max(sles->n_iter_max, *n_iter);
+  sles->n_iter_tot += *n_iter;
+  cs_timer_counter_add_diff(&(sles->t_solve), &t0, &t1);
+
+  if (_telemetry_size > 0) {
+    cs_timer_counter_t t_solve = cs_timer_diff(&t0, &t1);
+    _telemetry_add(sles, sles_name, state, *n_iter, precision, r_norm,
+                   *residual, (sles->setup_state == 2), &t_solve);
+  }
+  CS_TIMER_COUNTER_INIT(sles->t_setup_cur);
+  sles->setup_state = 2;
+
   return state;
 }
 
@@ -1887,6 +2137,7 @@ cs_sles_free(cs_sles_t  *sles)
   if (sles != nullptr) {
     if (sles->free_func != nullptr)
       sles->free_func(sles->context);
+    sles->setup_state = 0;
   }
 }
 
@@ -318,6 +318,28 @@ cs_sles_set_epzero(double  new_value);
 double
 cs_sles_get_epzero(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate per-call linear solver telemetry.
+ *
+ * When active, each call to \ref cs_sles_solve is recorded (time step,
+ * system name, solver type, iterations, convergence state, whether a
+ * previous setup was reused, precision, residual normalization, final
+ * residual, and setup and solve times). Records are buffered and appended
+ * to the "sles_telemetry.csv" file when the buffer is full, and at
+ * finalization.
+ *
+ * Telemetry may also be activated by setting the CS_SLES_TELEMETRY
+ * environment variable (whose value, if > 0, defines the buffer size).
+ *
+ * \param[in]  n_records  number of records buffered before output,
+ *                        or 0 to deactivate telemetry
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_telemetry(int  n_records);
+
 /*----------------------------------------------------------------------------
  * \brief Initialize sparse linear equation solver API.
  *----------------------------------------------------------------------------*/
@@ -64,9 +64,11 @@
 #include "alge/cs_matrix_util.h"
 #include "alge/cs_multigrid.h"
 #include "base/cs_parameters.h"
+#include "base/cs_parall.h"
 #include "alge/cs_sles.h"
 #include "alge/cs_sles_it.h"
 #include "alge/cs_sles_pc.h"
+#include "base/cs_time_step.h"
 #include "base/cs_timer.h"
 
 #if defined(HAVE_HYPRE)
@@ -95,10 +97,58 @@ BEGIN_C_DECLS
 
 #define CS_SLES_DEFAULT_N_SETUPS 2  /* Number of concurrent setups allowed */
 
+#define CS_SLES_AUTO_N_CANDIDATES 5  /* Maximum candidates per system,
+                                        including default definition */
+
 /*=============================================================================
  * Local Structure Definitions
  *============================================================================*/
 
+/* Candidate definition for automatic solver selection */
+
+typedef struct {
+
+  const char           *name;         /* Description */
+  cs_sles_it_type_t     type;         /* Iterative solver type */
+  int                   poly_degree;  /* Preconditioner polynomial degree,
+                                         or -1 for multigrid */
+  cs_multigrid_type_t   mg_type;      /* Multigrid preconditioner type */
+  bool                  symmetric;    /* Candidate for symmetric
+                                         (or non-symmetric) systems */
+
+} cs_sles_auto_candidate_t;
+
+/* Automatic solver selection state for a given system */
+
+typedef struct {
+
+  int       f_id;                 /* Associated field id */
+  bool      symmetric;            /* Is the system symmetric ? */
+
+  int       n_candidates;         /* Number of candidates */
+  int       candidate_id[CS_SLES_AUTO_N_CANDIDATES];  /* Ids in candidate
+                                                         definitions, or -1
+                                                         for default */
+  double    t_candidate[CS_SLES_AUTO_N_CANDIDATES];   /* Best time per time
+                                                         step, or < 0 if
+                                                         failed */
+
+  bool      locked;               /* Selection locked (not in trial) */
+  int       cur;                  /* Current candidate */
+  int       defined;              /* Currently defined candidate, or -1
+                                     for fallback after failure */
+  int       pending;              /* Candidate to define, or -1 */
+  int       selected;             /* Last selected candidate, or -1 */
+  int       n_rounds;             /* Number of evaluation rounds */
+
+  int       nt_last;              /* Time step of last solve */
+  int       nt_lock;              /* Time step at which selection locked */
+  int       n_steps;              /* Time steps for current candidate */
+  bool      failed;               /* Has current candidate failed ? */
+  double    t_step;               /* Time for current time step */
+
+} cs_sles_auto_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -111,6 +161,26 @@ static const int _poly_degree_default = 0;
 static const int _n_max_iter_default = 10000;
 static const int _n_max_iter_default_jacobi = 100;
 
+/* Automatic solver selection */
+
+static const cs_sles_auto_candidate_t _auto_candidates[] = {
+  {"CG + multigrid V-cycle", CS_SLES_PCG, -1, CS_MULTIGRID_V_CYCLE, true},
+  {"FCG + multigrid K-cycle", CS_SLES_FCG, -1, CS_MULTIGRID_K_CYCLE, true},
+  {"CG + Jacobi", CS_SLES_PCG, 0, CS_MULTIGRID_V_CYCLE, true},
+  {"CG + polynomial", CS_SLES_PCG, 1, CS_MULTIGRID_V_CYCLE, true},
+  {"BiCGStab + Jacobi", CS_SLES_BICGSTAB, 0, CS_MULTIGRID_V_CYCLE, false},
+  {"GMRES + polynomial", CS_SLES_GMRES, 1, CS_MULTIGRID_V_CYCLE, false},
+  {"GCR + Jacobi", CS_SLES_GCR, 0, CS_MULTIGRID_V_CYCLE, false}};
+
+static const int _n_auto_candidates
+  = sizeof(_auto_candidates) / sizeof(_auto_candidates[0]);
+
+static int              _auto_n_steps = 0;
+static int              _auto_interval = 0;
+
+static int              _n_auto = 0;
+static cs_sles_auto_t  *_auto = nullptr;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -506,6 +576,343 @@ _sles_setup_matrix_by_assembler(int               f_id,
   _matrix_setup[setup_id][1] = a; /* so it is freed later */
 }
 
+/*----------------------------------------------------------------------------
+ * Return automatic selection state associated with a field id.
+ *
+ * parameters:
+ *   f_id <-- associated field id, or < 0
+ *
+ * returns:
+ *   pointer to selection state, or nullptr if not handled
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_auto_t *
+_auto_select_find(int  f_id)
+{
+  if (f_id < 0)
+    return nullptr;
+
+  for (int i = 0; i < _n_auto; i++) {
+    if (_auto[i].f_id == f_id)
+      return _auto + i;
+  }
+
+  return nullptr;
+}
+
+/*----------------------------------------------------------------------------
+ * Return description of a candidate for automatic solver selection.
+ *
+ * parameters:
+ *   as <-- pointer to selection state
+ *   i  <-- candidate index
+ *
+ * returns:
+ *   candidate description
+ *----------------------------------------------------------------------------*/
+
+static const char *
+_auto_select_name(const cs_sles_auto_t  *as,
+                  int                    i)
+{
+  if (as->candidate_id[i] < 0)
+    return _("default");
+
+  return _(_auto_candidates[as->candidate_id[i]].name);
+}
+
+/*----------------------------------------------------------------------------
+ * Add a system to automatic solver selection.
+ *
+ * parameters:
+ *   f_id      <-- associated field id
+ *   symmetric <-- indicates if matrix is symmetric
+ *----------------------------------------------------------------------------*/
+
+static void
+_auto_select_add(int   f_id,
+                 bool  symmetric)
+{
+  CS_REALLOC(_auto, _n_auto + 1, cs_sles_auto_t);
+
+  cs_sles_auto_t *as = _auto + _n_auto;
+  _n_auto += 1;
+
+  as->f_id = f_id;
+  as->symmetric = symmetric;
+
+  /* First candidate is the default definition */
+
+  as->n_candidates = 1;
+  as->candidate_id[0] = -1;
+
+  for (int i = 0; i < _n_auto_candidates; i++) {
+    const cs_sles_auto_candidate_t *c = _auto_candidates + i;
+    if (c->symmetric != symmetric)
+      continue;
+    if (cs_get_device_id() > -1 && c->type == CS_SLES_BICGSTAB)
+      continue;
+    if (as->n_candidates < CS_SLES_AUTO_N_CANDIDATES)
+      as->candidate_id[as->n_candidates++] = i;
+  }
+
+  for (int i = 0; i < CS_SLES_AUTO_N_CANDIDATES; i++)
+    as->t_candidate[i] = -1;
+
+  as->locked = false;
+  as->cur = 0;
+  as->defined = 0;
+  as->pending = -1;
+  as->selected = -1;
+  as->n_rounds = 1;
+
+  as->nt_last = -1;
+  as->nt_lock = -1;
+  as->n_steps = 0;
+  as->failed = false;
+  as->t_step = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Error handler for automatic solver selection candidates.
+ *
+ * In case of failure, the system is redefined using a flexible Krylov
+ * solver with Jacobi preconditioning (which does not have specific matrix
+ * structure requirements), and the solution vector is reset for a re-try.
+ *
+ * parameters:
+ *   sles  <-> pointer to solver object
+ *   state <-- convergence status
+ *   a     <-- matrix
+ *   rhs   <-- right hand side
+ *   vx    <-> system solution
+ *
+ * returns:
+ *   true if fallback solution is possible, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_auto_select_error(cs_sles_t                    *sles,
+                   cs_sles_convergence_state_t   state,
+                   const cs_matrix_t            *a,
+                   const cs_real_t               rhs[],
+                   cs_real_t                     vx[])
+{
+  CS_UNUSED(state);
+  CS_UNUSED(rhs);
+
+  const int f_id = cs_sles_get_f_id(sles);
+
+  cs_sles_auto_t *as = _auto_select_find(f_id);
+  if (as == nullptr || as->defined < 1)
+    return false;
+
+  cs_sles_it_type_t sles_it_type
+    = (as->symmetric) ? CS_SLES_FCG : CS_SLES_GMRES;
+
+  bft_printf(_("\n\n"
+               "Automatic solver selection [%s]: %s failed\n"
+               "  fallback to Jacobi-preconditioned %s for re-try.\n"),
+             cs_sles_get_name(sles), _auto_select_name(as, as->defined),
+             _(cs_sles_it_type_name[sles_it_type]));
+
+  as->failed = true;
+
+  cs_sles_free(sles);
+  cs_sles_it_define(f_id, nullptr, sles_it_type, 0, _n_max_iter_default);
+  as->defined = -1;
+
+  const cs_lnum_t db_size = cs_matrix_get_diag_block_size(a);
+  const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * db_size;
+  for (cs_lnum_t i = 0; i < n_cols; i++)
+    vx[i] = 0;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Define solver for a given automatic selection candidate.
+ *
+ * parameters:
+ *   as <-> pointer to selection state
+ *   i  <-- candidate index
+ *----------------------------------------------------------------------------*/
+
+static void
+_auto_select_define(cs_sles_auto_t  *as,
+                    int              i)
+{
+  const int f_id = as->f_id;
+
+  as->defined = i;
+
+  if (as->candidate_id[i] < 0) {
+    _sles_default_native(f_id, nullptr, CS_MATRIX_N_TYPES, as->symmetric);
+    return;
+  }
+
+  const cs_sles_auto_candidate_t *c = _auto_candidates + as->candidate_id[i];
+
+  if (c->poly_degree < 0) {
+    cs_sles_it_type_t sles_it_type = c->type;
+    if (sles_it_type == CS_SLES_PCG && cs_glob_n_threads > 1)
+      sles_it_type = CS_SLES_FCG;
+    cs_sles_it_t *context = cs_sles_it_define(f_id,
+                                              nullptr,
+                                              sles_it_type,
+                                              -1, /* poly_degree */
+                                              _n_max_iter_default);
+    cs_sles_pc_t *pc = cs_multigrid_pc_create(c->mg_type);
+    cs_sles_it_transfer_pc(context, &pc);
+  }
+  else
+    cs_sles_it_define(f_id,
+                      nullptr,
+                      c->type,
+                      c->poly_degree,
+                      _n_max_iter_default);
+
+  cs_sles_t *sc = cs_sles_find(f_id, nullptr);
+  cs_sles_set_error_handler(sc, _auto_select_error);
+}
+
+/*----------------------------------------------------------------------------
+ * Log timings and selected solver for a system.
+ *
+ * parameters:
+ *   as <-- pointer to selection state
+ *----------------------------------------------------------------------------*/
+
+static void
+_auto_select_log(const cs_sles_auto_t  *as)
+{
+  const cs_field_t *f = cs_field_by_id(as->f_id);
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("\n"
+                  "Automatic solver selection for \"%s\" (time step %d):\n"
+                  "  candidate                       time/step (s)\n"),
+                f->name, as->nt_lock);
+
+  for (int i = 0; i < as->n_candidates; i++) {
+    if (as->t_candidate[i] < 0)
+      cs_log_printf(CS_LOG_DEFAULT, "  %-31s %s\n",
+                    _auto_select_name(as, i), _("failed"));
+    else
+      cs_log_printf(CS_LOG_DEFAULT, "  %-31s %12.5g%s\n",
+                    _auto_select_name(as, i), as->t_candidate[i],
+                    (i == as->cur) ? " *" : "");
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Update automatic selection state before a matrix definition or solve.
+ *
+ * Time step costs are accounted for when the time step changes, so this
+ * function is collective for the ranks sharing the system.
+ *
+ * Redefinition is only possible when the system is not set up, and
+ * before the matching matrix is defined, as its structure may depend on
+ * the solver type.
+ *
+ * parameters:
+ *   as           <-> pointer to selection state
+ *   can_redefine <-- true if system may be redefined
+ *----------------------------------------------------------------------------*/
+
+static void
+_auto_select_update(cs_sles_auto_t  *as,
+                    bool             can_redefine)
+{
+  const int nt = cs_glob_time_step->nt_cur;
+
+  if (nt != as->nt_last && as->nt_last > -1) {
+
+    /* Use the slowest rank's time */
+
+    double t = as->t_step;
+    cs_parall_max(1, CS_DOUBLE, &t);
+    as->t_step = 0;
+
+    /* Steps for which the selected candidate was not yet defined
+       are ignored */
+
+    if (as->locked == false && as->pending < 0) {
+
+      const int i = as->cur;
+
+      as->n_steps += 1;
+      if (as->n_steps == 1 || t < as->t_candidate[i])
+        as->t_candidate[i] = t;
+
+      if (as->failed || as->n_steps >= _auto_n_steps) {
+
+        if (as->failed)
+          as->t_candidate[i] = -1;
+
+        as->n_steps = 0;
+        as->failed = false;
+
+        if (i + 1 < as->n_candidates) {
+          as->cur = i + 1;
+          as->pending = i + 1;
+        }
+        else {
+          int i_best = 0;
+          for (int j = 0; j < as->n_candidates; j++) {
+            if (as->t_candidate[j] < 0)
+              continue;
+            if (   as->t_candidate[i_best] < 0
+                || as->t_candidate[j] < as->t_candidate[i_best])
+              i_best = j;
+          }
+          as->cur = i_best;
+          as->pending = i_best;
+          as->selected = i_best;
+          as->locked = true;
+          as->nt_lock = nt;
+          _auto_select_log(as);
+        }
+
+      }
+
+    }
+
+    else if (as->locked) {
+
+      /* Revert to default in case of failure of the selected solver */
+
+      if (as->failed) {
+        as->failed = false;
+        as->cur = 0;
+        as->pending = 0;
+        as->selected = 0;
+      }
+
+      /* Periodic re-evaluation */
+
+      if (_auto_interval > 0 && nt - as->nt_lock >= _auto_interval) {
+        for (int j = 0; j < as->n_candidates; j++)
+          as->t_candidate[j] = -1;
+        as->locked = false;
+        as->cur = 0;
+        as->pending = 0;
+        as->n_rounds += 1;
+      }
+
+    }
+
+  }
+
+  as->nt_last = nt;
+
+  if (as->pending > -1 && can_redefine) {
+    if (as->pending != as->defined)
+      _auto_select_define(as, as->pending);
+    as->pending = -1;
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -533,6 +940,37 @@ cs_sles_default(int                 f_id,
   _sles_default_native(f_id, name, type, symmetric);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate automatic selection of linear solvers based on
+ *        runtime measurements.
+ *
+ * This applies to solvers for variable fields using the default
+ * definition. Candidate solver and preconditioner combinations (including
+ * the default one) are tried successively for the given number of time
+ * steps each, and the one with the lowest time per time step (using the
+ * slowest rank's time) is then used. Candidates failing to converge are
+ * replaced by the default definition and discarded.
+ *
+ * This must be called before \ref cs_sles_default_setup. It may also be
+ * activated using the CS_SLES_AUTO_SELECT environment variable, set to
+ * "n_steps" or "n_steps,interval".
+ *
+ * \param[in]  n_steps   number of time steps per candidate, or 0
+ *                       to deactivate automatic selection
+ * \param[in]  interval  number of time steps after which selection is
+ *                       re-evaluated, or 0 for no re-evaluation
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_default_set_auto_select(int  n_steps,
+                                int  interval)
+{
+  _auto_n_steps = (n_steps > 0) ? n_steps : 0;
+  _auto_interval = (interval > 0) ? interval : 0;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Default setup for sparse linear equation solver API.
@@ -544,6 +982,14 @@ cs_sles_default(int                 f_id,
 void
 cs_sles_default_setup(void)
 {
+  const char *p = getenv("CS_SLES_AUTO_SELECT");
+  if (p != nullptr && _auto_n_steps == 0) {
+    int n_steps = 0, interval = 0;
+    if (sscanf(p, "%d,%d", &n_steps, &interval) < 1)
+      n_steps = 2;
+    cs_sles_default_set_auto_select(n_steps, interval);
+  }
+
   /* Associate "on the fly default definition" function */
 
   cs_sles_set_default_define(cs_sles_default);
@@ -574,6 +1020,14 @@ cs_sles_default_setup(void)
         if (eqp != nullptr) {
           bool symmetric = (eqp->iconv > 0) ? false : true;
           _sles_default_native(f_id, nullptr, CS_MATRIX_N_TYPES, symmetric);
+
+          /* Automatic selection is restricted to uncoupled systems
+             using the final default definition */
+          int coupling_id
+            = cs_field_get_key_int(f, cs_field_key_id("coupling_entity"));
+          if (   _auto_n_steps > 0 && coupling_id < 0
+              && strcmp(f->name, "hydraulic_head") != 0)
+            _auto_select_add(f_id, symmetric);
         }
       }
 
@@ -602,6 +1056,26 @@ cs_sles_default_setup(void)
 void
 cs_sles_default_finalize(void)
 {
+  if (_n_auto > 0) {
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Automatic linear solver selection:\n\n"
+                    "  system                          rounds  selected\n"));
+    for (int i = 0; i < _n_auto; i++) {
+      const cs_sles_auto_t *as = _auto + i;
+      const cs_field_t *f = cs_field_by_id(as->f_id);
+      cs_log_printf(CS_LOG_PERFORMANCE, "  %-31s %6d  %s\n",
+                    f->name, as->n_rounds,
+                    (as->selected > -1) ?
+                    _auto_select_name(as, as->selected) : _("-"));
+    }
+    cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+    cs_log_separator(CS_LOG_PERFORMANCE);
+
+    CS_FREE(_auto);
+    _n_auto = 0;
+  }
+
   cs_sles_log(CS_LOG_PERFORMANCE);
 
   cs_multigrid_finalize();
@@ -681,6 +1155,12 @@ cs_sles_default_get_matrix(int          f_id,
   const cs_field_t *f = nullptr;
   cs_sles_t *sc = cs_sles_find_or_add(f_id, name);
 
+  /* Automatic solver selection */
+
+  cs_sles_auto_t *as = _auto_select_find(f_id);
+  if (as != nullptr)
+    _auto_select_update(as, true);
+
   /* If context has not been defined yet, force default definition.
 
      The matrix type might be modified later based on solver
@@ -694,9 +1174,9 @@ cs_sles_default_get_matrix(int          f_id,
   cs_matrix_type_t mat_type = CS_MATRIX_MSR;
 
   if (f_id > -1) {
+    static const int k_cpl = cs_field_key_id("coupling_entity");
     f = cs_field_by_id(f_id);
-    int coupling_id
-      = cs_field_get_key_int(f, cs_field_key_id("coupling_entity"));
+    int coupling_id = cs_field_get_key_int(f, k_cpl);
     if (coupling_id > -1)
       need_matrix_assembler = true;
   }
@@ -994,6 +1474,11 @@ cs_sles_solve_ccc_fv(cs_sles_t           *sc,
 
   const cs_mesh_t *m = cs_glob_mesh;
 
+  cs_sles_auto_t *as = _auto_select_find(cs_sles_get_f_id(sc));
+  cs_timer_t t0;
+  if (as != nullptr)
+    t0 = cs_timer_time();
+
   /* If system uses specific halo (i.e. when matrix contains more than
      face->cell nonzeroes), allocate specific buffers and synchronize
      right hand side. */
@@ -1062,6 +1547,13 @@ cs_sles_solve_ccc_fv(cs_sles_t           *sc,
 
   }
 
+  if (as != nullptr) {
+    cs_timer_t t1 = cs_timer_time();
+    as->t_step += (t1.sec - t0.sec) + (t1.nsec - t0.nsec)*1e-9;
+    if (cvg < CS_SLES_ITERATING)
+      as->failed = true;
+  }
+
   return cvg;
 }
 
@@ -1120,6 +1612,16 @@ cs_sles_solve_native(int                  f_id,
       setup_id++;
   }
 
+  /* Automatic solver selection */
+
+  cs_sles_auto_t *as = (name == nullptr) ? _auto_select_find(f_id) : nullptr;
+  cs_timer_t t0;
+
+  if (as != nullptr) {
+    _auto_select_update(as, (setup_id >= _n_setups));
+    t0 = cs_timer_time();
+  }
+
   if (setup_id >= _n_setups) {
 
     _n_setups += 1;
@@ -1226,6 +1728,13 @@ cs_sles_solve_native(int                  f_id,
     CS_FREE(_vx);
   }
 
+  if (as != nullptr) {
+    cs_timer_t t1 = cs_timer_time();
+    as->t_step += (t1.sec - t0.sec) + (t1.nsec - t0.nsec)*1e-9;
+    if (cvg < CS_SLES_ITERATING)
+      as->failed = true;
+  }
+
   return cvg;
 }
 
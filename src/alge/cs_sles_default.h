@@ -77,6 +77,33 @@ cs_sles_default(int                 f_id,
                 const char         *name,
                 const cs_matrix_t  *a);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate automatic selection of linear solvers based on
+ *        runtime measurements.
+ *
+ * This applies to solvers for variable fields using the default
+ * definition. Candidate solver and preconditioner combinations (including
+ * the default one) are tried successively for the given number of time
+ * steps each, and the one with the lowest time per time step (using the
+ * slowest rank's time) is then used. Candidates failing to converge are
+ * replaced by the default definition and discarded.
+ *
+ * This must be called before \ref cs_sles_default_setup. It may also be
+ * activated using the CS_SLES_AUTO_SELECT environment variable, set to
+ * "n_steps" or "n_steps,interval".
+ *
+ * \param[in]  n_steps   number of time steps per candidate, or 0
+ *                       to deactivate automatic selection
+ * \param[in]  interval  number of time steps after which selection is
+ *                       re-evaluated, or 0 for no re-evaluation
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_default_set_auto_select(int  n_steps,
+                                int  interval);
+
 /*----------------------------------------------------------------------------
  * Default setup setup for sparse linear equation solver API.
  *
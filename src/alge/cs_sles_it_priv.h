@@ -57,6 +57,7 @@
 #include "base/cs_file.h"
 #include "base/cs_log.h"
 #include "base/cs_halo.h"
+#include "base/cs_parall.h"
 #include "mesh/cs_mesh.h"
 #include "alge/cs_matrix.h"
 #include "alge/cs_matrix_default.h"
@@ -277,6 +278,8 @@ _dot_product(const cs_sles_it_t  *c,
 
   if (c->comm != MPI_COMM_NULL) {
     double _sum;
+    if (cs_glob_parall_barrier_wait)
+      cs_parall_barrier_wait(c->comm);
     MPI_Allreduce(&s, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
     s = _sum;
   }
@@ -309,6 +312,8 @@ _dot_product_xx(const cs_sles_it_t  *c,
 
   if (c->comm != MPI_COMM_NULL) {
     double _sum;
+    if (cs_glob_parall_barrier_wait)
+      cs_parall_barrier_wait(c->comm);
     MPI_Allreduce(&s, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
     s = _sum;
   }
@@ -344,6 +349,8 @@ _dot_products_xx_xy(const cs_sles_it_t  *c,
 
   if (c->comm != MPI_COMM_NULL) {
     double _sum[2];
+    if (cs_glob_parall_barrier_wait)
+      cs_parall_barrier_wait(c->comm);
     MPI_Allreduce(s, _sum, 2, MPI_DOUBLE, MPI_SUM, c->comm);
     s[0] = _sum[0];
     s[1] = _sum[1];
@@ -383,6 +390,8 @@ _dot_products_xy_yz(const cs_sles_it_t  *c,
 
   if (c->comm != MPI_COMM_NULL) {
     double _sum[2];
+    if (cs_glob_parall_barrier_wait)
+      cs_parall_barrier_wait(c->comm);
     MPI_Allreduce(s, _sum, 2, MPI_DOUBLE, MPI_SUM, c->comm);
     s[0] = _sum[0];
     s[1] = _sum[1];
@@ -425,6 +434,8 @@ _dot_products_xx_xy_yz(const cs_sles_it_t  *c,
   if (c->comm != MPI_COMM_NULL) {
     double _sum[3];
 
+    if (cs_glob_parall_barrier_wait)
+      cs_parall_barrier_wait(c->comm);
     MPI_Allreduce(s, _sum, 3, MPI_DOUBLE, MPI_SUM, c->comm);
     s[0] = _sum[0];
     s[1] = _sum[1];
@@ -472,6 +483,8 @@ _dot_products_xx_yy_xy_xz_yz(const cs_sles_it_t  *c,
 
   if (c->comm != MPI_COMM_NULL) {
     double _sum[5];
+    if (cs_glob_parall_barrier_wait)
+      cs_parall_barrier_wait(c->comm);
     MPI_Allreduce(s, _sum, 5, MPI_DOUBLE, MPI_SUM, c->comm);
     memcpy(s, _sum, 5*sizeof(double));
   }
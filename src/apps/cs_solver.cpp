@@ -48,6 +48,7 @@
 #include "base/cs_ast_coupling.h"
 #include "atmo/cs_atmo.h"
 #include "alge/cs_balance.h"
+#include "alge/cs_balance_by_zone.h"
 #include "base/cs_base.h"
 #include "base/cs_base_fortran.h"
 #include "alge/cs_benchmark.h"
@@ -56,6 +57,7 @@
 #include "base/cs_calcium.h"
 #include "cdo/cs_cdo_main.h"
 #include "alge/cs_cell_to_vertex.h"
+#include "base/cs_comm_profile.h"
 #include "base/cs_control.h"
 #include "base/cs_coupling.h"
 #include "ctwr/cs_ctwr.h"
@@ -99,12 +101,14 @@
 #include "cdo/cs_param_cdo.h"
 #include "base/cs_paramedmem_coupling.h"
 #include "base/cs_parameters.h"
+#include "base/cs_perf_report.h"
 #include "base/cs_physical_properties.h"
 #include "base/cs_post.h"
 #include "base/cs_post_default.h"
 #include "base/cs_preprocess.h"
 #include "base/cs_preprocessor_data.h"
 #include "base/cs_probe.h"
+#include "base/cs_probe_spectra.h"
 #include "cdo/cs_property.h"
 #include "base/cs_prototypes.h"
 #include "base/cs_random.h"
@@ -113,8 +117,10 @@
 #include "base/cs_runaway_check.h"
 #include "base/cs_sat_coupling.h"
 #include "base/cs_setup.h"
+#include "base/cs_solve_equation.h"
 #include "alge/cs_sles.h"
 #include "alge/cs_sles_default.h"
+#include "base/cs_steady_acceleration.h"
 #include "base/cs_syr_coupling.h"
 #include "base/cs_sys_coupling.h"
 #include "base/cs_system_info.h"
@@ -124,6 +130,7 @@
 #include "base/cs_time_table.h"
 #include "base/cs_timer.h"
 #include "base/cs_timer_stats.h"
+#include "base/cs_trace.h"
 #include "base/cs_tree.h"
 #include "base/cs_turbomachinery.h"
 #include "base/cs_utilities.h"
@@ -231,6 +238,9 @@ _run(void)
   if (cs_get_device_id() < 0)
     cs_halo_set_buffer_alloc_mode(CS_ALLOC_HOST);
 
+  cs_trace_initialize();
+  cs_comm_profile_initialize();
+
   cs_timer_stats_initialize();
   cs_timer_stats_define_defaults();
 
@@ -594,6 +604,8 @@ _run(void)
   cs_atmo_finalize();
   cs_ctwr_all_destroy();
   cs_fan_destroy_all();
+  cs_steady_acceleration_finalize();
+  cs_solve_equation_finalize();
 
   /* Free internal coupling */
 
@@ -615,9 +627,11 @@ _run(void)
 
   /* Free post processing or logging related structures */
 
+  cs_probe_spectra_finalize();
   cs_probe_finalize();
   cs_post_finalize();
   cs_log_iteration_destroy_all();
+  cs_balance_by_zone_finalize();
 
   cs_function_destroy_all();
 
@@ -664,15 +678,19 @@ _run(void)
 
   /* CPU times and memory management finalization */
 
+  cs_comm_profile_finalize();
   cs_all_to_all_log_finalize();
   cs_io_log_finalize();
 
   cs_timer_stats_finalize();
+  cs_trace_finalize();
 
   cs_file_free_defaults();
 
   cs_base_time_summary();
 
+  cs_perf_report_finalize();
+
   cs_base_mem_finalize();
 
   cs_log_printf_flush(CS_LOG_N_TYPES);
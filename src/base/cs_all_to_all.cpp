@@ -47,12 +47,14 @@
 #include "base/cs_base.h"
 #include "base/cs_assert.h"
 #include "base/cs_block_dist.h"
+#include "base/cs_comm_profile.h"
 #include "base/cs_crystal_router.h"
 #include "base/cs_log.h"
 #include "base/cs_order.h"
 #include "base/cs_mem.h"
 #include "base/cs_rank_neighbors.h"
 #include "base/cs_timer.h"
+#include "base/cs_trace.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -1004,6 +1006,10 @@ _alltoall_caller_exchange_s(cs_all_to_all_t           *d,
     _n_trace += 1;
   }
 
+  if (cs_glob_comm_profile_active)
+    cs_comm_profile_add_counts(CS_COMM_PROFILE_OP_ALL_TO_ALL, dc->comm,
+                               dc->send_count, dc->comp_size);
+
   MPI_Alltoallv(dc->send_buffer, dc->send_count, dc->send_displ, dc->comp_type,
                 _recv_data, dc->recv_count, dc->recv_displ, dc->comp_type,
                 dc->comm);
@@ -1164,6 +1170,10 @@ _alltoall_caller_exchange_i(cs_all_to_all_t           *d,
     _n_trace += 1;
   }
 
+  if (cs_glob_comm_profile_active)
+    cs_comm_profile_add_counts(CS_COMM_PROFILE_OP_ALL_TO_ALL, dc->comm,
+                               dc->send_count, dc->comp_size);
+
   MPI_Alltoallv(dc->send_buffer, dc->send_count, dc->send_displ, dc->comp_type,
                 _recv_data, dc->recv_count, dc->recv_displ, dc->comp_type,
                 dc->comm);
@@ -1875,6 +1885,10 @@ _hybrid_alltoallv(_hybrid_pex_t   *hc,
     _compute_displ(n_ranks, send_count, send_displ);
     _compute_displ(n_ranks, recv_count, recv_displ);
 
+    if (cs_glob_comm_profile_active)
+      cs_comm_profile_add_counts(CS_COMM_PROFILE_OP_ALL_TO_ALL, hc->comm,
+                                 send_count, hc->comp_size);
+
     MPI_Alltoallv(sendbuf, send_count, send_displ, hc->comp_type,
                   recvbuf, recv_count, recv_displ, hc->comp_type,
                   hc->comm);
@@ -3034,6 +3048,7 @@ cs_all_to_all_copy_array(cs_all_to_all_t   *d,
   t1 = cs_timer_time();
   cs_timer_counter_add_diff(_all_to_all_timers + CS_ALL_TO_ALL_TIME_TOTAL,
                             &t0, &t1);
+  cs_trace_add("all_to_all", "all-to-all copy array", nullptr, &t0, &t1);
   _all_to_all_calls[CS_ALL_TO_ALL_TIME_TOTAL] += 1;
 
   return _dest_data;
@@ -3109,6 +3124,7 @@ cs_all_to_all_copy_index(cs_all_to_all_t  *d,
   t1 = cs_timer_time();
   cs_timer_counter_add_diff(_all_to_all_timers + CS_ALL_TO_ALL_TIME_TOTAL,
                             &t0, &t1);
+  cs_trace_add("all_to_all", "all-to-all copy index", nullptr, &t0, &t1);
 
   cs_all_to_all_copy_array(d,
                            CS_LNUM_TYPE,
@@ -3132,6 +3148,7 @@ cs_all_to_all_copy_index(cs_all_to_all_t  *d,
   t1 = cs_timer_time();
   cs_timer_counter_add_diff(_all_to_all_timers + CS_ALL_TO_ALL_TIME_TOTAL,
                             &t0, &t1);
+  cs_trace_add("all_to_all", "all-to-all copy index", nullptr, &t0, &t1);
 
   return _dest_index;
 }
@@ -3409,6 +3426,7 @@ cs_all_to_all_copy_indexed(cs_all_to_all_t  *d,
   t1 = cs_timer_time();
   cs_timer_counter_add_diff(_all_to_all_timers + CS_ALL_TO_ALL_TIME_TOTAL,
                             &t0, &t1);
+  cs_trace_add("all_to_all", "all-to-all copy indexed", nullptr, &t0, &t1);
   _all_to_all_calls[CS_ALL_TO_ALL_TIME_TOTAL] += 1;
 
   return _dest_data;
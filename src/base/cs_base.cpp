@@ -1706,6 +1706,65 @@ cs_base_mem_init(void)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Log memory usage summary by allocation tag.
+ *----------------------------------------------------------------------------*/
+
+static void
+_mem_tags_summary(void)
+{
+  const int n_tags = CS_MEM_N_TAGS;
+
+  double v_max[CS_MEM_N_TAGS*3], v_sum[CS_MEM_N_TAGS];
+
+  for (int i = 0; i < n_tags; i++) {
+    uint64_t alloc_cur = 0, alloc_max = 0, n_allocs = 0;
+    cs_mem_tag_stats((cs_mem_tag_t)i, &alloc_cur, &alloc_max, &n_allocs);
+    v_max[i*3]     = alloc_max;
+    v_max[i*3 + 1] = alloc_cur;
+    v_max[i*3 + 2] = n_allocs;
+    v_sum[i] = alloc_max;
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    double v_l[CS_MEM_N_TAGS*3];
+    memcpy(v_l, v_max, sizeof(v_l));
+    MPI_Reduce(v_l, v_max, n_tags*3, MPI_DOUBLE, MPI_MAX,
+               0, cs_glob_mpi_comm);
+    memcpy(v_l, v_sum, n_tags*sizeof(double));
+    MPI_Reduce(v_l, v_sum, n_tags, MPI_DOUBLE, MPI_SUM,
+               0, cs_glob_mpi_comm);
+  }
+#endif
+
+  int n_active = 0;
+  for (int i = 1; i < n_tags; i++) {
+    if (v_max[i*3 + 2] > 0)
+      n_active++;
+  }
+
+  if (n_active == 0)
+    return;
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nDynamic memory by allocation tag (MiB):\n\n"
+                  "                    peak (mean)    peak (max)"
+                  "     end (max)\n"));
+
+  const double mib = 1.0 / (1024.*1024.);
+
+  for (int i = 1; i < n_tags; i++) {
+    if (v_max[i*3 + 2] < 1)
+      continue;
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %-16s %13.3f %13.3f %13.3f\n",
+                  _(cs_mem_tag_name((cs_mem_tag_t)i)),
+                  v_sum[i]*mib / cs_glob_n_ranks,
+                  v_max[i*3]*mib, v_max[i*3 + 1]*mib);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Finalize management of memory allocated through BFT.
  *
@@ -1861,6 +1920,10 @@ cs_base_mem_finalize(void)
 
   }
 
+  /* Memory by allocation tag */
+
+  _mem_tags_summary();
+
   /* Finalize extra communicators now as they use memory allocated through
      bft_mem_* API */
 
@@ -97,6 +97,7 @@
 #include "base/cs_preprocess.h"
 #include "base/cs_preprocessor_data.h"
 #include "base/cs_probe.h"
+#include "base/cs_probe_spectra.h"
 #include "base/cs_prototypes.h"
 #include "base/cs_random.h"
 #include "base/cs_reducers.h"
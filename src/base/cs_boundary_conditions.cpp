@@ -126,6 +126,18 @@ typedef struct {
   double          tolerance;           /* search tolerance */
 
   ple_locator_t  *locator;             /* associated locator */
+  int             nt_located;          /* time step at which location
+                                          was last done */
+  cs_lnum_t       n_vtx_located;       /* number of mesh vertices at
+                                          last location */
+  cs_real_t      *vtx_coord_located;   /* mesh vertex coordinates at last
+                                          location, for moving meshes */
+
+#if defined(HAVE_MPI)
+  MPI_Comm        comm;                /* communicator restricted to ranks
+                                          with selected boundary faces, for
+                                          balance reductions */
+#endif
 
 } cs_bc_map_t;
 
@@ -225,15 +237,69 @@ _get_equation_param(const char  *name)
   return eqp;
 }
 
+/*----------------------------------------------------------------------------
+ * Free location data of a boundary condition map.
+ *
+ * parameters:
+ *   bc_map <-> pointer to boundary condition map
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_bc_map_location(cs_bc_map_t  *bc_map)
+{
+  bc_map->locator = ple_locator_destroy(bc_map->locator);
+  bc_map->nt_located = -1;
+  bc_map->n_vtx_located = 0;
+  CS_FREE(bc_map->vtx_coord_located);
+
+#if defined(HAVE_MPI)
+  if (bc_map->comm != MPI_COMM_NULL)
+    MPI_Comm_free(&(bc_map->comm));
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Check if mesh vertices have moved since a boundary condition map
+ * was last located.
+ *
+ * This function is collective, so that all ranks return the same value.
+ *
+ * parameters:
+ *   bc_map <-- pointer to boundary condition map
+ *   m      <-- pointer to mesh
+ *
+ * returns:
+ *   true if vertices have moved on any rank, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_bc_map_mesh_moved(const cs_bc_map_t  *bc_map,
+                   const cs_mesh_t    *m)
+{
+  int moved = 0;
+
+  if (   bc_map->vtx_coord_located == nullptr
+      || bc_map->n_vtx_located != m->n_vertices)
+    moved = 1;
+  else if (memcmp(bc_map->vtx_coord_located, m->vtx_coord,
+                  m->n_vertices*3*sizeof(cs_real_t)) != 0)
+    moved = 1;
+
+  cs_parall_max(1, CS_INT_TYPE, &moved);
+
+  return (moved > 0);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Build or update map of shifted boundary face coordinates on
  *        cells or boundary faces for automatic interpolation.
  *
- * \warning
- *
- * This function does not currently update the location in case of moving
- * meshes. It could be modifed to do so.
+ * Location is done only once for fixed meshes; for moving or
+ * transient meshes, it is updated at most once per time step, and only
+ * when mesh vertices have actually moved. The communicator used for
+ * balance reductions is only rebuilt when the mesh connectivity may
+ * change, as the selected faces are otherwise unchanged.
  *
  * \param[in]  map_id      id of defined map
  */
@@ -246,8 +312,22 @@ _update_bc_map(int  map_id)
 
   cs_bc_map_t *bc_map = _bc_maps + map_id;
 
-  if (bc_map->locator != nullptr)
-    return;
+  const cs_mesh_t *m = cs_glob_mesh;
+  const bool transient_connect = (m->time_dep == CS_MESH_TRANSIENT_CONNECT);
+  const bool moving = (   m->time_dep != CS_MESH_FIXED
+                       || cs_glob_ale != CS_ALE_NONE);
+  const bool first_location = (bc_map->locator == nullptr);
+
+  if (first_location == false) {
+    if (   moving == false
+        || bc_map->nt_located >= cs_glob_time_step->nt_cur)
+      return;
+    if (transient_connect == false && _bc_map_mesh_moved(bc_map, m) == false) {
+      bc_map->nt_located = cs_glob_time_step->nt_cur;
+      return;
+    }
+    bc_map->locator = ple_locator_destroy(bc_map->locator);
+  }
 
   cs_mesh_location_type_t location_type
     = cs_mesh_location_get_type(bc_map->source_location_id);
@@ -270,10 +350,40 @@ _update_bc_map(int  map_id)
                                                &(bc_map->coord_shift),
                                                0,
                                                bc_map->tolerance);
+
+  bc_map->nt_located = cs_glob_time_step->nt_cur;
+
+  /* Keep vertex coordinates to detect actual mesh motion */
+
+  if (moving && transient_connect == false) {
+    const cs_lnum_t n_vals = m->n_vertices*3;
+    bc_map->n_vtx_located = m->n_vertices;
+    CS_REALLOC(bc_map->vtx_coord_located, n_vals, cs_real_t);
+    memcpy(bc_map->vtx_coord_located, m->vtx_coord,
+           n_vals*sizeof(cs_real_t));
+  }
+
+  /* Balance sums only involve ranks with selected faces, so build
+     a matching communicator rather than reducing over all ranks
+     (ranks with no selected faces have a null communicator). */
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1 && (first_location || transient_connect)) {
+    if (bc_map->comm != MPI_COMM_NULL)
+      MPI_Comm_free(&(bc_map->comm));
+    MPI_Comm_split(cs_glob_mpi_comm,
+                   (n_faces > 0) ? 0 : MPI_UNDEFINED,
+                   cs_glob_rank_id,
+                   &(bc_map->comm));
+  }
+#endif
 }
 
 /*----------------------------------------------------------------------------
- * Compute balance at inlet
+ * Compute local contribution to balance at inlet
+ *
+ * Values are not summed over ranks here, so that reductions for multiple
+ * fields may be grouped by the caller.
  *
  * parameters:
  *   f               <-- associated field
@@ -294,7 +404,7 @@ _update_bc_map(int  map_id)
  *   faces           <-- list of selected boundary faces (0 to n-1),
  *                       or nullptr if no indirection is needed
  *   balance_w       <-- optional balance weight, or nullptr
- *   inlet_sum       --> inlet sum
+ *   inlet_sum       --> local inlet sum
  *----------------------------------------------------------------------------*/
 
 static void
@@ -342,8 +452,312 @@ _inlet_sum(const cs_field_t            *f,
     }
 
   }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute values of a field at mapped (distant) points.
+ *
+ * parameters:
+ *   f             <-- associated field
+ *   location_type <-- matching location type
+ *   interpolate   <-- interpolation option:
+ *                       0: values are simply based on matching
+ *                          cell or face center values
+ *                       1: values are based on matching cell or face
+ *                          center values, corrected by gradient
+ *                          interpolation
+ *   n_dist        <-- number of distant points
+ *   dist_loc      <-- element ids matching distant points
+ *   dist_coords   <-- coordinates of distant points
+ *   distant_var   --> values at distant points (interlaced)
+ *----------------------------------------------------------------------------*/
+
+static void
+_mapped_distant_values(const cs_field_t         *f,
+                       cs_mesh_location_type_t   location_type,
+                       int                       interpolate,
+                       cs_lnum_t                 n_dist,
+                       const ple_lnum_t         *dist_loc,
+                       const ple_coord_t        *dist_coords,
+                       cs_real_t                *distant_var)
+{
+  const int dim = f->dim;
+
+  cs_field_interpolate_t   interpolation_type = CS_FIELD_INTERPOLATE_MEAN;
+
+  if (interpolate)
+    interpolation_type = CS_FIELD_INTERPOLATE_GRADIENT;
+
+  assert(sizeof(ple_coord_t) == sizeof(cs_real_t));
+
+  if (location_type == CS_MESH_LOCATION_CELLS || interpolate) {
+    /* FIXME: we cheat here with the constedness of the field
+       for a possible ghost values update, but having a finer control
+       of when syncing is required would be preferable */
+    cs_field_t *_f = cs_field_by_id(f->id);
+    cs_field_interpolate(_f,
+                         interpolation_type,
+                         n_dist,
+                         dist_loc,
+                         (const cs_real_3_t *)dist_coords,
+                         distant_var);
+  }
+
+  else if (location_type == CS_MESH_LOCATION_BOUNDARY_FACES) {
+
+    const cs_lnum_t *b_face_cells = cs_glob_mesh->b_face_cells;
+    const cs_field_bc_coeffs_t   *bc_coeffs = f->bc_coeffs;
+
+    /* If boundary condition coefficients are available */
+
+    if (bc_coeffs != nullptr) {
+
+      if (dim == 1) {
+        for (cs_lnum_t i = 0; i < n_dist; i++) {
+          cs_lnum_t f_id = dist_loc[i];
+          cs_lnum_t c_id = b_face_cells[f_id];
+          distant_var[i] =   bc_coeffs->a[f_id]
+                           + bc_coeffs->b[f_id]*f->val[c_id];
+        }
+      }
+      else {
+        for (cs_lnum_t i = 0; i < n_dist; i++) {
+          cs_lnum_t f_id = dist_loc[i];
+          cs_lnum_t c_id = b_face_cells[f_id];
+          for (cs_lnum_t j = 0; j < dim; j++) {
+            distant_var[i*dim+j] = bc_coeffs->a[f_id*dim+j];
+            for (cs_lnum_t k = 0; k < dim; k++)
+              distant_var[i*dim+j] +=  bc_coeffs->b[(f_id*dim+k)*dim + j]
+                                      *f->val[c_id*dim+k];
+          }
+        }
+      }
+
+    }
+
+    /* If no boundary condition coefficients are available */
+
+    else {
+
+      for (cs_lnum_t i = 0; i < n_dist; i++) {
+        cs_lnum_t f_id = dist_loc[i];
+        cs_lnum_t c_id = b_face_cells[f_id];
+        for (cs_lnum_t j = 0; j < dim; j++)
+          distant_var[i*dim+j] = f->val[c_id*dim+j];
+      }
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Apply a boundary condition map to all matching variable fields.
+ *
+ * Values of all fields are exchanged in a single pass, and balance
+ * sums used for normalization are reduced in a single operation
+ * restricted to ranks with selected faces.
+ *
+ * parameters:
+ *   bc_map <-- pointer to boundary condition map
+ *----------------------------------------------------------------------------*/
+
+static void
+_apply_bc_map(const cs_bc_map_t  *bc_map)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+
+  ple_locator_t *locator = bc_map->locator;
+
+  const ple_lnum_t n_dist = ple_locator_get_n_dist_points(locator);
+  const ple_lnum_t *dist_loc = ple_locator_get_dist_locations(locator);
+  const ple_coord_t *dist_coords = ple_locator_get_dist_coords(locator);
+
+  cs_mesh_location_type_t location_type
+    = cs_mesh_location_get_type(bc_map->source_location_id);
+  cs_lnum_t n_faces
+    = cs_mesh_location_get_n_elts(bc_map->bc_location_id)[0];
+  const cs_lnum_t *faces
+    = cs_mesh_location_get_elt_ids_try(bc_map->bc_location_id);
+
+  /* Select mapped fields */
+
+  const int n_fields = cs_field_n_fields();
+  const int keysca = cs_field_key_id("scalar_id");
+
+  int n_map_fields = 0, stride = 0, max_dim = 0, n_sums = 0;
+  cs_field_t **map_fields;
+  int *normalize;
+  CS_MALLOC(map_fields, n_fields, cs_field_t *);
+  CS_MALLOC(normalize, n_fields, int);
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+    cs_field_t  *f = cs_field_by_id(f_id);
+
+    if (! (f->type & CS_FIELD_VARIABLE))
+      continue;
+
+    const cs_equation_param_t *eqp
+      = cs_field_get_equation_param_const(f);
+
+    /* Only handle legacy discretization here */
+    if (eqp != nullptr) {
+      if (eqp->space_scheme != CS_SPACE_SCHEME_LEGACY)
+        continue;
+    }
+
+    if (f->type & CS_FIELD_CDO)
+      continue;
+
+    if (f->bc_coeffs == nullptr || f == CS_F_(p))
+      continue;
+
+    assert(f->location_id == CS_MESH_LOCATION_CELLS);
+    assert(f->dim <= 9);
+
+    int _normalize = 0;
+    if (f == CS_F_(vel) || cs_field_get_key_int(f, keysca) > 0) {
+      _normalize = 1;
+      n_sums += f->dim;
+    }
+
+    map_fields[n_map_fields] = f;
+    normalize[n_map_fields] = _normalize;
+    n_map_fields += 1;
+
+    stride += f->dim;
+    max_dim = cs::max(max_dim, f->dim);
+  }
+
+  if (n_map_fields == 0) {
+    CS_FREE(normalize);
+    CS_FREE(map_fields);
+    return;
+  }
+
+  /* Initial (local) balance; sums after mapping are stored
+     after initial sums so as to be reduced together */
+
+  cs_real_t *inlet_sum;
+  CS_MALLOC(inlet_sum, 2*n_sums, cs_real_t);
+
+  for (int i = 0, s_id = 0; i < n_map_fields; i++) {
+    if (normalize[i] > 0) {
+      _inlet_sum(map_fields[i], m, mq, normalize[i],
+                 n_faces, faces, nullptr, inlet_sum + s_id);
+      s_id += map_fields[i]->dim;
+    }
+  }
+
+  /* Prepare interlaced values of all fields, and exchange them
+     in a single pass */
+
+  cs_real_t *distant_var, *local_var, *f_var;
+  CS_MALLOC(distant_var, n_dist*stride, cs_real_t);
+  CS_MALLOC(local_var, n_faces*stride, cs_real_t);
+  CS_MALLOC(f_var, n_dist*max_dim, cs_real_t);
+
+  for (int i = 0, v_id = 0; i < n_map_fields; i++) {
+    const int dim = map_fields[i]->dim;
+    _mapped_distant_values(map_fields[i],
+                           location_type,
+                           0,                 /* interpolate */
+                           n_dist,
+                           dist_loc,
+                           dist_coords,
+                           f_var);
+    for (cs_lnum_t j = 0; j < n_dist; j++) {
+      for (cs_lnum_t k = 0; k < dim; k++)
+        distant_var[j*stride + v_id + k] = f_var[j*dim + k];
+    }
+    v_id += dim;
+  }
+
+  CS_FREE(f_var);
+
+  ple_locator_exchange_point_var(locator,
+                                 distant_var,
+                                 local_var,
+                                 nullptr,               /* faces indirection */
+                                 sizeof(cs_real_t),
+                                 stride,
+                                 0);
+
+  CS_FREE(distant_var);
+
+  /* Now set boundary condition values */
+
+  for (int i = 0, v_id = 0, s_id = 0; i < n_map_fields; i++) {
+    const cs_field_t *f = map_fields[i];
+    const int dim = f->dim;
+
+    for (cs_lnum_t j = 0; j < dim; j++) {
+      cs_real_t *rcodcl1 = f->bc_coeffs->rcodcl1 + j*n_b_faces;
+      for (cs_lnum_t k = 0; k < n_faces; k++) {
+        const cs_lnum_t f_id = (faces != nullptr) ? faces[k] : k;
+        rcodcl1[f_id] = local_var[k*stride + v_id + j];
+      }
+    }
+    v_id += dim;
+
+    if (normalize[i] > 0) {
+      _inlet_sum(f, m, mq, normalize[i],
+                 n_faces, faces, nullptr, inlet_sum + n_sums + s_id);
+      s_id += dim;
+    }
+  }
 
-  cs_parall_sum(dim, CS_REAL_TYPE, inlet_sum);
+  CS_FREE(local_var);
+
+#if defined(HAVE_MPI)
+  if (bc_map->comm != MPI_COMM_NULL)
+    MPI_Allreduce(MPI_IN_PLACE, inlet_sum, 2*n_sums, CS_MPI_REAL, MPI_SUM,
+                  bc_map->comm);
+#endif
+
+  /* Normalize values */
+
+  for (int i = 0, s_id = 0; i < n_map_fields; i++) {
+    const cs_field_t *f = map_fields[i];
+    const int dim = f->dim;
+
+    if (normalize[i] > 0) {
+      const cs_real_t *inlet_sum_0 = inlet_sum + s_id;
+      const cs_real_t *inlet_sum_1 = inlet_sum + n_sums + s_id;
+
+      for (cs_lnum_t j = 0; j < dim; j++) {
+
+        const cs_real_t f_mult = (fabs(inlet_sum_1[j]) > 1.e-24) ?
+                                 inlet_sum_0[j] / inlet_sum_1[j] : 1.;
+
+        cs_real_t *rcodcl1 = f->bc_coeffs->rcodcl1 + j*n_b_faces;
+
+        for (cs_lnum_t k = 0; k < n_faces; k++) {
+          const cs_lnum_t f_id = (faces != nullptr) ? faces[k] : k;
+          rcodcl1[f_id] *= f_mult;
+        }
+
+      }
+
+      s_id += dim;
+    }
+
+    if (f == CS_F_(h)) {
+      int  *icodcl = f->bc_coeffs->icodcl;
+
+      for (cs_lnum_t k = 0; k < n_faces; k++) {
+        const cs_lnum_t f_id = (faces != nullptr) ? faces[k] : k;
+        if (icodcl[f_id] < 0)
+          icodcl[f_id] *= -1;
+      }
+    }
+  }
+
+  CS_FREE(inlet_sum);
+  CS_FREE(normalize);
+  CS_FREE(map_fields);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2004,8 +2418,6 @@ cs_boundary_conditions_mapped_set(const cs_field_t          *f,
   const ple_lnum_t *dist_loc = ple_locator_get_dist_locations(locator);
   const ple_coord_t *dist_coords = ple_locator_get_dist_coords(locator);
 
-  cs_field_interpolate_t   interpolation_type = CS_FIELD_INTERPOLATE_MEAN;
-
   cs_real_t inlet_sum_0[9], inlet_sum_1[9];
   cs_real_t *distant_var, *local_var;
 
@@ -2028,6 +2440,7 @@ cs_boundary_conditions_mapped_set(const cs_field_t          *f,
                faces,
                balance_w,
                inlet_sum_0);
+    cs_parall_sum(dim, CS_REAL_TYPE, inlet_sum_0);
   }
 
   /* Allocate working array */
@@ -2038,70 +2451,13 @@ cs_boundary_conditions_mapped_set(const cs_field_t          *f,
   /* Prepare values to send */
   /*------------------------*/
 
-  if (interpolate)
-    interpolation_type = CS_FIELD_INTERPOLATE_GRADIENT;
-
-  assert(sizeof(ple_coord_t) == sizeof(cs_real_t));
-
-  if (location_type == CS_MESH_LOCATION_CELLS || interpolate) {
-    /* FIXME: we cheat here with the constedness of the field
-       for a possible ghost values update, but having a finer control
-       of when syncing is required would be preferable */
-    cs_field_t *_f = cs_field_by_id(f->id);
-    cs_field_interpolate(_f,
-                         interpolation_type,
+  _mapped_distant_values(f,
+                         location_type,
+                         interpolate,
                          n_dist,
                          dist_loc,
-                         (const cs_real_3_t *)dist_coords,
+                         dist_coords,
                          distant_var);
-  }
-
-  else if (location_type == CS_MESH_LOCATION_BOUNDARY_FACES) {
-
-    const cs_lnum_t *b_face_cells = cs_glob_mesh->b_face_cells;
-    const cs_field_bc_coeffs_t   *bc_coeffs = f->bc_coeffs;
-
-    /* If boundary condition coefficients are available */
-
-    if (bc_coeffs != nullptr) {
-
-      if (dim == 1) {
-        for (cs_lnum_t i = 0; i < n_dist; i++) {
-          cs_lnum_t f_id = dist_loc[i];
-          cs_lnum_t c_id = b_face_cells[f_id];
-          distant_var[i] =   bc_coeffs->a[f_id]
-                           + bc_coeffs->b[f_id]*f->val[c_id];
-        }
-      }
-      else {
-        for (cs_lnum_t i = 0; i < n_dist; i++) {
-          cs_lnum_t f_id = dist_loc[i];
-          cs_lnum_t c_id = b_face_cells[f_id];
-          for (cs_lnum_t j = 0; j < dim; j++) {
-            distant_var[i*dim+j] = bc_coeffs->a[f_id*dim+j];
-            for (cs_lnum_t k = 0; k < dim; k++)
-              distant_var[i*dim+j] +=  bc_coeffs->b[(f_id*dim+k)*dim + j]
-                                      *f->val[c_id*dim+k];
-          }
-        }
-      }
-
-    }
-
-    /* If no boundary condition coefficients are available */
-
-    else {
-
-      for (cs_lnum_t i = 0; i < n_dist; i++) {
-        cs_lnum_t f_id = dist_loc[i];
-        cs_lnum_t c_id = b_face_cells[f_id];
-        for (cs_lnum_t j = 0; j < dim; j++)
-          distant_var[i*dim+j] = f->val[c_id*dim+j];
-      }
-
-    }
-
-  }
 
   ple_locator_exchange_point_var(locator,
                                  distant_var,
@@ -2139,6 +2495,7 @@ cs_boundary_conditions_mapped_set(const cs_field_t          *f,
                faces,
                balance_w,
                inlet_sum_1);
+    cs_parall_sum(dim, CS_REAL_TYPE, inlet_sum_1);
 
     for (cs_lnum_t j = 0; j < dim; j++) {
 
@@ -2204,6 +2561,13 @@ cs_boundary_conditions_add_map(int         bc_location_id,
   bc_map->tolerance = tolerance;
 
   bc_map->locator = nullptr;
+  bc_map->nt_located = -1;
+  bc_map->n_vtx_located = 0;
+  bc_map->vtx_coord_located = nullptr;
+
+#if defined(HAVE_MPI)
+  bc_map->comm = MPI_COMM_NULL;
+#endif
 
   _n_bc_maps += 1;
 
@@ -2342,7 +2706,7 @@ cs_boundary_conditions_free(void)
   CS_FREE(_bc_pm_face_zone);
 
   for (int i = 0; i < _n_bc_maps; i++)
-    ple_locator_destroy((_bc_maps + i)->locator);
+    _free_bc_map_location(_bc_maps + i);
 
   CS_FREE(_bc_maps);
   _n_bc_maps = 0;
@@ -2632,85 +2996,16 @@ cs_boundary_conditions_complete(int  bc_type[])
   for (int map_id = 0; map_id < _n_bc_maps; map_id++)
     _update_bc_map(map_id);
 
-  /* Loop on fields */
+  /* Treatment of mapped inlets */
 
-  const int n_fields = cs_field_n_fields();
+  for (int map_id = 0; map_id < _n_bc_maps; map_id++) {
 
-  for (int f_id = 0; f_id < n_fields; f_id++) {
-    cs_field_t  *f = cs_field_by_id(f_id);
+    cs_bc_map_t *bc_map = _bc_maps + map_id;
 
-    if (! (f->type & CS_FIELD_VARIABLE))
+    if (bc_map->locator == nullptr || ts->nt_cur <= 1)
       continue;
 
-    const cs_equation_param_t *eqp
-      = cs_field_get_equation_param_const(f);
-
-    /* Only handle legacy discretization here */
-    if (eqp != nullptr) {
-      if (eqp->space_scheme != CS_SPACE_SCHEME_LEGACY)
-        continue;
-    }
-
-    /* Settings in eqp may not be well-defined at this stage. The following
-       test should be more appropriate to decide if one skips this field or
-       not */
-    if (f->type & CS_FIELD_CDO)
-      continue;
-
-    if (f->bc_coeffs == nullptr)
-      continue;
-
-    /* Treatment of mapped inlets */
-
-    for (int map_id = 0; map_id < _n_bc_maps; map_id++) {
-
-      cs_bc_map_t *bc_map = _bc_maps + map_id;
-
-      if (bc_map->locator == nullptr || ts->nt_cur <= 1)
-        continue;
-
-      int interpolate = 0;
-      int normalize = 0;
-      if (f == CS_F_(vel))
-        normalize = 1;
-      else {
-        const int keysca = cs_field_key_id("scalar_id");
-        if (cs_field_get_key_int(f, keysca) > 0)
-          normalize = 1;
-      }
-
-      if (f != CS_F_(p)) {
-        cs_mesh_location_type_t location_type
-          = cs_mesh_location_get_type(bc_map->source_location_id);
-        cs_lnum_t n_faces
-          = cs_mesh_location_get_n_elts(bc_map->bc_location_id)[0];
-        const cs_lnum_t *faces
-          = cs_mesh_location_get_elt_ids_try(bc_map->bc_location_id);
-
-        cs_boundary_conditions_mapped_set(f,
-                                          bc_map->locator,
-                                          location_type,
-                                          normalize,
-                                          interpolate,
-                                          n_faces,
-                                          faces,
-                                          nullptr);
-
-        if (f == CS_F_(h)) {
-          if (f->bc_coeffs != nullptr) {
-            int  *icodcl = f->bc_coeffs->icodcl;
-
-            for (cs_lnum_t i = 0; i < n_faces; i++) {
-              const cs_lnum_t j = (faces != nullptr) ? faces[i] : i;
-              if (icodcl[j] < 0)
-                icodcl[j] *= -1;
-            }
-          }
-        }
-
-      }
-
-    }
+    _apply_bc_map(bc_map);
 
   }
 }
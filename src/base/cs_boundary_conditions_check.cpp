@@ -138,8 +138,8 @@ cs_boundary_conditions_check(int  bc_type[],
     = (cs_turb_model_type_t)cs_glob_turb_model->model;
   int itytur = cs_glob_turb_model->itytur;
 
-  const int keysca = cs_field_key_id("scalar_id");
-  const int kscavr = cs_field_key_id("first_moment_id");
+  static const int keysca = cs_field_key_id("scalar_id");
+  static const int kscavr = cs_field_key_id("first_moment_id");
 
   const cs_real_t *gxyz = cs_get_glob_physical_constants()->gravity;
 
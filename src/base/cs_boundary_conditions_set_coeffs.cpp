@@ -924,12 +924,12 @@ cs_boundary_conditions_set_coeffs(int        nvar,
   const int thermal_variable = cs_glob_thermal_model->thermal_variable;
   const int irijrb = cs_glob_turb_rans_model->irijrb;
 
-  const int keysca  = cs_field_key_id("scalar_id");
-  const int kivisl  = cs_field_key_id("diffusivity_id");
-  const int kturt   = cs_field_key_id("turbulent_flux_model");
-  const int kscacp  = cs_field_key_id("is_temperature");
-  const int kbfid   = cs_field_key_id("boundary_value_id");
-  const int ksigmas = cs_field_key_id("turbulent_schmidt");
+  static const int keysca  = cs_field_key_id("scalar_id");
+  static const int kivisl  = cs_field_key_id("diffusivity_id");
+  static const int kturt   = cs_field_key_id("turbulent_flux_model");
+  static const int kscacp  = cs_field_key_id("is_temperature");
+  static const int kbfid   = cs_field_key_id("boundary_value_id");
+  static const int ksigmas = cs_field_key_id("turbulent_schmidt");
 
   const cs_lnum_t nt_cur = cs_glob_time_step->nt_cur;
 
@@ -983,7 +983,8 @@ cs_boundary_conditions_set_coeffs(int        nvar,
   cs_les_inflow_compute();
 
   /* ALE method (mesh velocity BC and vertices displacement) */
-  cs_field_t *f_displ = cs_field_by_name_try("mesh_displacement");
+  static cs_field_handle_t h_displ = CS_FIELD_HANDLE("mesh_displacement");
+  cs_field_t *f_displ = cs_field_by_handle_try(&h_displ);
 
   if (f_displ != nullptr) { // (cs_glob_ale >= 1)
 
@@ -1116,11 +1117,14 @@ cs_boundary_conditions_set_coeffs(int        nvar,
     bhconv = cs_field_by_name("rad_exchange_coefficient")->val;
   }
 
-  cs_field_t *f_dttens  = cs_field_by_name_try("dttens");
+  static cs_field_handle_t h_dttens = CS_FIELD_HANDLE("dttens");
+  static cs_field_handle_t h_b_stress = CS_FIELD_HANDLE("boundary_stress");
+
+  cs_field_t *f_dttens  = cs_field_by_handle_try(&h_dttens);
   if (f_dttens != nullptr)
     dttens = (const cs_real_6_t *)f_dttens->val;
 
-  cs_field_t *f_b_stress = cs_field_by_name_try("boundary_stress");
+  cs_field_t *f_b_stress = cs_field_by_handle_try(&h_b_stress);
 
   if (f_b_stress != nullptr && iterns == 1)
     b_stress = (cs_real_3_t *)f_b_stress->val;
@@ -1146,19 +1150,23 @@ cs_boundary_conditions_set_coeffs(int        nvar,
     /* Initialization of the array storing yplus
        which is computed in clptur.f90 and/or clptrg.f90 */
 
-    cs_field_t *yplus = cs_field_by_name_try("yplus");
+    static cs_field_handle_t h_yplus = CS_FIELD_HANDLE("yplus");
+    static cs_field_handle_t h_tplus = CS_FIELD_HANDLE("tplus");
+    static cs_field_handle_t h_tstar = CS_FIELD_HANDLE("tstar");
+
+    cs_field_t *yplus = cs_field_by_handle_try(&h_yplus);
     if (yplus != nullptr) {
       yplbr = yplus->val;
       cs_array_real_fill_zero(n_b_faces, yplbr);
     }
 
-    cs_field_t *itplus = cs_field_by_name_try("tplus");
+    cs_field_t *itplus = cs_field_by_handle_try(&h_tplus);
     if (itplus != nullptr) {
       tplusp = itplus->val;
       cs_array_real_fill_zero(n_b_faces, tplusp);
     }
 
-    cs_field_t *itstar = cs_field_by_name_try("tstar");
+    cs_field_t *itstar = cs_field_by_handle_try(&h_tstar);
     if (itstar != nullptr) {
       tstarp = itstar->val;
       cs_array_real_fill_zero(n_b_faces, tstarp);
@@ -4186,7 +4194,7 @@ cs_boundary_conditions_update_bc_coeff_face_values
 
     /* internal coupling */
     if (eqp->icoupl > 0) {
-      const int coupling_key_id = cs_field_key_id("coupling_entity");
+      static const int coupling_key_id = cs_field_key_id("coupling_entity");
       int coupling_id = cs_field_get_key_int(f, coupling_key_id);
       cpl = cs_internal_coupling_by_id(coupling_id);
     }
@@ -4205,8 +4213,8 @@ cs_boundary_conditions_update_bc_coeff_face_values
     }
 
     /* diffusion limiter */
-    int df_limiter_id
-      = cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+    static const int kdflim = cs_field_key_id("diffusion_limiter_id");
+    int df_limiter_id = cs_field_get_key_int(f, kdflim);
     if (df_limiter_id > -1)
       df_limiter = cs_field_by_id(df_limiter_id)->val;
 
@@ -4411,8 +4419,8 @@ cs_boundary_conditions_update_bc_coeff_face_values
      the array is defined but not up to date). */
 
   if (f->bc_coeffs->val_f_d == nullptr && m->n_b_faces > 0) {
-    const int df_limiter_id
-      = cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+    static const int kdflim = cs_field_key_id("diffusion_limiter_id");
+    const int df_limiter_id = cs_field_get_key_int(f, kdflim);
     const int ircflb = (eqp->ircflu > 0) ? eqp->b_diff_flux_rc : 0;
 
     cs_boundary_conditions_ensure_bc_coeff_face_values_allocated
@@ -53,6 +53,7 @@
 #include "base/cs_ale.h"
 #include "atmo/cs_atmo.h"
 #include "base/cs_boundary_conditions_set_coeffs.h"
+#include "base/cs_dispatch.h"
 #include "base/cs_field_default.h"
 #include "base/cs_field_pointer.h"
 #include "base/cs_internal_coupling.h"
@@ -158,10 +159,10 @@ _cs_boundary_conditions_set_coeffs_turb_scalar(cs_field_t  *f_sc,
   const cs_real_t *viscl = CS_F_(mu)->val;
   const cs_real_t *visct = CS_F_(mu_t)->val;
 
-  const int kivisl  = cs_field_key_id("diffusivity_id");
-  const int kturt   = cs_field_key_id("turbulent_flux_model");
-  const int kscacp  = cs_field_key_id("is_temperature");
-  const int ksigmas = cs_field_key_id("turbulent_schmidt");
+  static const int kivisl  = cs_field_key_id("diffusivity_id");
+  static const int kturt   = cs_field_key_id("turbulent_flux_model");
+  static const int kscacp  = cs_field_key_id("is_temperature");
+  static const int ksigmas = cs_field_key_id("turbulent_schmidt");
 
   const int ifcvsl = cs_field_get_key_int(f_sc, kivisl);
   const int thermal_variable = cs_glob_thermal_model->thermal_variable;
@@ -195,7 +196,7 @@ _cs_boundary_conditions_set_coeffs_turb_scalar(cs_field_t  *f_sc,
 
   /* Get the turbulent flux model for the scalar */
 
-  const int kctheta = cs_field_key_id("turbulent_flux_ctheta");
+  static const int kctheta = cs_field_key_id("turbulent_flux_ctheta");
   const cs_real_t ctheta = cs_field_get_key_double(f_sc, kctheta);
 
   const int turb_flux_model = cs_field_get_key_int(f_sc, kturt);
@@ -285,7 +286,7 @@ _cs_boundary_conditions_set_coeffs_turb_scalar(cs_field_t  *f_sc,
 
   bool *cpl_faces = nullptr;
   if (eqp_sc->icoupl > 0) {
-    const int coupling_key_id = cs_field_key_id("coupling_entity");
+    static const int coupling_key_id = cs_field_key_id("coupling_entity");
     const int coupling_id = cs_field_get_key_int(f_sc, coupling_key_id);
     const cs_internal_coupling_t *cpl = cs_internal_coupling_by_id(coupling_id);
 
@@ -338,7 +339,7 @@ _cs_boundary_conditions_set_coeffs_turb_scalar(cs_field_t  *f_sc,
   const cs_real_t turb_schmidt = cs_field_get_key_double(f_sc, ksigmas);
 
   /* Reference diffusivity */
-  const int kvisl0 = cs_field_key_id("diffusivity_ref");
+  static const int kvisl0 = cs_field_key_id("diffusivity_ref");
   cs_real_t visls_0 = cs_field_get_key_double(f_sc, kvisl0);
 
   cs_field_t *f_id_cv = cs_field_by_name_try("isobaric_heat_capacity");
@@ -947,10 +948,10 @@ _cs_boundary_conditions_set_coeffs_turb_vector(cs_field_t  *f_v,
   const cs_real_t *b_dist = fvq->b_dist;
   const cs_nreal_3_t *b_face_u_normal = fvq->b_face_u_normal;
 
-  const int kscacp  = cs_field_key_id("is_temperature");
-  const int ksigmas = cs_field_key_id("turbulent_schmidt");
-  const int kturt   = cs_field_key_id("turbulent_flux_model");
-  const int kivisl  = cs_field_key_id("diffusivity_id");
+  static const int kscacp  = cs_field_key_id("is_temperature");
+  static const int ksigmas = cs_field_key_id("turbulent_schmidt");
+  static const int kturt   = cs_field_key_id("turbulent_flux_model");
+  static const int kivisl  = cs_field_key_id("diffusivity_id");
 
   const cs_real_t cp0 = fluid_props->cp0;
   const int icp = fluid_props->icp;
@@ -984,7 +985,7 @@ _cs_boundary_conditions_set_coeffs_turb_vector(cs_field_t  *f_v,
   const cs_real_t turb_schmidt = cs_field_get_key_double(f_v, ksigmas);
 
   /* Reference diffusivity */
-  const int kvisl0 = cs_field_key_id("diffusivity_ref");
+  static const int kvisl0 = cs_field_key_id("diffusivity_ref");
   cs_real_t visls_0 = cs_field_get_key_double(f_v, kvisl0);
 
   /* Get the turbulent flux model for the vector */
@@ -1719,6 +1720,178 @@ _atmo_cls(const cs_lnum_t  f_id,
   *dlmo = rib * sqrt(fm) / (distbf + rough_d);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute velocity wall function values for all smooth wall faces.
+ *
+ * Smooth wall faces (icodcl = 5) are grouped by wall function type (the
+ * global type, or CS_WALL_F_DISABLED for faces adjacent to disabled cells),
+ * and each group is handled by a single call to
+ * \ref cs_wall_functions_velocity_faces, so the wall function selection is
+ * not repeated for each face. The computation of the tangential velocity
+ * and turbulence scales used as inputs is the same as in the main loop of
+ * \ref cs_boundary_conditions_set_coeffs_turb.
+ *
+ * \param[in]   velipb    value of the velocity at \f$ \centip \f$
+ *                        of boundary cells
+ * \param[in]   rough_d   boundary roughness, or nullptr
+ * \param[in]   cvar_k    turbulent kinetic energy, or nullptr
+ * \param[in]   cvar_rij  Reynolds stresses, or nullptr
+ * \param[out]  iuntur    indicator: 0 in the viscous sublayer
+ * \param[out]  wf_vals   wall function values (ustar, uk, yplus, ypup,
+ *                        cofimp and dplus, each of size n_b_faces)
+ * \param[out]  nsubla    counter of faces in the viscous sublayer
+ * \param[out]  nlogla    counter of faces in the log-layer
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_smooth_wall_velocity_wall_functions(const cs_real_t    velipb[][3],
+                                     const cs_real_t   *rough_d,
+                                     const cs_real_t   *cvar_k,
+                                     const cs_real_6_t *cvar_rij,
+                                     int               *iuntur,
+                                     cs_real_t         *wf_vals,
+                                     cs_gnum_t         *nsubla,
+                                     cs_gnum_t         *nlogla)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+  const cs_lnum_t *b_face_cells = m->b_face_cells;
+  const cs_real_t *b_dist = fvq->b_dist;
+  const cs_nreal_3_t *b_face_u_normal = fvq->b_face_u_normal;
+  const int *c_disable_flag = (fvq->has_disable_flag) ?
+    fvq->c_disable_flag : nullptr;
+
+  const cs_turb_model_t *turb_model = cs_glob_turb_model;
+  const bool rij_rans = (   turb_model->order == CS_TURB_SECOND_ORDER
+                         && turb_model->type  == CS_TURB_RANS);
+  const bool project_rcodcl = (   cs_glob_ale == CS_ALE_NONE
+                               &&    cs_turbomachinery_get_model()
+                                  == CS_TURBOMACHINERY_NONE);
+
+  const cs_real_t *crom = CS_F_(rho)->val;
+  const cs_real_t *viscl = CS_F_(mu)->val;
+  const cs_real_t *visct = CS_F_(mu_t)->val;
+
+  const int *icodcl_vel = CS_F_(vel)->bc_coeffs->icodcl;
+  const cs_real_t *rcodcl1_vel = CS_F_(vel)->bc_coeffs->rcodcl1;
+
+  cs_real_t *xnuii, *xnuit, *utau, *rnnb, *ek;
+  CS_MALLOC(xnuii, n_b_faces*5, cs_real_t);
+  xnuit = xnuii + n_b_faces;
+  utau = xnuii + n_b_faces*2;
+  rnnb = xnuii + n_b_faces*3;
+  ek = xnuii + n_b_faces*4;
+
+  /* Build face groups: faces using the global wall function type
+     are added from the start, faces with a disabled cell from the end */
+
+  cs_lnum_t *face_ids;
+  CS_MALLOC(face_ids, n_b_faces, cs_lnum_t);
+
+  cs_lnum_t n_std = 0, n_disabled = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    if (icodcl_vel[f_id] != 5)
+      continue;
+    if (c_disable_flag != nullptr) {
+      if (c_disable_flag[b_face_cells[f_id]]) {
+        n_disabled += 1;
+        face_ids[n_b_faces - n_disabled] = f_id;
+        continue;
+      }
+    }
+    face_ids[n_std] = f_id;
+    n_std += 1;
+  }
+
+  /* Wall function inputs */
+
+  cs_host_context ctx;
+
+  ctx.parallel_for(n_b_faces, [=] CS_F_HOST (cs_lnum_t f_id) {
+    if (icodcl_vel[f_id] != 5)
+      return;
+
+    const cs_lnum_t c_id = b_face_cells[f_id];
+    const cs_nreal_t *n = b_face_u_normal[f_id];
+
+    cs_real_t rcodcxyz[3] = {rcodcl1_vel[n_b_faces*0 + f_id],
+                             rcodcl1_vel[n_b_faces*1 + f_id],
+                             rcodcl1_vel[n_b_faces*2 + f_id]};
+
+    if (project_rcodcl) {
+      const cs_real_t rcodcn = cs_math_3_dot_product(rcodcxyz, n);
+      rcodcxyz[0] = rcodcxyz[0] - rcodcn * n[0];
+      rcodcxyz[1] = rcodcxyz[1] - rcodcn * n[1];
+      rcodcxyz[2] = rcodcxyz[2] - rcodcn * n[2];
+    }
+
+    const cs_real_t upxyz[3] = {velipb[f_id][0] - rcodcxyz[0],
+                                velipb[f_id][1] - rcodcxyz[1],
+                                velipb[f_id][2] - rcodcxyz[2]};
+
+    const cs_real_t usn = cs_math_3_dot_product(upxyz, n);
+
+    const cs_real_t txyz[3] = {upxyz[0] - usn*n[0],
+                               upxyz[1] - usn*n[1],
+                               upxyz[2] - usn*n[2]};
+
+    cs_real_t _utau = cs_math_3_norm(txyz);
+    if (cs::abs(_utau) < cs_math_epzero)
+      _utau = cs_math_epzero;
+
+    utau[f_id] = _utau;
+    xnuii[f_id] = viscl[c_id] / crom[c_id];
+    xnuit[f_id] = visct[c_id] / crom[c_id];
+
+    if (cvar_k != nullptr) {
+      ek[f_id] = cvar_k[c_id];
+      rnnb[f_id] = (2./3.) * ek[f_id];
+    }
+    else if (rij_rans) {
+      ek[f_id] = 0.5 * (  cvar_rij[c_id][0] + cvar_rij[c_id][1]
+                        + cvar_rij[c_id][2]);
+      rnnb[f_id] = cs_math_3_sym_33_3_dot_product(n, cvar_rij[c_id], n);
+    }
+    else {
+      ek[f_id] = 0.;
+      rnnb[f_id] = 0.;
+    }
+  });
+
+  /* Batched wall function computation */
+
+  cs_real_t *ustar = wf_vals;
+  cs_real_t *uk = wf_vals + n_b_faces;
+  cs_real_t *yplus = wf_vals + n_b_faces*2;
+  cs_real_t *ypup = wf_vals + n_b_faces*3;
+  cs_real_t *cofimp = wf_vals + n_b_faces*4;
+  cs_real_t *dplus = wf_vals + n_b_faces*5;
+
+  cs_wall_functions_velocity_faces(cs_glob_wall_functions->iwallf,
+                                   n_std,
+                                   face_ids,
+                                   xnuii, xnuit, utau, b_dist, rough_d,
+                                   rnnb, ek,
+                                   iuntur, nsubla, nlogla,
+                                   ustar, uk, yplus, ypup, cofimp, dplus);
+
+  cs_wall_functions_velocity_faces(CS_WALL_F_DISABLED,
+                                   n_disabled,
+                                   face_ids + n_b_faces - n_disabled,
+                                   xnuii, xnuit, utau, b_dist, rough_d,
+                                   rnnb, ek,
+                                   iuntur, nsubla, nlogla,
+                                   ustar, uk, yplus, ypup, cofimp, dplus);
+
+  CS_FREE(face_ids);
+  CS_FREE(xnuii);
+}
+
 /*============================================================================
  * Public function definitions
  *============================================================================*/
@@ -1800,10 +1973,10 @@ cs_boundary_conditions_set_coeffs_turb(int        isvhb,
   const cs_real_t cp0 = fluid_props->cp0;
   const int icp = fluid_props->icp;
 
-  const int keysca  = cs_field_key_id("scalar_id");
-  const int kscavr = cs_field_key_id("first_moment_id");
-  const int ksigmas = cs_field_key_id("turbulent_schmidt");
-  const int kdflim = cs_field_key_id("diffusion_limiter_id");
+  static const int keysca  = cs_field_key_id("scalar_id");
+  static const int kscavr = cs_field_key_id("first_moment_id");
+  static const int ksigmas = cs_field_key_id("turbulent_schmidt");
+  static const int kdflim = cs_field_key_id("diffusion_limiter_id");
 
   cs_real_t turb_prandtl = 1.;
   if (f_th != nullptr)
@@ -2102,6 +2275,37 @@ cs_boundary_conditions_set_coeffs_turb(int        isvhb,
     cs_turbomachinery_get_wall_bc_coeffs(&coftur, &hfltur);
   }
 
+  /* Velocity wall functions for smooth walls, grouped by wall function
+     type. With Van Driest damping in LES, the turbulent viscosity is
+     updated in the main loop, so this is possible only for wall functions
+     which do not depend on it. */
+
+  int *wf_iuntur = nullptr;
+  cs_real_t *wf_vals = nullptr;
+
+  {
+    const cs_wall_f_type_t iwallf = cs_glob_wall_functions->iwallf;
+    bool batch_wf = true;
+    if (type == CS_TURB_LES && cs_glob_turb_les_model->idries == 1)
+      batch_wf = (   (   iwallf == CS_WALL_F_1SCALE_POWER
+                      || iwallf == CS_WALL_F_1SCALE_LOG
+                      || iwallf == CS_WALL_F_2SCALES_VDRIEST)
+                  && fvq->has_disable_flag == 0);
+
+    if (batch_wf) {
+      CS_MALLOC(wf_iuntur, n_b_faces, int);
+      CS_MALLOC(wf_vals, n_b_faces*6, cs_real_t);
+      _smooth_wall_velocity_wall_functions(velipb,
+                                           bpro_rough,
+                                           cvar_k,
+                                           cvar_rij,
+                                           wf_iuntur,
+                                           wf_vals,
+                                           &nsubla,
+                                           &nlogla);
+    }
+  }
+
   /* Loop on boundary faces
      ----------------------*/
 
@@ -2239,7 +2443,18 @@ cs_boundary_conditions_set_coeffs_turb(int        isvhb,
     int iuntur;
     cs_real_t uk, ypup, dplus, yplus;
 
-    if (icodcl_vel[f_id] == 5) {
+    if (icodcl_vel[f_id] == 5 && wf_vals != nullptr) {
+
+      iuntur = wf_iuntur[f_id];
+      uet = wf_vals[f_id];
+      uk = wf_vals[n_b_faces + f_id];
+      yplus = wf_vals[n_b_faces*2 + f_id];
+      ypup = wf_vals[n_b_faces*3 + f_id];
+      cofimp = wf_vals[n_b_faces*4 + f_id];
+      dplus = wf_vals[n_b_faces*5 + f_id];
+
+    }
+    else if (icodcl_vel[f_id] == 5) {
 
       cs_wall_f_type_t iwallf_loc = cs_glob_wall_functions->iwallf;
       if (fvq->has_disable_flag) {
@@ -3819,6 +4034,8 @@ cs_boundary_conditions_set_coeffs_turb(int        isvhb,
     }
   }
 
+  CS_FREE(wf_iuntur);
+  CS_FREE(wf_vals);
   CS_FREE(byplus);
   CS_FREE(_buk);
   CS_FREE(buet);
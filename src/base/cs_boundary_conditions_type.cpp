@@ -145,9 +145,9 @@ cs_boundary_conditions_type(bool  init,
   const cs_real_t *gxyz = cs_get_glob_physical_constants()->gravity;
   cs_real_t *xyzp0 = fluid_props->xyzp0;
 
-  const int kturt  = cs_field_key_id("turbulent_flux_model");
-  const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
-  const int keysca = cs_field_key_id("scalar_id");
+  static const int kturt  = cs_field_key_id("turbulent_flux_model");
+  static const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
+  static const int keysca = cs_field_key_id("scalar_id");
   const int meteo_profile = cs_glob_atmo_option->meteo_profile;
   const int n_fields = cs_field_n_fields();
 
@@ -1289,7 +1289,7 @@ cs_boundary_conditions_type(bool  init,
     cs_field_t *f_zground = cs_field_by_name_try("z_ground");
     cs_field_t *f_poro = cs_field_by_name_try("porosity");
 
-    const int kscavr = cs_field_key_id("first_moment_id");
+    static const int kscavr = cs_field_key_id("first_moment_id");
 
     int inlet_types[2] = {CS_INLET, CS_CONVECTIVE_INLET};
     int inlet_codes[2] = {1, 13};
@@ -0,0 +1,681 @@
+/*============================================================================
+ * Profiling of point-to-point communication volumes between ranks.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2025 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "base/cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C and C++ library headers
+ *----------------------------------------------------------------------------*/
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <map>
+#include <unordered_map>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft/bft_error.h"
+#include "bft/bft_printf.h"
+
+#include "base/cs_base.h"
+#include "base/cs_log.h"
+#include "base/cs_mem.h"
+
+/*----------------------------------------------------------------------------
+ * Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "base/cs_comm_profile.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_comm_profile.cpp
+        Profiling of point-to-point communication volumes between ranks.
+
+  When the CS_COMM_PROFILE environment variable is set, the number of
+  messages and bytes sent to each other rank by halo synchronizations,
+  interface set exchanges, all-to-all exchanges and crystal router stages
+  are accumulated, split by operation type and caller category (with
+  the level for multigrid cycles).
+
+  At the end of the computation, the resulting sparse communication matrix
+  is written to a "comm_profile.csv" file, with one line per source rank,
+  destination rank, operation type, category and level, and a summary
+  (including the mean and maximum number of peers per rank, which helps
+  identify coarse multigrid levels with dense communication patterns) is
+  added to the performance log.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Maximum depth of category stack */
+
+#define CS_COMM_PROFILE_STACK_MAX  64
+
+/* Number of values per serialized record */
+
+#define CS_COMM_PROFILE_REC_SIZE  3
+
+/*=============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Accumulated counts for a given key */
+
+typedef struct {
+
+  uint64_t  n_msgs;   /* Number of messages */
+  uint64_t  n_bytes;  /* Number of bytes */
+
+} cs_comm_profile_count_t;
+
+/* Summary for a given operation, category and level */
+
+typedef struct {
+
+  uint64_t  n_msgs;     /* Number of messages */
+  uint64_t  n_bytes;    /* Number of bytes */
+  uint64_t  n_peers;    /* Sum over ranks of number of peers */
+  int       max_peers;  /* Maximum number of peers for a rank */
+  int       n_ranks;    /* Number of sending ranks */
+
+} cs_comm_profile_summary_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static const char *_op_name[] = {N_("halo"),
+                                 N_("interface"),
+                                 N_("all_to_all"),
+                                 N_("crystal_router")};
+
+static const char *_cat_name[] = {N_("other"),
+                                  N_("gradient"),
+                                  N_("spmv"),
+                                  N_("multigrid"),
+                                  N_("lagrangian"),
+                                  N_("post")};
+
+static int  _stack_depth = 0;
+static int  _stack_cat[CS_COMM_PROFILE_STACK_MAX];
+static int  _stack_level[CS_COMM_PROFILE_STACK_MAX];
+
+/* Counts, indexed by packed operation, category, level, and peer */
+
+static std::unordered_map<uint64_t, cs_comm_profile_count_t>  _counts;
+
+/*============================================================================
+ * Global variables
+ *============================================================================*/
+
+bool cs_glob_comm_profile_active = false;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Pack a record key.
+ *
+ * The channel (operation, category, level) uses the upper 32 bits,
+ * and the peer rank the lower 32 bits.
+ *
+ * parameters:
+ *   op    <-- operation type
+ *   cat   <-- caller category
+ *   level <-- level, or -1
+ *   peer  <-- peer rank
+ *
+ * return:
+ *   packed key
+ *----------------------------------------------------------------------------*/
+
+static inline uint64_t
+_pack_key(int  op,
+          int  cat,
+          int  level,
+          int  peer)
+{
+  uint64_t channel = (  ((uint64_t)op << 24) | ((uint64_t)cat << 16)
+                      | (uint64_t)((level + 1) & 0xffff));
+
+  return (channel << 32) | (uint64_t)((uint32_t)peer);
+}
+
+/*----------------------------------------------------------------------------
+ * Unpack a record key's channel.
+ *
+ * parameters:
+ *   channel <-- channel part of key (upper 32 bits)
+ *   op      --> operation type
+ *   cat     --> caller category
+ *   level   --> level, or -1
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_unpack_channel(uint64_t   channel,
+                int       *op,
+                int       *cat,
+                int       *level)
+{
+  *op = (int)((channel >> 24) & 0xff);
+  *cat = (int)((channel >> 16) & 0xff);
+  *level = (int)(channel & 0xffff) - 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Add counts for a given peer, with the current caller category.
+ *
+ * parameters:
+ *   op      <-- operation type
+ *   peer    <-- peer rank (in cs_glob_mpi_comm)
+ *   n_msgs  <-- number of messages
+ *   n_bytes <-- number of bytes
+ *----------------------------------------------------------------------------*/
+
+static void
+_add(int       op,
+     int       peer,
+     uint64_t  n_msgs,
+     uint64_t  n_bytes)
+{
+  int cat = CS_COMM_PROFILE_CAT_OTHER, level = -1;
+  if (_stack_depth > 0) {
+    cat = _stack_cat[_stack_depth - 1];
+    level = _stack_level[_stack_depth - 1];
+  }
+
+  uint64_t key = _pack_key(op, cat, level, peer);
+
+  #pragma omp critical(cs_comm_profile_add)
+  {
+    cs_comm_profile_count_t &c = _counts[key];
+    c.n_msgs += n_msgs;
+    c.n_bytes += n_bytes;
+  }
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Translate ranks of a given communicator to those of cs_glob_mpi_comm.
+ *
+ * parameters:
+ *   comm    <-- associated communicator
+ *   n       <-- number of ranks to translate
+ *   rank    <-- ranks in comm
+ *   g_rank  --> ranks in cs_glob_mpi_comm (-1 if not present)
+ *----------------------------------------------------------------------------*/
+
+static void
+_translate_ranks(MPI_Comm   comm,
+                 int        n,
+                 const int  rank[],
+                 int        g_rank[])
+{
+  if (comm == cs_glob_mpi_comm) {
+    for (int i = 0; i < n; i++)
+      g_rank[i] = rank[i];
+    return;
+  }
+
+  MPI_Group group, g_group;
+  MPI_Comm_group(comm, &group);
+  MPI_Comm_group(cs_glob_mpi_comm, &g_group);
+
+  MPI_Group_translate_ranks(group, n, rank, g_group, g_rank);
+
+  for (int i = 0; i < n; i++) {
+    if (g_rank[i] == MPI_UNDEFINED)
+      g_rank[i] = -1;
+  }
+
+  MPI_Group_free(&g_group);
+  MPI_Group_free(&group);
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Serialize local counts.
+ *
+ * Each record contains the packed key, number of messages, and bytes.
+ *
+ * parameters:
+ *   n_records --> number of records
+ *
+ * return:
+ *   array of serialized records
+ *----------------------------------------------------------------------------*/
+
+static uint64_t *
+_serialize_counts(int  *n_records)
+{
+  uint64_t *rec;
+  CS_MALLOC(rec, _counts.size()*CS_COMM_PROFILE_REC_SIZE, uint64_t);
+
+  /* Order by key so that the output is reproducible */
+
+  std::map<uint64_t, cs_comm_profile_count_t> s_counts(_counts.begin(),
+                                                       _counts.end());
+
+  int i = 0;
+  for (auto &kv : s_counts) {
+    rec[i*CS_COMM_PROFILE_REC_SIZE] = kv.first;
+    rec[i*CS_COMM_PROFILE_REC_SIZE + 1] = kv.second.n_msgs;
+    rec[i*CS_COMM_PROFILE_REC_SIZE + 2] = kv.second.n_bytes;
+    i++;
+  }
+
+  *n_records = i;
+
+  return rec;
+}
+
+/*----------------------------------------------------------------------------
+ * Write records from a given rank and update summary.
+ *
+ * parameters:
+ *   f         <-- output file, or nullptr
+ *   src_rank  <-- source rank
+ *   n_records <-- number of records
+ *   rec       <-- serialized records
+ *   summary   <-> summary by channel
+ *----------------------------------------------------------------------------*/
+
+static void
+_process_records
+(
+  FILE                                          *f,
+  int                                            src_rank,
+  int                                            n_records,
+  const uint64_t                                 rec[],
+  std::map<uint64_t, cs_comm_profile_summary_t>  &summary
+)
+{
+  uint64_t prev_channel = 0;
+  int n_peers = 0;
+
+  for (int i = 0; i < n_records; i++) {
+
+    const uint64_t *r = rec + i*CS_COMM_PROFILE_REC_SIZE;
+    uint64_t channel = r[0] >> 32;
+    int peer = (int)((uint32_t)(r[0] & 0xffffffff));
+
+    int op, cat, level;
+    _unpack_channel(channel, &op, &cat, &level);
+
+    if (f != nullptr)
+      fprintf(f, "%d,%d,%s,%s,%d,%llu,%llu\n",
+              src_rank, peer, _op_name[op], _cat_name[cat], level,
+              (unsigned long long)r[1], (unsigned long long)r[2]);
+
+    /* Records are sorted by key, so peers of a channel are contiguous */
+
+    if (i == 0 || channel != prev_channel) {
+      n_peers = 0;
+      prev_channel = channel;
+      summary[channel].n_ranks += 1;
+    }
+    n_peers += 1;
+
+    cs_comm_profile_summary_t &s = summary[channel];
+    s.n_msgs += r[1];
+    s.n_bytes += r[2];
+    s.n_peers += 1;
+    if (n_peers > s.max_peers)
+      s.max_peers = n_peers;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Log summary.
+ *
+ * parameters:
+ *   summary <-- summary by channel
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_summary
+(
+  const std::map<uint64_t, cs_comm_profile_summary_t>  &summary
+)
+{
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Point-to-point communication profile (messages sent):\n\n"
+                  "  operation       category    level     messages"
+                  "          MiB  peers: mean   max\n"));
+
+  for (auto &kv : summary) {
+    int op, cat, level;
+    _unpack_channel(kv.first, &op, &cat, &level);
+    const cs_comm_profile_summary_t &s = kv.second;
+
+    char level_str[16] = "-";
+    if (level > -1)
+      snprintf(level_str, 15, "%d", level);
+
+    double mean_peers = (s.n_ranks > 0) ?
+      (double)s.n_peers / (double)s.n_ranks : 0.;
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %-15s %-11s %5s %12llu %12.3f  %11.1f %5d\n",
+                  _(_op_name[op]), _(_cat_name[cat]), level_str,
+                  (unsigned long long)s.n_msgs,
+                  (double)s.n_bytes / (1024.*1024.),
+                  mean_peers, s.max_peers);
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "  (communication matrix written to \"%s\")\n"),
+                "comm_profile.csv");
+
+  cs_log_separator(CS_LOG_PERFORMANCE);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize communication profiling.
+ *
+ * Profiling is activated if the CS_COMM_PROFILE environment variable is set.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_comm_profile_initialize(void)
+{
+  if (getenv("CS_COMM_PROFILE") == nullptr || cs_glob_comm_profile_active)
+    return;
+
+  _counts.clear();
+  _stack_depth = 0;
+
+  cs_glob_comm_profile_active = true;
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("\n"
+                  "Point-to-point communication profiling active.\n"));
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write communication matrix, log summary, and finalize profiling.
+ *
+ * This function is collective.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_comm_profile_finalize(void)
+{
+  if (cs_glob_comm_profile_active == false)
+    return;
+
+  cs_glob_comm_profile_active = false;
+
+  int n_records = 0;
+  uint64_t *rec = _serialize_counts(&n_records);
+
+  _counts.clear();
+
+  std::map<uint64_t, cs_comm_profile_summary_t> summary;
+
+  FILE *f = nullptr;
+
+  if (cs_glob_rank_id < 1) {
+    f = fopen("comm_profile.csv", "w");
+    if (f == nullptr)
+      bft_printf(_("\n"
+                   "Warning: communication profile file \"%s\" could not be\n"
+                   "         opened: %s\n"),
+                 "comm_profile.csv", strerror(errno));
+    else
+      fprintf(f, "src_rank,dest_rank,operation,category,level,"
+              "n_messages,n_bytes\n");
+  }
+
+#if defined(HAVE_MPI)
+
+  /* Receive and process records rank by rank, so that memory use on
+     rank 0 does not depend on the total number of ranks */
+
+  if (cs_glob_n_ranks > 1) {
+
+    int *rank_n_records = nullptr;
+    if (cs_glob_rank_id == 0)
+      CS_MALLOC(rank_n_records, cs_glob_n_ranks, int);
+
+    MPI_Gather(&n_records, 1, MPI_INT, rank_n_records, 1, MPI_INT, 0,
+               cs_glob_mpi_comm);
+
+    if (cs_glob_rank_id == 0) {
+
+      _process_records(f, 0, n_records, rec, summary);
+
+      for (int r_id = 1; r_id < cs_glob_n_ranks; r_id++) {
+        int n_r = rank_n_records[r_id];
+        if (n_r < 1)
+          continue;
+        if (n_r > n_records) {
+          n_records = n_r;
+          CS_REALLOC(rec, n_records*CS_COMM_PROFILE_REC_SIZE, uint64_t);
+        }
+        MPI_Status status;
+        MPI_Recv(rec, n_r*CS_COMM_PROFILE_REC_SIZE, MPI_UINT64_T,
+                 r_id, 0, cs_glob_mpi_comm, &status);
+        _process_records(f, r_id, n_r, rec, summary);
+      }
+
+      CS_FREE(rank_n_records);
+
+    }
+    else if (n_records > 0)
+      MPI_Send(rec, n_records*CS_COMM_PROFILE_REC_SIZE, MPI_UINT64_T,
+               0, 0, cs_glob_mpi_comm);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (cs_glob_n_ranks == 1)
+    _process_records(f, 0, n_records, rec, summary);
+
+  CS_FREE(rec);
+
+  if (f != nullptr)
+    fclose(f);
+
+  if (cs_glob_rank_id < 1)
+    _log_summary(summary);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the caller category for subsequent communication.
+ *
+ * Categories are stacked, and must be restored using
+ * \ref cs_comm_profile_pop. The innermost category applies.
+ *
+ * \param[in]  category  caller category
+ * \param[in]  level     associated level (for multigrid), or -1
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_comm_profile_push(cs_comm_profile_cat_t  category,
+                     int                    level)
+{
+  if (_stack_depth >= CS_COMM_PROFILE_STACK_MAX)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Communication profile category stack depth limit (%d) "
+                "reached"),
+              CS_COMM_PROFILE_STACK_MAX);
+
+  _stack_cat[_stack_depth] = category;
+  _stack_level[_stack_depth] = level;
+  _stack_depth += 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Restore the caller category active before the matching
+ *        \ref cs_comm_profile_push call.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_comm_profile_pop(void)
+{
+  if (_stack_depth < 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("cs_comm_profile_pop() called with no active category"));
+
+  _stack_depth -= 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the currently active caller category.
+ *
+ * \return  active category, or CS_COMM_PROFILE_CAT_OTHER
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_comm_profile_cat_t
+cs_comm_profile_current(void)
+{
+  if (_stack_depth > 0)
+    return (cs_comm_profile_cat_t)_stack_cat[_stack_depth - 1];
+  return CS_COMM_PROFILE_CAT_OTHER;
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Record a message sent to a given rank.
+ *
+ * \param[in]  op       operation type
+ * \param[in]  comm     associated communicator
+ * \param[in]  dest     destination rank in comm
+ * \param[in]  n_bytes  message size, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_comm_profile_add(cs_comm_profile_op_t  op,
+                    MPI_Comm              comm,
+                    int                   dest,
+                    size_t                n_bytes)
+{
+  if (cs_glob_comm_profile_active == false)
+    return;
+
+  int g_dest;
+  _translate_ranks(comm, 1, &dest, &g_dest);
+
+  _add(op, g_dest, 1, n_bytes);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Record messages sent to all ranks of a communicator.
+ *
+ * Ranks with a zero count are ignored.
+ *
+ * \param[in]  op        operation type
+ * \param[in]  comm      associated communicator
+ * \param[in]  count     number of elements sent to each rank of comm
+ * \param[in]  elt_size  element size, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_comm_profile_add_counts(cs_comm_profile_op_t  op,
+                           MPI_Comm              comm,
+                           const int             count[],
+                           size_t                elt_size)
+{
+  if (cs_glob_comm_profile_active == false)
+    return;
+
+  int n_ranks, local_rank;
+  MPI_Comm_size(comm, &n_ranks);
+  MPI_Comm_rank(comm, &local_rank);
+
+  int *rank, *g_rank;
+  CS_MALLOC(rank, n_ranks, int);
+  CS_MALLOC(g_rank, n_ranks, int);
+
+  int n = 0;
+  for (int i = 0; i < n_ranks; i++) {
+    if (count[i] > 0 && i != local_rank)
+      rank[n++] = i;
+  }
+
+  _translate_ranks(comm, n, rank, g_rank);
+
+  for (int i = 0; i < n; i++)
+    _add(op, g_rank[i], 1, (uint64_t)count[rank[i]]*elt_size);
+
+  CS_FREE(g_rank);
+  CS_FREE(rank);
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
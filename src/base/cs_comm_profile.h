@@ -0,0 +1,243 @@
+#ifndef __CS_COMM_PROFILE_H__
+#define __CS_COMM_PROFILE_H__
+
+/*============================================================================
+ * Profiling of point-to-point communication volumes between ranks.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2025 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "base/cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Communication operation types
+ *----------------------------------------------------------------------------*/
+
+typedef enum {
+
+  CS_COMM_PROFILE_OP_HALO,            /*!< halo synchronization */
+  CS_COMM_PROFILE_OP_INTERFACE,       /*!< interface set exchange */
+  CS_COMM_PROFILE_OP_ALL_TO_ALL,      /*!< all-to-all (MPI_Alltoallv) */
+  CS_COMM_PROFILE_OP_CRYSTAL_ROUTER,  /*!< crystal router stage */
+
+  CS_COMM_PROFILE_N_OPS               /*!< number of operation types */
+
+} cs_comm_profile_op_t;
+
+/*----------------------------------------------------------------------------
+ * Caller categories
+ *----------------------------------------------------------------------------*/
+
+typedef enum {
+
+  CS_COMM_PROFILE_CAT_OTHER,          /*!< uncategorized */
+  CS_COMM_PROFILE_CAT_GRADIENT,       /*!< gradient reconstruction */
+  CS_COMM_PROFILE_CAT_SPMV,           /*!< matrix.vector products */
+  CS_COMM_PROFILE_CAT_MULTIGRID,      /*!< multigrid cycle (by level) */
+  CS_COMM_PROFILE_CAT_LAGRANGIAN,     /*!< Lagrangian particle tracking */
+  CS_COMM_PROFILE_CAT_POST,           /*!< postprocessing output */
+
+  CS_COMM_PROFILE_N_CATS              /*!< number of categories */
+
+} cs_comm_profile_cat_t;
+
+/*============================================================================
+ * Global variables
+ *============================================================================*/
+
+/* Profiling activation flag (do not modify directly) */
+
+extern bool cs_glob_comm_profile_active;
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize communication profiling.
+ *
+ * Profiling is activated if the CS_COMM_PROFILE environment variable is set.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_comm_profile_initialize(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write communication matrix, log summary, and finalize profiling.
+ *
+ * This function is collective.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_comm_profile_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the caller category for subsequent communication.
+ *
+ * Categories are stacked, and must be restored using
+ * \ref cs_comm_profile_pop. The innermost category applies.
+ *
+ * \param[in]  category  caller category
+ * \param[in]  level     associated level (for multigrid), or -1
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_comm_profile_push(cs_comm_profile_cat_t  category,
+                     int                    level);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Restore the caller category active before the matching
+ *        \ref cs_comm_profile_push call.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_comm_profile_pop(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the currently active caller category.
+ *
+ * \return  active category, or CS_COMM_PROFILE_CAT_OTHER
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_comm_profile_cat_t
+cs_comm_profile_current(void);
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Record a message sent to a given rank.
+ *
+ * \param[in]  op       operation type
+ * \param[in]  comm     associated communicator
+ * \param[in]  dest     destination rank in comm
+ * \param[in]  n_bytes  message size, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_comm_profile_add(cs_comm_profile_op_t  op,
+                    MPI_Comm              comm,
+                    int                   dest,
+                    size_t                n_bytes);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Record messages sent to all ranks of a communicator.
+ *
+ * Ranks with a zero count are ignored.
+ *
+ * \param[in]  op        operation type
+ * \param[in]  comm      associated communicator
+ * \param[in]  count     number of elements sent to each rank of comm
+ * \param[in]  elt_size  element size, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_comm_profile_add_counts(cs_comm_profile_op_t  op,
+                           MPI_Comm              comm,
+                           const int             count[],
+                           size_t                elt_size);
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#if defined(__cplusplus)
+
+/*=============================================================================
+ * Public C++ classes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Communication caller category bound to the enclosing scope.
+ *
+ * A weak category only applies if no other category is already active,
+ * so that for example matrix.vector products called from a multigrid
+ * cycle are accounted with the associated level.
+ */
+/*----------------------------------------------------------------------------*/
+
+class cs_comm_profile_scope {
+
+public:
+
+  explicit cs_comm_profile_scope(cs_comm_profile_cat_t  category,
+                                 int                    level = -1,
+                                 bool                   weak = false)
+    : active_(cs_glob_comm_profile_active)
+  {
+    if (active_) {
+      if (weak && cs_comm_profile_current() != CS_COMM_PROFILE_CAT_OTHER)
+        active_ = false;
+      else
+        cs_comm_profile_push(category, level);
+    }
+  }
+
+  ~cs_comm_profile_scope()
+  {
+    if (active_)
+      cs_comm_profile_pop();
+  }
+
+  cs_comm_profile_scope(const cs_comm_profile_scope &) = delete;
+  cs_comm_profile_scope &operator=(const cs_comm_profile_scope &) = delete;
+
+private:
+
+  bool  active_;
+
+};
+
+#endif /* defined(__cplusplus) */
+
+/*----------------------------------------------------------------------------*/
+
+#endif /* __CS_COMM_PROFILE_H__ */
@@ -45,6 +45,7 @@
 
 #include "base/cs_assert.h"
 #include "base/cs_block_dist.h"
+#include "base/cs_comm_profile.h"
 #include "base/cs_log.h"
 #include "base/cs_mem.h"
 #include "base/cs_timer.h"
@@ -953,6 +954,10 @@ _crystal_sendrecv(cs_crystal_router_t  *cr,
   MPI_Isend(cr->buffer[1], send_size[1], cr->mpi_type,
             target, cr->rank_id, cr->comm, request);
 
+  if (cs_glob_comm_profile_active)
+    cs_comm_profile_add(CS_COMM_PROFILE_OP_CRYSTAL_ROUTER, cr->comm, target,
+                        _data_size(cr, send_size[0], cr->n_vals[1]));
+
   cr->n_elts[1] = 0;
 
   for (int i = 0; i < n_recv; i++) {
@@ -120,8 +120,8 @@ cs_drift_boundary_mass_flux(const cs_mesh_t  *m,
   const int *bc_type = cs_glob_bc_type;
 
   //TODO add a return in case no addition
-  const int keydri = cs_field_key_id("drift_scalar_model");
-  const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
+  static const int keydri = cs_field_key_id("drift_scalar_model");
+  static const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
 
  /* At walls, if particle classes have a outgoing flux,
   * mixture get the same quantity.
@@ -200,11 +200,11 @@ cs_drift_convective_flux(cs_field_t  *f_sc,
   const cs_lnum_2_t *restrict i_face_cells = mesh->i_face_cells;
   const cs_real_t *cell_vol = fvq->cell_vol;
 
-  const int kivisl = cs_field_key_id("diffusivity_id");
-  const int keyccl = cs_field_key_id("scalar_class");
-  const int keydri = cs_field_key_id("drift_scalar_model");
-  const int kimasf = cs_field_key_id("inner_mass_flux_id");
-  const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
+  static const int kivisl = cs_field_key_id("diffusivity_id");
+  static const int keyccl = cs_field_key_id("scalar_class");
+  static const int keydri = cs_field_key_id("drift_scalar_model");
+  static const int kimasf = cs_field_key_id("inner_mass_flux_id");
+  static const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
 
   const int iscdri = cs_field_get_key_int(f_sc, keydri);
   const int icla = cs_field_get_key_int(f_sc, keyccl);
@@ -450,7 +450,7 @@ cs_drift_convective_flux(cs_field_t  *f_sc,
       }
       else {
 
-        const int kvisl0 = cs_field_key_id("diffusivity_ref");
+        static const int kvisl0 = cs_field_key_id("diffusivity_ref");
         const cs_real_t visls_0 = cs_field_get_key_double(f_sc, kvisl0);
 
         ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
@@ -378,7 +378,11 @@ _equation_iterative_solve_strided(int                   idtvar,
   /* Storing face values for kinetic energy balance and initialize them */
   if (CS_F_(vel) != nullptr && CS_F_(vel)->id == f_id) {
 
-    i_vf = cs_field_by_name_try("inner_face_velocity");
+    static cs_field_handle_t h_i_vf = CS_FIELD_HANDLE("inner_face_velocity");
+    static cs_field_handle_t h_b_vf
+      = CS_FIELD_HANDLE("boundary_face_velocity");
+
+    i_vf = cs_field_by_handle_try(&h_i_vf);
     if (i_vf != nullptr) {
       ctx.parallel_for(3*n_i_faces, [=] CS_F_HOST_DEVICE (cs_lnum_t face_id) {
         i_vf->val[face_id] = 0.;
@@ -386,7 +390,7 @@ _equation_iterative_solve_strided(int                   idtvar,
       i_pvar = (var_t *)i_vf->val;
     }
 
-    b_vf = cs_field_by_name_try("boundary_face_velocity");
+    b_vf = cs_field_by_handle_try(&h_b_vf);
     if (b_vf != nullptr) {
       ctx.parallel_for(3*n_b_faces, [=] CS_F_HOST_DEVICE (cs_lnum_t face_id) {
         b_vf->val[face_id] = 0.;
@@ -399,13 +403,13 @@ _equation_iterative_solve_strided(int                   idtvar,
 
   /* solving info */
   int df_limiter_id = -1;
-  int key_sinfo_id = cs_field_key_id("solving_info");
+  static const int key_sinfo_id = cs_field_key_id("solving_info");
   if (f_id > -1) {
     f = cs_field_by_id(f_id);
     cs_field_get_key_struct(f, key_sinfo_id, &sinfo);
 
-    df_limiter_id
-      = cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+    static const int kdflim = cs_field_key_id("diffusion_limiter_id");
+    df_limiter_id = cs_field_get_key_int(f, kdflim);
   }
 
   /* Symmetric matrix, except if advection */
@@ -646,7 +650,9 @@ _equation_iterative_solve_strided(int                   idtvar,
                       (cs_real_6_t *)smbrp);
 
   if (CS_F_(vel) != nullptr && CS_F_(vel)->id == f_id) {
-    cs_field_t *f_ex = cs_field_by_name_try("velocity_explicit_balance");
+    static cs_field_handle_t h_ex
+      = CS_FIELD_HANDLE("velocity_explicit_balance");
+    cs_field_t *f_ex = cs_field_by_handle_try(&h_ex);
 
     if (f_ex != nullptr) {
       cs_real_3_t *cpro_cv_df_v = (cs_real_3_t *)f_ex->val;
@@ -817,6 +823,10 @@ _equation_iterative_solve_strided(int                   idtvar,
   CS_FREE_HD(w2);
 
   sinfo.rhs_norm = rnorm;
+  if (cs::abs(rnorm)/sqrt(cs_real_t(stride)) > cs_math_epzero)
+    sinfo.res_norm_ini = residu/rnorm;
+  else
+    sinfo.res_norm_ini = 0.;
 
   /* Warning: for Weight Matrix, one and only one sweep is done. */
   int nswmod = cs::max(eqp->nswrsm, 1);
@@ -1513,11 +1523,12 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
     bft_printf("Equation iterative solve of: %s\n", var_name);
 
   /* solving info */
-  int key_sinfo_id = cs_field_key_id("solving_info");
+  static const int key_sinfo_id = cs_field_key_id("solving_info");
   if (f_id > -1) {
+    static const int key_cpl_id = cs_field_key_id("coupling_entity");
     f = cs_field_by_id(f_id);
     cs_field_get_key_struct(f, key_sinfo_id, &sinfo);
-    coupling_id = cs_field_get_key_int(f, cs_field_key_id("coupling_entity"));
+    coupling_id = cs_field_get_key_int(f, key_cpl_id);
   }
 
   /* Determine if we are in a case with special requirements */
@@ -1847,6 +1858,10 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
   }
 
   sinfo.rhs_norm = rnorm;
+  if (fabs(rnorm) > cs_math_epzero)
+    sinfo.res_norm_ini = residu/rnorm;
+  else
+    sinfo.res_norm_ini = 0.;
 
   /* Free memory */
   CS_FREE_HD(w1);
@@ -229,6 +229,22 @@ static int _k_label = -1;
 
 static cs_field_key_val_t  *_key_vals = nullptr;
 
+/* Generation counter, incremented when field definitions change,
+   so as to revalidate cached handles */
+
+static int  _field_generation = 0;
+
+/* Optional counters for name-based lookups (activated by the
+   CS_FIELD_LOOKUP_LOG environment variable) */
+
+static int  _lookup_count_active = -1;
+static int  _n_field_lookup_max = 0;
+static int  _n_key_lookup_max = 0;
+static unsigned long long  *_field_lookup_count = nullptr;
+static unsigned long long  *_key_lookup_count = nullptr;
+static unsigned long long   _n_failed_lookups = 0;
+static int  _lookup_log_nt_prev = -1;
+
 /* Names for logging */
 
 static const int _n_type_flags = 8;
@@ -360,6 +376,156 @@ cs_f_field_get_label(int           f_id,
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Check whether name-based lookups should be counted.
+ *
+ * Lookups in OpenMP parallel regions are never counted.
+ *
+ * returns:
+ *   true if lookup counting is active, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_lookup_count_is_active(void)
+{
+  /* Counters are not thread-safe */
+
+#if defined(HAVE_OPENMP)
+  if (omp_in_parallel())
+    return false;
+#endif
+
+  if (_lookup_count_active < 0)
+    _lookup_count_active = (getenv("CS_FIELD_LOOKUP_LOG") != nullptr) ? 1 : 0;
+
+  return (_lookup_count_active > 0);
+}
+
+/*----------------------------------------------------------------------------
+ * Count a name-based lookup.
+ *
+ * parameters:
+ *   id        <-- id of found field or key, or -1
+ *   n_max     <-> current size of count array
+ *   count     <-> count array
+ *----------------------------------------------------------------------------*/
+
+static void
+_count_lookup(int                   id,
+              int                  *n_max,
+              unsigned long long  **count)
+{
+  if (id < 0) {
+    _n_failed_lookups += 1;
+    return;
+  }
+
+  if (id >= *n_max) {
+    int n_max_prev = *n_max;
+    int n_max_new = cs::max(16, n_max_prev);
+    while (n_max_new <= id)
+      n_max_new *= 2;
+    CS_REALLOC(*count, n_max_new, unsigned long long);
+    for (int i = n_max_prev; i < n_max_new; i++)
+      (*count)[i] = 0;
+    *n_max = n_max_new;
+  }
+
+  (*count)[id] += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Find a field id based on its name, counting lookups if required.
+ *
+ * parameters:
+ *   name <-- field name
+ *
+ * returns:
+ *   id of matching field, or -1
+ *----------------------------------------------------------------------------*/
+
+static inline int
+_field_id_by_name(const char  *name)
+{
+  int id = cs_map_name_to_id_try(_field_map, name);
+
+  if (_lookup_count_is_active())
+    _count_lookup(id, &_n_field_lookup_max, &_field_lookup_count);
+
+  return id;
+}
+
+/*----------------------------------------------------------------------------
+ * Find a key id based on its name, counting lookups if required.
+ *
+ * parameters:
+ *   name <-- key name
+ *
+ * returns:
+ *   id of matching key, or -1
+ *----------------------------------------------------------------------------*/
+
+static inline int
+_key_id_by_name(const char  *name)
+{
+  int id = -1;
+
+  if (_key_map != nullptr)
+    id = cs_map_name_to_id_try(_key_map, name);
+
+  if (_lookup_count_is_active())
+    _count_lookup(id, &_n_key_lookup_max, &_key_lookup_count);
+
+  return id;
+}
+
+/*----------------------------------------------------------------------------
+ * Log the most frequent lookups of a given count array.
+ *
+ * parameters:
+ *   n_ids <-- number of ids
+ *   count <-- count array
+ *   map   <-- associated name to id map
+ *   n_ts  <-- number of time steps over which counts apply
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_top_lookups(int                        n_ids,
+                 const unsigned long long   count[],
+                 const cs_map_name_to_id_t *map,
+                 int                        n_ts)
+{
+  const int n_top_max = 8;
+  int top_ids[8];
+  int n_top = 0;
+
+  for (int i = 0; i < n_ids; i++) {
+    if (count[i] == 0)
+      continue;
+    int j = n_top;
+    if (n_top == n_top_max) {
+      if (count[top_ids[n_top_max - 1]] >= count[i])
+        continue;
+      j = n_top_max - 1;
+    }
+    else
+      n_top++;
+    while (j > 0 && count[top_ids[j-1]] < count[i]) {
+      top_ids[j] = top_ids[j-1];
+      j--;
+    }
+    top_ids[j] = i;
+  }
+
+  for (int i = 0; i < n_top; i++) {
+    int id = top_ids[i];
+    cs_log_printf(CS_LOG_DEFAULT,
+                  "      %-32s %12llu %12.1f\n",
+                  cs_map_name_to_id_reverse(map, id),
+                  count[id], (double)count[id] / (double)n_ts);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Create a field descriptor.
  *
@@ -419,6 +585,8 @@ _field_create(const char   *name,
 
   field_id = cs_map_name_to_id(_field_map, name);
 
+  _field_generation += 1;
+
   if (field_id == _n_fields)
     _n_fields = field_id + 1;
 
@@ -1708,6 +1876,8 @@ cs_field_set_n_time_vals(cs_field_t  *f,
 void
 cs_field_allocate_values(cs_field_t  *f)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_FIELDS);
+
   assert(f != nullptr);
 
   if (f->is_owner) {
@@ -1796,6 +1966,8 @@ cs_field_allocate_bc_coeffs(cs_field_t  *f,
                             bool         have_conv_bc,
                             bool         have_exch_bc)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_FIELDS);
+
   /* Add boundary condition coefficients if required */
 
   cs_lnum_t a_mult = f->dim;
@@ -2159,6 +2331,8 @@ cs_field_init_bc_coeffs(cs_field_t  *f)
 void
 cs_field_allocate_gradient(cs_field_t  *f)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_FIELDS);
+
   assert(f != nullptr);
 
   if (f->is_owner) {
@@ -2305,6 +2479,11 @@ cs_field_destroy_all(void)
 
   _n_fields = 0;
   _n_fields_max = 0;
+
+  _field_generation += 1;
+
+  _n_field_lookup_max = 0;
+  CS_FREE(_field_lookup_count);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2376,7 +2555,7 @@ cs_field_by_id(int  id)
 cs_field_t  *
 cs_field_by_name(const char  *name)
 {
-  int id = cs_map_name_to_id_try(_field_map, name);
+  int id = _field_id_by_name(name);
 
   if (id > -1)
     return _fields[id];
@@ -2402,7 +2581,7 @@ cs_field_by_name(const char  *name)
 cs_field_t  *
 cs_field_by_name_try(const char  *name)
 {
-  int id = cs_map_name_to_id_try(_field_map, name);
+  int id = _field_id_by_name(name);
 
   if (id > -1)
     return _fields[id];
@@ -2473,7 +2652,7 @@ cs_field_by_composite_name_try(const char  *name_prefix,
   memcpy(buffer + lp + 1, name_suffix, ls);
   buffer[lt] = '\0';
 
-  int id = cs_map_name_to_id_try(_field_map, buffer);
+  int id = _field_id_by_name(buffer);
 
   if (buffer != _buffer)
     CS_FREE(buffer);
@@ -2532,7 +2711,7 @@ cs_field_by_double_composite_name_try(const char  *name_part_1,
   }
   buffer[s] = '\0';  /* Null character instead of trailing '_' at end */
 
-  int id = cs_map_name_to_id_try(_field_map, buffer);
+  int id = _field_id_by_name(buffer);
 
   if (buffer != _buffer)
     CS_FREE(buffer);
@@ -2558,11 +2737,77 @@ cs_field_by_double_composite_name_try(const char  *name_part_1,
 int
 cs_field_id_by_name(const char *name)
 {
-  int id = cs_map_name_to_id_try(_field_map, name);
+  int id = _field_id_by_name(name);
 
   return id;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return a pointer to a field based on a cached handle.
+ *
+ * The name lookup is done only on the first call, or when field
+ * definitions have changed since the handle was last resolved; otherwise,
+ * the cached field id is used directly. Handles are usually defined
+ * as static variables at the call site, using \ref CS_FIELD_HANDLE:
+ *
+ * \code{.cpp}
+ * static cs_field_handle_t h_rho = CS_FIELD_HANDLE("density");
+ * cs_field_t *f_rho = cs_field_by_handle(&h_rho);
+ * \endcode
+ *
+ * The field must be defined.
+ *
+ * As the handle may be updated, this function should not be called
+ * inside OpenMP parallel regions.
+ *
+ * \param[in, out]  h  pointer to field handle
+ *
+ * \return  pointer to the field structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_field_t  *
+cs_field_by_handle(cs_field_handle_t  *h)
+{
+  cs_field_t *f = cs_field_by_handle_try(h);
+
+  if (f == nullptr)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Field \"%s\" is not defined."), h->name);
+
+  return f;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return a pointer to a field based on a cached handle if present.
+ *
+ * Similar to \ref cs_field_by_handle, except that nullptr is returned
+ * if no field of the given name is defined. Failed lookups are also
+ * cached, and only repeated if field definitions change.
+ * This function should not be called inside OpenMP parallel regions.
+ *
+ * \param[in, out]  h  pointer to field handle
+ *
+ * \return  pointer to the field structure, or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_field_t  *
+cs_field_by_handle_try(cs_field_handle_t  *h)
+{
+  if (h->generation != _field_generation) {
+    h->id = _field_id_by_name(h->name);
+    h->generation = _field_generation;
+  }
+
+  if (h->id > -1)
+    return _fields[h->id];
+  else
+    return nullptr;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return the id of a defined field and an associated component
@@ -2668,10 +2913,7 @@ cs_field_component_id_by_name(const char  *name,
 int
 cs_field_key_id(const char  *name)
 {
-  int id = -1;
-
-  if (_key_map != nullptr)
-    id = cs_map_name_to_id_try(_key_map, name);
+  int id = _key_id_by_name(name);
 
   if (id < 0)
     bft_error(__FILE__, __LINE__, 0,
@@ -2695,10 +2937,7 @@ cs_field_key_id(const char  *name)
 int
 cs_field_key_id_try(const char  *name)
 {
-  int id = -1;
-
-  if (_key_map != nullptr)
-    id = cs_map_name_to_id_try(_key_map, name);
+  int id = _key_id_by_name(name);
 
   return id;
 }
@@ -2943,6 +3182,9 @@ cs_field_destroy_all_keys(void)
   cs_map_name_to_id_destroy(&_key_map);
 
   CS_FREE(_key_vals);
+
+  _n_key_lookup_max = 0;
+  CS_FREE(_key_lookup_count);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -4419,6 +4661,80 @@ cs_field_log_all_key_vals(bool  log_defaults)
     cs_field_log_key_vals(i, log_defaults);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log counts of field and key name-based lookups since the
+ *        previous call, and reset counts.
+ *
+ * Counting is only active if the CS_FIELD_LOOKUP_LOG environment variable
+ * is defined; this function does nothing otherwise. Counts are local to
+ * each rank, and the most frequently looked-up names are listed, so as
+ * to help replace per time step lookups by cached handles
+ * (see \ref cs_field_by_handle) or static key ids.
+ *
+ * \param[in]  nt_cur  current time step number
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_log_name_lookups(int  nt_cur)
+{
+  if (_lookup_count_is_active() == false)
+    return;
+
+  unsigned long long n_f_lookups = 0, n_k_lookups = 0;
+
+  for (int i = 0; i < _n_field_lookup_max; i++)
+    n_f_lookups += _field_lookup_count[i];
+  for (int i = 0; i < _n_key_lookup_max; i++)
+    n_k_lookups += _key_lookup_count[i];
+
+  int n_ts = cs::max(nt_cur - _lookup_log_nt_prev, 1);
+
+  if (_lookup_log_nt_prev < 0)
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("\n  Field name lookups up to time step %d:\n"),
+                  nt_cur);
+  else
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("\n  Field name lookups over the last %d time step(s):\n"),
+                  n_ts);
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("    fields:  %12llu (%.1f per time step)\n"
+                  "    keys:    %12llu (%.1f per time step)\n"
+                  "    failed:  %12llu\n"),
+                n_f_lookups, (double)n_f_lookups / (double)n_ts,
+                n_k_lookups, (double)n_k_lookups / (double)n_ts,
+                _n_failed_lookups);
+
+  if (n_f_lookups > 0) {
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("    most looked-up fields:%25s %12s\n"),
+                  _("count"), _("per step"));
+    _log_top_lookups(cs::min(_n_field_lookup_max, _n_fields),
+                     _field_lookup_count, _field_map, n_ts);
+  }
+
+  if (n_k_lookups > 0) {
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("    most looked-up keys:%27s %12s\n"),
+                  _("count"), _("per step"));
+    _log_top_lookups(cs::min(_n_key_lookup_max, _n_keys),
+                     _key_lookup_count, _key_map, n_ts);
+  }
+
+  /* Reset counts */
+
+  for (int i = 0; i < _n_field_lookup_max; i++)
+    _field_lookup_count[i] = 0;
+  for (int i = 0; i < _n_key_lookup_max; i++)
+    _key_lookup_count[i] = 0;
+  _n_failed_lookups = 0;
+
+  _lookup_log_nt_prev = nt_cur;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define base keys.
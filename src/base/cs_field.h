@@ -79,6 +79,9 @@ BEGIN_C_DECLS
 
 /*! @} */
 
+/*! Static initializer for a field handle (\ref cs_field_handle_t) */
+#define CS_FIELD_HANDLE(name) {name, -1, -1}
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -194,6 +197,22 @@ typedef struct {
 
 } cs_field_t;
 
+/*----------------------------------------------------------------------------
+ * Field handle, caching the id associated with a field name.
+ *
+ * Handles should be initialized using CS_FIELD_HANDLE(name), and are
+ * resolved on first use (see cs_field_by_handle).
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  const char  *name;        /* field name */
+  int          id;          /* cached field id, or -1 */
+  int          generation;  /* field definitions generation at which
+                               id was resolved, or -1 */
+
+} cs_field_handle_t;
+
 /*----------------------------------------------------------------------------
  * Function pointer for structure associated to field key
  *
@@ -528,6 +547,42 @@ cs_field_by_name(const char *name);
 cs_field_t  *
 cs_field_by_name_try(const char *name);
 
+/*----------------------------------------------------------------------------
+ * Return a pointer to a field based on a cached handle.
+ *
+ * The name lookup is done only on the first call, or when field
+ * definitions have changed since the handle was last resolved.
+ * The field must be defined.
+ *
+ * As the handle may be updated, this function should not be called
+ * inside OpenMP parallel regions.
+ *
+ * parameters:
+ *   h <-> pointer to field handle
+ *
+ * returns:
+ *   pointer to the field structure
+ *----------------------------------------------------------------------------*/
+
+cs_field_t  *
+cs_field_by_handle(cs_field_handle_t  *h);
+
+/*----------------------------------------------------------------------------
+ * Return a pointer to a field based on a cached handle if present.
+ *
+ * If no field of the given name is defined, nullptr is returned.
+ * This function should not be called inside OpenMP parallel regions.
+ *
+ * parameters:
+ *   h <-> pointer to field handle
+ *
+ * returns:
+ *   pointer to the field structure, or nullptr
+ *----------------------------------------------------------------------------*/
+
+cs_field_t  *
+cs_field_by_handle_try(cs_field_handle_t  *h);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return a pointer to a field based on a composite name.
@@ -1178,6 +1233,20 @@ cs_field_log_key_vals(int   key_id,
 void
 cs_field_log_all_key_vals(bool  log_defaults);
 
+/*----------------------------------------------------------------------------
+ * Log counts of field and key name-based lookups since the previous call,
+ * and reset counts.
+ *
+ * Counting is only active if the CS_FIELD_LOOKUP_LOG environment variable
+ * is defined; this function does nothing otherwise.
+ *
+ * parameters:
+ *   nt_cur <-- current time step number
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_log_name_lookups(int  nt_cur);
+
 /*----------------------------------------------------------------------------
  * Define base keys.
  *
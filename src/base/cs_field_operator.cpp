@@ -340,8 +340,9 @@ cs_field_gradient_scalar(const cs_field_t          *f,
 
   const cs_field_t *parent_f = f;
 
-  const int f_parent_id
-    = cs_field_get_key_int(f, cs_field_key_id("parent_field_id"));
+  static const int k_parent = cs_field_key_id("parent_field_id");
+
+  const int f_parent_id = cs_field_get_key_int(f, k_parent);
   if (f_parent_id > -1)
     parent_f = cs_field_by_id(f_parent_id);
 
@@ -369,7 +370,7 @@ cs_field_gradient_scalar(const cs_field_t          *f,
 
     if (eqp->iwgrec == 1) {
       /* Weighted gradient coefficients */
-      int key_id = cs_field_key_id("gradient_weighting_id");
+      static const int key_id = cs_field_key_id("gradient_weighting_id");
       int diff_id = cs_field_get_key_int(parent_f, key_id);
       if (diff_id > -1) {
         cs_field_t *f_weight = cs_field_by_id(diff_id);
@@ -379,7 +380,9 @@ cs_field_gradient_scalar(const cs_field_t          *f,
     }
 
     /* Internal coupling structure */
-    int key_id = cs_field_key_id_try("coupling_entity");
+    static int key_id = -1;
+    if (key_id < 0)
+      key_id = cs_field_key_id_try("coupling_entity");
     if (key_id > -1) {
       int coupl_id = cs_field_get_key_int(parent_f, key_id);
       if (coupl_id > -1)
@@ -455,7 +458,9 @@ cs_field_gradient_scalar_array(int                         f_id,
   /* Check if given field has internal coupling  */
   cs_internal_coupling_t  *cpl = nullptr;
   if (f_id > -1) {
-    const int key_id = cs_field_key_id_try("coupling_entity");
+    static int key_id = -1;
+    if (key_id < 0)
+      key_id = cs_field_key_id_try("coupling_entity");
     if (key_id > -1) {
       int coupl_id = cs_field_get_key_int(f, key_id);
       if (coupl_id > -1)
@@ -516,8 +521,9 @@ cs_field_gradient_potential(const cs_field_t          *f,
 
   const cs_field_t *parent_f = f;
 
-  const int f_parent_id
-    = cs_field_get_key_int(f, cs_field_key_id("parent_field_id"));
+  static const int k_parent = cs_field_key_id("parent_field_id");
+
+  const int f_parent_id = cs_field_get_key_int(f, k_parent);
   if (f_parent_id > -1)
     parent_f = cs_field_by_id(f_parent_id);
 
@@ -552,7 +558,7 @@ cs_field_gradient_potential(const cs_field_t          *f,
   if (parent_f->type & CS_FIELD_VARIABLE && eqp->idiff > 0) {
 
     if (eqp->iwgrec == 1) {
-      int key_id = cs_field_key_id("gradient_weighting_id");
+      static const int key_id = cs_field_key_id("gradient_weighting_id");
       int diff_id = cs_field_get_key_int(parent_f, key_id);
       if (diff_id > -1) {
         cs_field_t *f_weight = cs_field_by_id(diff_id);
@@ -562,7 +568,9 @@ cs_field_gradient_potential(const cs_field_t          *f,
     }
 
     /* Internal coupling structure */
-    int key_id = cs_field_key_id_try("coupling_entity");
+    static int key_id = -1;
+    if (key_id < 0)
+      key_id = cs_field_key_id_try("coupling_entity");
     if (key_id > -1) {
       int coupl_id = cs_field_get_key_int(parent_f, key_id);
       if (coupl_id > -1)
@@ -641,7 +649,7 @@ cs_field_gradient_vector(const cs_field_t          *f,
 
     if (eqp->iwgrec == 1) {
       /* Weighted gradient coefficients */
-      int key_id = cs_field_key_id("gradient_weighting_id");
+      static const int key_id = cs_field_key_id("gradient_weighting_id");
       int diff_id = cs_field_get_key_int(f, key_id);
       if (diff_id > -1) {
         cs_field_t *f_weight = cs_field_by_id(diff_id);
@@ -649,7 +657,11 @@ cs_field_gradient_vector(const cs_field_t          *f,
       }
     }
 
-    int key_id = cs_field_key_id_try("coupling_entity");
+    static int key_id = -1;
+
+    if (key_id < 0)
+
+      key_id = cs_field_key_id_try("coupling_entity");
     if (key_id > -1) {
       int coupl_id = cs_field_get_key_int(f, key_id);
       if (coupl_id > -1)
@@ -806,8 +818,9 @@ cs_field_gradient_boundary_iprime_scalar(const cs_field_t  *f,
 
   const cs_field_t *parent_f = f;
 
-  const int f_parent_id
-    = cs_field_get_key_int(f, cs_field_key_id("parent_field_id"));
+  static const int k_parent = cs_field_key_id("parent_field_id");
+
+  const int f_parent_id = cs_field_get_key_int(f, k_parent);
   if (f_parent_id > -1)
     parent_f = cs_field_by_id(f_parent_id);
 
@@ -835,7 +848,7 @@ cs_field_gradient_boundary_iprime_scalar(const cs_field_t  *f,
 
     if (eqp->iwgrec == 1) {
       /* Weighted gradient coefficients */
-      int key_id = cs_field_key_id("gradient_weighting_id");
+      static const int key_id = cs_field_key_id("gradient_weighting_id");
       int diff_id = cs_field_get_key_int(parent_f, key_id);
       if (diff_id > -1) {
         cs_field_t *f_weight = cs_field_by_id(diff_id);
@@ -845,7 +858,9 @@ cs_field_gradient_boundary_iprime_scalar(const cs_field_t  *f,
     }
 
     /* Internal coupling structure */
-    int key_id = cs_field_key_id_try("coupling_entity");
+    static int key_id = -1;
+    if (key_id < 0)
+      key_id = cs_field_key_id_try("coupling_entity");
     if (key_id > -1) {
       int coupl_id = cs_field_get_key_int(parent_f, key_id);
       if (coupl_id > -1)
@@ -977,8 +992,9 @@ cs_field_gradient_boundary_iprime_vector(const cs_field_t  *f,
 
   const cs_field_t *parent_f = f;
 
-  const int f_parent_id
-    = cs_field_get_key_int(f, cs_field_key_id("parent_field_id"));
+  static const int k_parent = cs_field_key_id("parent_field_id");
+
+  const int f_parent_id = cs_field_get_key_int(f, k_parent);
   if (f_parent_id > -1)
     parent_f = cs_field_by_id(f_parent_id);
 
@@ -1004,7 +1020,9 @@ cs_field_gradient_boundary_iprime_vector(const cs_field_t  *f,
   if (parent_f->type & CS_FIELD_VARIABLE && eqp->idiff > 0) {
 
     /* Internal coupling structure */
-    int key_id = cs_field_key_id_try("coupling_entity");
+    static int key_id = -1;
+    if (key_id < 0)
+      key_id = cs_field_key_id_try("coupling_entity");
     if (key_id > -1) {
       int coupl_id = cs_field_get_key_int(parent_f, key_id);
       if (coupl_id > -1)
@@ -1139,8 +1157,9 @@ cs_field_gradient_boundary_iprime_tensor(const cs_field_t  *f,
 
   const cs_field_t *parent_f = f;
 
-  const int f_parent_id
-    = cs_field_get_key_int(f, cs_field_key_id("parent_field_id"));
+  static const int k_parent = cs_field_key_id("parent_field_id");
+
+  const int f_parent_id = cs_field_get_key_int(f, k_parent);
   if (f_parent_id > -1)
     parent_f = cs_field_by_id(f_parent_id);
 
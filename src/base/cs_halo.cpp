@@ -46,10 +46,12 @@
 #if defined(HAVE_CUDA)
 #include "base/cs_base_cuda.h"
 #endif
+#include "base/cs_comm_profile.h"
 #include "base/cs_interface.h"
 #include "base/cs_mem.h"
 #include "base/cs_order.h"
 #include "base/cs_rank_neighbors.h"
+#include "base/cs_trace.h"
 
 #include "fvm/fvm_periodicity.h"
 
@@ -348,6 +350,34 @@ _sync_local(const cs_halo_t  *halo,
 }
 
 #if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Record messages sent by a halo synchronization for profiling.
+ *
+ * parameters:
+ *   halo <-- pointer to halo structure
+ *   hs   <-- pointer to halo state
+ *----------------------------------------------------------------------------*/
+
+static void
+_comm_profile_sync(const cs_halo_t        *halo,
+                   const cs_halo_state_t  *hs)
+{
+  cs_lnum_t end_shift = (hs->sync_mode == CS_HALO_EXTENDED) ? 2 : 1;
+  size_t elt_size = cs_datatype_size[hs->data_type] * hs->stride;
+  const int local_rank = cs::max(cs_glob_rank_id, 0);
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+    cs_lnum_t length = (  halo->send_index[2*rank_id + end_shift]
+                        - halo->send_index[2*rank_id]);
+    if (halo->c_domain_rank[rank_id] != local_rank && length > 0)
+      cs_comm_profile_add(CS_COMM_PROFILE_OP_HALO,
+                          cs_glob_mpi_comm,
+                          halo->c_domain_rank[rank_id],
+                          length*elt_size);
+  }
+}
+
 #if (MPI_VERSION >= 3)
 
 /*----------------------------------------------------------------------------*/
@@ -1829,8 +1859,15 @@ cs_halo_sync_start(const cs_halo_t  *halo,
   if (halo == nullptr)
     return;
 
+  cs_trace_scope trace_scope("halo", "halo sync start");
+
   cs_halo_state_t  *_hs = (hs != nullptr) ? hs : _halo_state;
 
+#if defined(HAVE_MPI)
+  if (cs_glob_comm_profile_active)
+    _comm_profile_sync(halo, _hs);
+#endif
+
 #if (MPI_VERSION >= 3)
   if (_halo_comm_mode > CS_HALO_COMM_P2P) {
     _halo_sync_start_one_sided(halo, val, _hs);
@@ -1991,6 +2028,8 @@ cs_halo_sync_wait(const cs_halo_t  *halo,
   if (halo == nullptr)
     return;
 
+  cs_trace_scope trace_scope("halo", "halo sync wait");
+
   cs_halo_state_t  *_hs = (hs != nullptr) ? hs : _halo_state;
 
 #if (MPI_VERSION >= 3)
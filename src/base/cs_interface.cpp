@@ -46,6 +46,7 @@
 #include "base/cs_all_to_all.h"
 #include "base/cs_base.h"
 #include "base/cs_block_dist.h"
+#include "base/cs_comm_profile.h"
 #include "base/cs_math.h"
 #include "base/cs_mem.h"
 #include "base/cs_order.h"
@@ -3177,7 +3178,7 @@ _interface_set_copy_array_ni(const cs_interface_set_t  *ifs,
 
     for (i = 0, j = 0; i < ifs->size; i++) {
       cs_interface_t *itf = ifs->interfaces[i];
-      if (itf->rank != local_rank)
+      if (itf->rank != local_rank) {
         MPI_Isend(send_buf + j*stride_size,
                   itf->size*stride,
                   mpi_type,
@@ -3185,6 +3186,10 @@ _interface_set_copy_array_ni(const cs_interface_set_t  *ifs,
                   local_rank,
                   ifs->comm,
                   &(request[request_count++]));
+        if (cs_glob_comm_profile_active)
+          cs_comm_profile_add(CS_COMM_PROFILE_OP_INTERFACE, ifs->comm,
+                              itf->rank, itf->size*stride_size);
+      }
       j += itf->size;
     }
 
@@ -4133,7 +4138,7 @@ cs_interface_set_copy_array(const cs_interface_set_t  *ifs,
 
     for (i = 0, j = 0; i < ifs->size; i++) {
       cs_interface_t *itf = ifs->interfaces[i];
-      if (itf->rank != local_rank)
+      if (itf->rank != local_rank) {
         MPI_Isend(send_buf + j*stride_size,
                   itf->size*stride,
                   mpi_type,
@@ -4141,6 +4146,10 @@ cs_interface_set_copy_array(const cs_interface_set_t  *ifs,
                   local_rank,
                   ifs->comm,
                   &(request[request_count++]));
+        if (cs_glob_comm_profile_active)
+          cs_comm_profile_add(CS_COMM_PROFILE_OP_INTERFACE, ifs->comm,
+                              itf->rank, itf->size*stride_size);
+      }
       j += itf->size;
     }
 
@@ -4342,7 +4351,7 @@ cs_interface_set_copy_indexed(const cs_interface_set_t  *ifs,
     for (i = 0, j = 0; i < ifs->size; i++) {
       cs_interface_t *itf = ifs->interfaces[i];
       cs_lnum_t s_buf_shift = itf_s_index[i]*type_size;
-        if (itf->rank != local_rank)
+        if (itf->rank != local_rank) {
           MPI_Isend(send_buf + s_buf_shift,
                     (itf_s_index[i+1]-itf_s_index[i]),
                     mpi_type,
@@ -4350,6 +4359,11 @@ cs_interface_set_copy_indexed(const cs_interface_set_t  *ifs,
                     local_rank,
                     ifs->comm,
                     &(request[request_count++]));
+          if (cs_glob_comm_profile_active)
+            cs_comm_profile_add(CS_COMM_PROFILE_OP_INTERFACE, ifs->comm,
+                                itf->rank,
+                                (itf_s_index[i+1]-itf_s_index[i])*type_size);
+        }
     }
 
     MPI_Waitall(request_count, request, status);
@@ -193,6 +193,47 @@ cs_interpolate_from_location_p0(void                *input,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the halo type used by P1 interpolation for a given input.
+ *
+ * For variable fields, the halo type matches the field's gradient
+ * reconstruction options; otherwise, the extended neighborhood is used
+ * when available.
+ *
+ * \param[in]  input  pointer to optional (untyped) value or structure,
+ *                    as for \ref cs_interpolate_from_location_p1
+ *
+ * \return  halo type (defining the cell neighborhood used for gradients)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_halo_type_t
+cs_interpolate_p1_halo_type(const void  *input)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  cs_halo_type_t halo_type
+    = (m->cell_cells_idx != nullptr) ? CS_HALO_EXTENDED : CS_HALO_STANDARD;
+
+  if (input != nullptr) {
+    const char *name = reinterpret_cast<const char *>(input);
+    const cs_field_t *f = cs_field_by_name_try(name);
+    if (f != nullptr) {
+      if (f->type & CS_FIELD_VARIABLE) {
+        const cs_equation_param_t *eqp
+          = cs_field_get_equation_param_const(f);
+        cs_gradient_type_t gradient_type = CS_GRADIENT_LSQ;
+        cs_gradient_type_by_imrgra(eqp->imrgra,
+                                   &gradient_type,
+                                   &halo_type);
+      }
+    }
+  }
+
+  return halo_type;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Interpolate values defined on a mesh location at a given set of
@@ -255,8 +296,7 @@ cs_interpolate_from_location_p1(void                *input,
 
   const cs_real_3_t *cell_cen = fvq->cell_cen;
 
-  cs_halo_type_t halo_type
-    = (m->cell_cells_idx != nullptr) ? CS_HALO_EXTENDED : CS_HALO_STANDARD;
+  cs_halo_type_t halo_type = cs_interpolate_p1_halo_type(input);
 
   cs_field_t *f = nullptr;
   cs_field_bc_coeffs_t *bc_coeffs = nullptr;
@@ -288,14 +328,6 @@ cs_interpolate_from_location_p1(void                *input,
           }
         }
       }
-      if (f->type & CS_FIELD_VARIABLE) {
-        const cs_equation_param_t *eqp
-          = cs_field_get_equation_param_const(f);
-        cs_gradient_type_t gradient_type = CS_GRADIENT_LSQ;
-        cs_gradient_type_by_imrgra(eqp->imrgra,
-                                   &gradient_type,
-                                   &halo_type);
-      }
     }
   }
 
@@ -32,6 +32,7 @@
  *----------------------------------------------------------------------------*/
 
 #include "base/cs_defs.h"
+#include "base/cs_halo.h"
 #include "mesh/cs_mesh_location.h"
 
 /*----------------------------------------------------------------------------*/
@@ -111,6 +112,24 @@ cs_interpolate_from_location_p0(void                *input,
                                 const void          *location_vals,
                                 void                *point_vals);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the halo type used by P1 interpolation for a given input.
+ *
+ * For variable fields, the halo type matches the field's gradient
+ * reconstruction options; otherwise, the extended neighborhood is used
+ * when available.
+ *
+ * \param[in]  input  pointer to optional (untyped) value or structure,
+ *                    as for \ref cs_interpolate_from_location_p1
+ *
+ * \return  halo type (defining the cell neighborhood used for gradients)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_halo_type_t
+cs_interpolate_p1_halo_type(const void  *input);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Interpolate values defined on a mesh location at a given set of
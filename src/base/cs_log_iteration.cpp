@@ -63,6 +63,8 @@
 #include "base/cs_prototypes.h"
 #include "base/cs_range_set.h"
 #include "base/cs_reducers.h"
+#include "base/cs_solve_equation.h"
+#include "base/cs_steady_acceleration.h"
 #include "base/cs_time_moment.h"
 #include "base/cs_time_plot.h"
 #include "base/cs_time_step.h"
@@ -1712,6 +1714,8 @@ cs_log_iteration(void)
   cs_fan_log_iteration();
   cs_ctwr_log_balance();
 
+  cs_steady_acceleration_log_iteration();
+
   cs_notebook_log();
 }
 
@@ -1807,8 +1811,16 @@ cs_log_equation_convergence_info_write(void)
     /* Check if the variable was solved in the current time step */
     auto *sinfo = static_cast<cs_solving_info_t *>(
         cs_field_get_key_struct_ptr(f, si_k_id));
-    if (sinfo->n_it < 0)
+    if (sinfo->n_it < 0) {
+      /* Report solves skipped as converged */
+      int n_skipped = 0, n_skipped_tot = 0;
+      if (   cs_solve_equation_skipped(f, &n_skipped, &n_skipped_tot)
+          && log_flag > 0)
+        cs_log_printf(CS_LOG_DEFAULT,
+                      _("%s skipped (converged, %d consecutive, %d total)\n"),
+                      chain, n_skipped, n_skipped_tot);
       continue;
+    }
 
     const cs_lnum_t dim = f->dim;
     cs_real_t *dt = CS_F_(dt)->val;
@@ -39,13 +39,14 @@
  * Standard library headers
  *----------------------------------------------------------------------------*/
 
+#include <atomic>
 #include <map>
+#include <mutex>
+#include <unordered_map>
 
 #if defined(HAVE_ACCEL)
 
 #include <memory>
-#include <mutex>
-#include <unordered_map>
 #include <vector>
 
 #endif // defined(HAVE_ACCEL)
@@ -185,6 +186,16 @@ typedef struct
 
 } cs_mem_block_t;
 
+/* Structure describing a tagged memory block
+   ------------------------------------------ */
+
+typedef struct
+{
+  size_t        size;       //!< allocation size
+  cs_mem_tag_t  tag;        //!< allocation tag
+
+} cs_mem_tag_block_t;
+
 #if defined(HAVE_ACCEL)
 
 /* Structure describing a memory block in pool
@@ -430,6 +441,43 @@ static size_t  _cs_mem_global_n_frees = 0;
 static bft_error_handler_t  *_cs_mem_error_handler
                               = (_cs_mem_error_handler_default);
 
+/* Tagged allocations accounting (always active, independently of
+   the cs_mem_init options, but only for tagged allocations) */
+
+static const char  *_cs_mem_tag_name[] = {"untagged",
+                                          "mesh",
+                                          "quantities",
+                                          "fields",
+                                          "matrices",
+                                          "linear solvers",
+                                          "multigrid",
+                                          "Lagrangian",
+                                          "postprocessing",
+                                          "CDO"};
+
+#define CS_MEM_TAG_STACK_MAX 32
+
+/* The tag stack is private to each thread, so that tag scopes may be
+   used inside OpenMP parallel regions (a thread does not inherit the
+   tags of the thread which started the region). */
+
+static thread_local int           _cs_mem_tag_depth = 0;
+static thread_local cs_mem_tag_t  _cs_mem_tag_stack[CS_MEM_TAG_STACK_MAX];
+
+static std::unordered_map<const void *, cs_mem_tag_block_t> _cs_tag_map;
+
+static size_t    _cs_mem_tag_alloc_cur[CS_MEM_N_TAGS];
+static size_t    _cs_mem_tag_alloc_max[CS_MEM_N_TAGS];
+static size_t    _cs_mem_tag_alloc_sample_max[CS_MEM_N_TAGS];
+static uint64_t  _cs_mem_tag_n_allocs[CS_MEM_N_TAGS];
+
+/* Tag accounting may be updated from any thread (OpenMP or not), so
+   it is always protected by a mutex; it is skipped entirely until
+   a tag is first pushed. */
+
+static std::mutex  _cs_mem_tag_mutex;
+static std::atomic<bool>  _cs_mem_tag_used(false);
+
 #if defined(HAVE_OPENMP)
 static omp_lock_t _cs_mem_lock;
 #endif
@@ -907,6 +955,79 @@ _update_block_info(const char            *var_name,
   } /* End if map needs to be updated */
 }
 
+/*----------------------------------------------------------------------------
+ * Remove a block from tagged allocation accounting.
+ *
+ * parameters:
+ *   p <-- pointer to block
+ *
+ * returns:
+ *   removed block's size and tag, or 0 and CS_MEM_TAG_NONE if the block
+ *   was not tagged
+ *----------------------------------------------------------------------------*/
+
+static cs_mem_tag_block_t
+_tag_block_remove(const void  *p)
+{
+  cs_mem_tag_block_t tb = {0, CS_MEM_TAG_NONE};
+
+  if (_cs_mem_tag_used.load(std::memory_order_relaxed) == false)
+    return tb;
+
+  std::lock_guard<std::mutex> guard(_cs_mem_tag_mutex);
+
+  if (_cs_tag_map.empty() == false) {
+    auto it = _cs_tag_map.find(p);
+    if (it != _cs_tag_map.end()) {
+      tb = it->second;
+      _cs_mem_tag_alloc_cur[tb.tag] -= tb.size;
+      _cs_tag_map.erase(it);
+    }
+  }
+
+  return tb;
+}
+
+/*----------------------------------------------------------------------------
+ * Add a block to tagged allocation accounting.
+ *
+ * A block keeps the tag active when it was first accounted for, even if
+ * it is reallocated under another tag. Blocks allocated with no active
+ * tag are not accounted for, unless reallocated under a tag.
+ *
+ * parameters:
+ *   p      <-- pointer to block
+ *   size   <-- block size
+ *   tb_old <-- previous size and tag of reallocated block, if tagged
+ *----------------------------------------------------------------------------*/
+
+static void
+_tag_block_add(void                *p,
+               size_t               size,
+               cs_mem_tag_block_t   tb_old)
+{
+  cs_mem_tag_t tag = tb_old.tag;
+  if (tag == CS_MEM_TAG_NONE)
+    tag = cs_mem_tag_current();
+
+  if (tag == CS_MEM_TAG_NONE || p == nullptr)
+    return;
+
+  std::lock_guard<std::mutex> guard(_cs_mem_tag_mutex);
+
+  _cs_tag_map[p] = {size, tag};
+
+  if (tb_old.tag == CS_MEM_TAG_NONE)
+    _cs_mem_tag_n_allocs[tag] += 1;
+
+  _cs_mem_tag_alloc_cur[tag] += size;
+
+  if (_cs_mem_tag_alloc_max[tag] < _cs_mem_tag_alloc_cur[tag])
+    _cs_mem_tag_alloc_max[tag] = _cs_mem_tag_alloc_cur[tag];
+  if (_cs_mem_tag_alloc_sample_max[tag] < _cs_mem_tag_alloc_cur[tag])
+    _cs_mem_tag_alloc_sample_max[tag] = _cs_mem_tag_alloc_cur[tag];
+}
+
 #if defined(SYCL_LANGUAGE_VERSION)
 
 /*----------------------------------------------------------------------------*/
@@ -1736,7 +1857,10 @@ cs_mem_malloc(size_t       ni,
                   var_name, (unsigned long)alloc_size);
     return nullptr;
   }
-  else if (_cs_mem_global_init_mode < 2)
+
+  _tag_block_add(p_new, alloc_size, {0, CS_MEM_TAG_NONE});
+
+  if (_cs_mem_global_init_mode < 2)
     return p_new;
 
   cs_mem_block_t mib = _cs_mem_block_new(p_new, alloc_size);
@@ -1832,8 +1956,12 @@ cs_mem_realloc(void        *ptr,
   }
 #endif
 
+  cs_mem_tag_block_t tb_old = _tag_block_remove(ptr);
+
   void *p_new = realloc(ptr, new_size);
 
+  _tag_block_add(p_new, new_size, tb_old);
+
   if (file_name != nullptr) {
     cs_mem_block_t mib_new = _cs_mem_block_new(p_new, new_size);
 
@@ -1879,6 +2007,8 @@ cs_mem_free(void        *ptr,
 
   /* General case (free allocated memory) */
 
+  _tag_block_remove(ptr);
+
   /* When possible, get previous allocation information. */
 
   cs_mem_block_t mib_old;
@@ -1970,7 +2100,10 @@ cs_mem_memalign(size_t       alignment,
     }
     return nullptr;
   }
-  else if (_cs_mem_global_init_mode < 2)
+
+  _tag_block_add(p_loc, alloc_size, {0, CS_MEM_TAG_NONE});
+
+  if (_cs_mem_global_init_mode < 2)
     return p_loc;
 
   cs_mem_block_t mib = _cs_mem_block_new(p_loc, alloc_size);
@@ -2071,6 +2204,143 @@ cs_mem_stats(uint64_t  *alloc_cur,
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the allocation tag for subsequent host allocations.
+ *
+ * Tags are stacked, so each call must be matched by a call to
+ * \ref cs_mem_tag_pop. The innermost tag applies, so nested subsystems
+ * are accounted separately.
+ *
+ * The tag stack is specific to each thread: a tag set outside an OpenMP
+ * parallel region applies to allocations of the calling thread only.
+ *
+ * \param [in]  tag  allocation tag
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mem_tag_push(cs_mem_tag_t  tag)
+{
+  if (_cs_mem_tag_depth >= CS_MEM_TAG_STACK_MAX)
+    _cs_mem_error(__FILE__, __LINE__, 0,
+                  _("Allocation tag stack depth limit (%d) reached"),
+                  CS_MEM_TAG_STACK_MAX);
+
+  _cs_mem_tag_stack[_cs_mem_tag_depth] = tag;
+  _cs_mem_tag_depth += 1;
+
+  if (tag != CS_MEM_TAG_NONE)
+    _cs_mem_tag_used.store(true, std::memory_order_relaxed);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Restore the allocation tag active before the matching
+ *        \ref cs_mem_tag_push call.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mem_tag_pop(void)
+{
+  if (_cs_mem_tag_depth < 1)
+    _cs_mem_error(__FILE__, __LINE__, 0,
+                  _("cs_mem_tag_pop() called with no active tag"));
+
+  _cs_mem_tag_depth -= 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the currently active allocation tag.
+ *
+ * \return  active tag, or CS_MEM_TAG_NONE
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_mem_tag_t
+cs_mem_tag_current(void)
+{
+  if (_cs_mem_tag_depth > 0)
+    return _cs_mem_tag_stack[_cs_mem_tag_depth - 1];
+  return CS_MEM_TAG_NONE;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the name of an allocation tag.
+ *
+ * \param [in]  tag  allocation tag
+ *
+ * \return  pointer to tag name
+ */
+/*----------------------------------------------------------------------------*/
+
+const char *
+cs_mem_tag_name(cs_mem_tag_t  tag)
+{
+  if (tag < CS_MEM_TAG_NONE || tag >= CS_MEM_N_TAGS)
+    return nullptr;
+
+  return _cs_mem_tag_name[tag];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return memory allocation stats for a given tag.
+ *
+ * \param [in]   tag        allocation tag
+ * \param [out]  alloc_cur  current allocation size, or nullptr
+ * \param [out]  alloc_max  max allocation size, or nullptr
+ * \param [out]  n_allocs   total number of allocations, or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mem_tag_stats(cs_mem_tag_t   tag,
+                 uint64_t      *alloc_cur,
+                 uint64_t      *alloc_max,
+                 uint64_t      *n_allocs)
+{
+  if (tag < CS_MEM_TAG_NONE || tag >= CS_MEM_N_TAGS)
+    return;
+
+  std::lock_guard<std::mutex> guard(_cs_mem_tag_mutex);
+
+  if (alloc_cur != nullptr)
+    *alloc_cur = _cs_mem_tag_alloc_cur[tag];
+  if (alloc_max != nullptr)
+    *alloc_max = _cs_mem_tag_alloc_max[tag];
+  if (n_allocs != nullptr)
+    *n_allocs = _cs_mem_tag_n_allocs[tag];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sample current allocation sizes for all tags, and maximum sizes
+ *        since the previous sample.
+ *
+ * \param [out]  alloc_cur  current allocation size per tag
+ *                          (size: CS_MEM_N_TAGS)
+ * \param [out]  alloc_max  max allocation size per tag since previous
+ *                          call (size: CS_MEM_N_TAGS)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mem_tag_sample(uint64_t  alloc_cur[],
+                  uint64_t  alloc_max[])
+{
+  std::lock_guard<std::mutex> guard(_cs_mem_tag_mutex);
+
+  for (int i = 0; i < CS_MEM_N_TAGS; i++) {
+    alloc_cur[i] = _cs_mem_tag_alloc_cur[i];
+    alloc_max[i] = _cs_mem_tag_alloc_sample_max[i];
+    _cs_mem_tag_alloc_sample_max[i] = _cs_mem_tag_alloc_cur[i];
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Indicate if a memory aligned allocation variant is available.
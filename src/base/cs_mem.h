@@ -60,6 +60,27 @@ typedef enum {
 
 } cs_alloc_mode_t;
 
+/*!
+ * Allocation tags, used to account for memory by subsystem.
+ */
+
+typedef enum {
+
+  CS_MEM_TAG_NONE,              /*!< untagged allocations */
+  CS_MEM_TAG_MESH,              /*!< mesh and mesh building */
+  CS_MEM_TAG_QUANTITIES,        /*!< mesh quantities */
+  CS_MEM_TAG_FIELDS,            /*!< field values and boundary conditions */
+  CS_MEM_TAG_MATRICES,          /*!< matrix structures and coefficients */
+  CS_MEM_TAG_LINEAR_SOLVERS,    /*!< linear solver setup (except multigrid) */
+  CS_MEM_TAG_MULTIGRID,         /*!< multigrid hierarchy */
+  CS_MEM_TAG_LAGRANGIAN,        /*!< Lagrangian particle tracking */
+  CS_MEM_TAG_POST,              /*!< postprocessing */
+  CS_MEM_TAG_CDO,               /*!< CDO/HHO schemes */
+
+  CS_MEM_N_TAGS                 /*!< number of allocation tags */
+
+} cs_mem_tag_t;
+
 /*============================================================================
  * Public macros
  *============================================================================*/
@@ -559,6 +580,91 @@ cs_mem_stats(uint64_t  *alloc_cur,
              uint64_t  *n_frees,
              uint64_t  *n_current);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the allocation tag for subsequent host allocations.
+ *
+ * Tags are stacked, so each call must be matched by a call to
+ * \ref cs_mem_tag_pop. The innermost tag applies, so nested subsystems
+ * are accounted separately.
+ *
+ * The tag stack is specific to each thread: a tag set outside an OpenMP
+ * parallel region applies to allocations of the calling thread only.
+ *
+ * \param [in]  tag  allocation tag
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mem_tag_push(cs_mem_tag_t  tag);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Restore the allocation tag active before the matching
+ *        \ref cs_mem_tag_push call.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mem_tag_pop(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the currently active allocation tag.
+ *
+ * \return  active tag, or CS_MEM_TAG_NONE
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_mem_tag_t
+cs_mem_tag_current(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the name of an allocation tag.
+ *
+ * \param [in]  tag  allocation tag
+ *
+ * \return  pointer to tag name
+ */
+/*----------------------------------------------------------------------------*/
+
+const char *
+cs_mem_tag_name(cs_mem_tag_t  tag);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return memory allocation stats for a given tag.
+ *
+ * \param [in]   tag        allocation tag
+ * \param [out]  alloc_cur  current allocation size, or nullptr
+ * \param [out]  alloc_max  max allocation size, or nullptr
+ * \param [out]  n_allocs   total number of allocations, or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mem_tag_stats(cs_mem_tag_t   tag,
+                 uint64_t      *alloc_cur,
+                 uint64_t      *alloc_max,
+                 uint64_t      *n_allocs);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sample current allocation sizes for all tags, and maximum sizes
+ *        since the previous sample.
+ *
+ * \param [out]  alloc_cur  current allocation size per tag
+ *                          (size: CS_MEM_N_TAGS)
+ * \param [out]  alloc_max  max allocation size per tag since previous
+ *                          call (size: CS_MEM_N_TAGS)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mem_tag_sample(uint64_t  alloc_cur[],
+                  uint64_t  alloc_max[]);
+
 #if defined(HAVE_ACCEL)
 
 /*----------------------------------------------------------------------------*/
@@ -1309,4 +1415,47 @@ cs_mem_device_pool_clear(void);
 
 END_C_DECLS
 
+#if defined(__cplusplus)
+
+/*=============================================================================
+ * Public C++ classes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allocation tag bound to the enclosing scope.
+ *
+ * A weak tag only applies if no other tag is already active, so that
+ * for example matrices built during a multigrid setup are accounted
+ * for as part of the multigrid hierarchy.
+ */
+/*----------------------------------------------------------------------------*/
+
+class cs_mem_tag_scope {
+
+public:
+
+  explicit cs_mem_tag_scope(cs_mem_tag_t  tag,
+                            bool          weak = false)
+  {
+    if (weak) {
+      cs_mem_tag_t cur_tag = cs_mem_tag_current();
+      if (cur_tag != CS_MEM_TAG_NONE)
+        tag = cur_tag;
+    }
+    cs_mem_tag_push(tag);
+  }
+
+  ~cs_mem_tag_scope()
+  {
+    cs_mem_tag_pop();
+  }
+
+  cs_mem_tag_scope(const cs_mem_tag_scope &) = delete;
+  cs_mem_tag_scope &operator=(const cs_mem_tag_scope &) = delete;
+
+};
+
+#endif /* defined(__cplusplus) */
+
 #endif /* CS_MEM_H */
@@ -41,6 +41,7 @@
 #include "bft/bft_error.h"
 #include "base/cs_mem.h"
 #include "base/cs_order.h"
+#include "base/cs_timer.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -154,6 +155,10 @@ static size_t _cs_parall_min_coll_buf_size = 1024*1024;
 
 #endif
 
+/* Accumulated barrier wait time */
+
+static cs_timer_counter_t  _barrier_wait_time = {0};
+
 /*============================================================================
  * Global variables
  *============================================================================*/
@@ -162,6 +167,10 @@ static size_t _cs_parall_min_coll_buf_size = 1024*1024;
 
 cs_e2n_sum_t cs_glob_e2n_sum_type = CS_E2N_SUM_SCATTER;
 
+/*! Barrier wait timing before reductions */
+
+bool cs_glob_parall_barrier_wait = false;
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -261,6 +270,9 @@ _cs_parall_allreduce(MPI_Comm        comm,
 
   memcpy(locval, val, data_size);
 
+  if (cs_glob_parall_barrier_wait)
+    cs_parall_barrier_wait(comm);
+
   MPI_Allreduce(locval, val, n, cs_datatype_to_mpi[datatype], operation,
                 comm);
 
@@ -304,6 +316,64 @@ cs_f_parall_sum_r(double  *sum)
  * Public function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate barrier wait timing before reductions.
+ *
+ * When active, a timed barrier is called before global reductions, so as
+ * to measure the time spent waiting for other ranks (due to load
+ * imbalance) separately from the reduction itself. This adds
+ * synchronization, so should only be used for performance analysis.
+ *
+ * \param[in]  active  true to activate timing, false to deactivate it
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_set_barrier_wait(bool  active)
+{
+  cs_glob_parall_barrier_wait = (cs_glob_n_ranks > 1) ? active : false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return time spent waiting in barriers before reductions.
+ *
+ * \return  accumulated barrier wait time on local rank, in seconds
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_parall_get_barrier_wait_time(void)
+{
+  return _barrier_wait_time.nsec*1e-9;
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Call a barrier and accumulate time spent waiting in it.
+ *
+ * This is called before reductions when \ref cs_glob_parall_barrier_wait
+ * is set.
+ *
+ * \param[in]  comm  associated communicator
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_barrier_wait(MPI_Comm  comm)
+{
+  cs_timer_t t0 = cs_timer_time();
+  MPI_Barrier(comm);
+  cs_timer_t t1 = cs_timer_time();
+
+  cs_timer_counter_add_diff(&_barrier_wait_time, &t0, &t1);
+}
+
+#endif
+
 #if !defined(HAVE_MPI_IN_PLACE)
 
 void
@@ -69,10 +69,59 @@ typedef enum {
 
 extern cs_e2n_sum_t cs_glob_e2n_sum_type;
 
+/* Barrier wait timing before reductions (do not modify directly) */
+
+extern bool cs_glob_parall_barrier_wait;
+
 /*=============================================================================
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate barrier wait timing before reductions.
+ *
+ * When active, a timed barrier is called before global reductions, so as
+ * to measure the time spent waiting for other ranks (due to load
+ * imbalance) separately from the reduction itself. This adds
+ * synchronization, so should only be used for performance analysis.
+ *
+ * \param[in]  active  true to activate timing, false to deactivate it
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_set_barrier_wait(bool  active);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return time spent waiting in barriers before reductions.
+ *
+ * \return  accumulated barrier wait time on local rank, in seconds
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_parall_get_barrier_wait_time(void);
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Call a barrier and accumulate time spent waiting in it.
+ *
+ * This is called before reductions when \ref cs_glob_parall_barrier_wait
+ * is set.
+ *
+ * \param[in]  comm  associated communicator
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_barrier_wait(MPI_Comm  comm);
+
+#endif
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Sum values of a counter on all default communicator processes.
@@ -89,6 +138,8 @@ cs_parall_counter(cs_gnum_t   cpt[],
                   const int   n)
 {
   if (cs_glob_n_ranks > 1) {
+    if (cs_glob_parall_barrier_wait)
+      cs_parall_barrier_wait(cs_glob_mpi_comm);
     MPI_Allreduce(MPI_IN_PLACE, cpt, n, CS_MPI_GNUM, MPI_SUM,
                   cs_glob_mpi_comm);
   }
@@ -118,6 +169,8 @@ cs_parall_counter_max(cs_lnum_t   cpt[],
                       const int   n)
 {
   if (cs_glob_n_ranks > 1) {
+    if (cs_glob_parall_barrier_wait)
+      cs_parall_barrier_wait(cs_glob_mpi_comm);
     MPI_Allreduce(MPI_IN_PLACE, cpt, n, CS_MPI_LNUM, MPI_MAX,
                   cs_glob_mpi_comm);
   }
@@ -149,6 +202,8 @@ cs_parall_sum(int             n,
               void           *val)
 {
   if (cs_glob_n_ranks > 1) {
+    if (cs_glob_parall_barrier_wait)
+      cs_parall_barrier_wait(cs_glob_mpi_comm);
     MPI_Allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype], MPI_SUM,
                   cs_glob_mpi_comm);
   }
@@ -182,6 +237,8 @@ cs_parall_max(int             n,
               void           *val)
 {
   if (cs_glob_n_ranks > 1) {
+    if (cs_glob_parall_barrier_wait)
+      cs_parall_barrier_wait(cs_glob_mpi_comm);
     MPI_Allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype], MPI_MAX,
                   cs_glob_mpi_comm);
   }
@@ -215,6 +272,8 @@ cs_parall_min(int             n,
               void           *val)
 {
   if (cs_glob_n_ranks > 1) {
+    if (cs_glob_parall_barrier_wait)
+      cs_parall_barrier_wait(cs_glob_mpi_comm);
     MPI_Allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype], MPI_MIN,
                   cs_glob_mpi_comm);
   }
@@ -708,6 +767,8 @@ cs_parall_counter(cs_execution_context  *ec,
                   const int              n)
 {
   if (ec->use_mpi()) {
+    if (cs_glob_parall_barrier_wait)
+      cs_parall_barrier_wait(ec->comm());
     MPI_Allreduce(MPI_IN_PLACE, cpt, n, CS_MPI_GNUM, MPI_SUM,
                   ec->comm());
   }
@@ -740,6 +801,8 @@ cs_parall_counter_max(cs_execution_context  *ec,
                       const int              n)
 {
   if (ec->use_mpi()) {
+    if (cs_glob_parall_barrier_wait)
+      cs_parall_barrier_wait(ec->comm());
     MPI_Allreduce(MPI_IN_PLACE, cpt, n, CS_MPI_LNUM, MPI_MAX,
                   ec->comm());
   }
@@ -774,6 +837,8 @@ cs_parall_sum(cs_execution_context  *ec,
               void                  *val)
 {
   if (ec->use_mpi()) {
+    if (cs_glob_parall_barrier_wait)
+      cs_parall_barrier_wait(ec->comm());
     MPI_Allreduce(MPI_IN_PLACE, val, n,
                   cs_datatype_to_mpi[datatype], MPI_SUM,
                   ec->comm());
@@ -811,6 +876,8 @@ cs_parall_max(cs_execution_context  *ec,
               void                  *val)
 {
   if (ec->use_mpi()) {
+    if (cs_glob_parall_barrier_wait)
+      cs_parall_barrier_wait(ec->comm());
     MPI_Allreduce(MPI_IN_PLACE, val, n,
                   cs_datatype_to_mpi[datatype], MPI_MAX,
                   ec->comm());
@@ -848,6 +915,8 @@ cs_parall_min(cs_execution_context  *ec,
               void                  *val)
 {
   if (ec->use_mpi()) {
+    if (cs_glob_parall_barrier_wait)
+      cs_parall_barrier_wait(ec->comm());
     MPI_Allreduce(MPI_IN_PLACE, val, n,
                   cs_datatype_to_mpi[datatype], MPI_MIN,
                   ec->comm());
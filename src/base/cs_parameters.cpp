@@ -514,6 +514,7 @@ static cs_solving_info_t _solving_info =
   0.,    /* res_norm: normed residual                        */
   0.,    /* derive: norm of the time derivative              */
   0.,    /* l2residual: L2 time residual                     */
+  0.,    /* res_norm_ini: normed initial residual            */
 };
 
 /*============================================================================
@@ -841,6 +842,10 @@ cs_parameters_define_field_keys(void)
 
   cs_field_define_key_int("time_extrapolated", -1, 0);
   cs_field_define_key_int("scalar_time_scheme", -1, 0); /* ex-isso2t */
+  cs_field_define_key_int("scalar_explicit_rk_stages", 0,
+                          CS_FIELD_VARIABLE);
+  cs_field_define_key_double("solve_skip_threshold", -1., CS_FIELD_VARIABLE);
+  cs_field_define_key_int("solve_skip_interval", 10, CS_FIELD_VARIABLE);
   cs_field_define_key_double("st_exp_extrapolated", -1,
                              CS_FIELD_VARIABLE); /* ex-thetss */
   cs_field_define_key_double("diffusivity_extrapolated", -1,
@@ -72,6 +72,7 @@ typedef struct {
   double  res_norm;
   double  derive;
   double  l2residual;
+  double  res_norm_ini;
 
 } cs_solving_info_t;
 
@@ -1023,6 +1023,89 @@ cs_parameters_check(void)
          "(ibdtso = %d > 1) and (time_order = %d > 1)\n"),
        eqp_u->ibdtso, time_scheme->time_order);
 
+  /* Explicit Runge-Kutta time integration for scalars */
+
+  {
+    const int key_rk = cs_field_key_id("scalar_explicit_rk_stages");
+    const int key_cpl_vp = cs_field_key_id_try("coupled_with_vel_p");
+    int list_rk[2] = {0, 3};
+
+    for (int f_id = 0; f_id < n_fields; f_id++) {
+      cs_field_t *f = cs_field_by_id(f_id);
+      if (!(f->type & CS_FIELD_VARIABLE))
+        continue;
+      const int rk_stages = cs_field_get_key_int(f, key_rk);
+      if (rk_stages == 0)
+        continue;
+
+      cs_equation_param_t *eqp = cs_field_get_equation_param(f);
+      if (eqp == nullptr)
+        continue;
+      const int scalar_id = (ks > -1) ? cs_field_get_key_int(f, ks) : -1;
+      const int cpl_vp = (key_cpl_vp > -1) ?
+        cs_field_get_key_int(f, key_cpl_vp) : 0;
+
+      cs_parameters_is_in_list_int(CS_ABORT_DELAYED,
+                                   _("time scheme selection"),
+                                   "scalar_explicit_rk_stages",
+                                   rk_stages,
+                                   2,
+                                   list_rk,
+                                   nullptr);
+
+      if (   scalar_id < 0 || cpl_vp == 1
+          || eqp->istat != 1
+          || cs_glob_time_step_options->idtvar < CS_TIME_STEP_CONSTANT
+          || cs_glob_time_step_options->idtvar > CS_TIME_STEP_ADAPTIVE)
+        cs_parameters_error
+          (CS_ABORT_DELAYED,
+           _("time scheme selection"),
+           _("Explicit Runge-Kutta time integration was requested for\n"
+             "field \"%s\" (scalar_explicit_rk_stages = %d).\n"
+             "It is available only for transported scalars which are not\n"
+             "coupled with the velocity-pressure system, with an unsteady\n"
+             "term (istat = 1), and a constant or adaptive time step\n"
+             "(idtvar = 0 or 1)."),
+           f->name, rk_stages);
+
+      if (time_scheme->time_order == 2)
+        cs_parameters_error
+          (CS_ABORT_DELAYED,
+           _("time scheme selection"),
+           _("Explicit Runge-Kutta time integration was requested for\n"
+             "field \"%s\" (scalar_explicit_rk_stages = %d),\n"
+             "which is not compatible with the second order time scheme\n"
+             "(time_order = %d)."),
+           f->name, rk_stages, time_scheme->time_order);
+    }
+  }
+
+  /* Adaptive scheduling of converged equations */
+
+  {
+    const int k_thr = cs_field_key_id("solve_skip_threshold");
+    const int k_itv = cs_field_key_id("solve_skip_interval");
+
+    for (int f_id = 0; f_id < n_fields; f_id++) {
+      cs_field_t *f = cs_field_by_id(f_id);
+      if (!(f->type & CS_FIELD_VARIABLE))
+        continue;
+      if (cs_field_get_key_double(f, k_thr) <= 0.)
+        continue;
+
+      f_desc = _field_section_desc(f, "while reading input data "
+                                      "for variable");
+
+      cs_parameters_is_greater_int(CS_ABORT_DELAYED,
+                                   f_desc,
+                                   "solve_skip_interval",
+                                   cs_field_get_key_int(f, k_itv),
+                                   1);
+
+      CS_FREE(f_desc);
+    }
+  }
+
   /*--------------------------------------------------------------------------
    * Turbulence option checks
    *--------------------------------------------------------------------------*/
@@ -2205,6 +2288,63 @@ cs_parameters_check(void)
                                0);
   }
 
+  /* Outer iteration acceleration (steady and local time step algorithms) */
+
+  if (   cs_glob_time_step_options->rsmcoe > 0.
+      || cs_glob_time_step_options->nandrs != 0) {
+
+    if (   cs_glob_time_step_options->idtvar != CS_TIME_STEP_STEADY
+        && cs_glob_time_step_options->idtvar != CS_TIME_STEP_LOCAL)
+      cs_parameters_error
+        (CS_WARNING,
+         _("while reading input data"),
+         _("Residual smoothing (rsmcoe = %g) or Anderson acceleration\n"
+           "(nandrs = %d) is only available with the steady (idtvar = -1)\n"
+           "or local (idtvar = 2) time step algorithms.\n"
+           "This setting will be ignored."),
+         cs_glob_time_step_options->rsmcoe,
+         cs_glob_time_step_options->nandrs);
+
+    if (cs_glob_ale != CS_ALE_NONE)
+      cs_parameters_error
+        (CS_WARNING,
+         _("while reading input data"),
+         _("Residual smoothing and Anderson acceleration are not\n"
+           "available with ALE. This setting will be ignored."));
+
+    cs_parameters_is_in_range_int(CS_ABORT_DELAYED,
+                                  _("while reading input data"),
+                                  "cs_glob_time_step_options->nandrs "
+                                  "(Anderson acceleration depth)",
+                                  cs_glob_time_step_options->nandrs,
+                                  0, 21);
+
+    cs_parameters_is_in_range_double(CS_ABORT_DELAYED,
+                                     _("while reading input data"),
+                                     "cs_glob_time_step_options->andrlx "
+                                     "(Anderson relaxation)",
+                                     cs_glob_time_step_options->andrlx,
+                                     0.01, 1.);
+
+    if (   cs_glob_time_step_options->rsmcoe > 0.
+        && cs_glob_time_step_options->nandrs < 1)
+      cs_parameters_error
+        (CS_WARNING,
+         _("while reading input data"),
+         _("Residual smoothing (rsmcoe = %g) is only used with\n"
+           "Anderson acceleration (nandrs > 0).\n"
+           "This setting will be ignored."),
+         cs_glob_time_step_options->rsmcoe);
+
+    if (cs_glob_time_step_options->rsmcoe > 0.)
+      cs_parameters_is_greater_int(CS_ABORT_DELAYED,
+                                   _("while reading input data"),
+                                   "cs_glob_time_step_options->rsmnsw "
+                                   "(residual smoothing sweeps)",
+                                   cs_glob_time_step_options->rsmnsw,
+                                   1);
+  }
+
   /* Turbulence */
 
   /* Model */
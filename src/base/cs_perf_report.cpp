@@ -0,0 +1,618 @@
+/*============================================================================
+ * Machine-readable performance report.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2025 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "base/cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <errno.h>
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft/bft_error.h"
+#include "bft/bft_mem_usage.h"
+#include "bft/bft_printf.h"
+
+#include "base/cs_base.h"
+#include "base/cs_mem.h"
+#include "base/cs_timer.h"
+
+/*----------------------------------------------------------------------------
+ * Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "base/cs_perf_report.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_perf_report.cpp
+        Machine-readable performance report.
+
+  Performance data from various modules (timer statistics, linear solvers,
+  gradients, ...) is gathered at the end of the computation and written
+  in JSON format, so as to be easily compared between runs.
+
+  The report is organized in sections, each containing a list of records.
+  Each record has a name and a set of values, for which the minimum,
+  maximum, and mean over all MPI ranks are provided. Records are added
+  locally on each rank, and only reduced over ranks when the report is
+  written, matching values by section, record, and value name (so ranks
+  may add records in a different order; records not added on rank 0 are
+  ignored, and means are computed over the ranks which added a value):
+
+  \code{.json}
+  {
+    "format": "code_saturne performance report",
+    "version": 1,
+    "n_ranks": 4,
+    "n_threads": 2,
+    "sections": {
+      "linear_solvers": [
+        {"name": "Pressure",
+         "solve_time": {"min": 1.2, "max": 1.4, "mean": 1.3}, ...},
+        ...
+      ],
+      ...
+    }
+  }
+  \endcode
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Report record */
+
+typedef struct {
+
+  char     *section;   /* Section name */
+  char     *name;      /* Record name */
+
+  int       n_keys;    /* Number of values */
+  char    **keys;      /* Value names */
+  double   *vals;      /* min, max, and mean for each value (all equal
+                          to the local value before reduction) */
+
+} cs_perf_report_record_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static char  *_file_name = nullptr;
+static bool   _active = true;
+
+static int                       _n_records = 0;
+static int                       _n_records_max = 0;
+static cs_perf_report_record_t  *_records = nullptr;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Copy a string.
+ *
+ * parameters:
+ *   s <-- string to copy
+ *
+ * returns:
+ *   newly allocated copy
+ *----------------------------------------------------------------------------*/
+
+static char *
+_copy_str(const char  *s)
+{
+  char *c;
+  CS_MALLOC(c, strlen(s) + 1, char);
+  strcpy(c, s);
+  return c;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a JSON string, with required escapes.
+ *
+ * parameters:
+ *   f <-- output file
+ *   s <-- string to write
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_json_str(FILE        *f,
+                const char  *s)
+{
+  fputc('"', f);
+  for (const char *p = s; *p != '\0'; p++) {
+    unsigned char c = (unsigned char)(*p);
+    if (c == '"' || c == '\\')
+      fprintf(f, "\\%c", c);
+    else if (c < 0x20)
+      fprintf(f, "\\u%04x", (unsigned)c);
+    else
+      fputc(c, f);
+  }
+  fputc('"', f);
+}
+
+/*----------------------------------------------------------------------------
+ * Write a JSON number (null if not finite).
+ *
+ * parameters:
+ *   f <-- output file
+ *   v <-- value to write
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_json_val(FILE    *f,
+                double   v)
+{
+  if (isfinite(v))
+    fprintf(f, "%.9g", v);
+  else
+    fprintf(f, "null");
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Find a local record value matching a given section, record and value name.
+ *
+ * parameters:
+ *   section <-- section name
+ *   name    <-- record name
+ *   key     <-- value name
+ *   r_hint  <-- record id to check first
+ *   k_hint  <-- value id to check first
+ *
+ * returns:
+ *   pointer to matching local values, or nullptr
+ *----------------------------------------------------------------------------*/
+
+static const double *
+_find_local_val(const char  *section,
+                const char  *name,
+                const char  *key,
+                int          r_hint,
+                int          k_hint)
+{
+  /* Ranks usually add records in the same order, so check hint first */
+
+  if (r_hint < _n_records) {
+    const cs_perf_report_record_t *r = _records + r_hint;
+    if (   k_hint < r->n_keys
+        && strcmp(r->section, section) == 0
+        && strcmp(r->name, name) == 0
+        && strcmp(r->keys[k_hint], key) == 0)
+      return r->vals + k_hint*3;
+  }
+
+  for (int i = 0; i < _n_records; i++) {
+    const cs_perf_report_record_t *r = _records + i;
+    if (strcmp(r->section, section) != 0 || strcmp(r->name, name) != 0)
+      continue;
+    for (int k = 0; k < r->n_keys; k++) {
+      if (strcmp(r->keys[k], key) == 0)
+        return r->vals + k*3;
+    }
+  }
+
+  return nullptr;
+}
+
+/*----------------------------------------------------------------------------
+ * Reduce record values over all ranks, matching them by name.
+ *
+ * The section, record and value names of rank 0 are broadcast, and the
+ * matching values are reduced in a single pass, so that the result does
+ * not depend on the order in which records were added on each rank.
+ *----------------------------------------------------------------------------*/
+
+static void
+_reduce_records(void)
+{
+  /* Serialize names of rank 0 values ("section\0name\0key\0" for each) */
+
+  int n_vals = 0;
+  size_t buf_size = 0;
+  char *buf = nullptr;
+
+  if (cs_glob_rank_id < 1) {
+    for (int i = 0; i < _n_records; i++) {
+      const cs_perf_report_record_t *r = _records + i;
+      size_t l = strlen(r->section) + strlen(r->name) + 2;
+      for (int k = 0; k < r->n_keys; k++)
+        buf_size += l + strlen(r->keys[k]) + 1;
+      n_vals += r->n_keys;
+    }
+  }
+
+  unsigned long long sizes[2] = {(unsigned long long)n_vals,
+                                 (unsigned long long)buf_size};
+  MPI_Bcast(sizes, 2, MPI_UNSIGNED_LONG_LONG, 0, cs_glob_mpi_comm);
+  n_vals = sizes[0];
+  buf_size = sizes[1];
+
+  if (n_vals < 1)
+    return;
+
+  CS_MALLOC(buf, buf_size, char);
+
+  if (cs_glob_rank_id < 1) {
+    size_t j = 0;
+    for (int i = 0; i < _n_records; i++) {
+      const cs_perf_report_record_t *r = _records + i;
+      for (int k = 0; k < r->n_keys; k++) {
+        const char *s[] = {r->section, r->name, r->keys[k]};
+        for (int l = 0; l < 3; l++) {
+          strcpy(buf + j, s[l]);
+          j += strlen(s[l]) + 1;
+        }
+      }
+    }
+  }
+
+  MPI_Bcast(buf, buf_size, MPI_CHAR, 0, cs_glob_mpi_comm);
+
+  /* Local values (min, max, sum and count) matching rank 0 names */
+
+  double *l_vals, *g_vals;
+  CS_MALLOC(l_vals, n_vals*4, double);
+  CS_MALLOC(g_vals, n_vals*4, double);
+
+  {
+    const char *p = buf;
+    int r_hint = 0, k_hint = 0;
+    const char *prev_section = "", *prev_name = "";
+
+    for (int v_id = 0; v_id < n_vals; v_id++) {
+      const char *section = p; p += strlen(p) + 1;
+      const char *name = p; p += strlen(p) + 1;
+      const char *key = p; p += strlen(p) + 1;
+
+      if (strcmp(section, prev_section) != 0 || strcmp(name, prev_name) != 0) {
+        if (v_id > 0)
+          r_hint++;
+        k_hint = 0;
+        prev_section = section;
+        prev_name = name;
+      }
+
+      const double *v = _find_local_val(section, name, key, r_hint, k_hint);
+      k_hint++;
+
+      l_vals[v_id]            = (v != nullptr) ? v[0] :  DBL_MAX;
+      l_vals[n_vals + v_id]   = (v != nullptr) ? v[1] : -DBL_MAX;
+      l_vals[2*n_vals + 2*v_id]     = (v != nullptr) ? v[2] : 0;
+      l_vals[2*n_vals + 2*v_id + 1] = (v != nullptr) ? 1 : 0;
+    }
+  }
+
+  CS_FREE(buf);
+
+  MPI_Reduce(l_vals, g_vals, n_vals, MPI_DOUBLE, MPI_MIN, 0,
+             cs_glob_mpi_comm);
+  MPI_Reduce(l_vals + n_vals, g_vals + n_vals, n_vals, MPI_DOUBLE, MPI_MAX, 0,
+             cs_glob_mpi_comm);
+  MPI_Reduce(l_vals + 2*n_vals, g_vals + 2*n_vals, 2*n_vals, MPI_DOUBLE,
+             MPI_SUM, 0, cs_glob_mpi_comm);
+
+  /* Update values on rank 0 */
+
+  if (cs_glob_rank_id < 1) {
+    int v_id = 0;
+    for (int i = 0; i < _n_records; i++) {
+      cs_perf_report_record_t *r = _records + i;
+      for (int k = 0; k < r->n_keys; k++) {
+        r->vals[k*3]     = g_vals[v_id];
+        r->vals[k*3 + 1] = g_vals[n_vals + v_id];
+        r->vals[k*3 + 2] =   g_vals[2*n_vals + 2*v_id]
+                           / g_vals[2*n_vals + 2*v_id + 1];
+        v_id++;
+      }
+    }
+  }
+
+  CS_FREE(g_vals);
+  CS_FREE(l_vals);
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Write the report to file (on rank 0).
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_report(void)
+{
+  FILE *f = fopen(_file_name, "w");
+
+  if (f == nullptr) {
+    bft_printf(_("\n"
+                 "Warning: performance report file \"%s\" could not be\n"
+                 "         opened: %s\n"),
+               _file_name, strerror(errno));
+    return;
+  }
+
+  fprintf(f,
+          "{\n"
+          "  \"format\": \"code_saturne performance report\",\n"
+          "  \"version\": 1,\n"
+          "  \"n_ranks\": %d,\n"
+          "  \"n_threads\": %d,\n"
+          "  \"sections\": {",
+          cs_glob_n_ranks, cs_glob_n_threads);
+
+  /* Group records by section, in order of first appearance */
+
+  bool *written;
+  CS_MALLOC(written, _n_records, bool);
+  for (int i = 0; i < _n_records; i++)
+    written[i] = false;
+
+  int n_sections = 0;
+
+  for (int i = 0; i < _n_records; i++) {
+
+    if (written[i])
+      continue;
+
+    const char *section = _records[i].section;
+
+    fprintf(f, (n_sections > 0) ? ",\n    " : "\n    ");
+    _write_json_str(f, section);
+    fprintf(f, ": [");
+    n_sections++;
+
+    int n_section_records = 0;
+
+    for (int j = i; j < _n_records; j++) {
+
+      const cs_perf_report_record_t *r = _records + j;
+      if (written[j] || strcmp(r->section, section) != 0)
+        continue;
+
+      fprintf(f, (n_section_records > 0) ? ",\n      " : "\n      ");
+      fprintf(f, "{\"name\": ");
+      _write_json_str(f, r->name);
+
+      for (int k = 0; k < r->n_keys; k++) {
+        fprintf(f, ",\n       ");
+        _write_json_str(f, r->keys[k]);
+        fprintf(f, ": {\"min\": ");
+        _write_json_val(f, r->vals[k*3]);
+        fprintf(f, ", \"max\": ");
+        _write_json_val(f, r->vals[k*3 + 1]);
+        fprintf(f, ", \"mean\": ");
+        _write_json_val(f, r->vals[k*3 + 2]);
+        fprintf(f, "}");
+      }
+
+      fprintf(f, "}");
+      written[j] = true;
+      n_section_records++;
+    }
+
+    fprintf(f, "\n    ]");
+  }
+
+  fprintf(f, "\n  }\n}\n");
+
+  CS_FREE(written);
+
+  if (fclose(f) != 0)
+    bft_printf(_("\n"
+                 "Warning: error closing performance report file \"%s\":\n"
+                 "         %s\n"),
+               _file_name, strerror(errno));
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the performance report file name.
+ *
+ * \param[in]  file_name  name of the file to write (default:
+ *                        "performance.json"), or nullptr to disable output
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_perf_report_set_file_name(const char  *file_name)
+{
+  CS_FREE(_file_name);
+
+  if (file_name != nullptr) {
+    _file_name = _copy_str(file_name);
+    _active = true;
+  }
+  else
+    _active = false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a record to the performance report.
+ *
+ * This function is local (not collective). Values are local to each rank;
+ * their minimum, maximum and mean over the ranks which added a record
+ * with the same section, name and key are computed when the report
+ * is written by \ref cs_perf_report_finalize.
+ *
+ * \param[in]  section  name of the report section
+ * \param[in]  name     name of the record in its section
+ * \param[in]  n_keys   number of values
+ * \param[in]  keys     names of values
+ * \param[in]  vals     values on local rank
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_perf_report_add(const char    *section,
+                   const char    *name,
+                   int            n_keys,
+                   const char    *keys[],
+                   const double   vals[])
+{
+  if (_active == false || n_keys < 1)
+    return;
+
+  double *r_vals;
+  CS_MALLOC(r_vals, n_keys*3, double);
+
+  for (int k = 0; k < n_keys; k++) {
+    r_vals[k*3]     = vals[k];
+    r_vals[k*3 + 1] = vals[k];
+    r_vals[k*3 + 2] = vals[k];
+  }
+
+  if (_n_records >= _n_records_max) {
+    _n_records_max = (_n_records_max > 0) ? _n_records_max*2 : 16;
+    CS_REALLOC(_records, _n_records_max, cs_perf_report_record_t);
+  }
+
+  cs_perf_report_record_t *r = _records + _n_records;
+
+  r->section = _copy_str(section);
+  r->name = _copy_str(name);
+  r->n_keys = n_keys;
+  CS_MALLOC(r->keys, n_keys, char *);
+  for (int k = 0; k < n_keys; k++)
+    r->keys[k] = _copy_str(keys[k]);
+  r->vals = r_vals;
+
+  _n_records += 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add global run and memory info, write the performance report,
+ *        and free the associated structures.
+ *
+ * This function is collective.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_perf_report_finalize(void)
+{
+  if (_active) {
+
+    /* Global run info */
+
+    {
+      const char *keys[] = {"wall_time", "cpu_time"};
+      double vals[] = {cs_timer_wtime(), cs_timer_cpu_time()};
+      cs_perf_report_add("run", "total", 2, keys, vals);
+    }
+
+    /* Memory high-water marks (in kB) */
+
+    {
+      const char *keys[] = {"max_pr_size_kb",
+                            "max_instrumented_kb",
+                            "max_vm_size_kb"};
+      double vals[] = {(double)bft_mem_usage_max_pr_size(),
+                       (double)cs_mem_size_max(),
+                       (double)bft_mem_usage_max_vm_size()};
+      cs_perf_report_add("memory", "total", 3, keys, vals);
+    }
+
+    /* Memory by allocation tag (in kB) */
+
+    for (int i = 1; i < CS_MEM_N_TAGS; i++) {
+      uint64_t alloc_cur = 0, alloc_max = 0, n_allocs = 0;
+      cs_mem_tag_stats((cs_mem_tag_t)i, &alloc_cur, &alloc_max, &n_allocs);
+      const char *keys[] = {"max_kb", "end_kb", "n_allocs"};
+      double vals[] = {alloc_max / 1024.,
+                       alloc_cur / 1024.,
+                       (double)n_allocs};
+      cs_perf_report_add("memory_tags",
+                         cs_mem_tag_name((cs_mem_tag_t)i),
+                         3, keys, vals);
+    }
+
+#if defined(HAVE_MPI)
+    if (cs_glob_n_ranks > 1)
+      _reduce_records();
+#endif
+
+    if (cs_glob_rank_id < 1) {
+      if (_file_name == nullptr)
+        _file_name = _copy_str("performance.json");
+      _write_report();
+    }
+
+  }
+
+  for (int i = 0; i < _n_records; i++) {
+    cs_perf_report_record_t *r = _records + i;
+    for (int k = 0; k < r->n_keys; k++)
+      CS_FREE(r->keys[k]);
+    CS_FREE(r->keys);
+    CS_FREE(r->vals);
+    CS_FREE(r->name);
+    CS_FREE(r->section);
+  }
+  CS_FREE(_records);
+
+  _n_records = 0;
+  _n_records_max = 0;
+
+  CS_FREE(_file_name);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
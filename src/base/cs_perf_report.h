@@ -0,0 +1,96 @@
+#ifndef __CS_PERF_REPORT_H__
+#define __CS_PERF_REPORT_H__
+
+/*============================================================================
+ * Machine-readable performance report.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2025 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "base/cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the performance report file name.
+ *
+ * \param[in]  file_name  name of the file to write (default:
+ *                        "performance.json"), or nullptr to disable output
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_perf_report_set_file_name(const char  *file_name);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a record to the performance report.
+ *
+ * This function is local (not collective). Values are local to each rank;
+ * their minimum, maximum and mean over the ranks which added a record
+ * with the same section, name and key are computed when the report
+ * is written by \ref cs_perf_report_finalize.
+ *
+ * \param[in]  section  name of the report section
+ * \param[in]  name     name of the record in its section
+ * \param[in]  n_keys   number of values
+ * \param[in]  keys     names of values
+ * \param[in]  vals     values on local rank
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_perf_report_add(const char    *section,
+                   const char    *name,
+                   int            n_keys,
+                   const char    *keys[],
+                   const double   vals[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add global run and memory info, write the performance report,
+ *        and free the associated structures.
+ *
+ * This function is collective.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_perf_report_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_PERF_REPORT_H__ */
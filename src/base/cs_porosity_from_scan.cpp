@@ -64,6 +64,7 @@
 #include "base/cs_field_pointer.h"
 #include "base/cs_field_default.h"
 #include "base/cs_field_operator.h"
+#include "base/cs_file.h"
 #include "base/cs_file_csv_parser.h"
 #include "mesh/cs_geom.h"
 #include "base/cs_halo.h"
@@ -80,6 +81,8 @@
 #include "base/cs_equation_iterative_solve.h"
 #include "base/cs_physical_constants.h"
 #include "base/cs_post.h"
+#include "base/cs_restart.h"
+#include "base/cs_restart_default.h"
 #include "base/cs_timer.h"
 
 #include "base/cs_volume_zone.h"
@@ -100,6 +103,14 @@ BEGIN_C_DECLS
  * Local Macro Definitions
  *============================================================================*/
 
+/* Size of chunks read from scan points files by each rank (in bytes) */
+
+#define _SCAN_CHUNK_SIZE  (64*1024*1024)
+
+/* Name of cached porosity from scan results file */
+
+#define _SCAN_CACHE_NAME  "porosity_from_scan.csc"
+
 /*=============================================================================
  * Local Type Definitions
  *============================================================================*/
@@ -127,7 +138,8 @@ static cs_porosity_from_scan_opt_t _porosity_from_scan_opt = {
   .use_staircase = false,
   .eigenvalue_criteria = 1e-3,
   .use_restart = false,
-  .cog_location = CS_COG_FROM_FLUID_FACES
+  .cog_location = CS_COG_FROM_FLUID_FACES,
+  .cache_dir = nullptr
 };
 
 /*============================================================================
@@ -139,93 +151,16 @@ cs_porosity_from_scan_opt_t *cs_glob_porosity_from_scan_opt
 
 static  ple_locator_t  *_locator = nullptr;  /* PLE locator */
 
+/* Fields cached in addition to those of the porous model restart file */
+
+static const char *_scan_cache_fields[] = {"porosity",
+                                           "nb_scan_points",
+                                           "cell_scan_points_color"};
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
-/*----------------------------------------------------------------------------
- * Incremental local solid plane computation at cells from scan points.
- * So that the summed squared distance to all points is minimized.
- *
- * parameters:
- *   m               <-- pointer to mesh
- *   n_points        <-- total number of points
- *   elt_ids         <-- point to cell id
- *   n_points_cell   <-- number of points in cell
- *   cen_cell        <-- center of gravity of cell
- *   mom_mat         --> incremental second moment matrix
- *----------------------------------------------------------------------------*/
-
-static void
-_incremental_solid_plane_from_points(const cs_mesh_t   *m,
-                                     cs_lnum_t          n_points,
-                                     const cs_lnum_t    elt_ids[],
-                                     const cs_real_t    n_points_cell[],
-                                     const cs_real_t    cen_cell[][3],
-                                     const cs_real_t    point_coords[][3],
-                                     cs_real_t          mom_mat[][3][3])
-{
-  cs_real_33_t  *c, *d, *z, *t;
-  CS_MALLOC(c, m->n_cells, cs_real_33_t);
-  CS_MALLOC(d, m->n_cells, cs_real_33_t);
-  CS_MALLOC(z, m->n_cells, cs_real_33_t);
-  CS_MALLOC(t, m->n_cells, cs_real_33_t);
-  const cs_real_t threshold = _porosity_from_scan_opt.threshold;
-
-  // Initialization
-
-  for (cs_lnum_t c_id = 0; c_id < m->n_cells; c_id++) {
-    for (cs_lnum_t i = 0; i < 3; i++) {
-      for (cs_lnum_t j = 0; j < 3; j++) {
-        c[c_id][i][j] = 0.;
-        d[c_id][i][j] = 0.;
-        t[c_id][i][j] = 0.;
-        z[c_id][i][j] = 0.;
-      }
-    }
-  }
-
-  // Loop over points
-
-  for (cs_lnum_t p_id = 0; p_id < n_points; p_id++) {
-
-    cs_lnum_t c_id = elt_ids[p_id];
-
-    if (n_points_cell[c_id] > threshold) { // At least three points required
-
-      cs_real_t point_local[3];
-      for (cs_lnum_t i = 0; i < 3; i++)
-        point_local[i] = (point_coords[p_id][i] - cen_cell[c_id][i]);
-
-      // Kahan summation
-      for (cs_lnum_t i = 0; i < 3; i++) {
-        for (cs_lnum_t j = 0; j < 3; j++) {
-          z[c_id][i][j] = point_local[i] * point_local[j]
-                            - c[c_id][i][j];
-          t[c_id][i][j] = d[c_id][i][j] + z[c_id][i][j];
-          c[c_id][i][j] = (t[c_id][i][j] - d[c_id][i][j])
-                            - z[c_id][i][j];
-          d[c_id][i][j] = t[c_id][i][j];
-        }
-      }
-    }
-
-  } // Loop over points
-
-  CS_FREE(z);
-  CS_FREE(t);
-  CS_FREE(c);
-
-  for (cs_lnum_t c_id = 0; c_id < m->n_cells; c_id++) {
-    for (cs_lnum_t i = 0; i < 3; i++)
-      for (cs_lnum_t j = 0; j < 3; j++)
-          mom_mat[c_id][i][j] += d[c_id][i][j];
-
-  } // Loop over cells
-
-  CS_FREE(d);
-}
-
 /*----------------------------------------------------------------------------
  * Compute local solid planes at cells from scan points file.
  * So that the summed squared distance to all points is minimized.
@@ -249,6 +184,7 @@ _solid_plane_from_points(const cs_mesh_t   *m,
   const cs_real_t n_agglomeration = _porosity_from_scan_opt.n_agglomeration;
   cs_real_t tol_err = 1.0e-12;
 
+# pragma omp parallel for if (m->n_cells > CS_THR_MIN)
   for (cs_lnum_t c_id = 0; c_id < m->n_cells; c_id++) {
 
     /* At least three points required */
@@ -314,6 +250,610 @@ _solid_plane_from_points(const cs_mesh_t   *m,
   } // Loop over cells
 }
 
+/*----------------------------------------------------------------------------
+ * Return the position of the first line start at or after a given offset
+ * of a scan points file.
+ *
+ * parameters:
+ *   f       <-- pointer to file descriptor
+ *   offset  <-- offset in file
+ *   f_size  <-- file size
+ *
+ * returns:
+ *   offset of the first character of the next line
+ *----------------------------------------------------------------------------*/
+
+static cs_file_off_t
+_scan_line_start(cs_file_t      *f,
+                 cs_file_off_t   offset,
+                 cs_file_off_t   f_size)
+{
+  if (offset <= 0)
+    return 0;
+
+  char buf[4096];
+
+  /* A line starts at the given offset if the previous character
+     is a newline, so start looking from there. */
+
+  cs_file_off_t pos = offset - 1;
+
+  while (pos < f_size) {
+    size_t n = cs::min((cs_file_off_t)sizeof(buf), f_size - pos);
+    cs_file_seek(f, pos, CS_FILE_SEEK_SET);
+    n = cs_file_read_global(f, buf, 1, n);
+    if (n == 0)
+      break;
+    const char *eol = (const char *)memchr(buf, '\n', n);
+    if (eol != nullptr)
+      return pos + (eol - buf) + 1;
+    pos += n;
+  }
+
+  return f_size;
+}
+
+/*----------------------------------------------------------------------------
+ * Parse complete lines of a scan points file buffer.
+ *
+ * Lines with a single value are point count headers, and lines with less
+ * values than needed for coordinates are ignored. Parsed points are
+ * transformed and appended to the given arrays.
+ *
+ * parameters:
+ *   buf          <-- buffer (null-terminated)
+ *   size         <-- buffer size
+ *   is_last      <-- true if the last line of the buffer is complete
+ *                    even without a final newline
+ *   n_headers    <-- number of columns
+ *   col_role     <-- role of each column (0 to 2 for coordinates,
+ *                    3 to 5 for colors, -1 if ignored)
+ *   n_points     <-> number of points in arrays
+ *   n_points_max <-> allocated size of arrays
+ *   point_coords <-> point coordinates
+ *   colors       <-> point colors
+ *   min_vec      <-> bounding box minimum
+ *   max_vec      <-> bounding box maximum
+ *   n_announced  <-> number of points announced by count headers
+ *
+ * returns:
+ *   number of parsed bytes
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_parse_scan_points(const char     *buf,
+                   size_t          size,
+                   bool            is_last,
+                   int             n_headers,
+                   const int       col_role[],
+                   cs_lnum_t      *n_points,
+                   cs_lnum_t      *n_points_max,
+                   cs_real_3_t   **point_coords,
+                   float         **colors,
+                   cs_real_t       min_vec[3],
+                   cs_real_t       max_vec[3],
+                   cs_gnum_t      *n_announced)
+{
+  const cs_real_t (*tm)[4] = _porosity_from_scan_opt.transformation_matrix;
+
+  int n_cols_min = 0;
+  for (int h_id = 0; h_id < n_headers; h_id++) {
+    if (col_role[h_id] >= 0 && col_role[h_id] < 3)
+      n_cols_min = h_id + 1;
+  }
+
+  double *vals;
+  CS_MALLOC(vals, n_headers, double);
+
+  cs_lnum_t _n_points = *n_points;
+  cs_real_3_t *_coords = *point_coords;
+  float *_colors = *colors;
+
+  const char *p = buf;
+  const char *end = buf + size;
+
+  while (p < end) {
+
+    const char *eol = (const char *)memchr(p, '\n', end - p);
+    if (eol == nullptr) {
+      if (!is_last)
+        break;
+      eol = end;
+    }
+
+    /* Values are separated by white space; strtod skips leading
+       white space, so values past the end of line are rejected. */
+
+    int n_vals = 0;
+    const char *s = p;
+    while (n_vals < n_headers) {
+      char *s_end;
+      double v = strtod(s, &s_end);
+      if (s_end == s || s_end > eol)
+        break;
+      vals[n_vals++] = v;
+      s = s_end;
+    }
+
+    p = eol + 1;
+
+    if (n_vals == 1) {
+      *n_announced += (cs_gnum_t)vals[0];
+      continue;
+    }
+    else if (n_vals < n_cols_min || n_vals < 3)
+      continue;
+
+    if (_n_points >= *n_points_max) {
+      *n_points_max = cs::max(*n_points_max*2, (cs_lnum_t)1024);
+      CS_REALLOC(_coords, *n_points_max, cs_real_3_t);
+      CS_REALLOC(_colors, 3*(*n_points_max), float);
+    }
+
+    cs_real_t xyz[4] = {0., 0., 0., 1.};
+    int rgb[3] = {0, 0, 0};
+
+    for (int h_id = 0; h_id < n_vals; h_id++) {
+      int role = col_role[h_id];
+      if (role < 0)
+        continue;
+      else if (role < 3)
+        xyz[role] = vals[h_id];
+      else
+        rgb[role - 3] = (int)vals[h_id];
+    }
+
+    /* Translation and rotation */
+
+    for (int j = 0; j < 3; j++) {
+      _coords[_n_points][j] = 0.;
+      for (int k = 0; k < 4; k++)
+        _coords[_n_points][j] += tm[j][k] * xyz[k];
+
+      min_vec[j] = cs::min(min_vec[j], _coords[_n_points][j]);
+      max_vec[j] = cs::max(max_vec[j], _coords[_n_points][j]);
+    }
+
+    /* When colors are written as int, Paraview interprets them in [0, 255]
+     * when they are written as float, Paraview interprets them in [0., 1.]
+     * */
+    for (int j = 0; j < 3; j++)
+      _colors[3*_n_points + j] = rgb[j]/255.;
+
+    _n_points++;
+
+  }
+
+  CS_FREE(vals);
+
+  *n_points = _n_points;
+  *point_coords = _coords;
+  *colors = _colors;
+
+  return (p < end) ? (size_t)(p - buf) : size;
+}
+
+/*----------------------------------------------------------------------------
+ * Locate a set of scan points on the mesh and accumulate cell sums.
+ *
+ * Each rank provides its own points, which the locator sends to the
+ * ranks owning the matching cells. Located points are then grouped by cell,
+ * so that sums are threaded and keep the point order within each cell.
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   m              <-- pointer to mesh
+ *   location_mesh  <-- location mesh
+ *   n_points       <-- number of local points
+ *   point_coords   <-- local point coordinates
+ *   colors         <-- local point colors
+ *   n_points_cell  <-> number of points in cell
+ *   cen_points     <-> sum of point coordinates relative to cell center
+ *   cell_color     <-> sum of point colors
+ *   mom_mat        <-> second moment matrix, relative to cell center
+ *----------------------------------------------------------------------------*/
+
+static void
+_locate_and_accumulate(const cs_mesh_t    *m,
+                       fvm_nodal_t        *location_mesh,
+                       cs_lnum_t           n_points,
+                       const cs_real_3_t   point_coords[],
+                       const float         colors[],
+                       cs_real_t           n_points_cell[],
+                       cs_real_t           cen_points[][3],
+                       cs_real_t           cell_color[][3],
+                       cs_real_t           mom_mat[][3][3])
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_real_3_t *cell_cen = cs_glob_mesh_quantities_g->cell_cen;
+
+  int options[PLE_LOCATOR_N_OPTIONS];
+  for (int i = 0; i < PLE_LOCATOR_N_OPTIONS; i++)
+    options[i] = 0;
+  options[PLE_LOCATOR_NUMBERING] = 0; /* base 0 numbering */
+
+#if defined(PLE_HAVE_MPI)
+  _locator = ple_locator_create(cs_glob_mpi_comm,
+                                cs_glob_n_ranks,
+                                0);
+#else
+  _locator = ple_locator_create();
+#endif
+
+  ple_locator_set_mesh(_locator,
+                       location_mesh,
+                       options,
+                       0., /* tolerance_base */
+                       0.1, /* tolerance */
+                       3, /* dim */
+                       n_points,
+                       nullptr,
+                       nullptr, /* point_tag */
+                       (const ple_coord_t *)point_coords,
+                       nullptr, /* distance */
+                       cs_coupling_mesh_extents,
+                       cs_coupling_point_in_mesh_p);
+
+  /* Shift from 1-base to 0-based locations */
+  ple_locator_shift_locations(_locator, -1);
+
+  /* Number of distant points located on local mesh. */
+  cs_lnum_t n_points_dist = ple_locator_get_n_dist_points(_locator);
+
+  const cs_lnum_t *dist_loc = ple_locator_get_dist_locations(_locator);
+  const ple_coord_t *dist_coords = ple_locator_get_dist_coords(_locator);
+
+  float *dist_colors = nullptr;
+  CS_MALLOC(dist_colors, 3*n_points_dist, float);
+
+  ple_locator_exchange_point_var(_locator,
+                                 dist_colors,
+                                 const_cast<float *>(colors),
+                                 nullptr,
+                                 sizeof(float),
+                                 3,
+                                 1);
+
+  /* Group points by cell (stable counting sort) */
+
+  cs_lnum_t *cell_idx, *p_ids;
+  CS_MALLOC(cell_idx, n_cells + 1, cs_lnum_t);
+  CS_MALLOC(p_ids, n_points_dist, cs_lnum_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells + 1; c_id++)
+    cell_idx[c_id] = 0;
+  for (cs_lnum_t i = 0; i < n_points_dist; i++)
+    cell_idx[dist_loc[i] + 1] += 1;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    cell_idx[c_id + 1] += cell_idx[c_id];
+  for (cs_lnum_t i = 0; i < n_points_dist; i++)
+    p_ids[cell_idx[dist_loc[i]]++] = i;
+  for (cs_lnum_t c_id = n_cells; c_id > 0; c_id--)
+    cell_idx[c_id] = cell_idx[c_id - 1];
+  cell_idx[0] = 0;
+
+  /* Accumulate cell sums; the second moment matrix uses Kahan summation */
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    const cs_lnum_t s_id = cell_idx[c_id];
+    const cs_lnum_t e_id = cell_idx[c_id + 1];
+
+    if (s_id == e_id)
+      continue;
+
+    cs_real_t s_cen[3] = {0., 0., 0.};
+    cs_real_t s_col[3] = {0., 0., 0.};
+    cs_real_t d[3][3], c[3][3];
+    for (int i = 0; i < 3; i++) {
+      for (int j = 0; j < 3; j++) {
+        d[i][j] = 0.;
+        c[i][j] = 0.;
+      }
+    }
+
+    for (cs_lnum_t k = s_id; k < e_id; k++) {
+      const cs_lnum_t p_id = p_ids[k];
+
+      cs_real_t point_local[3];
+      for (int i = 0; i < 3; i++) {
+        point_local[i] = dist_coords[p_id*3 + i] - cell_cen[c_id][i];
+        s_cen[i] += point_local[i];
+        s_col[i] += dist_colors[p_id*3 + i];
+      }
+
+      for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+          cs_real_t z = point_local[i] * point_local[j] - c[i][j];
+          cs_real_t t = d[i][j] + z;
+          c[i][j] = (t - d[i][j]) - z;
+          d[i][j] = t;
+        }
+      }
+    }
+
+    n_points_cell[c_id] += e_id - s_id;
+    for (int i = 0; i < 3; i++) {
+      cen_points[c_id][i] += s_cen[i];
+      cell_color[c_id][i] += s_col[i];
+      for (int j = 0; j < 3; j++)
+        mom_mat[c_id][i][j] += d[i][j];
+    }
+
+  } // Loop over cells
+
+  CS_FREE(cell_idx);
+  CS_FREE(p_ids);
+  CS_FREE(dist_colors);
+
+  //TODO compute the solid face roughness as the RMS of points
+  //     distance to the reconstructed plane, and the minimum distance
+  //     between points to suggest a minimum resolution
+
+  _locator = ple_locator_destroy(_locator);
+}
+
+/*----------------------------------------------------------------------------
+ * Write scan points and their colors to a dedicated postprocessing output.
+ *
+ * Each rank writes the points it has read. This function is collective.
+ *
+ * parameters:
+ *   name          <-- output name
+ *   n_points      <-- number of local points
+ *   point_coords  <-- local point coordinates
+ *   colors        <-- local point colors
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_scan_points(const char         *name,
+                   cs_lnum_t           n_points,
+                   const cs_real_3_t   point_coords[],
+                   const float         colors[])
+{
+  /* Build FVM mesh from scanned points */
+  fvm_nodal_t *pts_mesh = fvm_nodal_create(name, 3);
+
+  fvm_nodal_define_vertex_list(pts_mesh, n_points, nullptr);
+  fvm_nodal_set_shared_vertices(pts_mesh, (const cs_coord_t *)point_coords);
+
+  /* Points are numbered by rank, in file order */
+
+  cs_gnum_t g_shift = 0;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_gnum_t l_count = n_points;
+    MPI_Scan(&l_count, &g_shift, 1, CS_MPI_GNUM, MPI_SUM, cs_glob_mpi_comm);
+    g_shift -= l_count;
+  }
+#endif
+
+  cs_gnum_t *vtx_gnum = nullptr;
+  CS_MALLOC(vtx_gnum, n_points, cs_gnum_t);
+  for (cs_lnum_t i = 0; i < n_points; i++)
+    vtx_gnum[i] = g_shift + i + 1;
+
+  fvm_nodal_init_io_num(pts_mesh, vtx_gnum, 0);
+
+  CS_FREE(vtx_gnum);
+
+  /* Create default writer */
+  fvm_writer_t *writer
+    = fvm_writer_init(name,
+                      "postprocessing",
+                      cs_post_get_default_format(),
+                      cs_post_get_default_format_options(),
+                      FVM_WRITER_FIXED_MESH);
+
+  fvm_writer_export_nodal(writer, pts_mesh);
+
+  const void *var_ptr[1] = {colors};
+
+  fvm_writer_export_field(writer,
+                          pts_mesh,
+                          "color",
+                          FVM_WRITER_PER_NODE,
+                          3,
+                          CS_INTERLACE,
+                          0,
+                          0,
+                          CS_FLOAT,
+                          -1,
+                          0.0,
+                          (const void * *)var_ptr);
+
+  /* Free and destroy */
+  fvm_writer_finalize(writer);
+  pts_mesh = fvm_nodal_destroy(pts_mesh);
+}
+
+/*----------------------------------------------------------------------------
+ * Read a scan points file, locate its points and accumulate cell sums.
+ *
+ * Each rank reads a contiguous range of lines of the file, by chunks
+ * of bounded size, so the whole cloud never needs to fit in memory
+ * unless points are postprocessed.
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   m              <-- pointer to mesh
+ *   location_mesh  <-- location mesh
+ *   f_name         <-- file name
+ *   f_id           <-- file id (for output name)
+ *   n_headers      <-- number of columns
+ *   col_role       <-- role of each column
+ *   n_points_cell  <-> number of points in cell
+ *   cen_points     <-> sum of point coordinates relative to cell center
+ *   cell_color     <-> sum of point colors
+ *   mom_mat        <-> second moment matrix, relative to cell center
+ *   min_vec        <-> bounding box minimum
+ *   max_vec        <-> bounding box maximum
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_scan_file(const cs_mesh_t  *m,
+                fvm_nodal_t      *location_mesh,
+                const char       *f_name,
+                int               f_id,
+                int               n_headers,
+                const int         col_role[],
+                cs_real_t         n_points_cell[],
+                cs_real_t         cen_points[][3],
+                cs_real_t         cell_color[][3],
+                cs_real_t         mom_mat[][3][3],
+                cs_real_t         min_vec_tot[3],
+                cs_real_t         max_vec_tot[3])
+{
+  const int n_ranks = cs_glob_n_ranks;
+  const int rank_id = cs::max(cs_glob_rank_id, 0);
+
+  bft_printf(_("\n\n  Open file:\n"
+               "    %s\n\n"), f_name);
+
+  if (cs_file_isreg(f_name) == 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Porosity from scan: Could not open file \"%s\"."), f_name);
+
+  const cs_file_off_t f_size = cs_file_size(f_name);
+
+#if defined(HAVE_MPI)
+  cs_file_t *f = cs_file_open(f_name,
+                              CS_FILE_MODE_READ,
+                              CS_FILE_STDIO_SERIAL,
+                              MPI_INFO_NULL,
+                              MPI_COMM_NULL,
+                              MPI_COMM_NULL);
+#else
+  cs_file_t *f = cs_file_open(f_name,
+                              CS_FILE_MODE_READ,
+                              CS_FILE_STDIO_SERIAL);
+#endif
+
+  /* Range of lines read by this rank */
+
+  cs_file_off_t r_start
+    = _scan_line_start(f, (f_size / n_ranks) * rank_id
+                          + (f_size % n_ranks) * rank_id / n_ranks, f_size);
+  cs_file_off_t r_end
+    = _scan_line_start(f, (f_size / n_ranks) * (rank_id+1)
+                          + (f_size % n_ranks) * (rank_id+1) / n_ranks, f_size);
+
+  const cs_file_off_t chunk_size = _SCAN_CHUNK_SIZE;
+
+  int n_rounds = (r_end - r_start + chunk_size - 1) / chunk_size;
+  cs_parall_max(1, CS_INT_TYPE, &n_rounds);
+
+  const bool postprocess = _porosity_from_scan_opt.postprocess_points;
+
+  cs_lnum_t n_points = 0, n_points_max = 0;
+  cs_real_3_t *point_coords = nullptr;
+  float *colors = nullptr;
+
+  cs_real_t min_vec[3] = { HUGE_VAL,  HUGE_VAL,  HUGE_VAL};
+  cs_real_t max_vec[3] = {-HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
+
+  cs_gnum_t n_g_points = 0, n_announced = 0;
+
+  size_t n_carry = 0, buf_size = 0;
+  char *buf = nullptr;
+
+  cs_file_off_t pos = r_start;
+  cs_file_seek(f, pos, CS_FILE_SEEK_SET);
+
+  for (int round_id = 0; round_id < n_rounds; round_id++) {
+
+    /* Read next chunk after the incomplete line from the previous one */
+
+    size_t n_read = cs::min(chunk_size, r_end - pos);
+    if (n_carry + n_read + 1 > buf_size) {
+      buf_size = n_carry + n_read + 1;
+      CS_REALLOC(buf, buf_size, char);
+    }
+    if (n_read > 0)
+      n_read = cs_file_read_global(f, buf + n_carry, 1, n_read);
+    pos += n_read;
+
+    size_t n_buf = n_carry + n_read;
+    buf[n_buf] = '\0';
+
+    cs_lnum_t n_prev = (postprocess) ? n_points : 0;
+    if (!postprocess)
+      n_points = 0;
+
+    size_t n_parsed = _parse_scan_points(buf,
+                                         n_buf,
+                                         pos >= r_end,
+                                         n_headers,
+                                         col_role,
+                                         &n_points,
+                                         &n_points_max,
+                                         &point_coords,
+                                         &colors,
+                                         min_vec,
+                                         max_vec,
+                                         &n_announced);
+
+    n_carry = n_buf - n_parsed;
+    memmove(buf, buf + n_parsed, n_carry);
+
+    n_g_points += n_points - n_prev;
+
+    _locate_and_accumulate(m,
+                           location_mesh,
+                           n_points - n_prev,
+                           point_coords + n_prev,
+                           colors + 3*n_prev,
+                           n_points_cell,
+                           cen_points,
+                           cell_color,
+                           mom_mat);
+
+  }
+
+  CS_FREE(buf);
+  cs_file_free(f);
+
+  cs_parall_counter(&n_g_points, 1);
+  cs_parall_counter(&n_announced, 1);
+  cs_parall_min(3, CS_REAL_TYPE, min_vec);
+  cs_parall_max(3, CS_REAL_TYPE, max_vec);
+
+  bft_printf(_("  Porosity from scan: %llu points read"
+               " (%llu announced in file).\n\n"),
+             (unsigned long long)n_g_points,
+             (unsigned long long)n_announced);
+
+  bft_printf(_("  Bounding box [%f, %f, %f], [%f, %f, %f].\n\n"),
+             min_vec[0], min_vec[1], min_vec[2],
+             max_vec[0], max_vec[1], max_vec[2]);
+
+  /* Update global bounding box */
+  for (int j = 0; j < 3; j++) {
+    min_vec_tot[j] = cs::min(min_vec[j], min_vec_tot[j]);
+    max_vec_tot[j] = cs::max(max_vec[j], max_vec_tot[j]);
+  }
+
+  /* FVM meshes for writers */
+  if (postprocess) {
+    const char *base_name = (_porosity_from_scan_opt.output_name != nullptr) ?
+      _porosity_from_scan_opt.output_name : f_name;
+    char *fvm_name;
+    CS_MALLOC(fvm_name, strlen(base_name) + 16, char);
+    sprintf(fvm_name, "%s_%02d", base_name, f_id);
+
+    _write_scan_points(fvm_name, n_points, point_coords, colors);
+
+    CS_FREE(fvm_name);
+  }
+
+  CS_FREE(point_coords);
+  CS_FREE(colors);
+}
+
 /*----------------------------------------------------------------------------
  * Prepare computation of porosity from scan points file.
  *
@@ -328,7 +868,6 @@ _solid_plane_from_points(const cs_mesh_t   *m,
 static void
 _prepare_porosity_from_scan(const cs_mesh_t             *m,
                             const cs_mesh_quantities_t  *mq) {
-  char line[512];
 
   cs_mesh_quantities_t *mq_g = cs_glob_mesh_quantities_g;
 
@@ -363,6 +902,11 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
     }
   }
 
+  /* Role of each column: 0 to 2 for coordinates, 3 to 5 for colors */
+  const char *role_names[] = {"X", "Y", "Z", "Red", "Green", "Blue"};
+  int *col_role;
+  CS_MALLOC(col_role, n_headers, int);
+
   bft_printf("Reading .pts file headers\n");
   for (int i = 0; i < n_headers; i++) {
 
@@ -375,6 +919,11 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
     else {
       type[i] = 0;
     }
+    col_role[i] = -1;
+    for (int j = 0; j < 6; j++) {
+      if (strcmp(headers[i], role_names[j]) == 0)
+        col_role[i] = j;
+    }
     bft_printf("header %d: %s, type: %d\n", i, headers[i], type[i]);
   }
 
@@ -413,377 +962,65 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
   cs_real_t *cell_color =
     (cs_real_t *)cs_field_by_name("cell_scan_points_color")->val;
 
-  /* Immersed solid roughness */
-  cs_real_t *c_w_face_rough =
-    (cs_real_t *)cs_field_by_name("solid_roughness")->val;
+  /* Number of points per cell */
+  cs_field_t *f_nb_scan = cs_field_by_name("nb_scan_points");
 
   /* Covariance matrix for solid plane computation */
   cs_real_33_t *mom_mat;
   CS_MALLOC(mom_mat, m->n_cells, cs_real_33_t);
   memset(mom_mat, 0., m->n_cells * sizeof(cs_real_33_t));
 
-  /* Loop on file_names */
-  char *tok;
-  const char sep[4] = ";";
-  // parse names
-
-  char *file_names;
-  CS_MALLOC(file_names, strlen(_porosity_from_scan_opt.file_names)+1, char);
-  strcpy(file_names, _porosity_from_scan_opt.file_names);
-
-  tok = strtok(file_names, sep);
-
-  while (tok != nullptr) {
-    char *f_name;
-    CS_MALLOC(f_name,
-        strlen(tok) + 1,
-        char);
-    strcpy(f_name, tok);
-
-    bft_printf(_("\n\n  Open file:\n"
-          "    %s\n\n"),
-        f_name);
-    FILE *file = fopen(f_name, "rt");
-    if (file == nullptr)
-      bft_error(__FILE__, __LINE__, 0,
-          _("Porosity from scan: Could not open file."));
-
-    /* next file to be read */
-    tok = strtok(nullptr, sep);
-    long int n_read_points = 0;
-    long int n_points = 0;
-    if (fscanf(file, "%ld\n", &n_read_points) != 1)
-      bft_error(__FILE__, __LINE__, 0,
-                _("Porosity from scan: Could not read the number of lines."));
-
-    bft_printf(_("  Porosity from scan: %ld points to be read.\n\n"),
-               n_read_points);
-
-    /* Pointer to field */
-    cs_field_t *f_nb_scan = cs_field_by_name_try("nb_scan_points");
-
-    /* Location mesh where points will be localized */
-    fvm_nodal_t *location_mesh =
-      cs_mesh_connect_cells_to_nodal(m,
-                                     "pts_location_mesh",
-                                     false, // no family info
-                                     m->n_cells,
-                                     nullptr);
-
-    fvm_nodal_make_vertices_private(location_mesh);
-
-    /* Read multiple scan files
-     * ------------------------ */
-
-    for (int n_scan = 0; n_read_points > 0; n_scan++) {
-      n_points = n_read_points;
-      bft_printf(_("  Immersed boundary from scan: scan %d.\n"
-                   "                               %ld points to be read.\n\n"),
-                 n_scan, n_points);
-
-
-      cs_real_3_t *point_coords;
-      float *colors;
-      CS_MALLOC(point_coords, n_points, cs_real_3_t);
-      CS_MALLOC(colors, 3*n_points, float);
-
-      cs_real_3_t min_vec = { HUGE_VAL,  HUGE_VAL,  HUGE_VAL};
-      cs_real_3_t max_vec = {-HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
-
-      /* Read points */
-      for (int i = 0; i < n_points; i++ ) {
-        int num = 0, green = 0, red = 0, blue = 0;
-        cs_real_4_t xyz;
-        for (int j = 0; j < 3; j++)
-          point_coords[i][j] = 0.;
-
-        for (int h_id = 0; h_id < n_headers; h_id++) {
-
-          double local_double = 0.;
-          int local_int = 0.;
-
-          if (type[h_id] == 0)
-            fscanf(file, "%d", &local_int);
-          if (type[h_id] == 1)
-            fscanf(file, "%lf", &local_double);
-
-          if (h_id == (n_headers-1))
-            fscanf(file, "%*[^\n]");
-
-          if (strcmp(headers[h_id], "X") == 0)
-            xyz[0] = local_double;
-
-          else if (strcmp(headers[h_id], "Y") == 0)
-            xyz[1] = local_double;
-
-          else if (strcmp(headers[h_id], "Z") == 0)
-            xyz[2] = local_double;
-
-          else if (strcmp(headers[h_id], "Intensity") == 0)
-            num = local_int;
-
-          else if (strcmp(headers[h_id], "Red") == 0)
-            red = local_int;
-
-          else if (strcmp(headers[h_id], "Green") == 0)
-            green = local_int;
-
-          else if (strcmp(headers[h_id], "Blue") == 0)
-            blue = local_int;
-
-        } /* end loop on headers*/
-
-        /* Translation and rotation */
-        xyz[3] = 1.;
-        for (int j = 0; j < 3; j++) {
-          for (int k = 0; k < 4; k++)
-            point_coords[i][j]
-              += _porosity_from_scan_opt.transformation_matrix[j][k] * xyz[k];
-
-          /* Compute bounding box*/
-          min_vec[j] = cs::min(min_vec[j], point_coords[i][j]);
-          max_vec[j] = cs::max(max_vec[j], point_coords[i][j]);
-        }
-
-        /* When colors are written as int, Paraview interprets them in [0, 255]
-         * when they are written as float, Paraview interprets them in [0., 1.]
-         * */
-        colors[3*i + 0] = red/255.;
-        colors[3*i + 1] = green/255.;
-        colors[3*i + 2] = blue/255.;
-      }
-
-      /* Check EOF was correctly reached */
-      if (fgets(line, sizeof(line), file) != nullptr)
-        n_read_points = strtol(line, nullptr, 10);
-      else
-        n_read_points = 0;
-
-      /* Bounding box*/
-      bft_printf(_("  Bounding box [%f, %f, %f], [%f, %f, %f].\n\n"),
-                 min_vec[0], min_vec[1], min_vec[2],
-                 max_vec[0], max_vec[1], max_vec[2]);
-
-      /* Update global bounding box */
-      for (int j = 0; j < 3; j++) {
-        min_vec_tot[j] = cs::min(min_vec[j], min_vec_tot[j]);
-        max_vec_tot[j] = cs::max(max_vec[j], max_vec_tot[j]);
-      }
-
-      if (n_read_points > 0)
-        bft_printf
-          (_("  Porosity from scan: %ld additional points to be read.\n\n"),
-           n_read_points);
-
-      /* FVM meshes for writers */
-      if (_porosity_from_scan_opt.postprocess_points) {
-        char *fvm_name;
-        if (_porosity_from_scan_opt.output_name == nullptr) {
-          CS_MALLOC(fvm_name,
-                    strlen(f_name) + 3 + 1,
-                    char);
-          strcpy(fvm_name, f_name);
-        }
-        else {
-          CS_MALLOC(fvm_name,
-                    strlen(_porosity_from_scan_opt.output_name) + 3 + 1,
-                    char);
-          strcpy(fvm_name, _porosity_from_scan_opt.output_name);
-        }
-        char suffix[13];
-        sprintf(suffix, "_%02d", n_scan);
-        strcat(fvm_name, suffix);
-
-        /* Build FVM mesh from scanned points */
-        fvm_nodal_t *pts_mesh = fvm_nodal_create(fvm_name, 3);
-
-        /* Only the first rank writes points for now */
-        cs_gnum_t *vtx_gnum = nullptr;
-
-        if (cs_glob_rank_id < 1) {
-          /* Update the points set structure */
-          fvm_nodal_define_vertex_list(pts_mesh, n_points, nullptr);
-          fvm_nodal_set_shared_vertices(pts_mesh, (cs_coord_t *)point_coords);
-
-          CS_MALLOC(vtx_gnum, n_points, cs_gnum_t);
-          for (cs_lnum_t i = 0; i < n_points; i++)
-            vtx_gnum[i] = i + 1;
-
-        }
-        fvm_nodal_init_io_num(pts_mesh, vtx_gnum, 0);
-
-        /* Free if allocated */
-        CS_FREE(vtx_gnum);
-
-        /* Create default writer */
-        fvm_writer_t *writer
-          = fvm_writer_init(fvm_name,
-                            "postprocessing",
-                            cs_post_get_default_format(),
-                            cs_post_get_default_format_options(),
-                            FVM_WRITER_FIXED_MESH);
-
-        fvm_writer_export_nodal(writer, pts_mesh);
-
-        const void *var_ptr[1] = {nullptr};
-
-        var_ptr[0] = colors;
-
-        fvm_writer_export_field(writer,
-                                pts_mesh,
-                                "color",
-                                FVM_WRITER_PER_NODE,
-                                3,
-                                CS_INTERLACE,
-                                0,
-                                0,
-                                CS_FLOAT,
-                                -1,
-                                0.0,
-                                (const void * *)var_ptr);
-
-        /* Free and destroy */
-        fvm_writer_finalize(writer);
-        pts_mesh = fvm_nodal_destroy(pts_mesh);
-        CS_FREE(fvm_name);
-        CS_FREE(f_name);
-      }
-
-      /* Now build locator
-       * Locate points on this location mesh */
-      /*-------------------------------------*/
-
-      int options[PLE_LOCATOR_N_OPTIONS];
-      for (int i = 0; i < PLE_LOCATOR_N_OPTIONS; i++)
-        options[i] = 0;
-      options[PLE_LOCATOR_NUMBERING] = 0; /* base 0 numbering */
-
-#if defined(PLE_HAVE_MPI)
-      _locator = ple_locator_create(cs_glob_mpi_comm,
-                                    cs_glob_n_ranks,
-                                    0);
-#else
-      _locator = ple_locator_create();
-#endif
-
-      cs_lnum_t _n_points = (cs_glob_rank_id < 1) ? n_points : 0;
-      cs_real_t *_point_coords = (cs_glob_rank_id < 1) ? (cs_real_t *)point_coords : nullptr;
-
-      ple_locator_set_mesh(_locator,
-                           location_mesh,
-                           options,
-                           0., /* tolerance_base */
-                           0.1, /* tolerance */
-                           3, /* dim */
-                           _n_points,
-                           nullptr,
-                           nullptr, /* point_tag */
-                           _point_coords,
-                           nullptr, /* distance */
-                           cs_coupling_mesh_extents,
-                           cs_coupling_point_in_mesh_p);
-
-      /* Shift from 1-base to 0-based locations */
-      ple_locator_shift_locations(_locator, -1);
-
-      /* dump locator */
-#if 0
-      ple_locator_dump(_locator);
-#endif
-
-      /* Number of distant points located on local mesh. */
-      cs_lnum_t n_points_dist = ple_locator_get_n_dist_points(_locator);
-
-#if 0
-      bft_printf("ple_locator_get_n_dist_points = %d, n_points = %ld\n",
-                 n_points_dist, n_points);
-#endif
-
-      const cs_lnum_t *dist_loc = ple_locator_get_dist_locations(_locator);
-      const ple_coord_t *dist_coords = ple_locator_get_dist_coords(_locator);
-
-      float *dist_colors = nullptr;
-      CS_MALLOC(dist_colors, 3*n_points_dist, float);
-
-      ple_locator_exchange_point_var(_locator,
-                                     dist_colors,
-                                     colors,
-                                     nullptr,
-                                     sizeof(float),
-                                     3,
-                                     1);
-
-      for (cs_lnum_t i = 0; i < n_points_dist; i++) {
-        cs_lnum_t c_id = dist_loc[i];
-        f_nb_scan->val[c_id] += 1.;
-        for (cs_lnum_t idim = 0; idim < 3; idim++) {
-          cen_points[c_id*3+idim]
-            += (dist_coords[i*3 + idim] - mq_g->cell_cen[c_id][idim]);
-
-          cell_color[c_id*3+idim] += dist_colors[i*3 + idim];
-        }
-      }
+  /* Location mesh where points will be localized */
+  fvm_nodal_t *location_mesh =
+    cs_mesh_connect_cells_to_nodal(m,
+                                   "pts_location_mesh",
+                                   false, // no family info
+                                   m->n_cells,
+                                   nullptr);
 
-      _incremental_solid_plane_from_points(m,
-                                           n_points_dist,
-                                           dist_loc,
-                                           (const cs_real_t *)f_nb_scan->val,
-                                           mq_g->cell_cen,
-                                           (const cs_real_3_t *)dist_coords,
-                                           mom_mat);
-
-      CS_FREE(dist_colors);
-
-      /* Solid face roughness from point cloud is computed as the RMS of points
-       *  distance to the reconstructed plane */
-      cs_real_t w_point_dist =  0.;
-
-      for (cs_lnum_t i = 0; i < n_points_dist; i++) {
-        cs_lnum_t c_id = dist_loc[i];
-
-        if (f_nb_scan->val[c_id] > 1.)  { // at least 2 points to compute distance
-
-#if 0
-          cs_real_t vec_w_point[3]  = {0., 0., 0.};
-          for (cs_lnum_t idim = 0; idim < 3; idim++)
-            vec_w_point[idim] = dist_coords[i*3 + idim]
-                              - cen_points[c_id*3+idim];
-          //TODO compute roughness incrementally
-          //w_point_dist = cs_math_3_dot_product(vec_w_point,
-          //                                     c_w_face_normal[c_id]);
-#endif
+  fvm_nodal_make_vertices_private(location_mesh);
 
-          c_w_face_rough[c_id] += 2 * sqrt(w_point_dist * w_point_dist)
-                                / f_nb_scan->val[c_id];
-        }
-      }
-      //TODO compute the minimum distance between point
-      //     to suggest a minimum resolution
+  /* Loop on file_names */
+  char *tok;
+  const char sep[4] = ";";
+  // parse names
 
-      /* Free memory */
-      _locator = ple_locator_destroy(_locator);
-      CS_FREE(point_coords);
-      CS_FREE(colors);
+  char *file_names;
+  CS_MALLOC(file_names, strlen(_porosity_from_scan_opt.file_names)+1, char);
+  strcpy(file_names, _porosity_from_scan_opt.file_names);
 
-    } /* End loop on multiple scans */
+  tok = strtok(file_names, sep);
 
-    if (fclose(file) != 0)
-      bft_error(__FILE__, __LINE__, 0,
-                _("Porosity from scan: Could not close the file."));
+  for (int f_id = 0; tok != nullptr; f_id++) {
+
+    _read_scan_file(m,
+                    location_mesh,
+                    tok,
+                    f_id,
+                    n_headers,
+                    col_role,
+                    f_nb_scan->val,
+                    (cs_real_3_t *)cen_points,
+                    (cs_real_3_t *)cell_color,
+                    mom_mat,
+                    min_vec_tot,
+                    max_vec_tot);
 
-    /* Nodal mesh is not needed anymore */
-    location_mesh = fvm_nodal_destroy(location_mesh);
+    /* next file to be read */
+    tok = strtok(nullptr, sep);
 
   } /* End of multiple files */
 
+  /* Nodal mesh is not needed anymore */
+  location_mesh = fvm_nodal_destroy(location_mesh);
+
   /* Finalization */
   for (int i = 0; i < n_headers; i++) {
     CS_FREE(headers[i]);
   }
   CS_FREE(headers);
   CS_FREE(type);
-
-  const cs_field_t *f_nb_scan = cs_field_by_name_try("nb_scan_points");
+  CS_FREE(col_role);
 
   // Normal vector to the solid plane
   cs_real_3_t *restrict c_w_face_normal
@@ -823,8 +1060,6 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
     if (m->n_init_perio > 0)
       cs_halo_perio_sync_coords(m->halo, CS_HALO_EXTENDED,
                                 (cs_real_t *)cen_points);
-    cs_parall_min(3, CS_REAL_TYPE, min_vec_tot);
-    cs_parall_max(3, CS_REAL_TYPE, max_vec_tot);
   }
 
   /* Bounding box */
@@ -832,7 +1067,6 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
              min_vec_tot[0], min_vec_tot[1], min_vec_tot[2],
              max_vec_tot[0], max_vec_tot[1], max_vec_tot[2]);
 
-
   /* Solid cells should have enough points */
   for (cs_lnum_t c_id = 0; c_id < m->n_cells_with_ghosts; c_id++) {
     cell_f_vol[c_id] = mq_g->cell_vol[c_id];
@@ -899,6 +1133,374 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Update a 64-bit FNV-1a hash with a data buffer.
+ *
+ * parameters:
+ *   h     <-- current hash value
+ *   data  <-- data buffer
+ *   size  <-- data size, in bytes
+ *
+ * returns:
+ *   updated hash value
+ *----------------------------------------------------------------------------*/
+
+static uint64_t
+_fnv1a_hash(uint64_t     h,
+            const void  *data,
+            size_t       size)
+{
+  const unsigned char *p = (const unsigned char *)data;
+
+  for (size_t i = 0; i < size; i++) {
+    h ^= p[i];
+    h *= 1099511628211ULL;
+  }
+
+  return h;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the key identifying cached porosity from scan results.
+ *
+ * The key combines the scan files names and full contents, the model
+ * options, and global mesh dimensions and extents, so that any change
+ * leads to a new computation.
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   m    <-- pointer to mesh
+ *   key  --> key string (16 hexadecimal digits)
+ *----------------------------------------------------------------------------*/
+
+static void
+_scan_cache_key(const cs_mesh_t  *m,
+                char              key[17])
+{
+  const cs_porosity_from_scan_opt_t *o = &_porosity_from_scan_opt;
+
+  uint64_t h = 14695981039346656037ULL;
+
+  /* Scan files (read by the root rank only) */
+
+  if (cs_glob_rank_id < 1) {
+
+    const size_t blk_size = 1048576;
+
+    char *buf;
+    CS_MALLOC(buf, blk_size, char);
+
+    char *file_names;
+    CS_MALLOC(file_names, strlen(o->file_names)+1, char);
+    strcpy(file_names, o->file_names);
+
+    for (char *tok = strtok(file_names, ";");
+         tok != nullptr;
+         tok = strtok(nullptr, ";")) {
+
+      cs_file_off_t f_size = cs_file_size(tok);
+      h = _fnv1a_hash(h, tok, strlen(tok));
+      h = _fnv1a_hash(h, &f_size, sizeof(cs_file_off_t));
+
+      if (f_size == 0)
+        continue;
+
+#if defined(HAVE_MPI)
+      cs_file_t *f = cs_file_open(tok,
+                                  CS_FILE_MODE_READ,
+                                  CS_FILE_STDIO_SERIAL,
+                                  MPI_INFO_NULL,
+                                  MPI_COMM_NULL,
+                                  MPI_COMM_NULL);
+#else
+      cs_file_t *f = cs_file_open(tok,
+                                  CS_FILE_MODE_READ,
+                                  CS_FILE_STDIO_SERIAL);
+#endif
+
+      /* Whole file contents (reading is much cheaper than processing
+         the scan points) */
+
+      for (cs_file_off_t offset = 0; offset < f_size; offset += blk_size) {
+        size_t n = cs::min((size_t)(f_size - offset), blk_size);
+        size_t n_read = cs_file_read_global(f, buf, 1, n);
+        h = _fnv1a_hash(h, buf, n_read);
+      }
+
+      cs_file_free(f);
+    }
+
+    CS_FREE(file_names);
+    CS_FREE(buf);
+  }
+
+  /* Options */
+
+  h = _fnv1a_hash(h, &(o->n_headers), sizeof(int));
+  if (o->headers != nullptr) {
+    for (int i = 0; i < o->n_headers; i++)
+      h = _fnv1a_hash(h, o->headers[i], strlen(o->headers[i]) + 1);
+  }
+  h = _fnv1a_hash(h, o->transformation_matrix, sizeof(cs_real_34_t));
+  h = _fnv1a_hash(h, o->direction_vector, sizeof(cs_real_3_t));
+  h = _fnv1a_hash(h, &(o->type_fill), sizeof(cs_fill_type_t));
+  h = _fnv1a_hash(h, &(o->nb_sources), sizeof(int));
+  h = _fnv1a_hash(h, o->sources, o->nb_sources*sizeof(cs_real_3_t));
+  h = _fnv1a_hash(h, &(o->threshold), sizeof(cs_lnum_t));
+  h = _fnv1a_hash(h, &(o->n_agglomeration), sizeof(cs_lnum_t));
+  h = _fnv1a_hash(h, &(o->porosity_threshold), sizeof(cs_real_t));
+  h = _fnv1a_hash(h, &(o->convection_porosity_threshold), sizeof(cs_real_t));
+  h = _fnv1a_hash(h, &(o->use_staircase), sizeof(bool));
+  h = _fnv1a_hash(h, &(o->eigenvalue_criteria), sizeof(cs_real_t));
+  h = _fnv1a_hash(h, &(o->cog_location), sizeof(cs_ibm_cog_location_t));
+
+  /* Mesh */
+
+  cs_real_t extents[6] = {HUGE_VAL, HUGE_VAL, HUGE_VAL,
+                          -HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
+  for (cs_lnum_t i = 0; i < m->n_vertices; i++) {
+    for (int j = 0; j < 3; j++) {
+      extents[j] = cs::min(extents[j], m->vtx_coord[i*3 + j]);
+      extents[j+3] = cs::max(extents[j+3], m->vtx_coord[i*3 + j]);
+    }
+  }
+  cs_parall_min(3, CS_REAL_TYPE, extents);
+  cs_parall_max(3, CS_REAL_TYPE, extents + 3);
+
+  h = _fnv1a_hash(h, &(m->n_g_cells), sizeof(cs_gnum_t));
+  h = _fnv1a_hash(h, &(m->n_g_i_faces), sizeof(cs_gnum_t));
+  h = _fnv1a_hash(h, &(m->n_g_vertices), sizeof(cs_gnum_t));
+  h = _fnv1a_hash(h, extents, sizeof(extents));
+
+  /* Options and mesh are the same on all ranks, but the file part
+     of the hash is only known on the root rank */
+
+  cs_gnum_t _h = h;
+  cs_parall_bcast(0, 1, CS_GNUM_TYPE, &_h);
+
+  snprintf(key, 17, "%016llx", (unsigned long long)_h);
+}
+
+/*----------------------------------------------------------------------------
+ * Write porous model arrays to a restart file.
+ *
+ * parameters:
+ *   r  <-> associated restart file
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_porous_arrays(cs_restart_t  *r)
+{
+  cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  cs_restart_write_fields(r, CS_RESTART_IBM);
+
+  /* Store some useful mesh quantities arrays (not a field) */
+  cs_restart_write_section(r,
+                           "c_disable_flag::vals::0",
+                           CS_MESH_LOCATION_CELLS,
+                           1,
+                           CS_TYPE_int,
+                           mq->c_disable_flag);
+}
+
+/*----------------------------------------------------------------------------
+ * Read porous model arrays from a restart file.
+ *
+ * parameters:
+ *   r           <-> associated restart file
+ *   error_name  --> name of an array which could not be read, if any
+ *
+ * returns:
+ *   number of arrays which could not be read, on all ranks
+ *----------------------------------------------------------------------------*/
+
+static int
+_read_porous_arrays(cs_restart_t  *r,
+                    char           error_name[128])
+{
+  cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  int errcount = 0;
+
+  const char *new_sec_name[] = {"c_w_face_normal",
+                                "cell_scan_points_cog"};
+
+  cs_restart_read_fields(r, CS_RESTART_IBM);
+
+  /* Read some useful mesh quantities arrays (not a field) */
+
+  int ierr = cs_restart_read_section(r,
+                                     "c_disable_flag::vals::0",
+                                     CS_MESH_LOCATION_CELLS,
+                                     1,
+                                     CS_TYPE_int,
+                                     mq->c_disable_flag);
+
+  if (ierr != CS_RESTART_SUCCESS) {
+    errcount += 1;
+    snprintf(error_name, 127, "%s", "c_disable_flag");
+  }
+
+  /* Check if all all porous arrays are read successfully */
+
+  for (int i = 0; i < 2; i++) {
+
+    cs_field_t *f = cs_field_by_name(new_sec_name[i]);
+
+    char sec_name[128];
+    snprintf(sec_name, 127, "%s::vals::%d", new_sec_name[i], 0);
+
+    int retval = cs_restart_check_section(r,
+                                          sec_name,
+                                          f->location_id,
+                                          f->dim,
+                                          CS_TYPE_cs_real_t);
+
+    if (retval != CS_RESTART_SUCCESS) {
+      errcount += 1;
+      snprintf(error_name, 127, "%s", new_sec_name[i]);
+    }
+  }
+
+  cs_parall_sum(1, CS_INT_TYPE, &errcount);
+
+  return errcount;
+}
+
+/*----------------------------------------------------------------------------
+ * Try to read cached porosity from scan results.
+ *
+ * parameters:
+ *   key  <-- expected cache key
+ *
+ * returns:
+ *   true if matching results were read, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_scan_cache_read(const char  *key)
+{
+  const char *cache_dir = _porosity_from_scan_opt.cache_dir;
+
+  char *path;
+  CS_MALLOC(path, strlen(cache_dir) + strlen(_SCAN_CACHE_NAME) + 2, char);
+  sprintf(path, "%s/%s", cache_dir, _SCAN_CACHE_NAME);
+
+  int exists = (cs_glob_rank_id < 1) ? cs_file_isreg(path) : 0;
+  cs_parall_bcast(0, 1, CS_INT_TYPE, &exists);
+
+  CS_FREE(path);
+
+  if (exists == 0) {
+    bft_printf(_("  Porosity from scan: no cached results in \"%s\".\n\n"),
+               cache_dir);
+    return false;
+  }
+
+  cs_restart_t *r
+    = cs_restart_create(_SCAN_CACHE_NAME, cache_dir, CS_RESTART_MODE_READ);
+
+  char c_key[17];
+  memset(c_key, 0, sizeof(c_key));
+
+  int retval = cs_restart_read_section(r,
+                                       "porosity_from_scan:key",
+                                       CS_MESH_LOCATION_NONE,
+                                       17,
+                                       CS_TYPE_char,
+                                       c_key);
+
+  bool is_valid = (   retval == CS_RESTART_SUCCESS
+                   && strncmp(c_key, key, 16) == 0);
+
+  if (is_valid) {
+    char error_name[128];
+    int errcount = _read_porous_arrays(r, error_name);
+    for (int i = 0; i < 3; i++) {
+      const cs_field_t *f = cs_field_by_name_try(_scan_cache_fields[i]);
+      if (f == nullptr)
+        continue;
+      if (cs_restart_read_field_vals(r, f->id, 0) != CS_RESTART_SUCCESS) {
+        errcount += 1;
+        snprintf(error_name, 127, "%s", f->name);
+      }
+    }
+    if (errcount > 0) {
+      cs_base_warn(__FILE__, __LINE__);
+      cs_log_printf(CS_LOG_DEFAULT,
+                    _("\n Porosity from scan: cached array \"%s\" "
+                      "could not be read; results will be recomputed.\n\n"),
+                    error_name);
+      is_valid = false;
+    }
+  }
+  else
+    bft_printf(_("  Porosity from scan: cached results in \"%s\" do not\n"
+                 "  match the current scan files, options, or mesh.\n\n"),
+               cache_dir);
+
+  cs_restart_destroy(&r);
+
+  if (is_valid)
+    bft_printf(_("  Porosity from scan: using cached results from\n"
+                 "    \"%s/%s\" (key %s)\n"
+                 "  for scan files \"%s\".\n\n"),
+               cache_dir, _SCAN_CACHE_NAME, key,
+               _porosity_from_scan_opt.file_names);
+
+  return is_valid;
+}
+
+/*----------------------------------------------------------------------------
+ * Write porosity from scan results to cache.
+ *
+ * parameters:
+ *   key  <-- cache key
+ *----------------------------------------------------------------------------*/
+
+static void
+_scan_cache_write(const char  *key)
+{
+  const char *cache_dir = _porosity_from_scan_opt.cache_dir;
+
+  /* Replace previous results, without keeping a copy */
+
+  if (cs_glob_rank_id < 1) {
+    char *path;
+    CS_MALLOC(path, strlen(cache_dir) + strlen(_SCAN_CACHE_NAME) + 2, char);
+    sprintf(path, "%s/%s", cache_dir, _SCAN_CACHE_NAME);
+    if (cs_file_isreg(path))
+      remove(path);
+    CS_FREE(path);
+  }
+
+  cs_restart_t *r
+    = cs_restart_create(_SCAN_CACHE_NAME, cache_dir, CS_RESTART_MODE_WRITE);
+
+  cs_restart_write_section(r,
+                           "porosity_from_scan:key",
+                           CS_MESH_LOCATION_NONE,
+                           17,
+                           CS_TYPE_char,
+                           key);
+
+  _write_porous_arrays(r);
+
+  for (int i = 0; i < 3; i++) {
+    const cs_field_t *f = cs_field_by_name_try(_scan_cache_fields[i]);
+    if (f != nullptr)
+      cs_restart_write_field_vals(r, f->id, 0);
+  }
+
+  cs_restart_destroy(&r);
+
+  bft_printf(_("  Porosity from scan: results cached in\n"
+               "    \"%s/%s\" (key %s).\n\n"),
+             cache_dir, _SCAN_CACHE_NAME, key);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -973,6 +1575,31 @@ cs_porosity_from_scan_set_output_name(const char  *output_name)
   sprintf(_porosity_from_scan_opt.output_name, "%s", output_name);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set a directory in which porosity from scan results are cached.
+ *
+ * Results are written to this directory once computed, and reused by
+ * later computations with the same scan files, options, and mesh,
+ * skipping the reading of points and the fill computation. Scan files
+ * are identified by a hash of their full contents.
+ *
+ * \param[in] path  cache directory, or nullptr to disable caching
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_porosity_from_scan_set_cache_dir(const char  *path)
+{
+  CS_FREE(_porosity_from_scan_opt.cache_dir);
+
+  if (path == nullptr)
+    return;
+
+  CS_MALLOC(_porosity_from_scan_opt.cache_dir, strlen(path) + 1, char);
+  strcpy(_porosity_from_scan_opt.cache_dir, path);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Add a scanner source point.
@@ -1117,6 +1744,22 @@ cs_compute_porosity_from_scan(void)
   cs_lnum_t *source_c_ids = _porosity_from_scan_opt.source_c_ids;
   int nb_sources = _porosity_from_scan_opt.nb_sources;
 
+  /* Reuse cached results if available */
+
+  char cache_key[17] = "";
+
+  if (_porosity_from_scan_opt.cache_dir != nullptr) {
+    _scan_cache_key(m, cache_key);
+    if (_scan_cache_read(cache_key)) {
+      CS_FREE(_porosity_from_scan_opt.output_name);
+      CS_FREE(_porosity_from_scan_opt.file_names);
+      CS_FREE(_porosity_from_scan_opt.sources);
+      CS_FREE(_porosity_from_scan_opt.source_c_ids);
+      CS_FREE(_porosity_from_scan_opt.cache_dir);
+      return;
+    }
+  }
+
   /* First pass to put fluid surfaces to 0 for all faces' cells with
    * at least some points */
   _prepare_porosity_from_scan(m, mq);
@@ -1470,12 +2113,16 @@ cs_compute_porosity_from_scan(void)
     }
   }
 
+  if (_porosity_from_scan_opt.cache_dir != nullptr)
+    _scan_cache_write(cache_key);
+
   /* Free memory */
 
   CS_FREE(_porosity_from_scan_opt.output_name);
   CS_FREE(_porosity_from_scan_opt.file_names);
   CS_FREE(_porosity_from_scan_opt.sources);
   CS_FREE(_porosity_from_scan_opt.source_c_ids);
+  CS_FREE(_porosity_from_scan_opt.cache_dir);
 
   CS_FREE_HD(grdporo);
   CS_FREE_HD(rovsdt);
@@ -1497,8 +2144,6 @@ cs_porous_model_write(void) {
       && !(cs_glob_porosity_from_scan_opt->compute_porosity_from_scan))
     return;
 
-  cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
-
   cs_log_printf(CS_LOG_DEFAULT,
                 _("   ** Writing the porous restart file\n"
                   "-------------------------------------\n"));
@@ -1506,15 +2151,7 @@ cs_porous_model_write(void) {
   cs_restart_t *porous_restart
     = cs_restart_create("ibm.csc", nullptr, CS_RESTART_MODE_WRITE);
 
-  cs_restart_write_fields(porous_restart, CS_RESTART_IBM);
-
-  /* Store some useful mesh quantities arrays (not a field) */
-  cs_restart_write_section(porous_restart,
-                           "c_disable_flag::vals::0",
-                           CS_MESH_LOCATION_CELLS,
-                           1,
-                           CS_TYPE_int,
-                           mq->c_disable_flag);
+  _write_porous_arrays(porous_restart);
 
   cs_restart_destroy(&porous_restart);
 
@@ -1533,59 +2170,16 @@ cs_porous_model_read(void) {
       && !(cs_glob_porosity_from_scan_opt->compute_porosity_from_scan))
     return;
 
-  cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
   char error_name[128];
 
   cs_log_printf(CS_LOG_DEFAULT,
                 _(" \nReading the porous restart file\n"
                   " -------------------------------\n"));
 
-  int errcount = 0;
-
-  const char *new_sec_name[] = {"c_w_face_normal",
-                                "cell_scan_points_cog"};
-
   cs_restart_t *porous_restart
     = cs_restart_create("ibm.csc", nullptr, CS_RESTART_MODE_READ);
 
-  cs_restart_read_fields(porous_restart, CS_RESTART_IBM);
-
-  /* Read some useful mesh quantities arrays (not a field) */
-
-  int ierr = cs_restart_read_section(porous_restart,
-                                     "c_disable_flag::vals::0",
-                                     CS_MESH_LOCATION_CELLS,
-                                     1,
-                                     CS_TYPE_int,
-                                     mq->c_disable_flag);
-
-  if (ierr != CS_RESTART_SUCCESS) {
-    errcount += 1;
-    snprintf(error_name, 127, "%s", "c_disable_flag");
-  }
-
-  /* Check if all all porous arrays are read successfully */
-
-  for (int i = 0; i < 2; i++) {
-
-    cs_field_t *f = cs_field_by_name(new_sec_name[i]);
-
-    char sec_name[128];
-    snprintf(sec_name, 127, "%s::vals::%d", new_sec_name[i], 0);
-
-    int retval = cs_restart_check_section(porous_restart,
-                                          sec_name,
-                                          f->location_id,
-                                          f->dim,
-                                          CS_TYPE_cs_real_t);
-
-    if (retval != CS_RESTART_SUCCESS) {
-      errcount += 1;
-      snprintf(error_name, 127, "%s", new_sec_name[i]);
-    }
-  }
-
-  cs_parall_sum(1, CS_INT_TYPE, &errcount);
+  int errcount = _read_porous_arrays(porous_restart, error_name);
 
   if (errcount > 0) {
     cs_base_warn(__FILE__, __LINE__);
@@ -111,6 +111,8 @@ typedef struct {
   cs_real_t eigenvalue_criteria;
   int       use_restart;
   cs_ibm_cog_location_t cog_location;
+  char     *cache_dir;          /*!< directory for cached results,
+                                     or nullptr */
 } cs_porosity_from_scan_opt_t;
 
 /*============================================================================
@@ -151,6 +153,22 @@ cs_porosity_from_scan_set_file_name(const char  *file_name);
 void
 cs_porosity_from_scan_set_output_name(const char  *output_name);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set a directory in which porosity from scan results are cached.
+ *
+ * Results are written to this directory once computed, and reused by
+ * later computations with the same scan files, options, and mesh,
+ * skipping the reading of points and the fill computation. Scan files
+ * are identified by a hash of their full contents.
+ *
+ * \param[in] path  cache directory, or nullptr to disable caching
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_porosity_from_scan_set_cache_dir(const char  *path);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Add a scanner source point.
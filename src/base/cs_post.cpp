@@ -49,6 +49,7 @@
 #include "base/cs_array.h"
 #include "base/cs_base.h"
 #include "base/cs_boundary_zone.h"
+#include "base/cs_comm_profile.h"
 #include "base/cs_field.h"
 #include "base/cs_field_operator.h"
 #include "base/cs_file.h"
@@ -69,6 +70,7 @@
 #include "base/cs_time_control.h"
 #include "base/cs_timer.h"
 #include "base/cs_timer_stats.h"
+#include "base/cs_trace.h"
 #include "base/cs_volume_zone.h"
 
 /*----------------------------------------------------------------------------
@@ -6067,11 +6069,16 @@ cs_post_add_writer_t_value(int     writer_id,
 void
 cs_post_write_meshes(const cs_time_step_t  *ts)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_POST);
+  cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_POST);
+
   int  i;
   cs_post_mesh_t  *post_mesh;
 
   int t_top_id = cs_timer_stats_switch(_post_out_stat_id);
 
+  cs_trace_begin("post", "post-processing mesh output");
+
   /* First loop on meshes, for probes and profiles (which must not be
      "reduced" afer first output, as coordinates may be required for
      interpolation, and also and share volume or surface location meshes) */
@@ -6095,6 +6102,8 @@ cs_post_write_meshes(const cs_time_step_t  *ts)
       fvm_nodal_reduce(post_mesh->_exp_mesh, 0);
   }
 
+  cs_trace_end();
+
   cs_timer_stats_switch(t_top_id);
 }
 
@@ -7054,14 +7063,26 @@ cs_post_write_probe_values(int                              mesh_id,
                                   point_coords);
     }
 
-    _interpolate_func(interpolate_input,
-                      datatype,
-                      var_dim,
-                      n_points,
-                      elt_ids,
-                      (const cs_real_3_t *)point_coords,
-                      vals,
-                      _vals);
+    if (   _interpolate_func == cs_interpolate_from_location_p1
+        && parent_location_id == CS_MESH_LOCATION_CELLS)
+      cs_probe_set_interpolate_p1(pset,
+                                  interpolate_input,
+                                  datatype,
+                                  var_dim,
+                                  n_points,
+                                  elt_ids,
+                                  (const cs_real_3_t *)point_coords,
+                                  vals,
+                                  _vals);
+    else
+      _interpolate_func(interpolate_input,
+                        datatype,
+                        var_dim,
+                        n_points,
+                        elt_ids,
+                        (const cs_real_3_t *)point_coords,
+                        vals,
+                        _vals);
     var_ptr[0] = _vals;
 
     CS_FREE(point_coords);
@@ -7211,14 +7232,26 @@ cs_post_write_probe_function(int                              mesh_id,
                            nullptr,
                            _p_vals);
 
-      _interpolate_func(interpolate_input,
-                        f->datatype,
-                        f->dim,
-                        n_points,
-                        elt_ids,
-                        (const cs_real_3_t *)point_coords,
-                        _p_vals,
-                        _vals);
+      if (   _interpolate_func == cs_interpolate_from_location_p1
+          && parent_location_id == CS_MESH_LOCATION_CELLS)
+        cs_probe_set_interpolate_p1(pset,
+                                    interpolate_input,
+                                    f->datatype,
+                                    f->dim,
+                                    n_points,
+                                    elt_ids,
+                                    (const cs_real_3_t *)point_coords,
+                                    _p_vals,
+                                    _vals);
+      else
+        _interpolate_func(interpolate_input,
+                          f->datatype,
+                          f->dim,
+                          n_points,
+                          elt_ids,
+                          (const cs_real_3_t *)point_coords,
+                          _p_vals,
+                          _vals);
 
       CS_FREE(_p_vals);
     }
@@ -7600,6 +7633,9 @@ cs_post_init_writers(void)
 void
 cs_post_init_meshes(int check_mask)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_POST);
+  cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_POST);
+
   { /* Definition of default post-processing meshes if this has not been
        done yet */
 
@@ -8137,6 +8173,11 @@ cs_post_time_step_end(void)
 void
 cs_post_write_vars(const cs_time_step_t  *ts)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_POST);
+  cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_POST);
+
+  cs_trace_begin("post", "post-processing output");
+
   /* Output meshes if needed */
 
   _update_meshes(ts);
@@ -8148,6 +8189,8 @@ cs_post_write_vars(const cs_time_step_t  *ts)
   /* Flush writers and free time-varying and Lagragian mesh if needed */
 
   cs_post_time_step_end();
+
+  cs_trace_end();
 }
 
 /*----------------------------------------------------------------------------*/
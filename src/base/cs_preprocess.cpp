@@ -219,6 +219,8 @@ cs_preprocess_mesh_define(void)
 void
 cs_preprocess_mesh(cs_halo_type_t   halo_type)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_MESH);
+
   double t_start;
   t_start = cs_timer_wtime();
 
@@ -181,8 +181,9 @@ _hydrostatic_pressure_compute(const cs_mesh_t       *m,
   int *c_disable_flag = mq->c_disable_flag;
   cs_lnum_t has_dc = mq->has_disable_flag;
 
-  const int ksinfo = cs_field_key_id("solving_info");
-  cs_field_t *f = cs_field_by_name_try("hydrostatic_pressure");
+  static const int ksinfo = cs_field_key_id("solving_info");
+  static cs_field_handle_t h_hp = CS_FIELD_HANDLE("hydrostatic_pressure");
+  cs_field_t *f = cs_field_by_handle_try(&h_hp);
   cs_solving_info_t *sinfo =
     static_cast<cs_solving_info_t*>(cs_field_get_key_struct_ptr(f, ksinfo));
   const cs_equation_param_t *eqp_pr = cs_field_get_equation_param_const(f);
@@ -603,7 +604,8 @@ _pressure_correction_fv(int                   iterns,
   cs_real_6_t *vitenp = nullptr;
   cs_real_t *taui = nullptr, *taub = nullptr;
 
-  cs_field_t  *f_hp = cs_field_by_name_try("hydrostatic_pressure");
+  static cs_field_handle_t h_hp = CS_FIELD_HANDLE("hydrostatic_pressure");
+  cs_field_t  *f_hp = cs_field_by_handle_try(&h_hp);
   if (f_hp != nullptr) {
     cvar_hydro_pres = f_hp->vals[0];
     cvar_hydro_pres_prev = f_hp->vals[1];
@@ -641,20 +643,21 @@ _pressure_correction_fv(int                   iterns,
     vitenp = (cs_real_6_t *)(cs_field_by_name("dttens")->val);
 
   /* Index of the field */
-  const int ksinfo = cs_field_key_id("solving_info");
+  static const int ksinfo = cs_field_key_id("solving_info");
   cs_solving_info_t *sinfo
     = static_cast<cs_solving_info_t*>(cs_field_get_key_struct_ptr(f_p, ksinfo));
 
   cs_field_t *f_weight = nullptr;
   if (eqp_p->iwgrec == 1) {
     /* Weighting field for gradient */
-    int kwgrec = cs_field_key_id("gradient_weighting_id");
+    static const int kwgrec = cs_field_key_id("gradient_weighting_id");
     f_weight = cs_field_by_id(cs_field_get_key_int(f_p, kwgrec));
   }
 
   cs_real_t *cpro_divu = nullptr, *_cpro_divu = nullptr;
-  cs_field_t *f_divu
-    = cs_field_by_name_try("algo:predicted_velocity_divergence");
+  static cs_field_handle_t h_divu
+    = CS_FIELD_HANDLE("algo:predicted_velocity_divergence");
+  cs_field_t *f_divu = cs_field_by_handle_try(&h_divu);
   if (f_divu != nullptr)
     cpro_divu = f_divu->val;
   else {
@@ -736,8 +739,8 @@ _pressure_correction_fv(int                   iterns,
   cs_real_t *cvar_pr = f_p->vals[0];
   cs_real_t *cvara_pr = f_p->vals[1];
 
-  const int kimasf = cs_field_key_id("inner_mass_flux_id");
-  const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
+  static const int kimasf = cs_field_key_id("inner_mass_flux_id");
+  static const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
 
   cs_real_t *imasfl = cs_field_by_id(cs_field_get_key_int(f_p, kimasf))->val;
   cs_real_t *bmasfl = cs_field_by_id(cs_field_get_key_int(f_p, kbmasf))->val;
@@ -2449,7 +2452,10 @@ _pressure_correction_fv(int                   iterns,
 
   /* Compute the indicator, taken the volume into account (L2 norm) or not */
 
-  cs_field_t *f_err_est = cs_field_by_name_try("est_error_der_1");
+  static cs_field_handle_t h_est_der_1 = CS_FIELD_HANDLE("est_error_der_1");
+  static cs_field_handle_t h_est_der_2 = CS_FIELD_HANDLE("est_error_der_2");
+
+  cs_field_t *f_err_est = cs_field_by_handle_try(&h_est_der_1);
   if (f_err_est != nullptr) {
     cs_real_t *c_estim_der = f_err_est->val;
     const cs_real_t *restrict cell_vol = fvq->cell_vol;
@@ -2458,7 +2464,7 @@ _pressure_correction_fv(int                   iterns,
       c_estim_der[c_id] = cs::abs(rhs[c_id]) / cell_vol[c_id];
     });
   }
-  f_err_est = cs_field_by_name_try("est_error_der_2");
+  f_err_est = cs_field_by_handle_try(&h_est_der_2);
   if (f_err_est != nullptr) {
     cs_real_t *c_estim_der = f_err_est->val;
     const cs_real_t *restrict cell_vol = fvq->cell_vol;
@@ -2660,7 +2666,8 @@ _pressure_correction_fv(int                   iterns,
   CS_FREE_HD(dc2);
 
   /* Compute the isobaric heat capacity if needed */
-  cs_field_t  *f_cv = cs_field_by_name_try("isobaric_heat_capacity");
+  static cs_field_handle_t h_cv = CS_FIELD_HANDLE("isobaric_heat_capacity");
+  cs_field_t  *f_cv = cs_field_by_handle_try(&h_cv);
   if (f_cv != nullptr) {
      cs_thermal_model_cv(f_cv->val);
   }
@@ -2687,7 +2694,8 @@ _pressure_correction_fv(int                   iterns,
   if (idilat == 2 && ieos != CS_EOS_NONE) {
     /* CFL conditions related to the pressure equation */
     cs_real_t *cflp = nullptr;
-    cs_field_t *f_cflp = cs_field_by_name_try("algo:cfl_p");
+    static cs_field_handle_t h_cflp = CS_FIELD_HANDLE("algo:cfl_p");
+    cs_field_t *f_cflp = cs_field_by_handle_try(&h_cflp);
     if (f_cflp != nullptr) {
       cflp = f_cflp->val;
 
@@ -2836,7 +2844,7 @@ _pressure_correction_cdo(cs_real_t              vel[][3],
   cs_real_t  *c_visc = dt;
 
   /* Index of the field */
-  const int ksinfo = cs_field_key_id("solving_info");
+  static const int ksinfo = cs_field_key_id("solving_info");
   cs_solving_info_t  *sinfo
     = static_cast<cs_solving_info_t*>(cs_field_get_key_struct_ptr(f_p, ksinfo));
 
@@ -2849,8 +2857,8 @@ _pressure_correction_cdo(cs_real_t              vel[][3],
 
   cs_real_t  *cvar_pr = f_p->vals[0];
 
-  const int  kimasf = cs_field_key_id("inner_mass_flux_id");
-  const int  kbmasf = cs_field_key_id("boundary_mass_flux_id");
+  static const int  kimasf = cs_field_key_id("inner_mass_flux_id");
+  static const int  kbmasf = cs_field_key_id("boundary_mass_flux_id");
 
   cs_real_t  *imasfl = cs_field_by_id(cs_field_get_key_int(f_p, kimasf))->val;
   cs_real_t  *bmasfl = cs_field_by_id(cs_field_get_key_int(f_p, kbmasf))->val;
@@ -46,10 +46,12 @@
 #include "fvm/fvm_point_location.h"
 
 #include "base/cs_base.h"
+#include "base/cs_interpolate.h"
 #include "base/cs_map.h"
 #include "base/cs_math.h"
 #include "base/cs_mem.h"
 #include "mesh/cs_mesh.h"
+#include "mesh/cs_mesh_adjacencies.h"
 #include "mesh/cs_mesh_connect.h"
 #include "mesh/cs_mesh_location.h"
 #include "mesh/cs_mesh_quantities.h"
@@ -95,10 +97,36 @@ BEGIN_C_DECLS
 #define CS_PROBE_AUTO_S      (1 << 5) //  32: output curvilinear coordinates
 #define CS_PROBE_AUTO_COORD  (1 << 6) //  64: output cartesian coordinates
 
+/* Number of cached P1 interpolation stencils per probe set
+   (postprocessing and spectra may use snapped and raw coordinates) */
+
+#define CS_PROBE_N_P1_STENCILS  2
+
 /*=============================================================================
  * Local Structure Definitions
  *============================================================================*/
 
+/* Cached P1 interpolation stencil for a set of points:
+   value at point i is v[c] + sum_j w[j].(v[c_j] - v[c]), with c the
+   containing cell and c_j neighbors used for gradient reconstruction */
+
+typedef struct {
+
+  int           halo_type;      /* halo type of stencil, or -1 if not built */
+  unsigned      last_use;       /* counter value at last use */
+  cs_real_3_t  *coords;         /* interpolation point coordinates used to
+                                   build stencil (size: n_loc_probes) */
+  cs_lnum_t    *idx;            /* stencil index (size: n_loc_probes + 1) */
+  cs_lnum_t    *c_id;           /* stencil neighbor cell ids */
+  cs_real_t    *w;              /* stencil neighbor weights */
+  cs_lnum_t     n_generic;      /* number of points requiring generic
+                                   interpolation (cells with boundary faces,
+                                   whose stencil depends on the field) */
+  cs_lnum_t    *generic_id;     /* ids of points requiring generic
+                                   interpolation */
+
+} _p1_stencil_t;
+
 /* Structure to handle a set of probes */
 
 struct _cs_probe_set_t {
@@ -155,6 +183,13 @@ struct _cs_probe_set_t {
   int           interpolation;  /* 0: no interpolation;
                                    1: local gradient-based interpolation */
 
+  /* Cached P1 interpolation stencils, built on first use after location,
+     one per set of interpolation point coordinates (least recently used
+     stencil replaced when coordinates do not match any cached one) */
+
+  unsigned       p1_n_uses;     /* stencil use counter */
+  _p1_stencil_t  p1[CS_PROBE_N_P1_STENCILS];
+
   /* User-defined writers associated to this set of probes */
 
   int           n_writers;      /* Number of writers (-1 if unset) */
@@ -288,6 +323,219 @@ _copy_label(const char  *name)
   return label;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Initialize or free a cached P1 interpolation stencil
+ *
+ * \param[in, out]  st  pointer to stencil structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_p1_stencil_free(_p1_stencil_t  *st)
+{
+  st->halo_type = -1;
+  st->last_use = 0;
+  st->n_generic = 0;
+
+  CS_FREE(st->coords);
+  CS_FREE(st->idx);
+  CS_FREE(st->c_id);
+  CS_FREE(st->w);
+  CS_FREE(st->generic_id);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free cached P1 interpolation stencils of a set of probes
+ *
+ * \param[in, out]  pset          pointer to a cs_probe_set_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_p1_stencils_free(cs_probe_set_t   *pset)
+{
+  pset->p1_n_uses = 0;
+
+  for (int i = 0; i < CS_PROBE_N_P1_STENCILS; i++)
+    _p1_stencil_free(pset->p1 + i);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check whether two sets of point coordinates match, up to
+ *         a relative tolerance (to allow for rounding in copies).
+ *
+ * \param[in]  n_points  number of points
+ * \param[in]  a         first set of point coordinates
+ * \param[in]  b         second set of point coordinates
+ *
+ * \return  true if coordinates match, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_p1_coords_match(cs_lnum_t          n_points,
+                 const cs_real_3_t  a[],
+                 const cs_real_3_t  b[])
+{
+  const cs_real_t tol = 1e-12;
+
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+    for (int k = 0; k < 3; k++) {
+      const cs_real_t d = cs::abs(a[i][k] - b[i][k]);
+      if (d > tol*(cs::abs(a[i][k]) + cs::abs(b[i][k])))
+        return false;
+    }
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build cached P1 interpolation stencils of a set of probes.
+ *
+ * The stencil weights are those of the cell-based least-squares gradient
+ * (see \ref cs_gradient_scalar_cell) combined with the probe's offset from
+ * the cell center. For cells with boundary faces, the gradient depends on
+ * the field's boundary conditions, so those probes are only marked for
+ * generic interpolation.
+ *
+ * \param[in, out]  st            pointer to stencil structure
+ * \param[in]       n_points      number of probes
+ * \param[in]       halo_type     halo type (cell neighborhood)
+ * \param[in]       elt_ids       ids of cells containing probes, or -1
+ * \param[in]       point_coords  probe coordinates
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_p1_stencil_build(_p1_stencil_t      *st,
+                  cs_lnum_t           n_points,
+                  cs_halo_type_t      halo_type,
+                  const cs_lnum_t     elt_ids[],
+                  const cs_real_3_t   point_coords[])
+{
+  const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+  const cs_real_3_t *cell_cen = cs_glob_mesh_quantities->cell_cen;
+
+  const cs_lnum_t *cell_cells_idx[2] = {ma->cell_cells_idx, nullptr};
+  const cs_lnum_t *cell_cells[2] = {ma->cell_cells, nullptr};
+  int n_adj = 1;
+  if (halo_type == CS_HALO_EXTENDED && ma->cell_cells_e_idx != nullptr) {
+    cell_cells_idx[1] = ma->cell_cells_e_idx;
+    cell_cells[1] = ma->cell_cells_e;
+    n_adj = 2;
+  }
+
+  _p1_stencil_free(st);
+
+  st->halo_type = halo_type;
+
+  CS_MALLOC(st->coords, n_points, cs_real_3_t);
+  memcpy(st->coords, point_coords, n_points*sizeof(cs_real_3_t));
+
+  /* Count stencil sizes */
+
+  CS_MALLOC(st->idx, n_points + 1, cs_lnum_t);
+  CS_MALLOC(st->generic_id, n_points, cs_lnum_t);
+
+  cs_lnum_t *p1_idx = st->idx;
+  p1_idx[0] = 0;
+
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+    const cs_lnum_t c_id = elt_ids[i];
+    cs_lnum_t n = 0;
+    if (c_id > -1) {
+      bool on_boundary
+        = (ma->cell_b_faces_idx[c_id+1] > ma->cell_b_faces_idx[c_id]);
+      if (ma->cell_hb_faces_idx != nullptr)
+        on_boundary =    on_boundary
+                      || (  ma->cell_hb_faces_idx[c_id+1]
+                          > ma->cell_hb_faces_idx[c_id]);
+      if (on_boundary)
+        st->generic_id[st->n_generic++] = i;
+      else {
+        for (int adj_id = 0; adj_id < n_adj; adj_id++)
+          n += cell_cells_idx[adj_id][c_id+1] - cell_cells_idx[adj_id][c_id];
+      }
+    }
+    p1_idx[i+1] = p1_idx[i] + n;
+  }
+
+  CS_REALLOC(st->generic_id, st->n_generic, cs_lnum_t);
+  CS_MALLOC(st->c_id, p1_idx[n_points], cs_lnum_t);
+  CS_MALLOC(st->w, p1_idx[n_points], cs_real_t);
+
+  /* Compute weights */
+
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+
+    if (p1_idx[i+1] == p1_idx[i])
+      continue;
+
+    const cs_lnum_t c_id = elt_ids[i];
+    cs_lnum_t *c_ids = st->c_id + p1_idx[i];
+    cs_real_t *w = st->w + p1_idx[i];
+
+    cs_real_t cocg[6] = {0., 0., 0., 0., 0., 0.};
+
+    cs_lnum_t k = 0;
+    for (int adj_id = 0; adj_id < n_adj; adj_id++) {
+      const cs_lnum_t s_id = cell_cells_idx[adj_id][c_id];
+      const cs_lnum_t e_id = cell_cells_idx[adj_id][c_id+1];
+      for (cs_lnum_t j = s_id; j < e_id; j++) {
+        cs_lnum_t c_id1 = cell_cells[adj_id][j];
+        cs_real_t dc[3];
+        for (int ll = 0; ll < 3; ll++)
+          dc[ll] = cell_cen[c_id1][ll] - cell_cen[c_id][ll];
+        cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+        cocg[0] += dc[0]*dc[0]*ddc;
+        cocg[1] += dc[1]*dc[1]*ddc;
+        cocg[2] += dc[2]*dc[2]*ddc;
+        cocg[3] += dc[0]*dc[1]*ddc;
+        cocg[4] += dc[1]*dc[2]*ddc;
+        cocg[5] += dc[0]*dc[2]*ddc;
+
+        c_ids[k++] = c_id1;
+      }
+    }
+
+    /* Solve cocg.q = d (with d the probe offset), so that
+       grad.d = sum_j (q.dc_j)*ddc_j*(v_j - v_c) */
+
+    cs_real_t a00 = cocg[1]*cocg[2] - cocg[4]*cocg[4];
+    cs_real_t a01 = cocg[4]*cocg[5] - cocg[3]*cocg[2];
+    cs_real_t a02 = cocg[3]*cocg[4] - cocg[1]*cocg[5];
+    cs_real_t a11 = cocg[0]*cocg[2] - cocg[5]*cocg[5];
+    cs_real_t a12 = cocg[3]*cocg[5] - cocg[0]*cocg[4];
+    cs_real_t a22 = cocg[0]*cocg[1] - cocg[3]*cocg[3];
+
+    cs_real_t det_inv = 1. / (cocg[0]*a00 + cocg[3]*a01 + cocg[5]*a02);
+
+    cs_real_t d[3];
+    for (int ll = 0; ll < 3; ll++)
+      d[ll] = point_coords[i][ll] - cell_cen[c_id][ll];
+
+    cs_real_t q[3] = {(a00*d[0] + a01*d[1] + a02*d[2]) * det_inv,
+                      (a01*d[0] + a11*d[1] + a12*d[2]) * det_inv,
+                      (a02*d[0] + a12*d[1] + a22*d[2]) * det_inv};
+
+    for (cs_lnum_t j = 0; j < k; j++) {
+      cs_lnum_t c_id1 = c_ids[j];
+      cs_real_t dc[3];
+      for (int ll = 0; ll < 3; ll++)
+        dc[ll] = cell_cen[c_id1][ll] - cell_cen[c_id][ll];
+      cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+      w[j] = (q[0]*dc[0] + q[1]*dc[1] + q[2]*dc[2]) * ddc;
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Free a cs_probe_set_t structure
@@ -312,6 +560,8 @@ _probe_set_free(cs_probe_set_t   *pset)
   CS_FREE(pset->vtx_id);
   CS_FREE(pset->located);
 
+  _p1_stencils_free(pset);
+
   CS_FREE(pset->_p_define_input);
 
   if (pset->labels != nullptr) {
@@ -403,6 +653,17 @@ _probe_set_create(const char    *name,
 
   pset->interpolation = 0;
 
+  pset->p1_n_uses = 0;
+  for (int i = 0; i < CS_PROBE_N_P1_STENCILS; i++) {
+    _p1_stencil_t *st = pset->p1 + i;
+    st->coords = nullptr;
+    st->idx = nullptr;
+    st->c_id = nullptr;
+    st->w = nullptr;
+    st->generic_id = nullptr;
+    _p1_stencil_free(st);
+  }
+
   pset->n_writers = -1;
   pset->writer_ids = nullptr;
 
@@ -1573,6 +1834,8 @@ cs_probe_set_locate(cs_probe_set_t     *pset,
   CS_FREE(pset->cell_id);
   CS_FREE(pset->vtx_id);
 
+  _p1_stencils_free(pset);
+
   if (location_mesh == nullptr) {
 
     cs_lnum_t  n_select_elements = 0;
@@ -2170,6 +2433,30 @@ cs_probe_set_get_n_local(const cs_probe_set_t   *pset)
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the ids (in the full probe set) of probes located in the
+ *         local domain.
+ *
+ * \param[in]       pset       pointer to a cs_probe_set_t structure
+ *
+ * \return  pointer to ids of local probes (size: n_local), or null
+ *          if the probe set has not been located yet or has no
+ *          local probes
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_lnum_t *
+cs_probe_set_get_loc_ids(const cs_probe_set_t   *pset)
+{
+  const cs_lnum_t *retval = nullptr;
+
+  if (pset != nullptr)
+    retval = pset->loc_id;
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Return the list of curvilinear abscissa for the given probe set
@@ -2288,6 +2575,161 @@ cs_probe_set_get_elt_ids(const cs_probe_set_t  *pset,
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Interpolate cell-based values at the probes of a set using a
+ *         P1 interpolation, with cached stencils.
+ *
+ * This function is equivalent to \ref cs_interpolate_from_location_p1,
+ * but the stencils and weights of probes located in cells without boundary
+ * faces are computed on first use after each location and reused for
+ * subsequent calls with the same point coordinates (and fields using the
+ * same gradient neighborhood). Separate stencils are cached for the
+ * snapped and raw probe coordinates, so callers using either one (such as
+ * postprocessing and spectra) do not cause stencils to be rebuilt.
+ * Other cases are handled using \ref cs_interpolate_from_location_p1.
+ *
+ * \param[in, out]  pset            pointer to a cs_probe_set_t structure
+ * \param[in, out]  input           pointer to optional (untyped) value
+ *                                  or structure (field name).
+ * \param[in]       datatype        associated datatype
+ * \param[in]       val_dim         dimension of data values
+ * \param[in]       n_points        number of interpolation points
+ * \param[in]       point_location  cells containing points
+ * \param[in]       point_coords    point coordinates
+ * \param[in]       location_vals   values at cells
+ * \param[out]      point_vals      interpolated values at points
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_probe_set_interpolate_p1(cs_probe_set_t     *pset,
+                            void               *input,
+                            cs_datatype_t       datatype,
+                            int                 val_dim,
+                            cs_lnum_t           n_points,
+                            const cs_lnum_t     point_location[],
+                            const cs_real_3_t   point_coords[],
+                            const void         *location_vals,
+                            void               *point_vals)
+{
+  /* Use generic interpolation when stencils may not be cached */
+
+  if (   pset == nullptr
+      || datatype != CS_REAL_TYPE
+      || (val_dim != 1 && val_dim != 3 && val_dim != 6)
+      || (pset->flags & CS_PROBE_BOUNDARY)
+      || cs_glob_mesh->time_dep != CS_MESH_FIXED
+      || n_points != pset->n_loc_probes
+      || point_location != pset->elt_id) {
+    cs_interpolate_from_location_p1(input,
+                                    datatype,
+                                    val_dim,
+                                    n_points,
+                                    point_location,
+                                    point_coords,
+                                    location_vals,
+                                    point_vals);
+    return;
+  }
+
+  /* Stencil weights depend on the interpolation point coordinates,
+     which may differ between callers (i.e. snapped or not), so look
+     for a matching cached stencil, or replace the least recently used */
+
+  const cs_halo_type_t halo_type = cs_interpolate_p1_halo_type(input);
+
+  _p1_stencil_t *st = nullptr;
+
+  for (int i = 0; i < CS_PROBE_N_P1_STENCILS && st == nullptr; i++) {
+    _p1_stencil_t *_st = pset->p1 + i;
+    if (   _st->halo_type == (int)halo_type
+        && _p1_coords_match(n_points, _st->coords, point_coords))
+      st = _st;
+  }
+
+  if (st == nullptr) {
+    st = pset->p1;
+    for (int i = 1; i < CS_PROBE_N_P1_STENCILS; i++) {
+      if (pset->p1[i].last_use < st->last_use)
+        st = pset->p1 + i;
+    }
+    _p1_stencil_build(st, n_points, halo_type, point_location, point_coords);
+  }
+
+  pset->p1_n_uses += 1;
+  st->last_use = pset->p1_n_uses;
+
+  /* Apply stencils */
+
+  const cs_lnum_t *p1_idx = st->idx;
+  const cs_lnum_t *p1_c_id = st->c_id;
+  const cs_real_t *p1_w = st->w;
+
+  const cs_real_t *c_vals = (const cs_real_t *)location_vals;
+  cs_real_t *p_vals = (cs_real_t *)point_vals;
+
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+    const cs_lnum_t c_id = point_location[i];
+    if (c_id > -1) {
+      const cs_lnum_t s_id = p1_idx[i], e_id = p1_idx[i+1];
+      for (int k = 0; k < val_dim; k++) {
+        const cs_real_t v_c = c_vals[c_id*val_dim + k];
+        cs_real_t v = v_c;
+        for (cs_lnum_t j = s_id; j < e_id; j++)
+          v += p1_w[j] * (c_vals[p1_c_id[j]*val_dim + k] - v_c);
+        p_vals[i*val_dim + k] = v;
+      }
+    }
+    else {
+      for (int k = 0; k < val_dim; k++)
+        p_vals[i*val_dim + k] = 0;
+    }
+  }
+
+  /* Probes in boundary cells use generic interpolation */
+
+  const cs_lnum_t n_generic = st->n_generic;
+
+  if (n_generic > 0) {
+
+    const cs_lnum_t *generic_id = st->generic_id;
+
+    cs_lnum_t *g_location;
+    cs_real_3_t *g_coords;
+    cs_real_t *g_vals;
+    CS_MALLOC(g_location, n_generic, cs_lnum_t);
+    CS_MALLOC(g_coords, n_generic, cs_real_3_t);
+    CS_MALLOC(g_vals, n_generic*val_dim, cs_real_t);
+
+    for (cs_lnum_t i = 0; i < n_generic; i++) {
+      const cs_lnum_t p_id = generic_id[i];
+      g_location[i] = point_location[p_id];
+      for (int k = 0; k < 3; k++)
+        g_coords[i][k] = point_coords[p_id][k];
+    }
+
+    cs_interpolate_from_location_p1(input,
+                                    datatype,
+                                    val_dim,
+                                    n_generic,
+                                    g_location,
+                                    g_coords,
+                                    location_vals,
+                                    g_vals);
+
+    for (cs_lnum_t i = 0; i < n_generic; i++) {
+      const cs_lnum_t p_id = generic_id[i];
+      for (int k = 0; k < val_dim; k++)
+        p_vals[p_id*val_dim + k] = g_vals[i*val_dim + k];
+    }
+
+    CS_FREE(g_vals);
+    CS_FREE(g_coords);
+    CS_FREE(g_location);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -598,6 +598,22 @@ cs_probe_set_get_members(const cs_probe_set_t   *pset,
 int
 cs_probe_set_get_n_local(const cs_probe_set_t   *pset);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the ids (in the full probe set) of probes located in the
+ *         local domain.
+ *
+ * \param[in]       pset       pointer to a cs_probe_set_t structure
+ *
+ * \return  pointer to ids of local probes (size: n_local), or null
+ *          if the probe set has not been located yet or has no
+ *          local probes
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_lnum_t *
+cs_probe_set_get_loc_ids(const cs_probe_set_t   *pset);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Return the list of curvilinear abscissa for the given probe set
@@ -644,6 +660,44 @@ const cs_lnum_t *
 cs_probe_set_get_elt_ids(const cs_probe_set_t  *pset,
                          int                    mesh_location_id);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Interpolate cell-based values at the probes of a set using a
+ *         P1 interpolation, with cached stencils.
+ *
+ * This function is equivalent to \ref cs_interpolate_from_location_p1,
+ * but the stencils and weights of probes located in cells without boundary
+ * faces are computed on first use after each location and reused for
+ * subsequent calls with the same point coordinates (and fields using the
+ * same gradient neighborhood). Separate stencils are cached for the
+ * snapped and raw probe coordinates, so callers using either one (such as
+ * postprocessing and spectra) do not cause stencils to be rebuilt.
+ * Other cases are handled using \ref cs_interpolate_from_location_p1.
+ *
+ * \param[in, out]  pset            pointer to a cs_probe_set_t structure
+ * \param[in, out]  input           pointer to optional (untyped) value
+ *                                  or structure (field name).
+ * \param[in]       datatype        associated datatype
+ * \param[in]       val_dim         dimension of data values
+ * \param[in]       n_points        number of interpolation points
+ * \param[in]       point_location  cells containing points
+ * \param[in]       point_coords    point coordinates
+ * \param[in]       location_vals   values at cells
+ * \param[out]      point_vals      interpolated values at points
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_probe_set_interpolate_p1(cs_probe_set_t     *pset,
+                            void               *input,
+                            cs_datatype_t       datatype,
+                            int                 val_dim,
+                            cs_lnum_t           n_points,
+                            const cs_lnum_t     point_location[],
+                            const cs_real_3_t   point_coords[],
+                            const void         *location_vals,
+                            void               *point_vals);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
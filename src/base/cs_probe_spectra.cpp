@@ -0,0 +1,1195 @@
+/*============================================================================
+ * In-situ spectra, correlations and statistics at probes.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2025 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "base/cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <errno.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft/bft_error.h"
+#include "bft/bft_printf.h"
+
+#include "base/cs_base.h"
+#include "base/cs_field.h"
+#include "base/cs_file.h"
+#include "base/cs_log.h"
+#include "base/cs_math.h"
+#include "base/cs_mem.h"
+#include "base/cs_parall.h"
+#include "base/cs_probe.h"
+#include "base/cs_restart.h"
+#include "base/cs_time_step.h"
+#include "mesh/cs_mesh_location.h"
+
+/*----------------------------------------------------------------------------
+ * Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "base/cs_probe_spectra.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_probe_spectra.cpp
+
+  \brief In-situ spectra, correlations and statistics at probes.
+
+  Values of a field component are sampled at the probes of a probe set
+  at each time step, and accumulated on the fly so that power spectral
+  densities (using Welch's method), running and sliding-window statistics,
+  and two-point correlations relative to a reference probe may be
+  output without writing the full time series.
+
+  Results are written in CSV format to the "monitoring" directory.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+typedef struct {
+
+  char        *name;            /* Definition name */
+  char        *pset_name;       /* Associated probe set name */
+
+  int          f_id;            /* Associated field id */
+  int          comp_id;         /* Sampled field component */
+  int          n_fft;           /* Number of samples per Welch segment */
+  int          n_freq;          /* Number of frequencies (n_fft/2 + 1) */
+  int          nt_output;       /* Output interval */
+
+  int          ref_probe_id;    /* Reference probe id for correlations */
+  int          n_lags;          /* Number of correlation lags */
+
+  /* Sampling state */
+
+  int          n_probes;        /* Number of probes in set */
+  cs_lnum_t    n_loc;           /* Number of local probes (-1 if not
+                                   initialized yet) */
+  cs_lnum_t   *loc_id;          /* Global ids of local probes */
+  cs_real_3_t *loc_coords;      /* Coordinates of local probes */
+  cs_real_t   *loc_vals;        /* Sampled values at local probes */
+
+  int          nt_last;         /* Time step of last sample */
+  int          n_samples;       /* Total number of samples */
+  int          n_segments;      /* Number of Welch segments */
+  double       t_first;         /* Time of first sample */
+  double       t_last;          /* Time of last sample */
+
+  cs_real_t   *buffer;          /* Ring buffer of last n_fft samples */
+  cs_real_t   *psd;             /* Accumulated periodograms */
+  cs_real_t   *mean;            /* Running mean */
+  cs_real_t   *m2;              /* Running sum of squared deviations */
+  cs_real_t   *ref_buffer;      /* Ring buffer of last reference values */
+  cs_real_t   *corr;            /* Accumulated lagged products */
+
+  /* Pending restart data (applied once probes are located) */
+
+  cs_real_t   *restart_data;
+
+} cs_probe_spectra_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static int                   _n_spectra = 0;
+static cs_probe_spectra_t   *_spectra = nullptr;
+
+/* FFT work arrays, shared by definitions with the same segment size */
+
+static int         _fft_n = 0;
+static int        *_fft_bit_rev = nullptr;
+static cs_real_t  *_fft_twiddle = nullptr;
+static cs_real_t  *_fft_window = nullptr;
+static cs_real_t  *_fft_work = nullptr;
+static cs_real_t   _fft_w_sum2 = 0;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Build FFT tables for a given segment size.
+ *
+ * parameters:
+ *   n <-- number of samples (power of 2)
+ *----------------------------------------------------------------------------*/
+
+static void
+_fft_tables(int  n)
+{
+  if (n == _fft_n)
+    return;
+
+  _fft_n = n;
+
+  CS_REALLOC(_fft_bit_rev, n, int);
+  CS_REALLOC(_fft_twiddle, n, cs_real_t);
+  CS_REALLOC(_fft_window, n, cs_real_t);
+  CS_REALLOC(_fft_work, 2*n, cs_real_t);
+
+  int log2n = 0;
+  while ((1 << log2n) < n)
+    log2n++;
+
+  for (int i = 0; i < n; i++) {
+    int r = 0;
+    for (int b = 0; b < log2n; b++) {
+      if ((i >> b) & 1)
+        r |= 1 << (log2n - 1 - b);
+    }
+    _fft_bit_rev[i] = r;
+  }
+
+  for (int k = 0; k < n/2; k++) {
+    _fft_twiddle[2*k]     =  cos(2.*cs_math_pi*k/n);
+    _fft_twiddle[2*k + 1] = -sin(2.*cs_math_pi*k/n);
+  }
+
+  /* Periodic Hann window, suited to Welch averaging */
+
+  _fft_w_sum2 = 0;
+  for (int i = 0; i < n; i++) {
+    _fft_window[i] = 0.5*(1. - cos(2.*cs_math_pi*i/n));
+    _fft_w_sum2 += _fft_window[i]*_fft_window[i];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * In-place iterative radix-2 FFT of interleaved complex values.
+ *
+ * parameters:
+ *   x <-> complex values (size: 2*_fft_n)
+ *----------------------------------------------------------------------------*/
+
+static void
+_fft(cs_real_t  x[])
+{
+  const int n = _fft_n;
+
+  for (int i = 0; i < n; i++) {
+    int j = _fft_bit_rev[i];
+    if (j > i) {
+      cs_real_t tr = x[2*i], ti = x[2*i + 1];
+      x[2*i] = x[2*j]; x[2*i + 1] = x[2*j + 1];
+      x[2*j] = tr; x[2*j + 1] = ti;
+    }
+  }
+
+  for (int len = 2; len <= n; len <<= 1) {
+    int half = len/2, stride = n/len;
+    for (int i = 0; i < n; i += len) {
+      for (int k = 0; k < half; k++) {
+        const cs_real_t wr = _fft_twiddle[2*k*stride];
+        const cs_real_t wi = _fft_twiddle[2*k*stride + 1];
+        int a = i + k, b = a + half;
+        cs_real_t tr = wr*x[2*b] - wi*x[2*b + 1];
+        cs_real_t ti = wr*x[2*b + 1] + wi*x[2*b];
+        x[2*b]     = x[2*a] - tr;
+        x[2*b + 1] = x[2*a + 1] - ti;
+        x[2*a]     += tr;
+        x[2*a + 1] += ti;
+      }
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Return a pointer to a probe set associated with a spectra definition.
+ *
+ * parameters:
+ *   s <-- pointer to spectra definition
+ *----------------------------------------------------------------------------*/
+
+static cs_probe_set_t *
+_probe_set(const cs_probe_spectra_t  *s)
+{
+  cs_probe_set_t *pset = cs_probe_set_get(s->pset_name);
+
+  if (pset == nullptr)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: probe set \"%s\" required by spectra \"%s\"\n"
+                "is not defined."),
+              __func__, s->pset_name, s->name);
+
+  return pset;
+}
+
+/*----------------------------------------------------------------------------
+ * Size of the restart record of each probe.
+ *
+ * parameters:
+ *   s <-- pointer to spectra definition
+ *----------------------------------------------------------------------------*/
+
+static int
+_probe_record_size(const cs_probe_spectra_t  *s)
+{
+  return s->n_fft + s->n_freq + 2 + s->n_lags;
+}
+
+/*----------------------------------------------------------------------------
+ * Gather per-probe records of local probes on rank 0.
+ *
+ * Only the records of probes located on each rank are exchanged, so
+ * the global array is only allocated on rank 0. Records of probes not
+ * located on any rank are set to 0.
+ *
+ * parameters:
+ *   s      <-- pointer to spectra definition
+ *   stride <-- number of values per probe
+ *   l_vals <-- values at local probes (size: n_loc*stride)
+ *
+ * returns:
+ *   values in global probe order on rank 0 (size: n_probes*stride),
+ *   or null on other ranks
+ *----------------------------------------------------------------------------*/
+
+static cs_real_t *
+_gather_to_root(const cs_probe_spectra_t  *s,
+                int                        stride,
+                const cs_real_t            l_vals[])
+{
+  cs_real_t *g_vals = nullptr;
+
+  cs_lnum_t n_recv = s->n_loc;
+  const cs_lnum_t *recv_id = s->loc_id;
+  const cs_real_t *recv_vals = l_vals;
+
+  if (cs_glob_rank_id < 1) {
+    const cs_lnum_t n_g_vals = (cs_lnum_t)(s->n_probes)*stride;
+    CS_MALLOC(g_vals, n_g_vals, cs_real_t);
+    for (cs_lnum_t i = 0; i < n_g_vals; i++)
+      g_vals[i] = 0.;
+  }
+
+#if defined(HAVE_MPI)
+
+  cs_lnum_t *_recv_id = nullptr;
+  cs_real_t *_recv_vals = nullptr;
+
+  if (cs_glob_n_ranks > 1) {
+
+    const int n_ranks = cs_glob_n_ranks;
+    int n_send = s->n_loc;
+    int *count = nullptr, *displ = nullptr;
+
+    n_recv = 0;
+
+    if (cs_glob_rank_id == 0) {
+      CS_MALLOC(count, n_ranks, int);
+      CS_MALLOC(displ, n_ranks, int);
+    }
+
+    MPI_Gather(&n_send, 1, MPI_INT, count, 1, MPI_INT, 0, cs_glob_mpi_comm);
+
+    if (cs_glob_rank_id == 0) {
+      for (int i = 0; i < n_ranks; i++) {
+        displ[i] = n_recv;
+        n_recv += count[i];
+      }
+      CS_MALLOC(_recv_id, n_recv, cs_lnum_t);
+      CS_MALLOC(_recv_vals, n_recv*stride, cs_real_t);
+    }
+
+    MPI_Gatherv(s->loc_id, n_send, CS_MPI_LNUM,
+                _recv_id, count, displ, CS_MPI_LNUM,
+                0, cs_glob_mpi_comm);
+
+    if (cs_glob_rank_id == 0) {
+      for (int i = 0; i < n_ranks; i++) {
+        count[i] *= stride;
+        displ[i] *= stride;
+      }
+    }
+
+    MPI_Gatherv(l_vals, n_send*stride, CS_MPI_REAL,
+                _recv_vals, count, displ, CS_MPI_REAL,
+                0, cs_glob_mpi_comm);
+
+    CS_FREE(displ);
+    CS_FREE(count);
+
+    recv_id = _recv_id;
+    recv_vals = _recv_vals;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  for (cs_lnum_t i = 0; i < n_recv; i++) {
+    cs_real_t *_g_vals = g_vals + (cs_lnum_t)(recv_id[i])*stride;
+    for (int j = 0; j < stride; j++)
+      _g_vals[j] = recv_vals[i*stride + j];
+  }
+
+#if defined(HAVE_MPI)
+  CS_FREE(_recv_vals);
+  CS_FREE(_recv_id);
+#endif
+
+  return g_vals;
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize sampling state of a spectra definition once probes are located.
+ *
+ * parameters:
+ *   s    <-> pointer to spectra definition
+ *   pset <-> associated probe set
+ *----------------------------------------------------------------------------*/
+
+static void
+_init_state(cs_probe_spectra_t  *s,
+            cs_probe_set_t      *pset)
+{
+  bool time_varying = false;
+  cs_probe_set_get_post_info(pset, &time_varying,
+                             nullptr, nullptr, nullptr, nullptr, nullptr,
+                             nullptr, nullptr);
+  if (time_varying)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: spectra \"%s\" require a fixed probe set,\n"
+                "but probe set \"%s\" is time-varying."),
+              __func__, s->name, s->pset_name);
+
+  /* Location is collective, and ids are null on ranks with no
+     local probes, so check the set is located on any rank. */
+
+  int located = (cs_probe_set_get_loc_ids(pset) != nullptr) ? 1 : 0;
+  cs_parall_max(1, CS_INT_TYPE, &located);
+  if (located == 0)
+    cs_probe_set_locate(pset, nullptr);
+
+  cs_probe_snap_t snap_mode;
+  cs_real_3_t *coords = nullptr;
+  cs_probe_set_get_members(pset, &snap_mode, &(s->n_probes), &coords);
+
+  if (s->ref_probe_id >= s->n_probes)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: reference probe id %d of spectra \"%s\" is not\n"
+                "in range [0, %d[ of probe set \"%s\"."),
+              __func__, s->ref_probe_id, s->name, s->n_probes,
+              s->pset_name);
+
+  const cs_lnum_t *loc_id = cs_probe_set_get_loc_ids(pset);
+
+  s->n_loc = cs_probe_set_get_n_local(pset);
+
+  CS_MALLOC(s->loc_id, s->n_loc, cs_lnum_t);
+  CS_MALLOC(s->loc_coords, s->n_loc, cs_real_3_t);
+  CS_MALLOC(s->loc_vals, s->n_loc, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < s->n_loc; i++) {
+    s->loc_id[i] = loc_id[i];
+    for (int j = 0; j < 3; j++)
+      s->loc_coords[i][j] = coords[loc_id[i]][j];
+  }
+
+  const cs_lnum_t n_loc = s->n_loc;
+
+  CS_MALLOC(s->buffer, n_loc*s->n_fft, cs_real_t);
+  CS_MALLOC(s->psd, n_loc*s->n_freq, cs_real_t);
+  CS_MALLOC(s->mean, n_loc, cs_real_t);
+  CS_MALLOC(s->m2, n_loc, cs_real_t);
+  CS_MALLOC(s->ref_buffer, s->n_lags, cs_real_t);
+  CS_MALLOC(s->corr, n_loc*s->n_lags, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_loc*s->n_fft; i++)
+    s->buffer[i] = 0.;
+  for (cs_lnum_t i = 0; i < n_loc*s->n_freq; i++)
+    s->psd[i] = 0.;
+  for (cs_lnum_t i = 0; i < n_loc; i++) {
+    s->mean[i] = 0.;
+    s->m2[i] = 0.;
+  }
+  for (int i = 0; i < s->n_lags; i++)
+    s->ref_buffer[i] = 0.;
+  for (cs_lnum_t i = 0; i < n_loc*s->n_lags; i++)
+    s->corr[i] = 0.;
+
+  /* Apply pending restart data */
+
+  if (s->restart_data != nullptr) {
+    const int rec_size = _probe_record_size(s);
+    for (cs_lnum_t i = 0; i < n_loc; i++) {
+      const cs_real_t *r = s->restart_data + (cs_lnum_t)loc_id[i]*rec_size;
+      for (int j = 0; j < s->n_fft; j++)
+        s->buffer[i*s->n_fft + j] = r[j];
+      r += s->n_fft;
+      for (int j = 0; j < s->n_freq; j++)
+        s->psd[i*s->n_freq + j] = r[j];
+      r += s->n_freq;
+      s->mean[i] = r[0];
+      s->m2[i] = r[1];
+      r += 2;
+      for (int j = 0; j < s->n_lags; j++)
+        s->corr[i*s->n_lags + j] = r[j];
+    }
+    const cs_real_t *r_ref = s->restart_data + s->n_probes*rec_size;
+    for (int j = 0; j < s->n_lags; j++)
+      s->ref_buffer[j] = r_ref[j];
+    CS_FREE(s->restart_data);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Sample field values at local probes.
+ *
+ * parameters:
+ *   s    <-> pointer to spectra definition
+ *   pset <-> associated probe set
+ *----------------------------------------------------------------------------*/
+
+static void
+_sample(cs_probe_spectra_t  *s,
+        cs_probe_set_t      *pset)
+{
+  const cs_field_t *f = cs_field_by_id(s->f_id);
+  const cs_lnum_t n_loc = s->n_loc;
+  const int dim = f->dim;
+
+  bool on_boundary = false;
+  cs_probe_set_get_post_info(pset, nullptr, &on_boundary,
+                             nullptr, nullptr, nullptr, nullptr,
+                             nullptr, nullptr);
+
+  const cs_lnum_t *elt_ids = cs_probe_set_get_elt_ids(pset, f->location_id);
+
+  if (elt_ids == nullptr && n_loc > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: field \"%s\" of spectra \"%s\" is not defined on a\n"
+                "location compatible with probe set \"%s\"."),
+              __func__, f->name, s->name, s->pset_name);
+
+  cs_real_t *p_vals = nullptr;
+  CS_MALLOC(p_vals, n_loc*dim, cs_real_t);
+
+  if (   f->location_id == CS_MESH_LOCATION_CELLS
+      && on_boundary == false
+      && cs_probe_set_get_interpolation(pset) == 1) {
+    char interpolate_input[96];
+    strncpy(interpolate_input, f->name, 95);
+    interpolate_input[95] = '\0';
+    cs_probe_set_interpolate_p1(pset,
+                                interpolate_input,
+                                CS_REAL_TYPE,
+                                dim,
+                                n_loc,
+                                elt_ids,
+                                (const cs_real_3_t *)s->loc_coords,
+                                f->val,
+                                p_vals);
+  }
+  else {
+    for (cs_lnum_t i = 0; i < n_loc; i++) {
+      cs_lnum_t e_id = elt_ids[i];
+      for (int j = 0; j < dim; j++)
+        p_vals[i*dim + j] = (e_id > -1) ? f->val[e_id*dim + j] : 0.;
+    }
+  }
+
+  for (cs_lnum_t i = 0; i < n_loc; i++)
+    s->loc_vals[i] = p_vals[i*dim + s->comp_id];
+
+  CS_FREE(p_vals);
+}
+
+/*----------------------------------------------------------------------------
+ * Accumulate the periodogram of the current segment at each local probe.
+ *
+ * parameters:
+ *   s <-> pointer to spectra definition
+ *----------------------------------------------------------------------------*/
+
+static void
+_accumulate_segment(cs_probe_spectra_t  *s)
+{
+  const int n = s->n_fft;
+  const int head = s->n_samples % n;
+
+  _fft_tables(n);
+
+  cs_real_t *x = _fft_work;
+
+  for (cs_lnum_t i = 0; i < s->n_loc; i++) {
+
+    const cs_real_t *b = s->buffer + i*n;
+
+    /* Remove segment mean to limit leakage from the zero frequency */
+
+    cs_real_t b_mean = 0.;
+    for (int j = 0; j < n; j++)
+      b_mean += b[j];
+    b_mean /= n;
+
+    for (int j = 0; j < n; j++) {
+      x[2*j]     = _fft_window[j] * (b[(head + j) % n] - b_mean);
+      x[2*j + 1] = 0.;
+    }
+
+    _fft(x);
+
+    cs_real_t *psd = s->psd + i*s->n_freq;
+    for (int k = 0; k < s->n_freq; k++)
+      psd[k] += x[2*k]*x[2*k] + x[2*k + 1]*x[2*k + 1];
+  }
+
+  s->n_segments += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Update a spectra definition with a new sample.
+ *
+ * parameters:
+ *   s <-> pointer to spectra definition
+ *----------------------------------------------------------------------------*/
+
+static void
+_update(cs_probe_spectra_t  *s)
+{
+  const cs_time_step_t *ts = cs_glob_time_step;
+
+  if (s->nt_last >= ts->nt_cur)
+    return;
+
+  cs_probe_set_t *pset = _probe_set(s);
+
+  if (s->n_loc < 0)
+    _init_state(s, pset);
+
+  _sample(s, pset);
+
+  const cs_lnum_t n_loc = s->n_loc;
+  const int n = s->n_fft;
+  const int pos = s->n_samples % n;
+
+  /* Reference value, shared by all ranks */
+
+  if (s->n_lags > 0) {
+    cs_real_t ref_val = 0.;
+    for (cs_lnum_t i = 0; i < n_loc; i++) {
+      if (s->loc_id[i] == s->ref_probe_id)
+        ref_val = s->loc_vals[i];
+    }
+    cs_parall_sum(1, CS_REAL_TYPE, &ref_val);
+    s->ref_buffer[s->n_samples % s->n_lags] = ref_val;
+  }
+
+  /* Running statistics (Welford's algorithm) and ring buffer */
+
+  const cs_real_t n_s = s->n_samples + 1;
+
+  for (cs_lnum_t i = 0; i < n_loc; i++) {
+    const cs_real_t v = s->loc_vals[i];
+    const cs_real_t delta = v - s->mean[i];
+    s->mean[i] += delta / n_s;
+    s->m2[i] += delta * (v - s->mean[i]);
+    s->buffer[i*n + pos] = v;
+  }
+
+  /* Lagged products with the reference probe */
+
+  for (int k = 0; k < s->n_lags && k <= s->n_samples; k++) {
+    const cs_real_t ref_val
+      = s->ref_buffer[(s->n_samples - k) % s->n_lags];
+    for (cs_lnum_t i = 0; i < n_loc; i++)
+      s->corr[i*s->n_lags + k] += s->loc_vals[i] * ref_val;
+  }
+
+  if (s->n_samples == 0)
+    s->t_first = ts->t_cur;
+  s->t_last = ts->t_cur;
+  s->n_samples += 1;
+  s->nt_last = ts->nt_cur;
+
+  /* Welch segments overlap by half */
+
+  if (s->n_samples >= n && (s->n_samples - n) % (n/2) == 0)
+    _accumulate_segment(s);
+}
+
+/*----------------------------------------------------------------------------
+ * Write results of a spectra definition.
+ *
+ * parameters:
+ *   s <-- pointer to spectra definition
+ *----------------------------------------------------------------------------*/
+
+static void
+_write(const cs_probe_spectra_t  *s)
+{
+  if (s->n_samples < 1 || s->n_loc < 0)
+    return;
+
+  const int n_probes = s->n_probes;
+  const cs_lnum_t n_loc = s->n_loc;
+  const int n = s->n_fft;
+  const int n_w = cs::min(s->n_samples, n);
+  const int head = s->n_samples % n;
+
+  /* Mean sampling interval */
+
+  double dt_mean = 0;
+  if (s->n_samples > 1)
+    dt_mean = (s->t_last - s->t_first) / (s->n_samples - 1);
+
+  /* Statistics: n_samples, mean, variance, and
+     window mean, variance, min, and max */
+
+  const int n_stats = 6;
+
+  cs_real_t *l_stats = nullptr;
+  CS_MALLOC(l_stats, n_loc*n_stats, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_loc; i++) {
+    const cs_real_t *b = s->buffer + i*n;
+    cs_real_t w_mean = 0., w_var = 0.;
+    cs_real_t w_min = HUGE_VAL, w_max = -HUGE_VAL;
+    for (int j = 0; j < n_w; j++) {
+      cs_real_t v = b[(head - n_w + j + n) % n];
+      w_mean += v;
+      w_min = cs::min(w_min, v);
+      w_max = cs::max(w_max, v);
+    }
+    w_mean /= n_w;
+    for (int j = 0; j < n_w; j++) {
+      cs_real_t d = b[(head - n_w + j + n) % n] - w_mean;
+      w_var += d*d;
+    }
+    w_var /= n_w;
+
+    cs_real_t *_stats = l_stats + i*n_stats;
+    _stats[0] = s->mean[i];
+    _stats[1] = s->m2[i] / s->n_samples;
+    _stats[2] = w_mean;
+    _stats[3] = w_var;
+    _stats[4] = w_min;
+    _stats[5] = w_max;
+  }
+
+  cs_real_t *stats = _gather_to_root(s, n_stats, l_stats);
+  CS_FREE(l_stats);
+
+  /* One-sided power spectral density */
+
+  cs_real_t *psd = nullptr;
+  if (s->n_segments > 0) {
+    _fft_tables(n);
+    const cs_real_t scale = dt_mean / (_fft_w_sum2 * s->n_segments);
+    cs_real_t *l_psd = nullptr;
+    CS_MALLOC(l_psd, n_loc*s->n_freq, cs_real_t);
+    for (cs_lnum_t i = 0; i < n_loc; i++) {
+      const cs_real_t *_psd = s->psd + i*s->n_freq;
+      for (int k = 0; k < s->n_freq; k++) {
+        cs_real_t m = (k == 0 || k == n/2) ? 1. : 2.;
+        l_psd[i*s->n_freq + k] = m*scale*_psd[k];
+      }
+    }
+    psd = _gather_to_root(s, s->n_freq, l_psd);
+    CS_FREE(l_psd);
+  }
+
+  /* Normalized correlation with reference probe */
+
+  cs_real_t *corr = nullptr;
+  const int n_lags = cs::min(s->n_lags, s->n_samples);
+  if (n_lags > 0) {
+    cs_real_t *l_corr = nullptr;
+    CS_MALLOC(l_corr, n_loc*n_lags, cs_real_t);
+    for (cs_lnum_t i = 0; i < n_loc; i++) {
+      for (int k = 0; k < n_lags; k++)
+        l_corr[i*n_lags + k]
+          = s->corr[i*s->n_lags + k] / (s->n_samples - k);
+    }
+    corr = _gather_to_root(s, n_lags, l_corr);
+    CS_FREE(l_corr);
+  }
+
+  if (cs_glob_rank_id < 1) {
+
+    cs_file_mkdir_default("monitoring");
+
+    char *file_name = nullptr;
+    CS_MALLOC(file_name, strlen(s->name) + 64, char);
+
+    sprintf(file_name, "monitoring/spectra_%s_stats.csv", s->name);
+    FILE *fp = fopen(file_name, "w");
+    if (fp == nullptr)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error opening file: \"%s\""), file_name);
+    fprintf(fp, "probe, n_samples, mean, variance, window_mean, "
+            "window_variance, window_min, window_max\n");
+    for (int i = 0; i < n_probes; i++) {
+      const cs_real_t *_stats = stats + i*n_stats;
+      fprintf(fp, "%d, %d", i+1, s->n_samples);
+      for (int j = 0; j < n_stats; j++)
+        fprintf(fp, ", %.8e", _stats[j]);
+      fprintf(fp, "\n");
+    }
+    fclose(fp);
+
+    if (psd != nullptr) {
+      sprintf(file_name, "monitoring/spectra_%s_psd.csv", s->name);
+      fp = fopen(file_name, "w");
+      if (fp == nullptr)
+        bft_error(__FILE__, __LINE__, errno,
+                  _("Error opening file: \"%s\""), file_name);
+      fprintf(fp, "frequency");
+      for (int i = 0; i < n_probes; i++)
+        fprintf(fp, ", %d", i+1);
+      fprintf(fp, "\n");
+      for (int k = 0; k < s->n_freq; k++) {
+        fprintf(fp, "%.8e", (dt_mean > 0) ? k / (n*dt_mean) : 0.);
+        for (int i = 0; i < n_probes; i++)
+          fprintf(fp, ", %.8e", psd[i*s->n_freq + k]);
+        fprintf(fp, "\n");
+      }
+      fclose(fp);
+    }
+
+    if (corr != nullptr) {
+      const cs_real_t *_ref_stats = stats + s->ref_probe_id*n_stats;
+      sprintf(file_name, "monitoring/spectra_%s_correlation.csv", s->name);
+      fp = fopen(file_name, "w");
+      if (fp == nullptr)
+        bft_error(__FILE__, __LINE__, errno,
+                  _("Error opening file: \"%s\""), file_name);
+      fprintf(fp, "lag");
+      for (int i = 0; i < n_probes; i++)
+        fprintf(fp, ", %d", i+1);
+      fprintf(fp, "\n");
+      for (int k = 0; k < n_lags; k++) {
+        fprintf(fp, "%.8e", k*dt_mean);
+        for (int i = 0; i < n_probes; i++) {
+          const cs_real_t *_stats = stats + i*n_stats;
+          cs_real_t d = sqrt(_ref_stats[1]*_stats[1]);
+          cs_real_t c = corr[i*n_lags + k] - _ref_stats[0]*_stats[0];
+          fprintf(fp, ", %.8e", (d > 0) ? c/d : 0.);
+        }
+        fprintf(fp, "\n");
+      }
+      fclose(fp);
+    }
+
+    CS_FREE(file_name);
+  }
+
+  CS_FREE(corr);
+  CS_FREE(psd);
+  CS_FREE(stats);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define in-situ spectra and statistics of a field component
+ *        sampled at each time step at the probes of a given probe set.
+ *
+ * Power spectral densities are estimated using Welch's method, with
+ * Hann-windowed segments of window_size samples overlapping by half.
+ * Sliding-window statistics are based on the last window_size samples.
+ *
+ * Results are written to the "monitoring" directory every
+ * output_interval time steps (if > 0) and at the end of the computation.
+ *
+ * The sampling interval is assumed constant; with a variable time step,
+ * the mean sampling interval is used.
+ *
+ * \param[in]  name             name of spectra definition (used for output)
+ * \param[in]  probe_set_name   name of associated probe set
+ * \param[in]  field_name       name of sampled field
+ * \param[in]  component_id     sampled field component (0 for scalars)
+ * \param[in]  window_size      number of samples per Welch segment
+ *                              (must be a power of 2)
+ * \param[in]  output_interval  time step interval between outputs,
+ *                              or <= 0 for output at end only
+ *
+ * \return  id of new spectra definition
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_probe_spectra_define(const char  *name,
+                        const char  *probe_set_name,
+                        const char  *field_name,
+                        int          component_id,
+                        int          window_size,
+                        int          output_interval)
+{
+  const cs_field_t *f = cs_field_by_name(field_name);
+
+  if (component_id < 0 || component_id >= f->dim)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: component %d of field \"%s\" is not in range [0, %d[."),
+              __func__, component_id, f->name, f->dim);
+
+  if (window_size < 4 || (window_size & (window_size - 1)) != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: window size %d for spectra \"%s\" must be\n"
+                "a power of 2 (at least 4)."),
+              __func__, window_size, name);
+
+  for (int i = 0; i < _n_spectra; i++) {
+    if (strcmp(_spectra[i].name, name) == 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: spectra \"%s\" already defined."),
+                __func__, name);
+  }
+
+  CS_REALLOC(_spectra, _n_spectra + 1, cs_probe_spectra_t);
+
+  cs_probe_spectra_t *s = _spectra + _n_spectra;
+  memset(s, 0, sizeof(cs_probe_spectra_t));
+
+  CS_MALLOC(s->name, strlen(name) + 1, char);
+  strcpy(s->name, name);
+  CS_MALLOC(s->pset_name, strlen(probe_set_name) + 1, char);
+  strcpy(s->pset_name, probe_set_name);
+
+  s->f_id = f->id;
+  s->comp_id = component_id;
+  s->n_fft = window_size;
+  s->n_freq = window_size/2 + 1;
+  s->nt_output = output_interval;
+
+  s->ref_probe_id = -1;
+  s->n_lags = 0;
+
+  s->n_probes = 0;
+  s->n_loc = -1;
+  s->nt_last = -1;
+
+  _n_spectra += 1;
+
+  return _n_spectra - 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate two-point correlations relative to a reference probe
+ *        for a given spectra definition.
+ *
+ * The normalized correlation of the values at each probe at time t
+ * with those of the reference probe at time t - k.dt is computed
+ * for k in [0, n_lags[.
+ *
+ * \param[in]  spectra_id    id of spectra definition
+ * \param[in]  ref_probe_id  id of reference probe in probe set
+ * \param[in]  n_lags        number of time lags
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_probe_spectra_set_correlation(int  spectra_id,
+                                 int  ref_probe_id,
+                                 int  n_lags)
+{
+  if (spectra_id < 0 || spectra_id >= _n_spectra)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: spectra id %d is not defined."),
+              __func__, spectra_id);
+
+  cs_probe_spectra_t *s = _spectra + spectra_id;
+
+  if (s->n_loc > -1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: correlations of spectra \"%s\" must be defined\n"
+                "before sampling starts."),
+              __func__, s->name);
+
+  if (ref_probe_id < 0 || n_lags < 1) {
+    s->ref_probe_id = -1;
+    s->n_lags = 0;
+  }
+  else {
+    s->ref_probe_id = ref_probe_id;
+    s->n_lags = n_lags;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sample values at probes and update spectra and statistics
+ *        for all definitions.
+ *
+ * Output is also handled by this function when required.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_probe_spectra_update_all(void)
+{
+  const int nt_cur = cs_glob_time_step->nt_cur;
+
+  for (int i = 0; i < _n_spectra; i++) {
+    cs_probe_spectra_t *s = _spectra + i;
+    _update(s);
+    if (s->nt_output > 0 && nt_cur % s->nt_output == 0)
+      _write(s);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write final results and free all spectra definitions.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_probe_spectra_finalize(void)
+{
+  for (int i = 0; i < _n_spectra; i++) {
+    cs_probe_spectra_t *s = _spectra + i;
+
+    _write(s);
+
+    CS_FREE(s->name);
+    CS_FREE(s->pset_name);
+    CS_FREE(s->loc_id);
+    CS_FREE(s->loc_coords);
+    CS_FREE(s->loc_vals);
+    CS_FREE(s->buffer);
+    CS_FREE(s->psd);
+    CS_FREE(s->mean);
+    CS_FREE(s->m2);
+    CS_FREE(s->ref_buffer);
+    CS_FREE(s->corr);
+    CS_FREE(s->restart_data);
+  }
+
+  CS_FREE(_spectra);
+  _n_spectra = 0;
+
+  _fft_n = 0;
+  CS_FREE(_fft_bit_rev);
+  CS_FREE(_fft_twiddle);
+  CS_FREE(_fft_window);
+  CS_FREE(_fft_work);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read spectra data from checkpoint.
+ *
+ * Data is applied when sampling resumes, once probes are located.
+ *
+ * \param[in, out]  r  associated restart file pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_probe_spectra_restart_read(cs_restart_t  *r)
+{
+  for (int i = 0; i < _n_spectra; i++) {
+
+    cs_probe_spectra_t *s = _spectra + i;
+
+    char *sec_name = nullptr;
+    CS_MALLOC(sec_name, strlen(s->name) + 64, char);
+
+    /* Check that the definition is compatible */
+
+    int info[4];
+    sprintf(sec_name, "probe_spectra:%s:info", s->name);
+
+    int retcode = cs_restart_check_section(r, sec_name,
+                                           CS_MESH_LOCATION_NONE,
+                                           4, CS_TYPE_int);
+    if (retcode == CS_RESTART_SUCCESS)
+      retcode = cs_restart_read_section(r, sec_name,
+                                        CS_MESH_LOCATION_NONE,
+                                        4, CS_TYPE_int, info);
+
+    if (retcode != CS_RESTART_SUCCESS) {
+      CS_FREE(sec_name);
+      continue;
+    }
+
+    cs_probe_set_t *pset = _probe_set(s);
+    int n_probes = 0;
+    cs_probe_set_get_members(pset, nullptr, &n_probes, nullptr);
+
+    if (   info[0] != n_probes || info[1] != s->n_fft
+        || info[2] != s->n_lags || info[3] != s->ref_probe_id) {
+      cs_log_printf
+        (CS_LOG_DEFAULT,
+         _("\n  Spectra \"%s\": checkpoint settings differ from current\n"
+           "  definition; accumulation restarts from zero.\n"), s->name);
+      CS_FREE(sec_name);
+      continue;
+    }
+
+    /* Read state */
+
+    const int n_state = 4 + s->n_lags;
+    cs_real_t *state = nullptr;
+    CS_MALLOC(state, n_state, cs_real_t);
+
+    sprintf(sec_name, "probe_spectra:%s:state", s->name);
+    retcode = cs_restart_read_section(r, sec_name,
+                                      CS_MESH_LOCATION_NONE,
+                                      n_state, CS_TYPE_cs_real_t, state);
+
+    const int rec_size = _probe_record_size(s);
+    CS_MALLOC(s->restart_data, n_probes*rec_size, cs_real_t);
+
+    sprintf(sec_name, "probe_spectra:%s:probe_data", s->name);
+    if (retcode == CS_RESTART_SUCCESS)
+      retcode = cs_restart_read_section(r, sec_name,
+                                        CS_MESH_LOCATION_NONE,
+                                        n_probes*rec_size,
+                                        CS_TYPE_cs_real_t, s->restart_data);
+
+    if (retcode == CS_RESTART_SUCCESS) {
+      s->n_samples = state[0];
+      s->n_segments = state[1];
+      s->t_first = state[2];
+      s->t_last = state[3];
+      /* Reference buffer is allocated with sampling state */
+      CS_REALLOC(s->restart_data, n_probes*rec_size + s->n_lags, cs_real_t);
+      for (int j = 0; j < s->n_lags; j++)
+        s->restart_data[n_probes*rec_size + j] = state[4 + j];
+    }
+    else
+      CS_FREE(s->restart_data);
+
+    CS_FREE(state);
+    CS_FREE(sec_name);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write spectra data to checkpoint.
+ *
+ * \param[in, out]  r  associated restart file pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_probe_spectra_restart_write(cs_restart_t  *r)
+{
+  for (int i = 0; i < _n_spectra; i++) {
+
+    const cs_probe_spectra_t *s = _spectra + i;
+
+    if (s->n_loc < 0)
+      continue;
+
+    char *sec_name = nullptr;
+    CS_MALLOC(sec_name, strlen(s->name) + 64, char);
+
+    int info[4] = {s->n_probes, s->n_fft, s->n_lags, s->ref_probe_id};
+
+    sprintf(sec_name, "probe_spectra:%s:info", s->name);
+    cs_restart_write_section(r, sec_name, CS_MESH_LOCATION_NONE,
+                             4, CS_TYPE_int, info);
+
+    /* Global state; the reference buffer is ordered so that
+       sample n is at position n % n_lags, as when sampling */
+
+    const int n_state = 4 + s->n_lags;
+    cs_real_t *state = nullptr;
+    CS_MALLOC(state, n_state, cs_real_t);
+    state[0] = s->n_samples;
+    state[1] = s->n_segments;
+    state[2] = s->t_first;
+    state[3] = s->t_last;
+    for (int j = 0; j < s->n_lags; j++)
+      state[4 + j] = s->ref_buffer[j];
+
+    sprintf(sec_name, "probe_spectra:%s:state", s->name);
+    cs_restart_write_section(r, sec_name, CS_MESH_LOCATION_NONE,
+                             n_state, CS_TYPE_cs_real_t, state);
+
+    CS_FREE(state);
+
+    /* Per-probe data, gathered in global probe order on rank 0
+       (the section is large enough never to be embedded in its
+       header, so values are not needed on other ranks) */
+
+    const int rec_size = _probe_record_size(s);
+    const cs_lnum_t n_vals = (cs_lnum_t)(s->n_probes)*rec_size;
+
+    cs_real_t *l_vals = nullptr;
+    CS_MALLOC(l_vals, s->n_loc*rec_size, cs_real_t);
+
+    for (cs_lnum_t j = 0; j < s->n_loc; j++) {
+      cs_real_t *_r = l_vals + j*rec_size;
+      for (int k = 0; k < s->n_fft; k++)
+        _r[k] = s->buffer[j*s->n_fft + k];
+      _r += s->n_fft;
+      for (int k = 0; k < s->n_freq; k++)
+        _r[k] = s->psd[j*s->n_freq + k];
+      _r += s->n_freq;
+      _r[0] = s->mean[j];
+      _r[1] = s->m2[j];
+      _r += 2;
+      for (int k = 0; k < s->n_lags; k++)
+        _r[k] = s->corr[j*s->n_lags + k];
+    }
+
+    cs_real_t *vals = _gather_to_root(s, rec_size, l_vals);
+    CS_FREE(l_vals);
+
+    sprintf(sec_name, "probe_spectra:%s:probe_data", s->name);
+    cs_restart_write_section(r, sec_name, CS_MESH_LOCATION_NONE,
+                             n_vals, CS_TYPE_cs_real_t, vals);
+
+    CS_FREE(vals);
+    CS_FREE(sec_name);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,150 @@
+#ifndef __CS_PROBE_SPECTRA_H__
+#define __CS_PROBE_SPECTRA_H__
+
+/*============================================================================
+ * In-situ spectra, correlations and statistics at probes.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2025 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "base/cs_defs.h"
+#include "base/cs_restart.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define in-situ spectra and statistics of a field component
+ *        sampled at each time step at the probes of a given probe set.
+ *
+ * Power spectral densities are estimated using Welch's method, with
+ * Hann-windowed segments of window_size samples overlapping by half.
+ * Sliding-window statistics are based on the last window_size samples.
+ *
+ * Results are written to the "monitoring" directory every
+ * output_interval time steps (if > 0) and at the end of the computation.
+ *
+ * The sampling interval is assumed constant; with a variable time step,
+ * the mean sampling interval is used.
+ *
+ * \param[in]  name             name of spectra definition (used for output)
+ * \param[in]  probe_set_name   name of associated probe set
+ * \param[in]  field_name       name of sampled field
+ * \param[in]  component_id     sampled field component (0 for scalars)
+ * \param[in]  window_size      number of samples per Welch segment
+ *                              (must be a power of 2)
+ * \param[in]  output_interval  time step interval between outputs,
+ *                              or <= 0 for output at end only
+ *
+ * \return  id of new spectra definition
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_probe_spectra_define(const char  *name,
+                        const char  *probe_set_name,
+                        const char  *field_name,
+                        int          component_id,
+                        int          window_size,
+                        int          output_interval);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate two-point correlations relative to a reference probe
+ *        for a given spectra definition.
+ *
+ * The normalized correlation of the values at each probe at time t
+ * with those of the reference probe at time t - k.dt is computed
+ * for k in [0, n_lags[.
+ *
+ * \param[in]  spectra_id    id of spectra definition
+ * \param[in]  ref_probe_id  id of reference probe in probe set
+ * \param[in]  n_lags        number of time lags
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_probe_spectra_set_correlation(int  spectra_id,
+                                 int  ref_probe_id,
+                                 int  n_lags);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sample values at probes and update spectra and statistics
+ *        for all definitions.
+ *
+ * Output is also handled by this function when required.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_probe_spectra_update_all(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write final results and free all spectra definitions.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_probe_spectra_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read spectra data from checkpoint.
+ *
+ * Data is applied when sampling resumes, once probes are located.
+ *
+ * \param[in, out]  r  associated restart file pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_probe_spectra_restart_read(cs_restart_t  *r);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write spectra data to checkpoint.
+ *
+ * \param[in, out]  r  associated restart file pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_probe_spectra_restart_write(cs_restart_t  *r);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_PROBE_SPECTRA_H__ */
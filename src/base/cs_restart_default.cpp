@@ -1726,6 +1726,10 @@ static void
 _restart_set_field_read_status(const cs_field_t *f,
                                const int         status)
 {
+  /* Status is only tracked when reading a main restart */
+  if (_fields_read_status == nullptr)
+    return;
+
   if (status != CS_RESTART_SUCCESS) {
     // Mark failures with invalid id
     _fields_read_status[f->id] = CS_RESTART_N_RESTART_FILES;
@@ -65,6 +65,7 @@
 #include "base/cs_parameters.h"
 #include "base/cs_physical_constants.h"
 #include "pprt/cs_physical_model.h"
+#include "base/cs_probe_spectra.h"
 #include "base/cs_time_moment.h"
 #include "base/cs_time_step.h"
 #include "turb/cs_turbulence_model.h"
@@ -523,6 +524,9 @@ _write_auxiliary_checkpoint(void)
   /* Time moments */
   cs_time_moment_restart_write(r);
 
+  /* Spectra at probes */
+  cs_probe_spectra_restart_write(r);
+
   /* Wall distance */
   // Currently not done
 
@@ -1015,6 +1019,11 @@ _read_auxiliary_checkpoint(cs_map_name_to_id_t *old_field_map)
 
   cs_time_moment_restart_read(r);
 
+  /* Spectra at probes
+     ----------------- */
+
+  cs_probe_spectra_restart_read(r);
+
   /* Wall temperature associated to the condensation model with or without
    * the 1D thermal model tag1D
    *- -------------------------------------------------------------------- */
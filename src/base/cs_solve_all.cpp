@@ -65,8 +65,10 @@
 #include "base/cs_porous_model.h"
 #include "base/cs_prototypes.h"
 #include "base/cs_sat_coupling.h"
+#include "base/cs_solve_equation.h"
 #include "base/cs_solve_navier_stokes.h"
 #include "base/cs_solve_transported_variables.h"
+#include "base/cs_steady_acceleration.h"
 #include "base/cs_syr_coupling.h"
 #include "base/cs_thermal_model.h"
 #include "base/cs_theta_scheme.h"
@@ -305,7 +307,8 @@ _solve_coupled_vel_p_variables_equation(const int        iterns,
   const int key_buoyant_id = cs_field_key_id_try("coupled_with_vel_p");
 
   // Correction only made for the collocated time-scheme (Li Ma phd)
-  cs_field_t *rho_mass = cs_field_by_name_try("density_mass");
+  static cs_field_handle_t h_rho_mass = CS_FIELD_HANDLE("density_mass");
+  cs_field_t *rho_mass = cs_field_by_handle_try(&h_rho_mass);
   if (   rho_mass != nullptr
       && cs_glob_velocity_pressure_param->itpcol == 1) {
     const int n_fields = cs_field_n_fields();
@@ -749,6 +752,22 @@ _solve_turbulence(cs_lnum_t   n_cells,
 {
   cs_dispatch_context ctx;
 
+  /* Skip RANS turbulence equations if all of them have converged */
+
+  if (   cs_glob_turb_model->type == CS_TURB_RANS
+      && cs_glob_turb_model->hybrid_turb == CS_HYBRID_NONE) {
+    cs_field_t *turb_f[] = {CS_F_(k), CS_F_(eps), CS_F_(rij), CS_F_(phi),
+                            CS_F_(f_bar), CS_F_(alp_bl), CS_F_(omg),
+                            CS_F_(nusa)};
+    int n_turb_f = 0;
+    for (int i = 0; i < 8; i++) {
+      if (turb_f[i] != nullptr)
+        turb_f[n_turb_f++] = turb_f[i];
+    }
+    if (cs_solve_equation_skip(n_turb_f, turb_f))
+      return;
+  }
+
   if (   verbosity > 0
       && (   cs_glob_turb_model->itytur == 2
           || cs_glob_turb_model->itytur == 3
@@ -888,7 +907,7 @@ cs_solve_all(int  itrale)
   int n_scal = 0;
   const int n_fields = cs_field_n_fields();
 
-  const int keysca = cs_field_key_id("scalar_id");
+  static const int keysca = cs_field_key_id("scalar_id");
 
   {
     const cs_field_t *f_th = cs_thermal_model_field();
@@ -1218,6 +1237,13 @@ cs_solve_all(int  itrale)
     _transfer_mass_flux_cdo_to_fv();
   }
 
+  /* Residual smoothing and Anderson acceleration of the velocity-pressure
+     outer iterations (steady and local time step algorithms); the pressure
+     may be reset during the first iterations, so history is dropped. */
+
+  if (_active_dyn && cs_steady_acceleration_is_active())
+    cs_steady_acceleration_apply(ts->nt_cur <= ts->nt_ini);
+
   /* Computation on non-frozen velocity field, continued */
 
   if (_active_dyn) {
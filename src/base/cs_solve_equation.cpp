@@ -45,6 +45,7 @@
 
 #include "base/cs_array.h"
 #include "base/cs_assert.h"
+#include "alge/cs_balance.h"
 #include "alge/cs_blas.h"
 #include "base/cs_boundary_conditions.h"
 #include "alge/cs_bw_time_diff.h"
@@ -135,10 +136,25 @@ BEGIN_C_DECLS
  * Type and macro definitions
  *============================================================================*/
 
+/* Solve skipping state for a given field */
+
+typedef struct {
+
+  int      nt_decided;     /* time step at which skipping was decided */
+  bool     skip;           /* skip solve at time step nt_decided */
+  int      n_solved;       /* number of solves since start */
+  int      n_skipped;      /* number of consecutive skipped solves */
+  int      n_skipped_tot;  /* total number of skipped solves */
+
+} _solve_skip_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
 
+static int             _n_skip_info = 0;
+static _solve_skip_t  *_skip_info = nullptr;
+
 /* Use legacy macro type to maintain compatibility with legacy user files */
 
 /*============================================================================
@@ -966,6 +982,178 @@ _physical_model_source_terms(cs_field_t        *f,
     cs_ctwr_source_term(f->id, rhs, fimp);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Advance a scalar over a time step using a low-storage explicit
+ *        Runge-Kutta scheme.
+ *
+ * The 3-stage, 2-register scheme of Williamson (1980) is used:
+ * \f[
+ *   \delta_s = A_s \delta_{s-1} + \Delta t \, L(\varia_{s-1}), \quad
+ *   \varia_s = \varia_{s-1} + B_s \delta_s
+ * \f]
+ * where \f$ L \f$ is the explicit convection/diffusion balance
+ * (see \ref cs_balance_scalar) plus the source terms, the implicit part of
+ * which is linearized around \f$ \varia^n \f$. Only the variable and
+ * the increment are kept between stages, and no linear system is solved.
+ *
+ * \param[in]       f          pointer to field structure
+ * \param[in]       eqp        equation parameters
+ * \param[in]       imucpp     multiply the convective term by Cp ?
+ * \param[in]       imasfl     mass flux at interior faces
+ * \param[in]       bmasfl     mass flux at boundary faces
+ * \param[in]       viscf      visc*surface/dist at internal faces
+ * \param[in]       viscb      visc*surface/dist at boundary faces
+ * \param[in]       viscce     symmetric diffusivity tensor, or nullptr
+ * \param[in]       weighf     internal face weights for tensor diffusion
+ * \param[in]       weighb     boundary face weights for tensor diffusion
+ * \param[in]       xcpp       Cp or 1 depending on imucpp
+ * \param[in]       pcrom      density for the unsteady term
+ * \param[in]       dt         time step (per cell)
+ * \param[in]       fimp       implicit source terms, including the
+ *                             unsteady term
+ * \param[in]       rhs        explicit source terms
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_explicit_rk_scalar(cs_field_t                 *f,
+                    const cs_equation_param_t  *eqp,
+                    int                         imucpp,
+                    const cs_real_t             imasfl[],
+                    const cs_real_t             bmasfl[],
+                    const cs_real_t             viscf[],
+                    const cs_real_t             viscb[],
+                    cs_real_6_t                 viscce[],
+                    const cs_real_2_t           weighf[],
+                    const cs_real_t             weighb[],
+                    const cs_real_t             xcpp[],
+                    const cs_real_t             pcrom[],
+                    const cs_real_t             dt[],
+                    const cs_real_t             fimp[],
+                    const cs_real_t             rhs[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_real_t *cell_f_vol = fvq->cell_vol;
+  const int *c_disable_flag = (fvq->has_disable_flag) ?
+    fvq->c_disable_flag : nullptr;
+
+  /* Williamson low-storage 3-stage coefficients */
+  const cs_real_t rk_a[3] = {0., -5./9., -153./128.};
+  const cs_real_t rk_b[3] = {1./3., 15./16., 8./15.};
+
+  cs_real_t *cvar_var = f->val;
+  const cs_real_t *cvara_var = f->val_pre;
+
+  cs_dispatch_context ctx;
+
+  cs_real_t *dvar, *rhs_s;
+  CS_MALLOC_HD(dvar, n_cells_ext, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(rhs_s, n_cells_ext, cs_real_t, cs_alloc_mode);
+
+  /* Convection/diffusion is fully evaluated at the current stage */
+  cs_equation_param_t eqp_rk = *eqp;
+  eqp_rk.theta = 1.;
+
+  /* Stages start from the previous time step value, so that sub-iterations
+     (nterup > 1) do not accumulate successive steps */
+
+  ctx.parallel_for(n_cells_ext, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+    dvar[c_id] = 0.;
+    cvar_var[c_id] = cvara_var[c_id];
+  });
+
+  for (int stage = 0; stage < 3; stage++) {
+
+    const cs_real_t a_s = rk_a[stage];
+    const cs_real_t b_s = rk_b[stage];
+
+    ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+      const cs_real_t rovsdt
+        = xcpp[c_id]*pcrom[c_id]*cell_f_vol[c_id]/dt[c_id];
+      rhs_s[c_id] =   rhs[c_id]
+                    - (fimp[c_id] - rovsdt)*(cvar_var[c_id] - cvara_var[c_id]);
+    });
+
+    ctx.wait();
+
+    cs_balance_scalar(cs_glob_time_step_options->idtvar,
+                      f->id,
+                      imucpp,
+                      1,       /* imasac */
+                      1,       /* inc */
+                      &eqp_rk,
+                      cvar_var,
+                      cvara_var,
+                      f->bc_coeffs,
+                      imasfl,
+                      bmasfl,
+                      viscf,
+                      viscb,
+                      viscce,
+                      xcpp,
+                      weighf,
+                      weighb,
+                      0,       /* icvflb */
+                      nullptr, /* icvfli */
+                      rhs_s);
+
+    ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+      const cs_real_t rovsdt
+        = xcpp[c_id]*pcrom[c_id]*cell_f_vol[c_id]/dt[c_id];
+      cs_real_t d = a_s*dvar[c_id] + rhs_s[c_id]/rovsdt;
+      if (c_disable_flag != nullptr) {
+        if (c_disable_flag[c_id])
+          d = 0.;
+      }
+      dvar[c_id] = d;
+      cvar_var[c_id] += b_s*d;
+    });
+
+    ctx.wait();
+
+    cs_halo_sync(m->halo, CS_HALO_STANDARD, ctx.use_gpu(), cvar_var);
+
+  }
+
+  CS_FREE_HD(rhs_s);
+  CS_FREE_HD(dvar);
+}
+
+/*----------------------------------------------------------------------------
+ * Return solve skipping state for a given field, allocating it if needed.
+ *
+ * parameters:
+ *   f_id <-- field id
+ *
+ * returns:
+ *   pointer to solve skipping state
+ *----------------------------------------------------------------------------*/
+
+static _solve_skip_t *
+_get_skip_info(int  f_id)
+{
+  if (f_id >= _n_skip_info) {
+    int n_skip_info_old = _n_skip_info;
+    _n_skip_info = cs_field_n_fields();
+    CS_REALLOC(_skip_info, _n_skip_info, _solve_skip_t);
+    for (int i = n_skip_info_old; i < _n_skip_info; i++) {
+      _solve_skip_t *si = _skip_info + i;
+      si->nt_decided = -1;
+      si->skip = false;
+      si->n_solved = 0;
+      si->n_skipped = 0;
+      si->n_skipped_tot = 0;
+    }
+  }
+
+  return _skip_info + f_id;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1777,39 +1965,70 @@ cs_solve_equation_scalar(cs_field_t        *f,
   /* all boundary convective flux with upwind */
   cs_real_t normp = -1.0;
 
-  cs_real_t *dpvar;
-  CS_MALLOC_HD(dpvar, n_cells_ext, cs_real_t, cs_alloc_mode);
-
-  cs_equation_iterative_solve_scalar(cs_glob_time_step_options->idtvar,
-                                     iterns,
-                                     f->id,
-                                     nullptr,
-                                     0,       // iescap
-                                     imucpp,
-                                     normp,
-                                     eqp,
-                                     cvara_var,
-                                     cvark_var,
-                                     f->bc_coeffs,
-                                     imasfl,
-                                     bmasfl,
-                                     viscf,
-                                     viscb,
-                                     viscf,
-                                     viscb,
-                                     viscce,
-                                     weighf,
-                                     weighb,
-                                     0,       // icvflb,
-                                     nullptr, // icvfli
-                                     fimp,
-                                     rhs,
-                                     cvar_var,
-                                     dpvar,
-                                     xcpp,
-                                     nullptr);
-
-  CS_FREE_HD(dpvar);
+  static const int key_rk = cs_field_key_id("scalar_explicit_rk_stages");
+  const int rk_stages = cs_field_get_key_int(f, key_rk);
+
+  /* The implicit solve is skipped if the equation has already converged;
+     the unknown then keeps its current value, and the updates below
+     (clipping, derived quantities) are still applied. */
+
+  if (rk_stages > 0) {
+
+    _explicit_rk_scalar(f,
+                        eqp,
+                        imucpp,
+                        imasfl,
+                        bmasfl,
+                        viscf,
+                        viscb,
+                        viscce,
+                        weighf,
+                        weighb,
+                        xcpp,
+                        pcrom,
+                        dt,
+                        fimp,
+                        rhs);
+
+  }
+  else if (cs_solve_equation_skip(1, &f) == false) {
+
+    cs_real_t *dpvar;
+    CS_MALLOC_HD(dpvar, n_cells_ext, cs_real_t, cs_alloc_mode);
+
+    cs_equation_iterative_solve_scalar(cs_glob_time_step_options->idtvar,
+                                       iterns,
+                                       f->id,
+                                       nullptr,
+                                       0,       // iescap
+                                       imucpp,
+                                       normp,
+                                       eqp,
+                                       cvara_var,
+                                       cvark_var,
+                                       f->bc_coeffs,
+                                       imasfl,
+                                       bmasfl,
+                                       viscf,
+                                       viscb,
+                                       viscf,
+                                       viscb,
+                                       viscce,
+                                       weighf,
+                                       weighb,
+                                       0,       // icvflb,
+                                       nullptr, // icvfli
+                                       fimp,
+                                       rhs,
+                                       cvar_var,
+                                       dpvar,
+                                       xcpp,
+                                       nullptr);
+
+    CS_FREE_HD(dpvar);
+
+  }
+
   if (weighb != nullptr) {
     CS_FREE_HD(weighb);
     CS_FREE_HD(weighf);
@@ -2438,35 +2657,38 @@ cs_solve_equation_vector(cs_field_t       *f,
   }
 
   /* Solve
-     ===== */
-
-  cs_equation_iterative_solve_vector(cs_glob_time_step_options->idtvar,
-                                     iterns,
-                                     f->id,
-                                     nullptr,
-                                     0,  // ivissv,
-                                     0,  // iescap,
-                                     eqp,
-                                     cvara_var,
-                                     cvara_var,
-                                     f->bc_coeffs,
-                                     imasfl,
-                                     bmasfl,
-                                     viscf,
-                                     viscb,
-                                     viscf,
-                                     viscb,
-                                     nullptr,
-                                     nullptr,
-                                     viscce,
-                                     weighf,
-                                     weighb,
-                                     0,  // icvflb,
-                                     nullptr,
-                                     fimp,
-                                     rhs,
-                                     cvar_var,
-                                     nullptr);
+     =====
+     (skipped if the equation has already converged, in which case the
+     unknown keeps its current value) */
+
+  if (cs_solve_equation_skip(1, &f) == false)
+    cs_equation_iterative_solve_vector(cs_glob_time_step_options->idtvar,
+                                       iterns,
+                                       f->id,
+                                       nullptr,
+                                       0,  // ivissv,
+                                       0,  // iescap,
+                                       eqp,
+                                       cvara_var,
+                                       cvara_var,
+                                       f->bc_coeffs,
+                                       imasfl,
+                                       bmasfl,
+                                       viscf,
+                                       viscb,
+                                       viscf,
+                                       viscb,
+                                       nullptr,
+                                       nullptr,
+                                       viscce,
+                                       weighf,
+                                       weighb,
+                                       0,  // icvflb,
+                                       nullptr,
+                                       fimp,
+                                       rhs,
+                                       cvar_var,
+                                       nullptr);
 
   if (weighb != nullptr) {
     CS_FREE(weighb);
@@ -2512,6 +2734,148 @@ cs_solve_equation_vector(cs_field_t       *f,
   CS_FREE(dtr);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check whether the solution of a group of equations may be skipped
+ *        at the current time step, and update the associated counters.
+ *
+ * The solve is skipped if the normalized initial residual of the previous
+ * solve (\ref cs_solving_info_t::res_norm_ini, i.e. the residual before
+ * the first sweep divided by the normalization norm
+ * \ref cs_solving_info_t::rhs_norm) is below the "solve_skip_threshold"
+ * keyword, for all fields of the group. A solve is forced after
+ * "solve_skip_interval" consecutive skipped time steps. Fields advanced
+ * with explicit Runge-Kutta stages ("scalar_explicit_rk_stages" keyword)
+ * do not update the initial residual, so they are never skipped.
+ *
+ * Fields which must be solved together (such as coupled turbulence
+ * variables) are either all skipped or all solved. The decision is taken
+ * once per time step, so that sub-iterations are consistent.
+ *
+ * \param[in]  n_fields  number of fields in group
+ * \param[in]  fields    pointers to fields in group
+ *
+ * \return  true if the solve should be skipped, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_solve_equation_skip(int          n_fields,
+                       cs_field_t  *fields[])
+{
+  if (n_fields < 1)
+    return false;
+
+  const int nt_cur = cs_glob_time_step->nt_cur;
+
+  /* Decision already taken for this time step (sub-iterations) */
+
+  {
+    bool decided = true, skip = true;
+    for (int i = 0; i < n_fields; i++) {
+      const _solve_skip_t *si = _get_skip_info(fields[i]->id);
+      if (si->nt_decided != nt_cur)
+        decided = false;
+      else if (si->skip == false)
+        skip = false;
+    }
+    if (decided)
+      return skip;
+  }
+
+  static const int k_thr = cs_field_key_id("solve_skip_threshold");
+  static const int k_itv = cs_field_key_id("solve_skip_interval");
+  static const int si_k_id = cs_field_key_id("solving_info");
+  static const int k_rk = cs_field_key_id("scalar_explicit_rk_stages");
+
+  bool skip = true;
+
+  for (int i = 0; i < n_fields; i++) {
+    cs_field_t *f = fields[i];
+    _solve_skip_t *si = _get_skip_info(f->id);
+
+    const cs_real_t threshold = cs_field_get_key_double(f, k_thr);
+    const int interval = cs_field_get_key_int(f, k_itv);
+
+    const cs_solving_info_t *sinfo
+      = static_cast<const cs_solving_info_t *>
+          (cs_field_get_key_struct_ptr(f, si_k_id));
+
+    if (   threshold <= 0.
+        || si->n_solved < 2
+        || si->n_skipped >= interval
+        || cs_field_get_key_int(f, k_rk) > 0
+        || sinfo->res_norm_ini > threshold)
+      skip = false;
+  }
+
+  for (int i = 0; i < n_fields; i++) {
+    _solve_skip_t *si = _get_skip_info(fields[i]->id);
+    si->nt_decided = nt_cur;
+    si->skip = skip;
+    if (skip) {
+      si->n_skipped += 1;
+      si->n_skipped_tot += 1;
+    }
+    else {
+      si->n_skipped = 0;
+      si->n_solved += 1;
+    }
+  }
+
+  return skip;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query whether the solution of a field's equation was skipped at
+ *        the current time step.
+ *
+ * \param[in]   f              pointer to field
+ * \param[out]  n_skipped      number of consecutive skipped solves,
+ *                             or nullptr
+ * \param[out]  n_skipped_tot  total number of skipped solves, or nullptr
+ *
+ * \return  true if the solve was skipped at the current time step
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_solve_equation_skipped(const cs_field_t  *f,
+                          int               *n_skipped,
+                          int               *n_skipped_tot)
+{
+  int _n_skipped = 0, _n_skipped_tot = 0;
+  bool skipped = false;
+
+  if (f->id < _n_skip_info) {
+    const _solve_skip_t *si = _skip_info + f->id;
+    _n_skipped = si->n_skipped;
+    _n_skipped_tot = si->n_skipped_tot;
+    skipped = (si->skip && si->nt_decided == cs_glob_time_step->nt_cur);
+  }
+
+  if (n_skipped != nullptr)
+    *n_skipped = _n_skipped;
+  if (n_skipped_tot != nullptr)
+    *n_skipped_tot = _n_skipped_tot;
+
+  return skipped;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free solve skipping info.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_solve_equation_finalize(void)
+{
+  CS_FREE(_skip_info);
+  _n_skip_info = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
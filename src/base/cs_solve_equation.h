@@ -98,6 +98,50 @@ cs_solve_equation_vector(cs_field_t       *f,
                          cs_real_t         viscf[],
                          cs_real_t         viscb[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check whether the solution of a group of equations may be skipped
+ *        at the current time step, and update the associated counters.
+ *
+ * \param[in]  n_fields  number of fields in group
+ * \param[in]  fields    pointers to fields in group
+ *
+ * \return  true if the solve should be skipped, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_solve_equation_skip(int          n_fields,
+                       cs_field_t  *fields[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query whether the solution of a field's equation was skipped at
+ *        the current time step.
+ *
+ * \param[in]   f              pointer to field
+ * \param[out]  n_skipped      number of consecutive skipped solves,
+ *                             or nullptr
+ * \param[out]  n_skipped_tot  total number of skipped solves, or nullptr
+ *
+ * \return  true if the solve was skipped at the current time step
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_solve_equation_skipped(const cs_field_t  *f,
+                          int               *n_skipped,
+                          int               *n_skipped_tot);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free solve skipping info.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_solve_equation_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -197,8 +197,8 @@ _cs_mass_flux_prediction(const cs_mesh_t       *m,
   cs_real_t *cfbpot = bc_coeffs_pot.bf;
 
   /* Mass fluxes */
-  const int kimasf = cs_field_key_id("inner_mass_flux_id");
-  const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
+  static const int kimasf = cs_field_key_id("inner_mass_flux_id");
+  static const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
   cs_real_t *imasfl
     = cs_field_by_id(cs_field_get_key_int(CS_F_(vel), kimasf))->val;
   cs_real_t *bmasfl
@@ -1391,7 +1391,9 @@ _update_fluid_vel(const cs_mesh_t             *m,
     /* Pressure increment gradient */
 
     cs_real_3_t *cpro_gradp = nullptr, *gradp = nullptr;
-    cs_field_t *f_inc = cs_field_by_name_try("algo:pressure_increment_gradient");
+    static cs_field_handle_t h_inc
+      = CS_FIELD_HANDLE("algo:pressure_increment_gradient");
+    cs_field_t *f_inc = cs_field_by_handle_try(&h_inc);
     if (f_inc != nullptr)
       cpro_gradp = (cs_real_3_t *)f_inc->val;
     else {
@@ -1625,8 +1627,8 @@ _update_fluid_vel(const cs_mesh_t             *m,
       const cs_real_t *cell_f_vol = mq->cell_vol;
 
       /* Id of the volume flux */
-      const int kimasf = cs_field_key_id("inner_mass_flux_id");
-      const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
+      static const int kimasf = cs_field_key_id("inner_mass_flux_id");
+      static const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
       const int ivolfl_id
         = cs_field_get_key_int(cs_field_by_name("void_fraction"), kimasf);
       const int bvolfl_id
@@ -1815,8 +1817,8 @@ _log_norm(const cs_mesh_t                *m,
   }
 
   if (vof_model > 0) {
-    const int kimasf = cs_field_key_id("inner_mass_flux_id");
-    const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
+    static const int kimasf = cs_field_key_id("inner_mass_flux_id");
+    static const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
     const int ivolfl_id
       = cs_field_get_key_int(cs_field_by_name("void_fraction"), kimasf);
     const int bvolfl_id
@@ -2032,8 +2034,8 @@ _velocity_prediction(const cs_mesh_t             *m,
   const cs_equation_param_t *eqp_p
     = cs_field_get_equation_param_const(CS_F_(p));
 
-  const int kimasf = cs_field_key_id("inner_mass_flux_id");
-  const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
+  static const int kimasf = cs_field_key_id("inner_mass_flux_id");
+  static const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
   const int iflmas = cs_field_get_key_int(CS_F_(vel), kimasf);
   const int iflmab = cs_field_get_key_int(CS_F_(vel), kbmasf);
 
@@ -2154,12 +2156,23 @@ _velocity_prediction(const cs_mesh_t             *m,
   if (eqp_u->idften & CS_ANISOTROPIC_LEFT_DIFFUSION)
     CS_MALLOC_HD(viscce, n_cells_ext, cs_real_6_t, cs_alloc_mode);
 
-  cs_field_t *iespre = cs_field_by_name_try("est_error_pre_2");
+  static cs_field_handle_t h_iespre = CS_FIELD_HANDLE("est_error_pre_2");
+  static cs_field_handle_t h_iestot = CS_FIELD_HANDLE("est_error_tot_2");
+  static cs_field_handle_t h_b_stress = CS_FIELD_HANDLE("boundary_stress");
+  static cs_field_handle_t h_st_exp
+    = CS_FIELD_HANDLE("velocity_source_term_exp");
+  static cs_field_handle_t h_st_imp
+    = CS_FIELD_HANDLE("velocity_source_term_imp");
+  static cs_field_handle_t h_gradp = CS_FIELD_HANDLE("algo:pressure_gradient");
+  static cs_field_handle_t h_pre_vel
+    = CS_FIELD_HANDLE("algo:predicted_velocity");
+
+  cs_field_t *iespre = cs_field_by_handle_try(&h_iespre);
 
   cs_real_t *cvar_pr = nullptr;
   cs_real_t *cvara_k = nullptr;
 
-  cs_field_t *ib_stress = cs_field_by_name_try("boundary_stress");
+  cs_field_t *ib_stress = cs_field_by_handle_try(&h_b_stress);
 
   if ((ib_stress != nullptr && iterns == 1) || (vof_param->vof_model > 0))
     cvar_pr = CS_F_(p)->val;
@@ -2185,14 +2198,14 @@ _velocity_prediction(const cs_mesh_t             *m,
   const cs_real_t thets = cs_glob_time_scheme->thetsn;
 
   if (cs_glob_time_scheme->isno2t > 0) {
-    int kstprv = cs_field_key_id("source_term_prev_id");
+    static const int kstprv = cs_field_key_id("source_term_prev_id");
     int istprv = cs_field_get_key_int(CS_F_(vel), kstprv);
     if (istprv > -1)
       c_st_vel = (cs_real_3_t *)cs_field_by_id(istprv)->val;
   }
 
   /* Get user source terms */
-  cs_field_t *f = cs_field_by_name_try("velocity_source_term_exp");
+  cs_field_t *f = cs_field_by_handle_try(&h_st_exp);
   cs_real_3_t *loctsexp = nullptr, *tsexp = nullptr;
   if (f != nullptr)
     tsexp = (cs_real_3_t *)f->val;
@@ -2201,7 +2214,7 @@ _velocity_prediction(const cs_mesh_t             *m,
     tsexp = loctsexp;
   }
 
-  f = cs_field_by_name_try("velocity_source_term_imp");
+  f = cs_field_by_handle_try(&h_st_imp);
   cs_real_33_t *loctsimp = nullptr, *tsimp = nullptr;
   if (f != nullptr)
     tsimp = (cs_real_33_t *)f->val;
@@ -2287,7 +2300,7 @@ _velocity_prediction(const cs_mesh_t             *m,
 
   /* Pressure gradient */
   cs_real_3_t *grad = nullptr, *cpro_gradp = nullptr;
-  f = cs_field_by_name_try("algo:pressure_gradient");
+  f = cs_field_by_handle_try(&h_gradp);
   if (f != nullptr)
     cpro_gradp = (cs_real_3_t *)f->val;
   else {
@@ -3127,7 +3140,7 @@ _velocity_prediction(const cs_mesh_t             *m,
   if (cs_glob_physical_model_flag[CS_COMPRESSIBLE] > -1)
     icvflb = 1;
 
-  cs_field_t *iestot = cs_field_by_name_try("est_error_tot_2");
+  cs_field_t *iestot = cs_field_by_handle_try(&h_iestot);
 
   cs_real_3_t *eswork = nullptr;
   if (iespre != nullptr)
@@ -3366,7 +3379,7 @@ _velocity_prediction(const cs_mesh_t             *m,
 
   /* Finalaze estimators + logging */
 
-  f = cs_field_by_name_try("algo:predicted_velocity");
+  f = cs_field_by_handle_try(&h_pre_vel);
   if (f != nullptr) {
     cs_real_3_t *pre_vel = (cs_real_3_t *)f->val;
 
@@ -3455,8 +3468,8 @@ _hydrostatic_pressure_prediction(cs_real_t        grdphd[][3],
 
   const cs_real_t *crom = CS_F_(rho)->val;
 
-  const int kimasf = cs_field_key_id("inner_mass_flux_id");
-  const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
+  static const int kimasf = cs_field_key_id("inner_mass_flux_id");
+  static const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
   const int iflmas = cs_field_get_key_int(CS_F_(vel), kimasf);
   const int iflmab = cs_field_get_key_int(CS_F_(vel), kbmasf);
 
@@ -4090,8 +4103,8 @@ cs_solve_navier_stokes(const int        iterns,
   /* Exit if no pressure-continuity:
    * update mass fluxes and return */
 
-  const int kimasf = cs_field_key_id("inner_mass_flux_id");
-  const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
+  static const int kimasf = cs_field_key_id("inner_mass_flux_id");
+  static const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
   const int iflmas = cs_field_get_key_int(CS_F_(vel), kimasf);
   const int iflmab = cs_field_get_key_int(CS_F_(vel), kbmasf);
 
@@ -0,0 +1,936 @@
+/*============================================================================
+ * Convergence acceleration of outer iterations for steady and
+ * local time step algorithms.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2025 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "base/cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft/bft_printf.h"
+
+#include "alge/cs_blas.h"
+#include "base/cs_ale.h"
+#include "base/cs_dispatch.h"
+#include "base/cs_field.h"
+#include "base/cs_field_operator.h"
+#include "base/cs_field_pointer.h"
+#include "base/cs_halo.h"
+#include "base/cs_log.h"
+#include "base/cs_mem.h"
+#include "base/cs_parall.h"
+#include "base/cs_time_step.h"
+#include "cdo/cs_param_cdo.h"
+#include "mesh/cs_mesh.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "base/cs_steady_acceleration.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_steady_acceleration.cpp
+        Convergence acceleration of outer iterations for steady and
+        local time step algorithms.
+
+  Each outer iteration (time step) of the steady or local time step
+  algorithms is seen as a fixed-point map \f$ x_{k+1} = G(x_k) \f$ acting
+  on the velocity, pressure, and mass flux fields.
+
+  - Anderson acceleration combines the last increments
+    \f$ r = G(x_k) - x_k \f$ to extrapolate the fixed point:
+    \f$ x_{k+1} = G(x_k) - \Delta G \gamma
+    - (1 - \beta) (r_k - \Delta R \gamma) \f$, where \f$ \gamma \f$
+    minimizes \f$ \| r_k - \Delta R \gamma \| \f$.
+  - Implicit residual smoothing replaces the cell-based increments used
+    in this least-squares problem by the solution of
+    \f$ (1 - \epsilon \Delta) \tilde{r} = r \f$, approximated by a few
+    Jacobi sweeps on the cell adjacency graph, so that the mixing
+    coefficients are driven by the smooth part of the increments.
+
+  The velocity, pressure, and mass fluxes are all updated with the same
+  linear combination of previous iterates. As the mass fluxes combined are
+  computed by the pressure correction step, the accelerated mass flux
+  remains (discretely) divergence-free and consistent with the velocity.
+  Smoothed increments are not applied to the fields themselves, as no
+  matching mass flux increment would be available.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Maximum number of accelerated value blocks */
+
+#define _N_BLOCKS_MAX  4
+
+/* Ratio of residual increase between two iterations leading to a restart */
+
+#define _RESTART_RATIO  10.
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Block of accelerated values */
+
+typedef struct {
+
+  cs_real_t  *val;       /* values (not owned) */
+  cs_lnum_t   n_vals;    /* number of values */
+  cs_lnum_t   shift;     /* shift in concatenated vector */
+  int         stride;    /* values per cell for cell-based blocks,
+                            0 for face-based blocks */
+  cs_real_t   weight;    /* scaling weight for dot products */
+  const cs_real_t  *elt_w;  /* per value weight for dot products,
+                               or nullptr */
+
+} _block_t;
+
+/* Acceleration state */
+
+typedef struct {
+
+  int         n_blocks;                 /* number of value blocks */
+  _block_t    blocks[_N_BLOCKS_MAX];    /* value blocks */
+  cs_lnum_t   n_vals;                   /* total number of values */
+
+  int         depth;                    /* allocated history depth */
+  int         n_hist;                   /* number of stored differences */
+  int         hist_id;                  /* next history column to replace */
+
+  bool        has_x;                    /* previous iterate available */
+  bool        has_prev;                 /* previous increment available */
+  bool        weights_set;              /* block weights defined */
+
+  cs_real_t  *i_face_w;                 /* interior face weights for dot
+                                           products (1/2 for faces shared
+                                           with another rank or periodic
+                                           faces, 1 otherwise) */
+
+  cs_real_t  *x;                        /* last iterate */
+  cs_real_t  *r_prev;                   /* previous increment */
+  cs_real_t  *g_prev;                   /* previous fixed-point image */
+  cs_real_t  *rs_prev;                  /* previous smoothed increment */
+  cs_real_t  *dr;                       /* increment differences */
+  cs_real_t  *drs;                      /* smoothed increment differences
+                                           (or nullptr if no smoothing) */
+  cs_real_t  *dg;                       /* image differences */
+
+  /* Monitoring */
+
+  bool        logged;                   /* info available for log */
+  int         n_restarts;               /* number of history restarts */
+  int         n_used;                   /* history used at last update */
+  double      res_norm;                 /* current normalized increment */
+  double      res_norm0;                /* first normalized increment */
+  double      gamma_norm;               /* norm of mixing coefficients */
+
+} _acceleration_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static _acceleration_t  _acc = {
+  .n_blocks = 0,
+  .blocks = {},
+  .n_vals = 0,
+  .depth = 0,
+  .n_hist = 0,
+  .hist_id = 0,
+  .has_x = false,
+  .has_prev = false,
+  .weights_set = false,
+  .i_face_w = nullptr,
+  .x = nullptr,
+  .r_prev = nullptr,
+  .g_prev = nullptr,
+  .rs_prev = nullptr,
+  .dr = nullptr,
+  .drs = nullptr,
+  .dg = nullptr,
+  .logged = false,
+  .n_restarts = 0,
+  .n_used = 0,
+  .res_norm = 0.,
+  .res_norm0 = -1.,
+  .gamma_norm = 0.
+};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Free arrays and reset history of acceleration structure.
+ *
+ * parameters:
+ *   acc <-> pointer to acceleration structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_arrays(_acceleration_t  *acc)
+{
+  CS_FREE(acc->i_face_w);
+  CS_FREE(acc->x);
+  CS_FREE(acc->r_prev);
+  CS_FREE(acc->g_prev);
+  CS_FREE(acc->rs_prev);
+  CS_FREE(acc->dr);
+  CS_FREE(acc->drs);
+  CS_FREE(acc->dg);
+
+  acc->n_vals = 0;
+  acc->depth = 0;
+  acc->n_hist = 0;
+  acc->hist_id = 0;
+  acc->has_x = false;
+  acc->has_prev = false;
+  acc->weights_set = false;
+}
+
+/*----------------------------------------------------------------------------
+ * Define accelerated value blocks: velocity, pressure, and interior and
+ * boundary mass fluxes.
+ *
+ * parameters:
+ *   acc <-> pointer to acceleration structure
+ *
+ * returns:
+ *   total number of values
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_define_blocks(_acceleration_t  *acc)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  const int kimasf = cs_field_key_id("inner_mass_flux_id");
+  const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
+
+  cs_field_t *f_vel = CS_F_(vel);
+  cs_field_t *f_p = CS_F_(p);
+
+  cs_real_t *i_massflux
+    = cs_field_by_id(cs_field_get_key_int(f_vel, kimasf))->val;
+  cs_real_t *b_massflux
+    = cs_field_by_id(cs_field_get_key_int(f_vel, kbmasf))->val;
+
+  cs_real_t *vals[_N_BLOCKS_MAX]
+    = {f_vel->val, f_p->val, i_massflux, b_massflux};
+  const cs_lnum_t n_vals[_N_BLOCKS_MAX]
+    = {m->n_cells*f_vel->dim, m->n_cells, m->n_i_faces, m->n_b_faces};
+  const int strides[_N_BLOCKS_MAX] = {f_vel->dim, 1, 0, 0};
+  const cs_real_t *elt_w[_N_BLOCKS_MAX]
+    = {nullptr, nullptr, acc->i_face_w, nullptr};
+
+  cs_lnum_t shift = 0;
+
+  for (int b_id = 0; b_id < _N_BLOCKS_MAX; b_id++) {
+    _block_t *b = acc->blocks + b_id;
+    b->val = vals[b_id];
+    b->n_vals = n_vals[b_id];
+    b->shift = shift;
+    b->stride = strides[b_id];
+    b->elt_w = elt_w[b_id];
+    if (acc->weights_set == false)
+      b->weight = 1.;
+    shift += n_vals[b_id];
+  }
+
+  acc->n_blocks = _N_BLOCKS_MAX;
+
+  return shift;
+}
+
+/*----------------------------------------------------------------------------
+ * Copy accelerated values to a concatenated vector, or the reverse.
+ *
+ * parameters:
+ *   acc     <-- pointer to acceleration structure
+ *   scatter <-- if true, copy v to fields, otherwise fields to v
+ *   v       <-> concatenated vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_copy_values(const _acceleration_t  *acc,
+             bool                    scatter,
+             cs_real_t              *v)
+{
+  for (int b_id = 0; b_id < acc->n_blocks; b_id++) {
+    const _block_t *b = acc->blocks + b_id;
+    if (scatter)
+      memcpy(b->val, v + b->shift, b->n_vals*sizeof(cs_real_t));
+    else
+      memcpy(v + b->shift, b->val, b->n_vals*sizeof(cs_real_t));
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build interior face weights so that faces adjacent to a ghost cell,
+ * which are also present on the neighboring rank (or as the matching
+ * periodic face), are counted once in global dot products.
+ *
+ * parameters:
+ *   acc <-> pointer to acceleration structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_i_face_weights(_acceleration_t  *acc)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_2_t *restrict i_face_cells = m->i_face_cells;
+
+  CS_REALLOC(acc->i_face_w, n_i_faces, cs_real_t);
+  cs_real_t *i_face_w = acc->i_face_w;
+
+# pragma omp parallel for if (n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    if (   i_face_cells[f_id][0] >= n_cells
+        || i_face_cells[f_id][1] >= n_cells)
+      i_face_w[f_id] = 0.5;
+    else
+      i_face_w[f_id] = 1.;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute local dot product of two vectors restricted to a block.
+ *
+ * parameters:
+ *   b <-- pointer to block
+ *   x <-- first concatenated vector
+ *   y <-- second concatenated vector
+ *
+ * returns:
+ *   local contribution to the block dot product (without block weight)
+ *----------------------------------------------------------------------------*/
+
+static double
+_block_dot(const _block_t   *b,
+           const cs_real_t   x[],
+           const cs_real_t   y[])
+{
+  const cs_real_t *x_b = x + b->shift;
+  const cs_real_t *y_b = y + b->shift;
+
+  if (b->elt_w == nullptr)
+    return cs_dot(b->n_vals, x_b, y_b);
+
+  const cs_real_t *elt_w = b->elt_w;
+  const cs_lnum_t n_vals = b->n_vals;
+
+  double s = 0.;
+
+# pragma omp parallel for reduction(+:s) if (n_vals > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_vals; i++)
+    s += elt_w[i]*x_b[i]*y_b[i];
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute local weighted dot product of two concatenated vectors.
+ *
+ * parameters:
+ *   acc <-- pointer to acceleration structure
+ *   x   <-- first vector
+ *   y   <-- second vector
+ *
+ * returns:
+ *   local contribution to the weighted dot product
+ *----------------------------------------------------------------------------*/
+
+static double
+_local_dot(const _acceleration_t  *acc,
+           const cs_real_t         x[],
+           const cs_real_t         y[])
+{
+  double s = 0.;
+
+  for (int b_id = 0; b_id < acc->n_blocks; b_id++) {
+    const _block_t *b = acc->blocks + b_id;
+    s += b->weight * b->weight * _block_dot(b, x, y);
+  }
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------
+ * Apply implicit residual smoothing to the cell-based blocks of an
+ * increment vector.
+ *
+ * The smoothed increment solves (1 - coef.Delta) r_s = r, where Delta
+ * is the graph Laplacian of the cell adjacency (homogeneous Neumann
+ * conditions at boundaries), using Jacobi sweeps.
+ *
+ * parameters:
+ *   acc      <-- pointer to acceleration structure
+ *   coef     <-- smoothing coefficient
+ *   n_sweeps <-- number of Jacobi sweeps
+ *   r        <-> concatenated increment vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_smooth_increment(const _acceleration_t  *acc,
+                  cs_real_t               coef,
+                  int                     n_sweeps,
+                  cs_real_t              *r)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_2_t *restrict i_face_cells = m->i_face_cells;
+
+  /* History arrays are host-only */
+  cs_dispatch_context ctx;
+  ctx.set_use_gpu(false);
+
+  cs_dispatch_sum_type_t i_sum_type = ctx.get_parallel_for_i_faces_sum_type(m);
+
+  /* Number of neighbors of each cell */
+
+  cs_real_t *n_nb;
+  CS_MALLOC(n_nb, n_cells_ext, cs_real_t);
+
+  ctx.parallel_for(n_cells_ext, [=] CS_F_HOST (cs_lnum_t c_id) {
+    n_nb[c_id] = 0.;
+  });
+
+  ctx.parallel_for_i_faces(m, [=] CS_F_HOST (cs_lnum_t f_id) {
+    const cs_lnum_t ii = i_face_cells[f_id][0];
+    const cs_lnum_t jj = i_face_cells[f_id][1];
+    if (ii < n_cells)
+      cs_dispatch_sum(&n_nb[ii], 1., i_sum_type);
+    if (jj < n_cells)
+      cs_dispatch_sum(&n_nb[jj], 1., i_sum_type);
+  });
+
+  ctx.wait();
+
+  for (int b_id = 0; b_id < acc->n_blocks; b_id++) {
+
+    const _block_t *b = acc->blocks + b_id;
+    const int stride = b->stride;
+    if (stride < 1)
+      continue;
+
+    cs_real_t *r_b = r + b->shift;
+
+    cs_real_t *t, *nb_sum;
+    CS_MALLOC(t, n_cells_ext*stride, cs_real_t);
+    CS_MALLOC(nb_sum, n_cells_ext*stride, cs_real_t);
+
+    memcpy(t, r_b, n_cells*stride*sizeof(cs_real_t));
+    if (m->halo != nullptr)
+      cs_halo_sync_var_strided(m->halo, CS_HALO_STANDARD, t, stride);
+
+    for (int sweep = 0; sweep < n_sweeps; sweep++) {
+
+      ctx.parallel_for(n_cells_ext*stride, [=] CS_F_HOST (cs_lnum_t i) {
+        nb_sum[i] = 0.;
+      });
+
+      ctx.parallel_for_i_faces(m, [=] CS_F_HOST (cs_lnum_t f_id) {
+        const cs_lnum_t ii = i_face_cells[f_id][0];
+        const cs_lnum_t jj = i_face_cells[f_id][1];
+        for (int k = 0; k < stride; k++) {
+          if (ii < n_cells)
+            cs_dispatch_sum(&nb_sum[ii*stride + k], t[jj*stride + k],
+                            i_sum_type);
+          if (jj < n_cells)
+            cs_dispatch_sum(&nb_sum[jj*stride + k], t[ii*stride + k],
+                            i_sum_type);
+        }
+      });
+
+      ctx.parallel_for(n_cells, [=] CS_F_HOST (cs_lnum_t c_id) {
+        const cs_real_t d = 1. / (1. + coef*n_nb[c_id]);
+        for (int k = 0; k < stride; k++)
+          t[c_id*stride + k] = (  r_b[c_id*stride + k]
+                                + coef*nb_sum[c_id*stride + k]) * d;
+      });
+
+      ctx.wait();
+
+      if (m->halo != nullptr)
+        cs_halo_sync_var_strided(m->halo, CS_HALO_STANDARD, t, stride);
+
+    }
+
+    memcpy(r_b, t, n_cells*stride*sizeof(cs_real_t));
+
+    CS_FREE(nb_sum);
+    CS_FREE(t);
+  }
+
+  CS_FREE(n_nb);
+}
+
+/*----------------------------------------------------------------------------
+ * Solve the regularized normal equations of the Anderson least-squares
+ * problem using a Cholesky factorization.
+ *
+ * parameters:
+ *   n     <-- system size
+ *   a     <-> symmetric matrix (n*n), overwritten by its factorization
+ *   b     <-- right-hand side
+ *   gamma --> solution
+ *
+ * returns:
+ *   true if the factorization succeeded, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_solve_normal_equations(int        n,
+                        cs_real_t  a[],
+                        cs_real_t  b[],
+                        cs_real_t  gamma[])
+{
+  /* Tikhonov regularization relative to the largest diagonal term */
+
+  cs_real_t d_max = 0.;
+  for (int i = 0; i < n; i++)
+    d_max = cs::max(d_max, a[i*n + i]);
+  if (d_max <= 0.)
+    return false;
+
+  for (int i = 0; i < n; i++)
+    a[i*n + i] += 1.e-12*d_max;
+
+  /* Cholesky factorization (lower triangle) */
+
+  for (int j = 0; j < n; j++) {
+    cs_real_t s = a[j*n + j];
+    for (int k = 0; k < j; k++)
+      s -= a[j*n + k]*a[j*n + k];
+    if (s <= 1.e-14*d_max)
+      return false;
+    a[j*n + j] = sqrt(s);
+    for (int i = j+1; i < n; i++) {
+      cs_real_t t = a[i*n + j];
+      for (int k = 0; k < j; k++)
+        t -= a[i*n + k]*a[j*n + k];
+      a[i*n + j] = t / a[j*n + j];
+    }
+  }
+
+  /* Forward and backward substitution */
+
+  for (int i = 0; i < n; i++) {
+    cs_real_t s = b[i];
+    for (int k = 0; k < i; k++)
+      s -= a[i*n + k]*gamma[k];
+    gamma[i] = s / a[i*n + i];
+  }
+
+  for (int i = n-1; i >= 0; i--) {
+    cs_real_t s = gamma[i];
+    for (int k = i+1; k < n; k++)
+      s -= a[k*n + i]*gamma[k];
+    gamma[i] = s / a[i*n + i];
+  }
+
+  return true;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if outer iteration acceleration is active.
+ *
+ * \return true if Anderson acceleration (possibly with residual
+ *         smoothing) is activated for the current time stepping algorithm
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_steady_acceleration_is_active(void)
+{
+  const cs_time_step_options_t *ts_opt = cs_glob_time_step_options;
+
+  if (   ts_opt->idtvar != CS_TIME_STEP_STEADY
+      && ts_opt->idtvar != CS_TIME_STEP_LOCAL)
+    return false;
+
+  if (ts_opt->nandrs < 1)
+    return false;
+
+  if (!cs_param_cdo_has_fv_main() || cs_glob_ale != CS_ALE_NONE)
+    return false;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Apply residual smoothing and Anderson acceleration to the
+ *        velocity, pressure, and mass flux fields after the
+ *        velocity-pressure solution of an outer iteration.
+ *
+ * \param[in]  reset  if true, drop the iteration history (for example
+ *                    when the fields were modified outside of the
+ *                    fixed-point iteration)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_steady_acceleration_apply(bool  reset)
+{
+  if (cs_steady_acceleration_is_active() == false)
+    return;
+
+  const cs_time_step_options_t *ts_opt = cs_glob_time_step_options;
+  _acceleration_t *acc = &_acc;
+
+  const int depth = cs::max(ts_opt->nandrs, 0);
+  const cs_lnum_t n_vals = _define_blocks(acc);
+
+  /* (Re)allocate if dimensions changed (e.g. after mesh modification) */
+
+  if (n_vals != acc->n_vals || depth != acc->depth) {
+    _free_arrays(acc);
+    acc->n_vals = n_vals;
+    acc->depth = depth;
+    CS_MALLOC(acc->x, n_vals, cs_real_t);
+    _build_i_face_weights(acc);
+    if (depth > 0) {
+      CS_MALLOC(acc->r_prev, n_vals, cs_real_t);
+      CS_MALLOC(acc->g_prev, n_vals, cs_real_t);
+      CS_MALLOC(acc->dr, (size_t)n_vals*depth, cs_real_t);
+      CS_MALLOC(acc->dg, (size_t)n_vals*depth, cs_real_t);
+      if (ts_opt->rsmcoe > 0. && ts_opt->rsmnsw > 0) {
+        CS_MALLOC(acc->rs_prev, n_vals, cs_real_t);
+        CS_MALLOC(acc->drs, (size_t)n_vals*depth, cs_real_t);
+      }
+    }
+    _define_blocks(acc);
+  }
+
+  if (reset) {
+    acc->has_x = false;
+    acc->has_prev = false;
+    acc->n_hist = 0;
+    acc->hist_id = 0;
+  }
+
+  acc->logged = false;
+
+  /* First iteration: only save current iterate */
+
+  if (acc->has_x == false) {
+    _copy_values(acc, false, acc->x);
+    acc->has_x = true;
+    return;
+  }
+
+  cs_real_t *g, *r, *rs;
+  CS_MALLOC(g, n_vals, cs_real_t);
+  CS_MALLOC(r, n_vals, cs_real_t);
+
+  _copy_values(acc, false, g);
+
+  cs_real_t *x = acc->x;
+
+# pragma omp parallel for if (n_vals > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_vals; i++)
+    r[i] = g[i] - x[i];
+
+  /* Implicit residual smoothing of cell-based increments, used only
+     in the least-squares problem (the fields themselves are updated
+     with consistent combinations of previous iterates) */
+
+  const bool smooth = (ts_opt->rsmcoe > 0. && ts_opt->rsmnsw > 0);
+
+  if (smooth) {
+    CS_MALLOC(rs, n_vals, cs_real_t);
+    memcpy(rs, r, n_vals*sizeof(cs_real_t));
+    _smooth_increment(acc, ts_opt->rsmcoe, ts_opt->rsmnsw, rs);
+  }
+  else
+    rs = r;
+
+  /* Block weights so that each variable contributes similarly to
+     the least-squares problem, based on the first increment */
+
+  if (acc->weights_set == false) {
+    double b_norm[_N_BLOCKS_MAX];
+    for (int b_id = 0; b_id < acc->n_blocks; b_id++) {
+      const _block_t *b = acc->blocks + b_id;
+      b_norm[b_id] = _block_dot(b, r, r);
+    }
+    cs_parall_sum(acc->n_blocks, CS_DOUBLE, b_norm);
+    for (int b_id = 0; b_id < acc->n_blocks; b_id++) {
+      _block_t *b = acc->blocks + b_id;
+      b->weight = (b_norm[b_id] > 0.) ? 1./sqrt(b_norm[b_id]) : 1.;
+    }
+    acc->weights_set = true;
+  }
+
+  double res_norm = _local_dot(acc, r, r);
+  cs_parall_sum(1, CS_DOUBLE, &res_norm);
+  res_norm = sqrt(res_norm);
+
+  const double res_norm_prev = acc->res_norm;
+  acc->res_norm = res_norm;
+  if (acc->res_norm0 < 0.)
+    acc->res_norm0 = res_norm;
+
+  acc->n_used = 0;
+  acc->gamma_norm = 0.;
+
+  /* Anderson acceleration */
+
+  if (depth > 0) {
+
+    /* Update history */
+
+    if (acc->has_prev) {
+      cs_real_t *dr = acc->dr + (size_t)acc->hist_id*n_vals;
+      cs_real_t *dg = acc->dg + (size_t)acc->hist_id*n_vals;
+      const cs_real_t *r_prev = acc->r_prev;
+      const cs_real_t *g_prev = acc->g_prev;
+
+#     pragma omp parallel for if (n_vals > CS_THR_MIN)
+      for (cs_lnum_t i = 0; i < n_vals; i++) {
+        dr[i] = r[i] - r_prev[i];
+        dg[i] = g[i] - g_prev[i];
+      }
+
+      if (smooth) {
+        cs_real_t *drs = acc->drs + (size_t)acc->hist_id*n_vals;
+        const cs_real_t *rs_prev = acc->rs_prev;
+
+#       pragma omp parallel for if (n_vals > CS_THR_MIN)
+        for (cs_lnum_t i = 0; i < n_vals; i++)
+          drs[i] = rs[i] - rs_prev[i];
+      }
+
+      acc->hist_id = (acc->hist_id + 1) % depth;
+      acc->n_hist = cs::min(acc->n_hist + 1, depth);
+    }
+
+    memcpy(acc->r_prev, r, n_vals*sizeof(cs_real_t));
+    memcpy(acc->g_prev, g, n_vals*sizeof(cs_real_t));
+    if (smooth)
+      memcpy(acc->rs_prev, rs, n_vals*sizeof(cs_real_t));
+    acc->has_prev = true;
+
+    /* Restart on strong divergence */
+
+    if (acc->n_hist > 0 && res_norm > _RESTART_RATIO*res_norm_prev) {
+      acc->n_hist = 0;
+      acc->hist_id = 0;
+      acc->n_restarts += 1;
+    }
+
+    const int n_hist = acc->n_hist;
+
+    if (n_hist > 0) {
+
+      /* Normal equations of min || r - dR.gamma ||, based on the
+         smoothed increments if residual smoothing is active;
+         only the upper triangle and right-hand side are computed
+         and reduced, the lower triangle being set afterwards. */
+
+      const cs_real_t *dr_fit = (smooth) ? acc->drs : acc->dr;
+
+      cs_real_t *a;
+      CS_MALLOC(a, n_hist*n_hist + 2*n_hist, cs_real_t);
+      cs_real_t *b = a + n_hist*n_hist;
+      cs_real_t *gamma = b + n_hist;
+
+      const int n_upper = n_hist*(n_hist+1)/2;
+      cs_real_t *a_u;
+      CS_MALLOC(a_u, n_upper + n_hist, cs_real_t);
+
+      for (int i = 0, k = 0; i < n_hist; i++) {
+        const cs_real_t *dr_i = dr_fit + (size_t)i*n_vals;
+        for (int j = i; j < n_hist; j++) {
+          const cs_real_t *dr_j = dr_fit + (size_t)j*n_vals;
+          a_u[k++] = _local_dot(acc, dr_i, dr_j);
+        }
+        a_u[n_upper + i] = _local_dot(acc, dr_i, rs);
+      }
+
+      cs_parall_sum(n_upper + n_hist, CS_REAL_TYPE, a_u);
+
+      for (int i = 0, k = 0; i < n_hist; i++) {
+        for (int j = i; j < n_hist; j++)
+          a[i*n_hist + j] = a_u[k++];
+        b[i] = a_u[n_upper + i];
+      }
+
+      CS_FREE(a_u);
+
+      for (int i = 0; i < n_hist; i++) {
+        for (int j = 0; j < i; j++)
+          a[i*n_hist + j] = a[j*n_hist + i];
+      }
+
+      if (_solve_normal_equations(n_hist, a, b, gamma)) {
+
+        /* x = g - dG.gamma - (1 - beta)(r - dR.gamma) */
+
+        const cs_real_t omb = 1. - ts_opt->andrlx;
+
+        for (int j = 0; j < n_hist; j++) {
+          const cs_real_t *dr_j = acc->dr + (size_t)j*n_vals;
+          const cs_real_t *dg_j = acc->dg + (size_t)j*n_vals;
+          const cs_real_t gamma_j = gamma[j];
+
+#         pragma omp parallel for if (n_vals > CS_THR_MIN)
+          for (cs_lnum_t i = 0; i < n_vals; i++) {
+            g[i] -= gamma_j*dg_j[i];
+            r[i] -= gamma_j*dr_j[i];
+          }
+
+          acc->gamma_norm += gamma_j*gamma_j;
+        }
+
+        if (omb > 0.)
+          cs_axpy(n_vals, -omb, r, g);
+
+        acc->gamma_norm = sqrt(acc->gamma_norm);
+        acc->n_used = n_hist;
+
+      }
+      else {
+        acc->n_hist = 0;
+        acc->hist_id = 0;
+        acc->n_restarts += 1;
+      }
+
+      CS_FREE(a);
+    }
+
+  }
+
+  /* Update fields and save iterate */
+
+  _copy_values(acc, true, g);
+  memcpy(x, g, n_vals*sizeof(cs_real_t));
+
+  cs_field_synchronize(CS_F_(vel), CS_HALO_STANDARD);
+  cs_field_synchronize(CS_F_(p), CS_HALO_STANDARD);
+
+  acc->logged = true;
+
+  if (rs != r)
+    CS_FREE(rs);
+  CS_FREE(r);
+  CS_FREE(g);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log outer iteration acceleration info for the current iteration.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_steady_acceleration_log_iteration(void)
+{
+  const _acceleration_t *acc = &_acc;
+
+  if (acc->logged == false)
+    return;
+
+  const cs_time_step_options_t *ts_opt = cs_glob_time_step_options;
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("\n"
+                  "Outer iteration acceleration\n"
+                  "----------------------------\n\n"));
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("  Normalized increment:      %12.5e\n"
+                  "  Ratio to first increment:  %12.5e\n"),
+                acc->res_norm,
+                (acc->res_norm0 > 0.) ? acc->res_norm/acc->res_norm0 : 1.);
+
+  if (ts_opt->rsmcoe > 0.)
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("  Residual smoothing:        %12.5e (%d sweeps)\n"),
+                  ts_opt->rsmcoe, ts_opt->rsmnsw);
+
+  if (acc->depth > 0)
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("  Anderson history used:     %12d / %d\n"
+                    "  Mixing coefficients norm:  %12.5e\n"
+                    "  Number of restarts:        %12d\n"),
+                  acc->n_used, acc->depth,
+                  acc->gamma_norm,
+                  acc->n_restarts);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free outer iteration acceleration structures.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_steady_acceleration_finalize(void)
+{
+  _free_arrays(&_acc);
+
+  _acc.logged = false;
+  _acc.n_restarts = 0;
+  _acc.res_norm0 = -1.;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,94 @@
+#ifndef __CS_STEADY_ACCELERATION_H__
+#define __CS_STEADY_ACCELERATION_H__
+
+/*============================================================================
+ * Convergence acceleration of outer iterations for steady and
+ * local time step algorithms.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2025 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "base/cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if outer iteration acceleration is active.
+ *
+ * \return true if Anderson acceleration (possibly with residual
+ *         smoothing) is activated for the current time stepping algorithm
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_steady_acceleration_is_active(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Apply residual smoothing and Anderson acceleration to the
+ *        velocity, pressure, and mass flux fields after the
+ *        velocity-pressure solution of an outer iteration.
+ *
+ * \param[in]  reset  if true, drop the iteration history (for example
+ *                    when the fields were modified outside of the
+ *                    fixed-point iteration)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_steady_acceleration_apply(bool  reset);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log outer iteration acceleration info for the current iteration.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_steady_acceleration_log_iteration(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free outer iteration acceleration structures.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_steady_acceleration_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_STEADY_ACCELERATION_H__ */
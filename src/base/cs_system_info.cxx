@@ -186,7 +186,10 @@ _sys_info_cpu(char      *cpu_str,
         for (i = strlen(s) - 1;
              i > 0 && (s[i] == ' ' || s[i] == '\n' || s[i] == '\r');
              s[i--] = '\0');
+        memmove(cpu_str, s, strlen(s) + 1);
       }
+      else
+        strcpy(cpu_str, "");
 
       fclose (fp);
 
@@ -869,6 +872,22 @@ cs_system_info(void)
   _omp_version_info(true);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return basic available CPU info (model name on Linux systems).
+ *
+ * \param[out]  cpu_str      string with CPU description
+ * \param[in]   cpu_str_max  maximum length of string with CPU description
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_system_info_cpu(char      *cpu_str,
+                   unsigned   cpu_str_max)
+{
+  _sys_info_cpu(cpu_str, cpu_str_max);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Print available system information, without additional logging
@@ -81,6 +81,19 @@ cs_system_info_no_log(void);
 
 #endif
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return basic available CPU info (model name on Linux systems).
+ *
+ * \param[out]  cpu_str      string with CPU description
+ * \param[in]   cpu_str_max  maximum length of string with CPU description
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_system_info_cpu(char      *cpu_str,
+                   unsigned   cpu_str_max);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
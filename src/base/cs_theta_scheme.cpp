@@ -88,7 +88,7 @@ cs_theta_scheme_update_var_stage1(void)
 
   cs_dispatch_context ctx, ctx_i, ctx_b;
 
-  const int key_t_ext_id = cs_field_key_id("time_extrapolated");
+  static const int key_t_ext_id = cs_field_key_id("time_extrapolated");
 
   cs_real_t *cpro_rho_mass = nullptr;
   cs_real_t *bpro_rho_mass = nullptr;
@@ -101,8 +101,8 @@ cs_theta_scheme_update_var_stage1(void)
   const cs_velocity_pressure_param_t  *vp_param
     = cs_glob_velocity_pressure_param;
 
-  const int kimasf = cs_field_key_id("inner_mass_flux_id");
-  const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
+  static const int kimasf = cs_field_key_id("inner_mass_flux_id");
+  static const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
   int iflmas = cs_field_get_key_int(CS_F_(vel), kimasf);
   int iflmab = cs_field_get_key_int(CS_F_(vel), kbmasf);
 
@@ -122,7 +122,7 @@ cs_theta_scheme_update_var_stage1(void)
   const cs_lnum_t n_i_faces   = cs_glob_mesh->n_i_faces;
   const cs_lnum_t n_b_faces   = cs_glob_mesh->n_b_faces;
 
-  const int k_sca = cs_field_key_id("scalar_id");
+  static const int k_sca = cs_field_key_id("scalar_id");
 
   /*----------------------------------------------------------------------
    * Store the previous mass flux (n-1->n) in *_mass_flux_prev
@@ -248,8 +248,8 @@ cs_theta_scheme_update_var_stage2(void)
 
   cs_dispatch_context ctx;
 
-  const int key_t_ext_id = cs_field_key_id("time_extrapolated");
-  const int kthetvs = cs_field_key_id("diffusivity_extrapolated");
+  static const int key_t_ext_id = cs_field_key_id("time_extrapolated");
+  static const int kthetvs = cs_field_key_id("diffusivity_extrapolated");
 
   cs_real_t *cpro_viscl  = CS_F_(mu)->val;
   cs_real_t *cproa_viscl = CS_F_(mu)->val_pre;
@@ -266,7 +266,7 @@ cs_theta_scheme_update_var_stage2(void)
 
   const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
 
-  const int k_sca = cs_field_key_id("scalar_id");
+  static const int k_sca = cs_field_key_id("scalar_id");
 
   /*----------------------------------------------------------------------
    * Update previous values : only done if values are unavailable at the
@@ -397,8 +397,8 @@ cs_theta_scheme_update_var_stage3(void)
   const cs_velocity_pressure_param_t  *vp_param
     = cs_glob_velocity_pressure_param;
 
-  const int kimasf = cs_field_key_id("inner_mass_flux_id");
-  const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
+  static const int kimasf = cs_field_key_id("inner_mass_flux_id");
+  static const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
   int iflmas = cs_field_get_key_int(CS_F_(vel), kimasf);
   int iflmab = cs_field_get_key_int(CS_F_(vel), kbmasf);
 
@@ -470,8 +470,8 @@ cs_theta_scheme_update_var_stage4(void)
   const cs_lnum_t n_i_faces   = cs_glob_mesh->n_i_faces;
   const cs_lnum_t n_b_faces   = cs_glob_mesh->n_b_faces;
 
-  const int kimasf = cs_field_key_id("inner_mass_flux_id");
-  const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
+  static const int kimasf = cs_field_key_id("inner_mass_flux_id");
+  static const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
   int iflmas = cs_field_get_key_int(CS_F_(vel), kimasf);
   int iflmab = cs_field_get_key_int(CS_F_(vel), kbmasf);
 
@@ -536,10 +536,10 @@ cs_theta_scheme_update_var_stage5(void)
 
   cs_dispatch_context ctx, ctx_i, ctx_b;
 
-  const int key_t_ext_id = cs_field_key_id("time_extrapolated");
+  static const int key_t_ext_id = cs_field_key_id("time_extrapolated");
 
-  const int kimasf = cs_field_key_id("inner_mass_flux_id");
-  const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
+  static const int kimasf = cs_field_key_id("inner_mass_flux_id");
+  static const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
   int iflmas = cs_field_get_key_int(CS_F_(vel), kimasf);
   int iflmab = cs_field_get_key_int(CS_F_(vel), kbmasf);
 
@@ -565,7 +565,7 @@ cs_theta_scheme_update_var_stage5(void)
   const cs_lnum_t n_i_faces   = cs_glob_mesh->n_i_faces;
   const cs_lnum_t n_b_faces   = cs_glob_mesh->n_b_faces;
 
-  const int k_sca = cs_field_key_id("scalar_id");
+  static const int k_sca = cs_field_key_id("scalar_id");
 
 
   /*----------------------------------------------------------------------
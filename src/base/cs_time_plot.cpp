@@ -37,6 +37,10 @@
 #include <string.h>
 #include <assert.h>
 
+#if defined(HAVE_ZLIB)
+#include <zlib.h>
+#endif
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -64,6 +68,18 @@ BEGIN_C_DECLS
  * Local Macro Definitions
  *============================================================================*/
 
+/* Binary format: magic strings, version, and target chunk size (in bytes)
+   when not limited by flush options */
+
+#define _BIN_MAGIC        "CS_TPLOT"
+#define _BIN_VERSION      1
+#define _BIN_CHUNK_SIZE   (1 << 20)
+
+/* Binary format chunk codecs */
+
+#define _BIN_CODEC_RAW    0
+#define _BIN_CODEC_ZLIB   1
+
 /*=============================================================================
  * Local Structure Definitions
  *============================================================================*/
@@ -101,6 +117,17 @@ struct _cs_time_plot_t {
   size_t      buffer_end;       /* Current buffer end */
   char       *buffer;           /* Associated buffer if required */
 
+  /* Binary format only: rows are buffered in binary form and written
+     as column-major chunks, indexed in a file footer on finalization */
+
+  int         n_cols;           /* Number of values per row */
+  int         n_rows;           /* Number of buffered rows */
+  uint64_t    f_size;           /* Current file size */
+  int         n_chunks;         /* Number of chunks written */
+  int         n_chunks_max;     /* Allocated size of chunk index */
+  unsigned char  *chunk_index;  /* Chunk index (offset, n_rows,
+                                   first time step and time) */
+
   struct _cs_time_plot_t  *prev;  /* Previous in flush list */
   struct _cs_time_plot_t  *next;  /* Next in flush list */
 
@@ -401,6 +428,301 @@ _write_probe_header_csv(cs_time_plot_t    *p,
     p->f = _f;
 }
 
+/*----------------------------------------------------------------------------
+ * Write data to a binary time plot file, updating the file size.
+ *
+ * parameters:
+ *   p    <-> time plot values file handler
+ *   data <-- data to write
+ *   size <-- data size, in bytes
+ *----------------------------------------------------------------------------*/
+
+static void
+_bin_write(cs_time_plot_t  *p,
+           const void      *data,
+           size_t           size)
+{
+  size_t n_written = fwrite(data, 1, size, p->f);
+
+  if (n_written < size)
+    bft_error(__FILE__, __LINE__, ferror(p->f),
+              _("Error writing file: \"%s\""), p->file_name);
+
+  p->f_size += size;
+}
+
+/*----------------------------------------------------------------------------
+ * Write file header for binary files
+ *
+ * The header contains the format version, a byte order marker, flags
+ * (bit 0 set if the first column is a time step number), the plot title,
+ * the number of columns, column labels (each null-terminated), and
+ * optional coordinates.
+ *
+ * parameters:
+ *   p                <-> time plot values file handler
+ *   n_cols           <-- number of value columns
+ *   probe_list       <-- numbers (1 to n) of probes if filtered, or nullptr
+ *   probe_coords     <-- probe coordinates, or nullptr
+ *   probe_names      <-- probe names, or nullptr
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_header_bin(cs_time_plot_t    *p,
+                  int                n_cols,
+                  const int         *probe_list,
+                  const cs_real_t    probe_coords[],
+                  const char        *probe_names[])
+{
+  if (p->f != nullptr) {
+    fclose(p->f);
+    p->f = nullptr;
+  }
+
+  p->f = fopen(p->file_name, "wb");
+  if (p->f == nullptr) {
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error opening file: \"%s\""), p->file_name);
+    return;
+  }
+
+  p->f_size = 0;
+  p->n_cols = n_cols;
+
+  /* Labels */
+
+  size_t labels_size = 0;
+  char *labels = nullptr;
+  char label[32];
+
+  for (int pass = 0; pass < 2; pass++) {
+    labels_size = 0;
+    for (int i = 0; i < n_cols; i++) {
+      const char *l = label;
+      if (probe_names != nullptr)
+        l = probe_names[i];
+      else {
+        int probe_id = (probe_list != nullptr) ? probe_list[i] - 1 : i;
+        snprintf(label, 31, "%d", probe_id + 1); label[31] = '\0';
+      }
+      size_t l_size = strlen(l) + 1;
+      if (pass == 1)
+        memcpy(labels + labels_size, l, l_size);
+      labels_size += l_size;
+    }
+    if (pass == 0)
+      CS_MALLOC(labels, labels_size + 1, char);
+  }
+
+  const uint32_t h_vals[] = {_BIN_VERSION,
+                             0x01020304,         /* byte order marker */
+                             (p->use_iteration) ? 1u : 0u,
+                             (uint32_t)strlen(p->plot_name),
+                             (uint32_t)n_cols,
+                             (probe_coords != nullptr) ? 1u : 0u};
+  const uint64_t l_size = labels_size;
+
+  _bin_write(p, _BIN_MAGIC, 8);
+  _bin_write(p, h_vals, sizeof(h_vals));
+  _bin_write(p, p->plot_name, h_vals[3]);
+  _bin_write(p, &l_size, sizeof(uint64_t));
+  _bin_write(p, labels, labels_size);
+
+  CS_FREE(labels);
+
+  if (probe_coords != nullptr) {
+    for (int i = 0; i < n_cols; i++) {
+      int probe_id = (probe_list != nullptr) ? probe_list[i] - 1 : i;
+      const double c[3] = {probe_coords[probe_id*3],
+                           probe_coords[probe_id*3 + 1],
+                           probe_coords[probe_id*3 + 2]};
+      _bin_write(p, c, 3*sizeof(double));
+    }
+  }
+
+  /* Close file or keep it open depending on options */
+
+  if (p->buffer_steps[0] > 0) {
+    if (fclose(p->f) != 0)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error closing file: \"%s\""), p->file_name);
+    p->f = nullptr;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Write buffered rows of a binary time plot as a chunk.
+ *
+ * A chunk header (magic, number of rows and columns, codec, raw and
+ * stored sizes) is followed by the payload, which contains the time step
+ * numbers (int32) followed by the time and value columns (double).
+ * Floating-point columns are byte-shuffled (i.e. bytes of same significance
+ * are grouped), which makes them much more compressible.
+ *
+ * parameters:
+ *   p <-> time plot values file handler
+ *----------------------------------------------------------------------------*/
+
+static void
+_bin_write_chunk(cs_time_plot_t  *p)
+{
+  const int n_rows = p->n_rows;
+  const int n_cols = p->n_cols;
+
+  if (n_rows < 1)
+    return;
+
+  /* Ensure file is open */
+
+  if (p->f == nullptr) {
+    p->f = fopen(p->file_name, "ab");
+    if (p->f == nullptr) {
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error re-opening file: \"%s\""), p->file_name);
+      p->buffer_end = 0;
+      p->n_rows = 0;
+      return;
+    }
+  }
+
+  /* Transpose and shuffle rows (tn, t, vals) */
+
+  const size_t row_size = n_cols + 2;
+  const size_t n_d = (size_t)n_rows * (n_cols + 1);
+  const size_t raw_size = n_rows*sizeof(int32_t) + n_d*sizeof(double);
+
+  const double *rows = (const double *)p->buffer;
+
+  unsigned char *raw;
+  double *cols;
+  CS_MALLOC(raw, raw_size, unsigned char);
+  CS_MALLOC(cols, n_d, double);
+
+  int32_t *tn = (int32_t *)raw;
+  for (int i = 0; i < n_rows; i++)
+    tn[i] = (int32_t)(rows[i*row_size]);
+
+  const int32_t tn_0 = tn[0];
+  const double t_0 = rows[1];
+
+  for (size_t j = 0; j < (size_t)n_cols + 1; j++) {
+    for (int i = 0; i < n_rows; i++)
+      cols[j*n_rows + i] = rows[i*row_size + j + 1];
+  }
+
+  const unsigned char *c_bytes = (const unsigned char *)cols;
+  unsigned char *s_bytes = raw + n_rows*sizeof(int32_t);
+  for (size_t i = 0; i < n_d; i++) {
+    for (size_t b = 0; b < sizeof(double); b++)
+      s_bytes[b*n_d + i] = c_bytes[i*sizeof(double) + b];
+  }
+
+  CS_FREE(cols);
+
+  /* Compress if possible */
+
+  uint32_t codec = _BIN_CODEC_RAW;
+  uint64_t stored_size = raw_size;
+  unsigned char *stored = raw;
+
+#if defined(HAVE_ZLIB)
+  {
+    uLongf z_size = compressBound(raw_size);
+    unsigned char *z;
+    CS_MALLOC(z, z_size, unsigned char);
+    if (   compress2(z, &z_size, raw, raw_size, Z_BEST_SPEED) == Z_OK
+        && z_size < raw_size) {
+      codec = _BIN_CODEC_ZLIB;
+      stored_size = z_size;
+      stored = z;
+      CS_FREE(raw);
+    }
+    else
+      CS_FREE(z);
+  }
+#endif
+
+  /* Update index */
+
+  if (p->n_chunks >= p->n_chunks_max) {
+    p->n_chunks_max = cs::max(16, p->n_chunks_max*2);
+    CS_REALLOC(p->chunk_index, p->n_chunks_max*24, unsigned char);
+  }
+
+  {
+    unsigned char *ci = p->chunk_index + p->n_chunks*24;
+    const uint64_t offset = p->f_size;
+    const uint32_t nr = n_rows;
+    memcpy(ci, &offset, 8);
+    memcpy(ci + 8, &nr, 4);
+    memcpy(ci + 12, &tn_0, 4);
+    memcpy(ci + 16, &t_0, 8);
+    p->n_chunks += 1;
+  }
+
+  /* Write chunk */
+
+  const uint32_t c_vals[] = {(uint32_t)n_rows, (uint32_t)n_cols, codec};
+  const uint64_t c_sizes[] = {raw_size, stored_size};
+
+  _bin_write(p, "CHNK", 4);
+  _bin_write(p, c_vals, sizeof(c_vals));
+  _bin_write(p, c_sizes, 2*sizeof(uint64_t));
+  _bin_write(p, stored, stored_size);
+
+  CS_FREE(stored);
+
+  p->buffer_end = 0;
+  p->n_rows = 0;
+
+  /* Close or flush file depending on options */
+
+  if (p->buffer_steps[0] > 0) {
+    if (fclose(p->f) != 0)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error closing file: \"%s\""), p->file_name);
+    p->f = nullptr;
+  }
+  else {
+    p->flush_times[1] = cs_timer_wtime();
+    fflush(p->f);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Write chunk index and trailer to a binary time plot file.
+ *
+ * The index is preceded by its magic string and number of chunks, and is
+ * followed by its offset and a closing magic string, so that readers may
+ * locate it from the end of the file (files without a trailer, for example
+ * from an interrupted computation, may still be read sequentially).
+ *
+ * parameters:
+ *   p <-> time plot values file handler
+ *----------------------------------------------------------------------------*/
+
+static void
+_bin_write_index(cs_time_plot_t  *p)
+{
+  if (p->f == nullptr) {
+    p->f = fopen(p->file_name, "ab");
+    if (p->f == nullptr) {
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error re-opening file: \"%s\""), p->file_name);
+      return;
+    }
+  }
+
+  const uint64_t index_offset = p->f_size;
+  const uint64_t n_chunks = p->n_chunks;
+
+  _bin_write(p, "CIDX", 4);
+  _bin_write(p, &n_chunks, sizeof(uint64_t));
+  _bin_write(p, p->chunk_index, n_chunks*24);
+  _bin_write(p, &index_offset, sizeof(uint64_t));
+  _bin_write(p, "CEND", 4);
+}
+
 /*----------------------------------------------------------------------------
  * Write file header for xmgrace/qsplotlib readable .dat files
  *
@@ -645,6 +967,9 @@ _plot_file_create(const char             *plot_name,
   case CS_TIME_PLOT_CSV:
     sprintf(p->file_name, "%s%s.csv", file_prefix, plot_name);
     break;
+  case CS_TIME_PLOT_BIN:
+    sprintf(p->file_name, "%s%s.ctp", file_prefix, plot_name);
+    break;
   default:
     break;
   }
@@ -670,6 +995,13 @@ _plot_file_create(const char             *plot_name,
 
   CS_MALLOC(p->buffer, p->buffer_size, char);
 
+  p->n_cols = 0;
+  p->n_rows = 0;
+  p->f_size = 0;
+  p->n_chunks = 0;
+  p->n_chunks_max = 0;
+  p->chunk_index = nullptr;
+
   _time_plot_register(p);
 
   return p;
@@ -687,6 +1019,25 @@ _plot_file_check_or_write(cs_time_plot_t  *p)
 {
   size_t n_written;
 
+  /* Binary format: write chunk when buffered steps, flush interval,
+     or chunk size are reached */
+
+  if (p->format == CS_TIME_PLOT_BIN) {
+    bool write_chunk = (  (size_t)p->n_rows * (p->n_cols + 2) * sizeof(double)
+                        >= _BIN_CHUNK_SIZE);
+    if (p->buffer_steps[0] > 0) {
+      if (p->n_rows >= p->buffer_steps[0])
+        write_chunk = true;
+    }
+    else if (p->flush_times[0] > 0) {
+      if (cs_timer_wtime() - p->flush_times[1] > p->flush_times[0])
+        write_chunk = true;
+    }
+    if (write_chunk)
+      _bin_write_chunk(p);
+    return;
+  }
+
   /* Return immediately if we are buffering and not writing now */
 
   if (   p->buffer_steps[0] > 0
@@ -799,6 +1150,9 @@ cs_time_plot_init_probe(const char             *plot_name,
                             probe_coords);
     _write_probe_header_csv(p, n_probes, probe_list, probe_coords, probe_names);
     break;
+  case CS_TIME_PLOT_BIN:
+    _write_header_bin(p, n_probes, probe_list, probe_coords, probe_names);
+    break;
   default:
     break;
   }
@@ -861,6 +1215,9 @@ cs_time_plot_init_struct(const char             *plot_name,
   case CS_TIME_PLOT_CSV:
     _write_struct_header_csv(p, n_structures);
   break;
+  case CS_TIME_PLOT_BIN:
+    _write_header_bin(p, n_structures, nullptr, nullptr, nullptr);
+    break;
   default:
     break;
   }
@@ -886,10 +1243,16 @@ cs_time_plot_finalize(cs_time_plot_t  **p)
 
     _time_plot_unregister(_p);
 
-    if (_p->buffer_steps[0] > 0)
-      _p->buffer_steps[1] = _p->buffer_steps[0] + 1;
+    if (_p->format == CS_TIME_PLOT_BIN) {
+      _bin_write_chunk(_p);
+      _bin_write_index(_p);
+    }
+    else {
+      if (_p->buffer_steps[0] > 0)
+        _p->buffer_steps[1] = _p->buffer_steps[0] + 1;
 
-    _plot_file_check_or_write(_p);
+      _plot_file_check_or_write(_p);
+    }
 
     if (_p->f != nullptr) {
       if (fclose(_p->f) != 0)
@@ -897,6 +1260,7 @@ cs_time_plot_finalize(cs_time_plot_t  **p)
                   _("Error closing file: \"%s\""), _p->file_name);
     }
 
+    CS_FREE(_p->chunk_index);
     CS_FREE(_p->buffer);
     CS_FREE(_p->file_name);
     CS_FREE(_p->plot_name);
@@ -970,6 +1334,29 @@ cs_time_plot_vals_write(cs_time_plot_t  *p,
 
     break;
 
+  case CS_TIME_PLOT_BIN:
+    {
+      /* Rows are stored as (tn, t, vals), and the number of columns
+         may only change between chunks */
+
+      if (n_vals != p->n_cols) {
+        _bin_write_chunk(p);
+        p->n_cols = n_vals;
+      }
+
+      _ensure_buffer_size(p, p->buffer_end + (n_vals + 2)*sizeof(double));
+
+      double *row = (double *)(p->buffer + p->buffer_end);
+      row[0] = tn;
+      row[1] = t;
+      for (i = 0; i < n_vals; i++)
+        row[i+2] = vals[i];
+
+      p->buffer_end += (n_vals + 2)*sizeof(double);
+      p->n_rows += 1;
+    }
+    break;
+
   default:
     break;
   }
@@ -991,7 +1378,10 @@ cs_time_plot_flush(cs_time_plot_t  *p)
 {
   /* Force buffered variant output */
 
-  if (p->buffer_end > 0) {
+  if (p->format == CS_TIME_PLOT_BIN)
+    _bin_write_chunk(p);
+
+  else if (p->buffer_end > 0) {
     if (p->buffer_steps[0] > 0)
       p->buffer_steps[1] = p->buffer_steps[0];
     _plot_file_check_or_write(p);
@@ -214,6 +214,32 @@ BEGIN_C_DECLS
         Relaxation coefficient for the steady algorithm.
         \ref relxst = 1 : no relaxation.
 
+  \var  cs_time_step_options_t::rsmcoe
+        Implicit residual smoothing coefficient for the steady
+        (\ref idtvar = CS_TIME_STEP_STEADY) and local time step
+        (\ref idtvar = CS_TIME_STEP_LOCAL) algorithms.
+        When strictly positive, the velocity and pressure increments of
+        each outer iteration used in the Anderson least-squares problem
+        are smoothed by solving
+        \f$ (1 - \epsilon \Delta) \tilde{r} = r \f$ with a few Jacobi sweeps,
+        so that mixing coefficients are driven by low frequency error modes.
+        Requires \ref nandrs > 0. 0 (default): no smoothing.
+
+  \var  cs_time_step_options_t::rsmnsw
+        Number of Jacobi sweeps for the implicit residual smoothing
+        (2 by default).
+
+  \var  cs_time_step_options_t::nandrs
+        Depth of the Anderson acceleration of the outer (time step)
+        iterations for the steady and local time step algorithms, i.e.
+        number of previous velocity, pressure, and mass flux increments
+        used to extrapolate the fixed point.
+        0 (default): no acceleration.
+
+  \var  cs_time_step_options_t::andrlx
+        Relaxation coefficient for Anderson acceleration
+        (1: full Anderson update, default).
+
 */
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
@@ -268,7 +294,11 @@ static cs_time_step_options_t  _time_step_options = {
   .varrdt = 0.1,
   .dtmin  = -1.e13,
   .dtmax  = -1.e13,
-  .relxst = 0.7 /* Not used in CDO schemes */
+  .relxst = 0.7, /* Not used in CDO schemes */
+  .rsmcoe = 0.,
+  .rsmnsw = 2,
+  .nandrs = 0,
+  .andrlx = 1.
 };
 
 const cs_time_step_t  *cs_glob_time_step = &_time_step;
@@ -671,6 +701,22 @@ cs_time_step_log_setup(void)
     }
   }
 
+  /* Outer iteration acceleration */
+  if (   ts_type == CS_TIME_STEP_STEADY
+      || ts_type == CS_TIME_STEP_LOCAL) {
+    cs_log_printf
+      (CS_LOG_SETUP,
+       _("  Outer iteration acceleration\n\n"
+         "    rsmcoe:     %17.5g (Implicit residual smoothing coef.)\n"
+         "    rsmnsw:     %17d (Residual smoothing sweeps)\n"
+         "    nandrs:     %17d (Anderson acceleration depth)\n"
+         "    andrlx:     %17.5g (Anderson relaxation coefficient)\n\n"),
+       cs_glob_time_step_options->rsmcoe,
+       cs_glob_time_step_options->rsmnsw,
+       cs_glob_time_step_options->nandrs,
+       cs_glob_time_step_options->andrlx);
+  }
+
   /* Stopping criteria */
   cs_log_printf
     (CS_LOG_SETUP,
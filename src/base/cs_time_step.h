@@ -121,6 +121,21 @@ typedef struct {
 
   double    relxst; /* Relaxation coefficient for the steady algorithm. */
 
+  double    rsmcoe; /* Implicit residual smoothing coefficient for the
+                       velocity-pressure increments with the steady or
+                       local time step algorithms (0: no smoothing). */
+
+  int       rsmnsw; /* Number of Jacobi sweeps for the implicit residual
+                       smoothing. */
+
+  int       nandrs; /* Number of previous outer iterations used for
+                       Anderson acceleration of the velocity-pressure
+                       system with the steady or local time step
+                       algorithms (0: no acceleration). */
+
+  double    andrlx; /* Relaxation (mixing) coefficient for Anderson
+                       acceleration (1: no damping). */
+
 } cs_time_step_options_t;
 
 /*============================================================================
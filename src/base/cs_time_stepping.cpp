@@ -65,6 +65,7 @@
 #include "base/cs_coupling.h"
 #include "cdo/cs_domain_op.h"
 #include "cdo/cs_domain_setup.h"
+#include "base/cs_field.h"
 #include "base/cs_field_pointer.h"
 #include "base/cs_gas_mix.h"
 #include "gui/cs_gui.h"
@@ -96,6 +97,7 @@
 #include "base/cs_restart_map.h"
 #include "base/cs_runaway_check.h"
 #include "base/cs_sat_coupling.h"
+#include "base/cs_probe_spectra.h"
 #include "base/cs_solve_all.h"
 #include "base/cs_time_moment.h"
 #include "base/cs_time_step.h"
@@ -544,6 +546,7 @@ cs_time_stepping(void)
   /* Logging of initial values */
 
   cs_log_iteration();
+  cs_field_log_name_lookups(ts->nt_cur);
 
   /* Start of time loop
      ------------------ */
@@ -731,6 +734,11 @@ cs_time_stepping(void)
 
       cs_time_moment_update_all();
 
+      /* Sample values for in-situ spectra at probes
+         ------------------------------------------- */
+
+      cs_probe_spectra_update_all();
+
     }
 
     /* Update mesh (ALE)
@@ -851,6 +859,8 @@ cs_time_stepping(void)
 
       cs_log_iteration_l2residual();
 
+      cs_field_log_name_lookups(ts->nt_cur);
+
     }
 
     cs_timer_stats_stop(post_stats_id);
@@ -43,19 +43,36 @@
  *----------------------------------------------------------------------------*/
 
 #include <math.h>
+#include <stdint.h>
 #include <string.h>
 #include <time.h>
 
+#if defined(HAVE_LINUX_PERF_EVENT_H)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
 
 #include "bft/bft_error.h"
+#include "bft/bft_printf.h"
 
+#include "base/cs_log.h"
 #include "base/cs_map.h"
 #include "base/cs_mem.h"
+#include "base/cs_parall.h"
+#include "base/cs_perf_report.h"
 #include "base/cs_timer.h"
 #include "base/cs_time_plot.h"
+#include "base/cs_trace.h"
 
 /*----------------------------------------------------------------------------
  * Header for the current file
@@ -84,6 +101,25 @@ BEGIN_C_DECLS
   Timer statistics also allow for incrementing results from base timers
   (in addition to starting/stopping their own timers), so they may be used
   to assist logging and plotting of other timers.
+
+  On Linux systems, hardware performance counters (cycles, instructions,
+  and last level cache misses) may also be attached to timer statistics,
+  using \ref cs_timer_stats_set_hw_counters. Counters are summed over
+  threads and ranks, and plotted along with the timings. The ratio of
+  instructions to cycles and the number of cache misses (each of which
+  usually implies a 64-byte memory transfer) help distinguish memory-bound
+  from compute-bound stages.
+
+  Memory allocated by subsystem (based on allocation tags) may also be
+  plotted, using \ref cs_timer_stats_set_mem_tags_plot.
+
+  In parallel, a load imbalance report is added to the performance log
+  at the end of the computation (and optionally at a given time step
+  interval, using \ref cs_timer_stats_set_imbalance_log). For each
+  statistic, the minimum, mean and maximum times over ranks are compared,
+  and statistics are ranked by the wall time lost to imbalance (maximum
+  minus mean time). When barrier wait timing is active, the time spent
+  waiting for other ranks before global reductions is also shown.
 */
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
@@ -92,6 +128,10 @@ BEGIN_C_DECLS
  * Local type definitions
  *-----------------------------------------------------------------------------*/
 
+/* Hardware counters */
+
+#define CS_TIMER_STATS_N_HW  3
+
 /* Field key definitions */
 
 typedef struct {
@@ -108,6 +148,20 @@ typedef struct {
   cs_timer_counter_t   t_cur;           /* Counter since last output */
   cs_timer_counter_t   t_tot;           /* Total time counter */
 
+  uint64_t             hw_start[CS_TIMER_STATS_N_HW];  /* Hardware counters
+                                                          at start */
+  uint64_t             hw_cur[CS_TIMER_STATS_N_HW];    /* Hardware counters
+                                                          since last output */
+  uint64_t             hw_tot[CS_TIMER_STATS_N_HW];    /* Total hardware
+                                                          counters */
+
+  double               wait_start;      /* Barrier wait time at start */
+  double               wait_tot;        /* Total barrier wait time */
+
+  double               imb_t_ref;       /* Time at previous imbalance log */
+  double               imb_w_ref;       /* Barrier wait time at previous
+                                           imbalance log */
+
 } cs_timer_stats_t;
 
 /*-------------------------------------------------------------------------------
@@ -140,6 +194,28 @@ static cs_timer_stats_t  *_stats= nullptr;
 
 static cs_map_name_to_id_t  *_name_map = nullptr;
 
+/* Hardware counters (one group of file descriptors per thread) */
+
+static const char *_hw_name[] = {"cycles", "instructions", "llc_misses"};
+
+static bool             _hw_active = false;
+static int              _hw_n_fds = 0;
+static int             *_hw_fd = nullptr;
+static cs_time_plot_t  *_hw_time_plot[CS_TIMER_STATS_N_HW] = {nullptr,
+                                                              nullptr,
+                                                              nullptr};
+
+/* Memory by allocation tag */
+
+static bool             _mem_tags_plot_active = false;
+static cs_time_plot_t  *_mem_tags_time_plot = nullptr;
+
+/* Load imbalance log */
+
+static int              _imb_interval = 0;
+static int              _imb_n_top = 10;
+static int              _imb_time_id_ref = -1;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -211,6 +287,209 @@ _common_parent_id(int  id_0,
   return p0;
 }
 
+#if defined(HAVE_LINUX_PERF_EVENT_H)
+
+/*----------------------------------------------------------------------------
+ * Open a hardware counter for the calling thread.
+ *
+ * parameters:
+ *   config   <-- generic hardware event type
+ *   group_fd <-- file descriptor of group leader, or -1
+ *
+ * return:
+ *   file descriptor, or -1 in case of error
+ *----------------------------------------------------------------------------*/
+
+static int
+_hw_counter_open(uint64_t  config,
+                 int       group_fd)
+{
+  struct perf_event_attr pe;
+  memset(&pe, 0, sizeof(pe));
+
+  pe.type = PERF_TYPE_HARDWARE;
+  pe.size = sizeof(pe);
+  pe.config = config;
+  pe.disabled = (group_fd < 0) ? 1 : 0;
+  pe.exclude_kernel = 1;
+  pe.exclude_hv = 1;
+  pe.read_format =   PERF_FORMAT_GROUP
+                   | PERF_FORMAT_TOTAL_TIME_ENABLED
+                   | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+  return syscall(__NR_perf_event_open, &pe, 0, -1, group_fd, 0);
+}
+
+#endif /* defined(HAVE_LINUX_PERF_EVENT_H) */
+
+/*----------------------------------------------------------------------------
+ * Open hardware counters for all threads.
+ *
+ * return:
+ *   true if counters are available on all threads, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_hw_counters_open(void)
+{
+  bool retval = false;
+
+#if defined(HAVE_LINUX_PERF_EVENT_H)
+
+  const uint64_t config[] = {PERF_COUNT_HW_CPU_CYCLES,
+                             PERF_COUNT_HW_INSTRUCTIONS,
+                             PERF_COUNT_HW_CACHE_MISSES};
+
+  _hw_n_fds = cs_glob_n_threads;
+  CS_MALLOC(_hw_fd, _hw_n_fds*CS_TIMER_STATS_N_HW, int);
+  for (int i = 0; i < _hw_n_fds*CS_TIMER_STATS_N_HW; i++)
+    _hw_fd[i] = -1;
+
+  int n_errors = 0;
+
+  /* Counters are attached to the calling thread, so must be opened
+     by each thread */
+
+  #pragma omp parallel num_threads(_hw_n_fds) reduction(+:n_errors)
+  {
+    int *fd = _hw_fd + cs_get_thread_id()*CS_TIMER_STATS_N_HW;
+    fd[0] = _hw_counter_open(config[0], -1);
+    for (int j = 1; j < CS_TIMER_STATS_N_HW; j++) {
+      if (fd[0] > -1)
+        fd[j] = _hw_counter_open(config[j], fd[0]);
+    }
+    for (int j = 0; j < CS_TIMER_STATS_N_HW; j++) {
+      if (fd[j] < 0)
+        n_errors += 1;
+    }
+    if (fd[0] > -1)
+      ioctl(fd[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+
+  retval = (n_errors == 0) ? true : false;
+
+#endif /* defined(HAVE_LINUX_PERF_EVENT_H) */
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Close hardware counters.
+ *----------------------------------------------------------------------------*/
+
+static void
+_hw_counters_close(void)
+{
+#if defined(HAVE_LINUX_PERF_EVENT_H)
+  for (int i = 0; i < _hw_n_fds*CS_TIMER_STATS_N_HW; i++) {
+    if (_hw_fd[i] > -1)
+      close(_hw_fd[i]);
+  }
+#endif
+
+  CS_FREE(_hw_fd);
+  _hw_n_fds = 0;
+  _hw_active = false;
+}
+
+/*----------------------------------------------------------------------------
+ * Read hardware counters, summed over threads.
+ *
+ * Counts are scaled in case of counter multiplexing.
+ *
+ * parameters:
+ *   c --> counter values
+ *----------------------------------------------------------------------------*/
+
+static void
+_hw_counters_read(uint64_t  c[CS_TIMER_STATS_N_HW])
+{
+  for (int j = 0; j < CS_TIMER_STATS_N_HW; j++)
+    c[j] = 0;
+
+#if defined(HAVE_LINUX_PERF_EVENT_H)
+
+  /* Group read format: nr, time_enabled, time_running, values[nr] */
+
+  uint64_t buf[3 + CS_TIMER_STATS_N_HW];
+
+  for (int i = 0; i < _hw_n_fds; i++) {
+    int fd = _hw_fd[i*CS_TIMER_STATS_N_HW];
+    if (read(fd, buf, sizeof(buf)) < (ssize_t)(4*sizeof(uint64_t)))
+      continue;
+    double scale = 1.;
+    if (buf[2] > 0 && buf[2] < buf[1])
+      scale = (double)buf[1] / (double)buf[2];
+    for (int j = 0; j < CS_TIMER_STATS_N_HW && j < (int)buf[0]; j++)
+      c[j] += (uint64_t)(buf[3+j]*scale);
+  }
+
+#endif /* defined(HAVE_LINUX_PERF_EVENT_H) */
+}
+
+/*----------------------------------------------------------------------------
+ * Add difference of hardware counters.
+ *
+ * As counts are scaled independently at each read in case of counter
+ * multiplexing, a change in the multiplexing ratio between two reads may
+ * lead to an end value lower than the start value; such differences are
+ * clamped to 0 rather than wrapped around.
+ *
+ * parameters:
+ *   c_sum <-> sum of counters
+ *   c0    <-- counters at start
+ *   c1    <-- counters at end
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_hw_counters_add_diff(uint64_t        c_sum[CS_TIMER_STATS_N_HW],
+                      const uint64_t  c0[CS_TIMER_STATS_N_HW],
+                      const uint64_t  c1[CS_TIMER_STATS_N_HW])
+{
+  for (int j = 0; j < CS_TIMER_STATS_N_HW; j++) {
+    if (c1[j] > c0[j])
+      c_sum[j] += c1[j] - c0[j];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Sum hardware counters of plotted statistics over ranks.
+ *
+ * parameters:
+ *   vals --> summed values for plotted statistics (interlaced by counter)
+ *
+ * return:
+ *   number of plotted statistics
+ *----------------------------------------------------------------------------*/
+
+static int
+_hw_counters_plot_sum(double  vals[])
+{
+  int stats_count = 0;
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+    cs_timer_stats_t  *s = _stats + stats_id;
+    if (s->plot) {
+      for (int j = 0; j < CS_TIMER_STATS_N_HW; j++)
+        vals[stats_count*CS_TIMER_STATS_N_HW + j] = s->hw_cur[j];
+      stats_count++;
+    }
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    int n = stats_count*CS_TIMER_STATS_N_HW;
+    double *w;
+    CS_MALLOC(w, n, double);
+    MPI_Reduce(vals, w, n, MPI_DOUBLE, MPI_SUM, 0, cs_glob_mpi_comm);
+    memcpy(vals, w, n*sizeof(double));
+    CS_FREE(w);
+  }
+#endif
+
+  return stats_count;
+}
+
 /*----------------------------------------------------------------------------
  * Create time plots
  *----------------------------------------------------------------------------*/
@@ -243,6 +522,24 @@ _build_time_plot(void)
                                          nullptr,
                                          stats_labels);
 
+  if (stats_count > 0 && _hw_active) {
+    for (int j = 0; j < CS_TIMER_STATS_N_HW; j++) {
+      char plot_name[64];
+      snprintf(plot_name, 63, "timer_stats_%s", _hw_name[j]);
+      plot_name[63] = '\0';
+      _hw_time_plot[j] = cs_time_plot_init_probe(plot_name,
+                                                 "",
+                                                 _plot_format,
+                                                 true,
+                                                 _plot_flush_wtime,
+                                                 _plot_buffer_steps,
+                                                 stats_count,
+                                                 nullptr,
+                                                 nullptr,
+                                                 stats_labels);
+    }
+  }
+
   CS_FREE(stats_labels);
 }
 
@@ -277,6 +574,321 @@ _output_time_plot(void)
   CS_FREE(vals);
 }
 
+/*----------------------------------------------------------------------------
+ * Output hardware counter time plots
+ *
+ * parameters:
+ *   hw_vals <-- counter values of plotted statistics (interlaced)
+ *   n_vals  <-- number of plotted statistics
+ *----------------------------------------------------------------------------*/
+
+static void
+_output_hw_time_plot(const double  hw_vals[],
+                     int           n_vals)
+{
+  cs_real_t *vals;
+  CS_MALLOC(vals, n_vals, cs_real_t);
+
+  for (int j = 0; j < CS_TIMER_STATS_N_HW; j++) {
+
+    if (_hw_time_plot[j] == nullptr)
+      continue;
+
+    for (int i = 0; i < n_vals; i++)
+      vals[i] = hw_vals[i*CS_TIMER_STATS_N_HW + j];
+
+    cs_time_plot_vals_write(_hw_time_plot[j],
+                            _time_id,
+                            -1.,
+                            n_vals,
+                            vals);
+
+  }
+
+  CS_FREE(vals);
+}
+
+/*----------------------------------------------------------------------------
+ * Output memory by allocation tag time plot.
+ *
+ * The maximum over ranks of each tag's peak allocation size since the
+ * previous output is plotted (in MiB). This is a collective operation.
+ *----------------------------------------------------------------------------*/
+
+static void
+_output_mem_tags_time_plot(void)
+{
+  const int n_tags = CS_MEM_N_TAGS - 1;
+
+  uint64_t alloc_cur[CS_MEM_N_TAGS], alloc_max[CS_MEM_N_TAGS];
+  cs_mem_tag_sample(alloc_cur, alloc_max);
+
+  cs_real_t vals[CS_MEM_N_TAGS];
+  for (int i = 0; i < n_tags; i++)
+    vals[i] = alloc_max[i+1] / (1024.*1024.);
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_real_t vals_l[CS_MEM_N_TAGS];
+    memcpy(vals_l, vals, n_tags*sizeof(cs_real_t));
+    MPI_Reduce(vals_l, vals, n_tags, CS_MPI_REAL, MPI_MAX,
+               0, cs_glob_mpi_comm);
+  }
+#endif
+
+  if (cs_glob_rank_id > 0)
+    return;
+
+  if (_mem_tags_time_plot == nullptr) {
+    const char *labels[CS_MEM_N_TAGS];
+    for (int i = 0; i < n_tags; i++)
+      labels[i] = cs_mem_tag_name((cs_mem_tag_t)(i+1));
+    _mem_tags_time_plot = cs_time_plot_init_probe("timer_stats_memory_tags",
+                                                  "",
+                                                  _plot_format,
+                                                  true,
+                                                  _plot_flush_wtime,
+                                                  _plot_buffer_steps,
+                                                  n_tags,
+                                                  nullptr,
+                                                  nullptr,
+                                                  labels);
+  }
+
+  cs_time_plot_vals_write(_mem_tags_time_plot,
+                          _time_id,
+                          -1.,
+                          n_tags,
+                          vals);
+}
+
+/*----------------------------------------------------------------------------
+ * Log hardware counter totals, summed over ranks.
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_hw_counters(void)
+{
+  int n = _n_stats*CS_TIMER_STATS_N_HW;
+  double *c;
+  CS_MALLOC(c, n, double);
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+    cs_timer_stats_t  *s = _stats + stats_id;
+    for (int j = 0; j < CS_TIMER_STATS_N_HW; j++)
+      c[stats_id*CS_TIMER_STATS_N_HW + j] = s->hw_tot[j] + s->hw_cur[j];
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    double *w;
+    CS_MALLOC(w, n, double);
+    MPI_Allreduce(c, w, n, MPI_DOUBLE, MPI_SUM, cs_glob_mpi_comm);
+    memcpy(c, w, n*sizeof(double));
+    CS_FREE(w);
+  }
+#endif
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Hardware counters for timer statistics "
+                  "(summed over threads and ranks):\n\n"
+                  "  %-32s %12s %12s %6s %8s\n"),
+                _("statistic"), _("cycles"), _("instr."), _("IPC"),
+                _("LLC MPKI"));
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+    cs_timer_stats_t  *s = _stats + stats_id;
+    const double *cv = c + stats_id*CS_TIMER_STATS_N_HW;
+    if (cv[0] <= 0)
+      continue;
+    double ipc = cv[1] / cv[0];
+    double mpki = (cv[1] > 0) ? cv[2] / cv[1] * 1e3 : 0;
+    int depth = 0;
+    for (int p_id = s->parent_id; p_id > -1; p_id = _stats[p_id].parent_id)
+      depth++;
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %*s%-*s %12.5e %12.5e %6.2f %8.3f\n",
+                  2*depth, "", 32 - 2*depth, s->label,
+                  cv[0], cv[1], ipc, mpki);
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+  cs_log_separator(CS_LOG_PERFORMANCE);
+
+  CS_FREE(c);
+}
+
+/*----------------------------------------------------------------------------
+ * Return current time and barrier wait time of a statistic.
+ *
+ * parameters:
+ *   s <-- pointer to statistic
+ *   t --> total time
+ *   w --> total barrier wait time
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_stat_times(const cs_timer_stats_t  *s,
+            double                  *t,
+            double                  *w)
+{
+  *t = (s->t_tot.nsec + s->t_cur.nsec)*1e-9;
+  *w = s->wait_tot;
+}
+
+/*----------------------------------------------------------------------------
+ * Log load imbalance for timer statistics, and optionally add it to the
+ * performance report.
+ *
+ * Times are those since the previous call (or since the start if
+ * final is true).
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   final <-- true for the final report (whole computation)
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_imbalance(bool  final)
+{
+  const int n = _n_stats;
+  const bool log_wait = cs_glob_parall_barrier_wait;
+
+  /* Local time and barrier wait time, and their sum, min and max
+     over ranks */
+
+  double *v_loc, *v_sum, *v_min, *v_max;
+  CS_MALLOC(v_loc, n*8, double);
+  v_sum = v_loc + n*2;
+  v_min = v_loc + n*4;
+  v_max = v_loc + n*6;
+
+  for (int stats_id = 0; stats_id < n; stats_id++) {
+    cs_timer_stats_t  *s = _stats + stats_id;
+    double t, w;
+    _stat_times(s, &t, &w);
+    if (final == false) {
+      t -= s->imb_t_ref;
+      w -= s->imb_w_ref;
+    }
+    v_loc[stats_id*2] = t;
+    v_loc[stats_id*2 + 1] = w;
+  }
+
+#if defined(HAVE_MPI)
+  MPI_Allreduce(v_loc, v_sum, n*2, MPI_DOUBLE, MPI_SUM, cs_glob_mpi_comm);
+  MPI_Allreduce(v_loc, v_min, n*2, MPI_DOUBLE, MPI_MIN, cs_glob_mpi_comm);
+  MPI_Allreduce(v_loc, v_max, n*2, MPI_DOUBLE, MPI_MAX, cs_glob_mpi_comm);
+#else
+  for (int i = 0; i < n*2; i++) {
+    v_sum[i] = v_loc[i];
+    v_min[i] = v_loc[i];
+    v_max[i] = v_loc[i];
+  }
+#endif
+
+  const double n_ranks = cs_glob_n_ranks;
+
+  /* Rank statistics by time lost */
+
+  int *order;
+  double *lost;
+  CS_MALLOC(order, n, int);
+  CS_MALLOC(lost, n, double);
+
+  /* Root statistics measure the elapsed time, so are ignored */
+
+  int n_ordered = 0;
+  for (int stats_id = 0; stats_id < n; stats_id++) {
+    double t_mean = v_sum[stats_id*2] / n_ranks;
+    lost[stats_id] = v_max[stats_id*2] - t_mean;
+    if (v_max[stats_id*2] > 0 && (_stats + stats_id)->parent_id > -1)
+      order[n_ordered++] = stats_id;
+  }
+
+  for (int i = 1; i < n_ordered; i++) {
+    int k = order[i];
+    int j = i;
+    for (; j > 0 && lost[order[j-1]] < lost[k]; j--)
+      order[j] = order[j-1];
+    order[j] = k;
+  }
+
+  if (final)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Load imbalance for timer statistics "
+                    "(whole computation):\n\n"));
+  else
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Load imbalance for timer statistics "
+                    "(time steps %d to %d):\n\n"),
+                  _imb_time_id_ref + 1, _time_id);
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "  %-32s %10s %10s %10s %9s %10s",
+                _("statistic"), _("min (s)"), _("mean (s)"), _("max (s)"),
+                _("max/mean"), _("lost (s)"));
+  if (log_wait)
+    cs_log_printf(CS_LOG_PERFORMANCE, " %10s %10s",
+                  _("wait mean"), _("wait max"));
+  cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+
+  int n_log = (_imb_n_top < n_ordered) ? _imb_n_top : n_ordered;
+
+  for (int i = 0; i < n_log; i++) {
+    int stats_id = order[i];
+    cs_timer_stats_t  *s = _stats + stats_id;
+    double t_mean = v_sum[stats_id*2] / n_ranks;
+    double ratio = (t_mean > 0) ? v_max[stats_id*2] / t_mean : 1.;
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %-32.32s %10.4g %10.4g %10.4g %9.3f %10.4g",
+                  s->label, v_min[stats_id*2], t_mean, v_max[stats_id*2],
+                  ratio, lost[stats_id]);
+    if (log_wait)
+      cs_log_printf(CS_LOG_PERFORMANCE, " %10.4g %10.4g",
+                    v_sum[stats_id*2 + 1] / n_ranks,
+                    v_max[stats_id*2 + 1]);
+    cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+  cs_log_separator(CS_LOG_PERFORMANCE);
+
+  /* Add to performance report */
+
+  if (final) {
+    for (int i = 0; i < n_ordered; i++) {
+      int stats_id = order[i];
+      double t_mean = v_sum[stats_id*2] / n_ranks;
+      const char *keys[] = {"wall_time", "time_lost", "imbalance_ratio",
+                            "barrier_wait"};
+      double vals[] = {v_loc[stats_id*2],
+                       lost[stats_id],
+                       (t_mean > 0) ? v_max[stats_id*2] / t_mean : 1.,
+                       v_loc[stats_id*2 + 1]};
+      cs_perf_report_add("load_imbalance",
+                         cs_map_name_to_id_reverse(_name_map, stats_id),
+                         (log_wait) ? 4 : 3, keys, vals);
+    }
+  }
+
+  /* Update references */
+
+  for (int stats_id = 0; stats_id < n; stats_id++) {
+    cs_timer_stats_t  *s = _stats + stats_id;
+    _stat_times(s, &(s->imb_t_ref), &(s->imb_w_ref));
+  }
+  _imb_time_id_ref = _time_id;
+
+  CS_FREE(lost);
+  CS_FREE(order);
+  CS_FREE(v_loc);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -329,6 +941,39 @@ cs_timer_stats_finalize(void)
   if (_time_plot != nullptr)
     cs_time_plot_finalize(&_time_plot);
 
+  for (int j = 0; j < CS_TIMER_STATS_N_HW; j++) {
+    if (_hw_time_plot[j] != nullptr)
+      cs_time_plot_finalize(&(_hw_time_plot[j]));
+  }
+
+  if (_mem_tags_time_plot != nullptr)
+    cs_time_plot_finalize(&_mem_tags_time_plot);
+
+  if (_hw_active)
+    _log_hw_counters();
+
+  if (_imb_interval > -1 && cs_glob_n_ranks > 1)
+    _log_imbalance(true);
+
+  /* Add totals to performance report */
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+    cs_timer_stats_t  *s = _stats + stats_id;
+    const char *keys[] = {"wall_time",
+                          _hw_name[0], _hw_name[1], _hw_name[2]};
+    double vals[] = {(s->t_tot.nsec + s->t_cur.nsec)*1e-9,
+                     (double)(s->hw_tot[0] + s->hw_cur[0]),
+                     (double)(s->hw_tot[1] + s->hw_cur[1]),
+                     (double)(s->hw_tot[2] + s->hw_cur[2])};
+    int n_keys = (_hw_active) ? 1 + CS_TIMER_STATS_N_HW : 1;
+    cs_perf_report_add("timer_stats",
+                       cs_map_name_to_id_reverse(_name_map, stats_id),
+                       n_keys, keys, vals);
+  }
+
+  if (_hw_active)
+    _hw_counters_close();
+
   _time_id = -1;
 
   for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
@@ -396,6 +1041,128 @@ cs_timer_stats_set_plot_options(cs_time_plot_format_t   format,
   _plot_flush_wtime = flush_wtime;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate hardware performance counters for
+ *        timer statistics.
+ *
+ * Cycles, instructions, and last level cache misses are counted for each
+ * statistic (in user mode only), using the Linux perf_event interface.
+ * If counters are not available on all threads and ranks (due to
+ * missing kernel or hardware support, or to restrictions set through
+ * /proc/sys/kernel/perf_event_paranoid), a warning is logged and
+ * counters remain inactive.
+ *
+ * Counters are plotted along with timings (in "timer_stats_cycles",
+ * "timer_stats_instructions" and "timer_stats_llc_misses"), so
+ * this function is only fully effective before the first call to
+ * \ref cs_timer_stats_increment_time_step.
+ *
+ * This function is collective.
+ *
+ * \param[in]  active  true to activate counters, false to deactivate them
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_hw_counters(bool  active)
+{
+  if (active == _hw_active)
+    return;
+
+  if (active == false) {
+    _hw_counters_close();
+    return;
+  }
+
+  int ok = (_hw_counters_open()) ? 1 : 0;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    int ok_l = ok;
+    MPI_Allreduce(&ok_l, &ok, 1, MPI_INT, MPI_MIN, cs_glob_mpi_comm);
+  }
+#endif
+
+  if (ok == 0) {
+    bft_printf(_("\n"
+                 "Warning: hardware performance counters are not available\n"
+                 "         for timer statistics on this system.\n"));
+    _hw_counters_close();
+    return;
+  }
+
+  _hw_active = true;
+
+  /* Initialize counters of already active statistics */
+
+  uint64_t hw_start[CS_TIMER_STATS_N_HW];
+  _hw_counters_read(hw_start);
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+    cs_timer_stats_t  *s = _stats + stats_id;
+    if (s->active)
+      memcpy(s->hw_start, hw_start, sizeof(hw_start));
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate plotting of memory by allocation tag.
+ *
+ * When active, the maximum over ranks of the peak memory allocated for
+ * each tag (see \ref cs_mem_tag_push) since the previous output is
+ * plotted at the timer statistics plot frequency, in
+ * "timer_stats_memory_tags". Peaks reached inside a time step, for example
+ * during a linear solver setup, are thus captured.
+ *
+ * This function is collective.
+ *
+ * \param[in]  active  true to activate plotting, false to deactivate it
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_mem_tags_plot(bool  active)
+{
+  _mem_tags_plot_active = active;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set load imbalance logging options.
+ *
+ * In parallel, a load imbalance report for the whole computation is
+ * logged by default at finalization. An intermediate report may also be
+ * logged periodically, in which case it covers the time steps since the
+ * previous report.
+ *
+ * Barrier wait timing inserts an MPI barrier before global reductions so
+ * that the time spent waiting for other ranks may be attributed to the
+ * active statistics. It adds synchronization points, so it is not
+ * active by default.
+ *
+ * \param[in]  interval      time step interval for intermediate reports,
+ *                           0 for the final report only, or < 0 to
+ *                           deactivate imbalance reports
+ * \param[in]  n_top         number of statistics with the highest time
+ *                           lost to imbalance to log
+ * \param[in]  barrier_wait  true to time waits before global reductions
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_imbalance_log(int   interval,
+                                 int   n_top,
+                                 bool  barrier_wait)
+{
+  _imb_interval = interval;
+  if (n_top > 0)
+    _imb_n_top = n_top;
+
+  cs_parall_set_barrier_wait(barrier_wait && interval > -1);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Increment time step for timer statistics.
@@ -407,6 +1174,13 @@ cs_timer_stats_increment_time_step(void)
 {
   cs_timer_t t_incr = cs_timer_time();
 
+  uint64_t hw_incr[CS_TIMER_STATS_N_HW];
+  if (_hw_active)
+    _hw_counters_read(hw_incr);
+
+  const bool wait_active = cs_glob_parall_barrier_wait;
+  double w_incr = (wait_active) ? cs_parall_get_barrier_wait_time() : 0;
+
   /* Update start and current time for active statistics
      (should be only root statistics if used properly) */
 
@@ -415,9 +1189,27 @@ cs_timer_stats_increment_time_step(void)
     if (s->active) {
       cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_incr);
       s->t_start = t_incr;
+      if (_hw_active) {
+        _hw_counters_add_diff(s->hw_cur, s->hw_start, hw_incr);
+        memcpy(s->hw_start, hw_incr, sizeof(hw_incr));
+      }
+      if (wait_active) {
+        s->wait_tot += w_incr - s->wait_start;
+        s->wait_start = w_incr;
+      }
     }
   }
 
+  /* Periodic load imbalance log (collective operation) */
+
+  if (   _imb_interval > 0 && cs_glob_n_ranks > 1
+      && _time_id > _start_time_id
+      && (_time_id - _start_time_id) % _imb_interval == 0) {
+    if (_imb_time_id_ref < 0)
+      _imb_time_id_ref = _start_time_id;
+    _log_imbalance(false);
+  }
+
   /* Now output data */
 
   if (   _time_plot == nullptr && _time_id < _start_time_id + 1
@@ -429,10 +1221,28 @@ cs_timer_stats_increment_time_step(void)
     if (_time_plot != nullptr)
       _output_time_plot();
 
+    /* Hardware counters are summed over ranks (collective operation) */
+
+    if (_hw_active) {
+      double *hw_vals;
+      CS_MALLOC(hw_vals, _n_stats*CS_TIMER_STATS_N_HW, double);
+      int n_vals = _hw_counters_plot_sum(hw_vals);
+      if (_time_plot != nullptr)
+        _output_hw_time_plot(hw_vals, n_vals);
+      CS_FREE(hw_vals);
+    }
+
+    if (_mem_tags_plot_active)
+      _output_mem_tags_time_plot();
+
     for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
       cs_timer_stats_t  *s = _stats + stats_id;
       CS_TIMER_COUNTER_ADD(s->t_tot, s->t_tot, s->t_cur);
       CS_TIMER_COUNTER_INIT(s->t_cur);
+      for (int j = 0; j < CS_TIMER_STATS_N_HW; j++) {
+        s->hw_tot[j] += s->hw_cur[j];
+        s->hw_cur[j] = 0;
+      }
     }
 
   }
@@ -538,6 +1348,17 @@ cs_timer_stats_create(const char  *parent_name,
   CS_TIMER_COUNTER_INIT(s->t_cur);
   CS_TIMER_COUNTER_INIT(s->t_tot);
 
+  for (int j = 0; j < CS_TIMER_STATS_N_HW; j++) {
+    s->hw_start[j] = 0;
+    s->hw_cur[j] = 0;
+    s->hw_tot[j] = 0;
+  }
+
+  s->wait_start = 0;
+  s->wait_tot = 0;
+  s->imb_t_ref = 0;
+  s->imb_w_ref = 0;
+
   return stats_id;
 }
 
@@ -637,6 +1458,13 @@ cs_timer_stats_start(int  id)
   if (! _is_parent(_active_id[root_id], id))
     return;
 
+  uint64_t hw_start[CS_TIMER_STATS_N_HW];
+  if (_hw_active)
+    _hw_counters_read(hw_start);
+
+  double w_start = (cs_glob_parall_barrier_wait) ?
+    cs_parall_get_barrier_wait_time() : 0;
+
   int parent_id = _common_parent_id(id, _active_id[root_id]);
 
   /* Start timer and inactive parents */
@@ -648,6 +1476,9 @@ cs_timer_stats_start(int  id)
     if (s->active == false) {
       s->active = true;
       s->t_start = t_start;
+      s->wait_start = w_start;
+      if (_hw_active)
+        memcpy(s->hw_start, hw_start, sizeof(hw_start));
     }
 
   }
@@ -674,6 +1505,13 @@ cs_timer_stats_stop(int  id)
 
   cs_timer_t t_stop = cs_timer_time();
 
+  uint64_t hw_stop[CS_TIMER_STATS_N_HW];
+  if (_hw_active)
+    _hw_counters_read(hw_stop);
+
+  const bool wait_active = cs_glob_parall_barrier_wait;
+  double w_stop = (wait_active) ? cs_parall_get_barrier_wait_time() : 0;
+
   /* Stop timer and active children */
 
   const int root_id = s->root_id;
@@ -686,6 +1524,14 @@ cs_timer_stats_stop(int  id)
       s->active = false;
       _active_id[root_id] = s->parent_id;
       cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_stop);
+      if (_hw_active)
+        _hw_counters_add_diff(s->hw_cur, s->hw_start, hw_stop);
+      if (wait_active)
+        s->wait_tot += w_stop - s->wait_start;
+      if (cs_glob_trace_active)
+        cs_trace_add("timer_stats", s->label,
+                     cs_map_name_to_id_reverse(_name_map, root_id),
+                     &(s->t_start), &t_stop);
     }
 
   }
@@ -721,6 +1567,13 @@ cs_timer_stats_switch(int  id)
   if (_active_id[root_id] == id)
     return retval; /* Nothing to do, already current */
 
+  uint64_t hw_switch[CS_TIMER_STATS_N_HW];
+  if (_hw_active)
+    _hw_counters_read(hw_switch);
+
+  const bool wait_active = cs_glob_parall_barrier_wait;
+  double w_switch = (wait_active) ? cs_parall_get_barrier_wait_time() : 0;
+
   int parent_id = _common_parent_id(id, _active_id[root_id]);
 
   /* Stop all active timers of same type which are lower level than the
@@ -734,6 +1587,14 @@ cs_timer_stats_switch(int  id)
       s->active = false;
       _active_id[root_id] = s->parent_id;
       cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_switch);
+      if (_hw_active)
+        _hw_counters_add_diff(s->hw_cur, s->hw_start, hw_switch);
+      if (wait_active)
+        s->wait_tot += w_switch - s->wait_start;
+      if (cs_glob_trace_active)
+        cs_trace_add("timer_stats", s->label,
+                     cs_map_name_to_id_reverse(_name_map, root_id),
+                     &(s->t_start), &t_switch);
     }
 
   }
@@ -748,6 +1609,9 @@ cs_timer_stats_switch(int  id)
     if (s->active == false) {
       s->active = true;
       s->t_start = t_switch;
+      s->wait_start = w_switch;
+      if (_hw_active)
+        memcpy(s->hw_start, hw_switch, sizeof(hw_switch));
     }
 
   }
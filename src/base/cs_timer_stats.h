@@ -105,6 +105,79 @@ cs_timer_stats_set_plot_options(cs_time_plot_format_t   format,
                                 int                     n_buffer_steps,
                                 double                  flush_wtime);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate hardware performance counters for
+ *        timer statistics.
+ *
+ * Cycles, instructions, and last level cache misses are counted for each
+ * statistic (in user mode only), using the Linux perf_event interface.
+ * If counters are not available on all threads and ranks (due to
+ * missing kernel or hardware support, or to restrictions set through
+ * /proc/sys/kernel/perf_event_paranoid), a warning is logged and
+ * counters remain inactive.
+ *
+ * Counters are plotted along with timings (in "timer_stats_cycles",
+ * "timer_stats_instructions" and "timer_stats_llc_misses"), so
+ * this function is only fully effective before the first call to
+ * \ref cs_timer_stats_increment_time_step.
+ *
+ * This function is collective.
+ *
+ * \param[in]  active  true to activate counters, false to deactivate them
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_hw_counters(bool  active);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate plotting of memory by allocation tag.
+ *
+ * When active, the maximum over ranks of the peak memory allocated for
+ * each tag (see \ref cs_mem_tag_push) since the previous output is
+ * plotted at the timer statistics plot frequency, in
+ * "timer_stats_memory_tags". Peaks reached inside a time step, for example
+ * during a linear solver setup, are thus captured.
+ *
+ * This function is collective.
+ *
+ * \param[in]  active  true to activate plotting, false to deactivate it
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_mem_tags_plot(bool  active);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set load imbalance logging options.
+ *
+ * In parallel, a load imbalance report for the whole computation is
+ * logged by default at finalization. An intermediate report may also be
+ * logged periodically, in which case it covers the time steps since the
+ * previous report.
+ *
+ * Barrier wait timing inserts an MPI barrier before global reductions so
+ * that the time spent waiting for other ranks may be attributed to the
+ * active statistics. It adds synchronization points, so it is not
+ * active by default.
+ *
+ * \param[in]  interval      time step interval for intermediate reports,
+ *                           0 for the final report only, or < 0 to
+ *                           deactivate imbalance reports
+ * \param[in]  n_top         number of statistics with the highest time
+ *                           lost to imbalance to log
+ * \param[in]  barrier_wait  true to time waits before global reductions
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_imbalance_log(int   interval,
+                                 int   n_top,
+                                 bool  barrier_wait);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Increment time step for timer statistics.
@@ -0,0 +1,549 @@
+/*============================================================================
+ * Timeline tracing of solver phases and communication.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2025 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "base/cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft/bft_printf.h"
+
+#include "base/cs_base.h"
+#include "base/cs_log.h"
+#include "base/cs_map.h"
+#include "base/cs_mem.h"
+#include "base/cs_timer.h"
+
+/*----------------------------------------------------------------------------
+ * Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "base/cs_trace.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_trace.cpp
+        Timeline tracing of solver phases and communication.
+
+  When the CS_TRACE environment variable is set, timer statistics regions,
+  linear system solves, halo exchanges, all-to-all exchanges and
+  post-processing output are recorded with their start and end times
+  on each thread, in a memory buffer of bounded size.
+
+  At the end of the computation, events are written in Chrome trace
+  (JSON) format, in a "trace.json" file, or one "trace_r<rank>.json" file
+  per rank in parallel. Such files may be merged with the
+  extras/script/cs_trace_merge.py script, and viewed with
+  https://ui.perfetto.dev or chrome://tracing.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Default maximum number of events */
+
+#define CS_TRACE_DEFAULT_MAX_EVENTS  1000000
+
+/* Maximum nesting depth of regions per thread */
+
+#define CS_TRACE_MAX_DEPTH  64
+
+/*=============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Complete event */
+
+typedef struct {
+
+  int     name_id;      /* Event name id */
+  int     category_id;  /* Event category id */
+  int     tid;          /* Thread or lane id */
+
+  double  ts;           /* Start time stamp (microseconds) */
+  double  dur;          /* Duration (microseconds) */
+
+} cs_trace_event_t;
+
+/* Open region */
+
+typedef struct {
+
+  int         name_id;      /* Region name id */
+  int         category_id;  /* Region category id */
+  cs_timer_t  t_start;      /* Start time */
+
+} cs_trace_region_t;
+
+/* Per-thread region stack */
+
+typedef struct {
+
+  int                 depth;           /* Current depth */
+  int                 n_overflow;      /* Regions ignored due to depth */
+  cs_trace_region_t   region[CS_TRACE_MAX_DEPTH];
+
+} cs_trace_stack_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static size_t             _max_events = 0;
+static size_t             _n_events = 0;
+static size_t             _n_dropped = 0;
+static cs_trace_event_t  *_events = nullptr;
+
+static int                _n_stacks = 0;
+static cs_trace_stack_t  *_stacks = nullptr;
+
+static cs_timer_t         _t_origin;
+
+static cs_map_name_to_id_t  *_names = nullptr;
+static cs_map_name_to_id_t  *_lanes = nullptr;
+
+/*============================================================================
+ * Global variables
+ *============================================================================*/
+
+bool cs_glob_trace_active = false;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return id associated with a name, adding it if needed.
+ *
+ * parameters:
+ *   m    <-> name to id map
+ *   name <-- name
+ *
+ * return:
+ *   associated id
+ *----------------------------------------------------------------------------*/
+
+static int
+_name_id(cs_map_name_to_id_t  *m,
+         const char           *name)
+{
+  int id;
+
+  #pragma omp critical(cs_trace_name_id)
+  id = cs_map_name_to_id(m, name);
+
+  return id;
+}
+
+/*----------------------------------------------------------------------------
+ * Convert a time to a time stamp in microseconds.
+ *
+ * parameters:
+ *   t <-- time
+ *
+ * return:
+ *   time stamp relative to tracing origin
+ *----------------------------------------------------------------------------*/
+
+static inline double
+_time_stamp(const cs_timer_t  *t)
+{
+  return   (t->sec - _t_origin.sec)*1e6
+         + (t->nsec - _t_origin.nsec)*1e-3;
+}
+
+/*----------------------------------------------------------------------------
+ * Record a complete event.
+ *
+ * parameters:
+ *   name_id     <-- event name id
+ *   category_id <-- event category id
+ *   tid         <-- thread or lane id
+ *   t0          <-- start time
+ *   t1          <-- end time
+ *----------------------------------------------------------------------------*/
+
+static void
+_record(int                name_id,
+        int                category_id,
+        int                tid,
+        const cs_timer_t  *t0,
+        const cs_timer_t  *t1)
+{
+  size_t e_id;
+
+  #pragma omp atomic capture
+  e_id = _n_events++;
+
+  if (e_id >= _max_events) {
+    #pragma omp atomic
+    _n_dropped++;
+    return;
+  }
+
+  cs_trace_event_t *e = _events + e_id;
+
+  e->name_id = name_id;
+  e->category_id = category_id;
+  e->tid = tid;
+  e->ts = _time_stamp(t0);
+  e->dur = _time_stamp(t1) - e->ts;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a JSON string, with required escapes.
+ *
+ * parameters:
+ *   f <-- output file
+ *   s <-- string to write
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_json_str(FILE        *f,
+                const char  *s)
+{
+  fputc('"', f);
+  for (const char *p = s; *p != '\0'; p++) {
+    unsigned char c = (unsigned char)(*p);
+    if (c == '"' || c == '\\')
+      fprintf(f, "\\%c", c);
+    else if (c < 0x20)
+      fprintf(f, "\\u%04x", (unsigned)c);
+    else
+      fputc(c, f);
+  }
+  fputc('"', f);
+}
+
+/*----------------------------------------------------------------------------
+ * Write trace file for the local rank.
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_trace(void)
+{
+  char file_name[64];
+
+  if (cs_glob_n_ranks > 1) {
+    int n_dec = 1;
+    for (int i = cs_glob_n_ranks; i >= 10; i /= 10, n_dec += 1);
+    snprintf(file_name, 63, "trace_r%0*d.json", n_dec, cs_glob_rank_id);
+  }
+  else
+    strcpy(file_name, "trace.json");
+  file_name[63] = '\0';
+
+  FILE *f = fopen(file_name, "w");
+
+  if (f == nullptr) {
+    bft_printf(_("\n"
+                 "Warning: trace file \"%s\" could not be opened: %s\n"),
+               file_name, strerror(errno));
+    return;
+  }
+
+  const int pid = cs::max(cs_glob_rank_id, 0);
+  const size_t n_events = cs::min(_n_events, _max_events);
+
+  fprintf(f, "{\"traceEvents\":[\n");
+
+  /* Metadata */
+
+  fprintf(f,
+          "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":0,"
+          "\"args\":{\"name\":\"rank %d\"}},\n"
+          "{\"name\":\"process_sort_index\",\"ph\":\"M\",\"pid\":%d,"
+          "\"tid\":0,\"args\":{\"sort_index\":%d}}",
+          pid, pid, pid, pid);
+
+  for (int t_id = 0; t_id < _n_stacks; t_id++)
+    fprintf(f,
+            ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,"
+            "\"args\":{\"name\":\"thread %d\"}}",
+            pid, t_id, t_id);
+
+  int n_lanes = cs_map_name_to_id_size(_lanes);
+  for (int l_id = 0; l_id < n_lanes; l_id++) {
+    fprintf(f,
+            ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,"
+            "\"args\":{\"name\":",
+            pid, _n_stacks + l_id);
+    _write_json_str(f, cs_map_name_to_id_reverse(_lanes, l_id));
+    fprintf(f, "}}");
+  }
+
+  /* Events */
+
+  for (size_t e_id = 0; e_id < n_events; e_id++) {
+    const cs_trace_event_t *e = _events + e_id;
+    fprintf(f, ",\n{\"name\":");
+    _write_json_str(f, cs_map_name_to_id_reverse(_names, e->name_id));
+    fprintf(f, ",\"cat\":");
+    _write_json_str(f, cs_map_name_to_id_reverse(_names, e->category_id));
+    fprintf(f, ",\"ph\":\"X\",\"pid\":%d,\"tid\":%d,"
+            "\"ts\":%.3f,\"dur\":%.3f}",
+            pid, e->tid, e->ts, e->dur);
+  }
+
+  fprintf(f,
+          "\n],\n"
+          "\"displayTimeUnit\":\"ms\",\n"
+          "\"otherData\":{\"rank\":%d,\"n_ranks\":%d,"
+          "\"n_events\":%llu,\"n_dropped\":%llu}\n"
+          "}\n",
+          pid, cs_glob_n_ranks,
+          (unsigned long long)n_events, (unsigned long long)_n_dropped);
+
+  fclose(f);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize tracing.
+ *
+ * Tracing is activated if the CS_TRACE environment variable is set; its
+ * value, if a positive integer, defines the maximum number of events
+ * recorded on each rank.
+ *
+ * This function is collective.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_trace_initialize(void)
+{
+  const char *p = getenv("CS_TRACE");
+
+  if (p == nullptr || cs_glob_trace_active)
+    return;
+
+  long long n = atoll(p);
+  _max_events = (n > 0) ? (size_t)n : CS_TRACE_DEFAULT_MAX_EVENTS;
+  _n_events = 0;
+  _n_dropped = 0;
+
+  CS_MALLOC(_events, _max_events, cs_trace_event_t);
+
+  _n_stacks = cs_glob_n_threads;
+  CS_MALLOC(_stacks, _n_stacks, cs_trace_stack_t);
+  for (int t_id = 0; t_id < _n_stacks; t_id++) {
+    _stacks[t_id].depth = 0;
+    _stacks[t_id].n_overflow = 0;
+  }
+
+  _names = cs_map_name_to_id_create();
+  _lanes = cs_map_name_to_id_create();
+
+  /* Use a common time origin on all ranks */
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Barrier(cs_glob_mpi_comm);
+#endif
+
+  _t_origin = cs_timer_time();
+
+  cs_glob_trace_active = true;
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("\n"
+                  "Timeline tracing active (up to %llu events per rank).\n"),
+                (unsigned long long)_max_events);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write recorded events and finalize tracing.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_trace_finalize(void)
+{
+  if (cs_glob_trace_active == false)
+    return;
+
+  cs_glob_trace_active = false;
+
+  _write_trace();
+
+  if (_n_dropped > 0)
+    bft_printf(_("\n"
+                 "Warning: %llu trace events were dropped\n"
+                 "         (buffer limited to %llu events by CS_TRACE).\n"),
+               (unsigned long long)_n_dropped,
+               (unsigned long long)_max_events);
+
+  CS_FREE(_events);
+  CS_FREE(_stacks);
+  _n_stacks = 0;
+  _max_events = 0;
+  _n_events = 0;
+  _n_dropped = 0;
+
+  cs_map_name_to_id_destroy(&_names);
+  cs_map_name_to_id_destroy(&_lanes);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Begin a traced region on the current thread.
+ *
+ * Regions must be properly nested on each thread, and ended with
+ * \ref cs_trace_end.
+ *
+ * \param[in]  category  event category
+ * \param[in]  name      event name
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_trace_begin(const char  *category,
+               const char  *name)
+{
+  if (cs_glob_trace_active == false)
+    return;
+
+  int t_id = cs_get_thread_id();
+  if (t_id >= _n_stacks)
+    return;
+
+  cs_trace_stack_t *s = _stacks + t_id;
+
+  if (s->depth >= CS_TRACE_MAX_DEPTH) {
+    s->n_overflow += 1;
+    return;
+  }
+
+  cs_trace_region_t *r = s->region + s->depth;
+  r->name_id = _name_id(_names, name);
+  r->category_id = _name_id(_names, category);
+  r->t_start = cs_timer_time();
+
+  s->depth += 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief End the innermost traced region on the current thread.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_trace_end(void)
+{
+  if (cs_glob_trace_active == false)
+    return;
+
+  int t_id = cs_get_thread_id();
+  if (t_id >= _n_stacks)
+    return;
+
+  cs_trace_stack_t *s = _stacks + t_id;
+
+  if (s->n_overflow > 0) {
+    s->n_overflow -= 1;
+    return;
+  }
+  else if (s->depth < 1)
+    return;
+
+  cs_timer_t t_end = cs_timer_time();
+
+  s->depth -= 1;
+  cs_trace_region_t *r = s->region + s->depth;
+
+  _record(r->name_id, r->category_id, t_id, &(r->t_start), &t_end);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a complete traced region, with given start and end times.
+ *
+ * Regions added to a named lane are displayed separately from those of
+ * threads, so they do not need to be nested relative to other regions.
+ *
+ * \param[in]  category  event category
+ * \param[in]  name      event name
+ * \param[in]  lane      name of lane, or nullptr for current thread
+ * \param[in]  t0        start time
+ * \param[in]  t1        end time
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_trace_add(const char        *category,
+             const char        *name,
+             const char        *lane,
+             const cs_timer_t  *t0,
+             const cs_timer_t  *t1)
+{
+  if (cs_glob_trace_active == false)
+    return;
+
+  int tid = (lane != nullptr) ?
+    _n_stacks + _name_id(_lanes, lane) : cs_get_thread_id();
+
+  _record(_name_id(_names, name),
+          _name_id(_names, category),
+          tid,
+          t0,
+          t1);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
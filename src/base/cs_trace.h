@@ -0,0 +1,171 @@
+#ifndef __CS_TRACE_H__
+#define __CS_TRACE_H__
+
+/*============================================================================
+ * Timeline tracing of solver phases and communication.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2025 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "base/cs_defs.h"
+#include "base/cs_timer.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Global variables
+ *============================================================================*/
+
+/* Tracing activation flag (do not modify directly) */
+
+extern bool cs_glob_trace_active;
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize tracing.
+ *
+ * Tracing is activated if the CS_TRACE environment variable is set; its
+ * value, if a positive integer, defines the maximum number of events
+ * recorded on each rank.
+ *
+ * This function is collective.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_trace_initialize(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write recorded events and finalize tracing.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_trace_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Begin a traced region on the current thread.
+ *
+ * Regions must be properly nested on each thread, and ended with
+ * \ref cs_trace_end.
+ *
+ * \param[in]  category  event category
+ * \param[in]  name      event name
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_trace_begin(const char  *category,
+               const char  *name);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief End the innermost traced region on the current thread.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_trace_end(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a complete traced region, with given start and end times.
+ *
+ * Regions added to a named lane are displayed separately from those of
+ * threads, so they do not need to be nested relative to other regions.
+ *
+ * \param[in]  category  event category
+ * \param[in]  name      event name
+ * \param[in]  lane      name of lane, or nullptr for current thread
+ * \param[in]  t0        start time
+ * \param[in]  t1        end time
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_trace_add(const char        *category,
+             const char        *name,
+             const char        *lane,
+             const cs_timer_t  *t0,
+             const cs_timer_t  *t1);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#if defined(__cplusplus)
+
+/*=============================================================================
+ * Public C++ classes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Traced region bound to the enclosing scope.
+ */
+/*----------------------------------------------------------------------------*/
+
+class cs_trace_scope {
+
+public:
+
+  cs_trace_scope(const char  *category,
+                 const char  *name)
+    : active_(cs_glob_trace_active)
+  {
+    if (active_)
+      cs_trace_begin(category, name);
+  }
+
+  ~cs_trace_scope()
+  {
+    if (active_)
+      cs_trace_end();
+  }
+
+  cs_trace_scope(const cs_trace_scope &) = delete;
+  cs_trace_scope &operator=(const cs_trace_scope &) = delete;
+
+private:
+
+  bool  active_;
+
+};
+
+#endif /* defined(__cplusplus) */
+
+/*----------------------------------------------------------------------------*/
+
+#endif /* __CS_TRACE_H__ */
@@ -55,10 +55,12 @@
 #include "mesh/cs_mesh_quantities.h"
 #include "turb/cs_turbulence_model.h"
 #include "cdo/cs_domain.h"
+#include "base/cs_dispatch.h"
 #include "base/cs_field.h"
 #include "base/cs_field_operator.h"
 #include "base/cs_field_pointer.h"
 #include "base/cs_field_default.h"
+#include "base/cs_reducers.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -167,6 +169,334 @@ static cs_wall_functions_t  _wall_functions =
 
 const cs_wall_functions_t  * cs_glob_wall_functions = &_wall_functions;
 
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+END_C_DECLS // Temporary used here for the templated functions
+
+/*----------------------------------------------------------------------------
+ * Compute the friction velocity and y+ / u+ for a given face, with the
+ * wall function type resolved at compile time.
+ *
+ * This is shared by cs_wall_functions_velocity (which selects the
+ * instance based on the wall function type) and _velocity_faces.
+ *
+ * parameters: see cs_wall_functions_velocity
+ *----------------------------------------------------------------------------*/
+
+template <cs_wall_f_type_t iwallf>
+static inline void
+_velocity_face(cs_real_t   l_visc,
+               cs_real_t   t_visc,
+               cs_real_t   vel,
+               cs_real_t   y,
+               cs_real_t   rough_d,
+               cs_real_t   rnnb,
+               cs_real_t   kinetic_en,
+               int        *iuntur,
+               cs_gnum_t  *nsubla,
+               cs_gnum_t  *nlogla,
+               cs_real_t  *ustar,
+               cs_real_t  *uk,
+               cs_real_t  *yplus,
+               cs_real_t  *ypup,
+               cs_real_t  *cofimp,
+               cs_real_t  *dplus)
+{
+  *dplus = 0.;
+  *iuntur = 1;
+
+  if constexpr (iwallf == CS_WALL_F_DISABLED)
+    cs_wall_functions_disabled(l_visc, t_visc, vel, y,
+                               iuntur, nsubla, nlogla,
+                               ustar, uk, yplus, dplus, ypup, cofimp);
+  else if constexpr (iwallf == CS_WALL_F_1SCALE_POWER)
+    cs_wall_functions_1scale_power(l_visc, vel, y,
+                                   iuntur, nsubla, nlogla,
+                                   ustar, uk, yplus, ypup, cofimp);
+  else if constexpr (iwallf == CS_WALL_F_1SCALE_LOG)
+    cs_wall_functions_1scale_log(l_visc, vel, y,
+                                 iuntur, nsubla, nlogla,
+                                 ustar, uk, yplus, ypup, cofimp);
+  else if constexpr (iwallf == CS_WALL_F_2SCALES_LOG)
+    cs_wall_functions_2scales_log(l_visc, t_visc, vel, y, kinetic_en,
+                                  iuntur, nsubla, nlogla,
+                                  ustar, uk, yplus, ypup, cofimp);
+  else if constexpr (iwallf == CS_WALL_F_SCALABLE_2SCALES_LOG)
+    cs_wall_functions_2scales_scalable(l_visc, t_visc, vel, y, kinetic_en,
+                                       iuntur, nsubla, nlogla,
+                                       ustar, uk, yplus, dplus, ypup, cofimp);
+  else if constexpr (iwallf == CS_WALL_F_2SCALES_VDRIEST) {
+    cs_real_t lmk;
+    cs_real_t sg_rough = rough_d * exp(cs_turb_xkappa*cs_turb_cstlog_rough);
+    cs_wall_functions_2scales_vdriest(rnnb, l_visc, vel, y, kinetic_en,
+                                      iuntur, nsubla, nlogla,
+                                      ustar, uk, yplus, ypup, cofimp,
+                                      &lmk, sg_rough, true);
+  }
+  else if constexpr (iwallf == CS_WALL_F_2SCALES_SMOOTH_ROUGH)
+    cs_wall_functions_2scales_smooth_rough(l_visc, t_visc, vel, y, rough_d,
+                                           kinetic_en,
+                                           iuntur, nsubla, nlogla,
+                                           ustar, uk, yplus, dplus, ypup,
+                                           cofimp);
+  else if constexpr (iwallf == CS_WALL_F_2SCALES_CONTINUOUS)
+    cs_wall_functions_2scales_continuous(rnnb, l_visc, t_visc, vel, y,
+                                         kinetic_en,
+                                         iuntur, nsubla, nlogla,
+                                         ustar, uk, yplus, ypup, cofimp);
+
+  /* To be coherent with a wall function, clip it to 0 */
+  *cofimp = cs::max(*cofimp, 0.);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the friction velocity and y+ / u+ for a list of faces sharing
+ * the same wall function type.
+ *
+ * parameters:
+ *   n_faces    <-- number of faces in list
+ *   face_ids   <-- ids of faces in list
+ *   (other arguments: see cs_wall_functions_velocity_faces)
+ *----------------------------------------------------------------------------*/
+
+template <cs_wall_f_type_t iwallf>
+static void
+_velocity_faces(cs_lnum_t         n_faces,
+                const cs_lnum_t   face_ids[],
+                const cs_real_t   l_visc[],
+                const cs_real_t   t_visc[],
+                const cs_real_t   vel[],
+                const cs_real_t   y[],
+                const cs_real_t   rough_d[],
+                const cs_real_t   rnnb[],
+                const cs_real_t   kinetic_en[],
+                int               iuntur[],
+                cs_gnum_t        *nsubla,
+                cs_gnum_t        *nlogla,
+                cs_real_t         ustar[],
+                cs_real_t         uk[],
+                cs_real_t         yplus[],
+                cs_real_t         ypup[],
+                cs_real_t         cofimp[],
+                cs_real_t         dplus[])
+{
+  cs_host_context ctx;
+
+  struct cs_int_n<2> rd_sum;
+  struct cs_reduce_sum_ni<2> reducer_sum;
+
+  ctx.parallel_for_reduce
+    (n_faces, rd_sum, reducer_sum, [=] CS_F_HOST
+     (cs_lnum_t i, cs_int_n<2> &res) {
+
+    const cs_lnum_t f_id = face_ids[i];
+    const cs_real_t _rough_d = (rough_d != nullptr) ? rough_d[f_id] : 0.;
+
+    cs_gnum_t _nsubla = 0, _nlogla = 0;
+
+    _velocity_face<iwallf>(l_visc[f_id],
+                           t_visc[f_id],
+                           vel[f_id],
+                           y[f_id],
+                           _rough_d,
+                           rnnb[f_id],
+                           kinetic_en[f_id],
+                           iuntur + f_id,
+                           &_nsubla,
+                           &_nlogla,
+                           ustar + f_id,
+                           uk + f_id,
+                           yplus + f_id,
+                           ypup + f_id,
+                           cofimp + f_id,
+                           dplus + f_id);
+
+    res.i[0] = _nsubla;
+    res.i[1] = _nlogla;
+  });
+
+  *nsubla += rd_sum.i[0];
+  *nlogla += rd_sum.i[1];
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the friction velocity and y+ / u+ for a list of faces using
+ * the one velocity scale log law.
+ *
+ * Faces are handled by packs of CS_WALL_F_PACK_SIZE, so that the
+ * fixed-point iterations on the friction velocity can be applied to all
+ * faces of a pack at once, using a convergence mask so that faces which
+ * have already converged are not updated anymore. The result is thus
+ * identical to that of cs_wall_functions_1scale_log, but the inner loops
+ * have no data-dependent exits, and may be vectorized.
+ *
+ * parameters: see _velocity_faces
+ *----------------------------------------------------------------------------*/
+
+#define CS_WALL_F_PACK_SIZE 8
+
+template <>
+void
+_velocity_faces<CS_WALL_F_1SCALE_LOG>(cs_lnum_t         n_faces,
+                                      const cs_lnum_t   face_ids[],
+                                      const cs_real_t   l_visc[],
+                                      const cs_real_t   t_visc[],
+                                      const cs_real_t   vel[],
+                                      const cs_real_t   y[],
+                                      const cs_real_t   rough_d[],
+                                      const cs_real_t   rnnb[],
+                                      const cs_real_t   kinetic_en[],
+                                      int               iuntur[],
+                                      cs_gnum_t        *nsubla,
+                                      cs_gnum_t        *nlogla,
+                                      cs_real_t         ustar[],
+                                      cs_real_t         uk[],
+                                      cs_real_t         yplus[],
+                                      cs_real_t         ypup[],
+                                      cs_real_t         cofimp[],
+                                      cs_real_t         dplus[])
+{
+  CS_UNUSED(t_visc);
+  CS_UNUSED(rough_d);
+  CS_UNUSED(rnnb);
+  CS_UNUSED(kinetic_en);
+
+  const cs_real_t ypluli = cs_glob_wall_functions->ypluli;
+  const cs_real_t xkappa = cs_turb_xkappa;
+  const cs_real_t cstlog = cs_turb_cstlog;
+  const cs_real_t apow = cs_turb_apow;
+  const cs_real_t bpow = cs_turb_bpow;
+  const cs_real_t dpow = cs_turb_dpow;
+
+  const cs_real_t eps = 0.001;
+  const int niter_max = 100;
+
+  constexpr cs_lnum_t p_size = CS_WALL_F_PACK_SIZE;
+  const cs_lnum_t n_packs = (n_faces + p_size - 1) / p_size;
+
+  cs_host_context ctx;
+
+  struct cs_int_n<3> rd_sum;
+  struct cs_reduce_sum_ni<3> reducer_sum;
+
+  ctx.parallel_for_reduce
+    (n_packs, rd_sum, reducer_sum, [=] CS_F_HOST
+     (cs_lnum_t p_id, cs_int_n<3> &res) {
+
+    const cs_lnum_t s_id = p_id * p_size;
+    const cs_lnum_t n = cs::min(p_size, n_faces - s_id);
+
+    cs_real_t vel_f[p_size], ydvisc_f[p_size];
+    cs_real_t _vel[p_size], ydvisc[p_size];
+    cs_real_t _ustar[p_size], ustaro[p_size];
+    int n_iter[p_size];
+    bool log_layer[p_size], converged[p_size];
+
+    /* Gather */
+
+    for (cs_lnum_t j = 0; j < p_size; j++) {
+      vel_f[j] = 1.;
+      ydvisc_f[j] = 1.;
+    }
+    for (cs_lnum_t j = 0; j < n; j++) {
+      const cs_lnum_t f_id = face_ids[s_id + j];
+      vel_f[j] = vel[f_id];
+      ydvisc_f[j] = y[f_id] / l_visc[f_id];
+    }
+
+    /* Initial value is Werner or the minimum ustar to ensure convergence;
+       faces not in the log layer (or padding) use harmless values, as
+       they are computed but never updated. */
+
+    for (cs_lnum_t j = 0; j < p_size; j++) {
+      const cs_real_t reynolds = vel_f[j] * ydvisc_f[j];
+      log_layer[j] = (j < n && reynolds > ypluli*ypluli);
+      converged[j] = !log_layer[j];
+      n_iter[j] = 0;
+
+      _vel[j] = (log_layer[j]) ? vel_f[j] : 1.;
+      ydvisc[j] = (log_layer[j]) ? ydvisc_f[j] : 1.;
+
+      const cs_real_t ustarwer = pow(cs::abs(_vel[j]) / apow
+                                     / pow(ydvisc[j], bpow), dpow);
+      const cs_real_t ustarmin = exp(-cstlog * xkappa) / ydvisc[j];
+      ustaro[j] = cs::max(ustarwer, ustarmin);
+      _ustar[j] =   (xkappa * _vel[j] + ustaro[j])
+                  / (log(ydvisc[j] * ustaro[j]) + xkappa * cstlog + 1.);
+    }
+
+    /* Masked fixed-point iterations */
+
+    for (int iter = 0; iter < niter_max; iter++) {
+      int n_active = 0;
+      for (cs_lnum_t j = 0; j < p_size; j++) {
+        converged[j] =    converged[j]
+                       || cs::abs(_ustar[j] - ustaro[j]) < eps * ustaro[j];
+        n_active += (converged[j]) ? 0 : 1;
+      }
+      if (n_active == 0)
+        break;
+      for (cs_lnum_t j = 0; j < p_size; j++) {
+        const cs_real_t u_n =   (xkappa * _vel[j] + _ustar[j])
+                              / (  log(ydvisc[j] * _ustar[j])
+                                 + xkappa * cstlog + 1.);
+        ustaro[j] = (converged[j]) ? ustaro[j] : _ustar[j];
+        _ustar[j] = (converged[j]) ? _ustar[j] : u_n;
+        n_iter[j] += (converged[j]) ? 0 : 1;
+      }
+    }
+
+    /* Scatter */
+
+    res.i[0] = 0; res.i[1] = 0; res.i[2] = 0;
+
+    for (cs_lnum_t j = 0; j < n; j++) {
+      const cs_lnum_t f_id = face_ids[s_id + j];
+
+      dplus[f_id] = 0.;
+
+      if (log_layer[j]) {
+        const cs_real_t _yplus = _ustar[j] * ydvisc[j];
+        const cs_real_t _ypup = _yplus / (log(_yplus) / xkappa + cstlog);
+        ustar[f_id] = _ustar[j];
+        uk[f_id] = _ustar[j];
+        yplus[f_id] = _yplus;
+        ypup[f_id] = _ypup;
+        cofimp[f_id] = cs::max(1. - _ypup / xkappa * 1.5 / _yplus, 0.);
+        iuntur[f_id] = 1;
+        res.i[1] += 1;
+        if (n_iter[j] >= niter_max)
+          res.i[2] += 1;
+      }
+      else {
+        /* In the viscous sub-layer: U+ = y+ */
+        const cs_real_t _u = sqrt(vel_f[j] / ydvisc_f[j]);
+        ustar[f_id] = _u;
+        uk[f_id] = _u;
+        yplus[f_id] = _u * ydvisc_f[j];
+        ypup[f_id] = 1.;
+        cofimp[f_id] = 0.;
+        iuntur[f_id] = 0;
+        res.i[0] += 1;
+      }
+    }
+  });
+
+  *nsubla += rd_sum.i[0];
+  *nlogla += rd_sum.i[1];
+
+  if (rd_sum.i[2] > 0)
+    bft_printf(_("WARNING: non-convergence in the computation\n"
+                 "******** of the friction velocity for %ld faces\n\n"),
+               (long)rd_sum.i[2]);
+}
+
+#undef CS_WALL_F_PACK_SIZE
+
+BEGIN_C_DECLS
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -231,148 +561,158 @@ cs_wall_functions_velocity(cs_wall_f_type_t  iwallf,
                            cs_real_t        *cofimp,
                            cs_real_t        *dplus)
 {
-  cs_real_t lmk;
-  bool wf = true;
-
-  /* Pseudo shift of the wall, 0 by default */
-  *dplus = 0.;
+  switch (iwallf) {
+  case CS_WALL_F_DISABLED:
+    _velocity_face<CS_WALL_F_DISABLED>
+      (l_visc, t_visc, vel, y, rough_d, rnnb, kinetic_en,
+       iuntur, nsubla, nlogla, ustar, uk, yplus, ypup, cofimp, dplus);
+    break;
+  case CS_WALL_F_1SCALE_POWER:
+    _velocity_face<CS_WALL_F_1SCALE_POWER>
+      (l_visc, t_visc, vel, y, rough_d, rnnb, kinetic_en,
+       iuntur, nsubla, nlogla, ustar, uk, yplus, ypup, cofimp, dplus);
+    break;
+  case CS_WALL_F_1SCALE_LOG:
+    _velocity_face<CS_WALL_F_1SCALE_LOG>
+      (l_visc, t_visc, vel, y, rough_d, rnnb, kinetic_en,
+       iuntur, nsubla, nlogla, ustar, uk, yplus, ypup, cofimp, dplus);
+    break;
+  case CS_WALL_F_2SCALES_LOG:
+    _velocity_face<CS_WALL_F_2SCALES_LOG>
+      (l_visc, t_visc, vel, y, rough_d, rnnb, kinetic_en,
+       iuntur, nsubla, nlogla, ustar, uk, yplus, ypup, cofimp, dplus);
+    break;
+  case CS_WALL_F_SCALABLE_2SCALES_LOG:
+    _velocity_face<CS_WALL_F_SCALABLE_2SCALES_LOG>
+      (l_visc, t_visc, vel, y, rough_d, rnnb, kinetic_en,
+       iuntur, nsubla, nlogla, ustar, uk, yplus, ypup, cofimp, dplus);
+    break;
+  case CS_WALL_F_2SCALES_VDRIEST:
+    _velocity_face<CS_WALL_F_2SCALES_VDRIEST>
+      (l_visc, t_visc, vel, y, rough_d, rnnb, kinetic_en,
+       iuntur, nsubla, nlogla, ustar, uk, yplus, ypup, cofimp, dplus);
+    break;
+  case CS_WALL_F_2SCALES_SMOOTH_ROUGH:
+    _velocity_face<CS_WALL_F_2SCALES_SMOOTH_ROUGH>
+      (l_visc, t_visc, vel, y, rough_d, rnnb, kinetic_en,
+       iuntur, nsubla, nlogla, ustar, uk, yplus, ypup, cofimp, dplus);
+    break;
+  case CS_WALL_F_2SCALES_CONTINUOUS:
+    _velocity_face<CS_WALL_F_2SCALES_CONTINUOUS>
+      (l_visc, t_visc, vel, y, rough_d, rnnb, kinetic_en,
+       iuntur, nsubla, nlogla, ustar, uk, yplus, ypup, cofimp, dplus);
+    break;
+  default:
+    _velocity_face<CS_WALL_F_UNSET>
+      (l_visc, t_visc, vel, y, rough_d, rnnb, kinetic_en,
+       iuntur, nsubla, nlogla, ustar, uk, yplus, ypup, cofimp, dplus);
+    break;
+  }
+}
 
-  /* Activation of wall function by default */
-  *iuntur = 1;
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the friction velocity and \f$y^+\f$ / \f$u^+\f$ for a list
+ *        of faces sharing the same wall function type.
+ *
+ * All arrays are indexed by face id, so only the entries of the given
+ * faces are read or written. Compared to calling
+ * \ref cs_wall_functions_velocity for each face, the wall function type
+ * selection is done once for the whole list, and faces are processed
+ * in parallel.
+ *
+ * \param[in]     iwallf        wall function type
+ * \param[in]     n_faces       number of faces in list
+ * \param[in]     face_ids      ids of faces in list
+ * \param[in]     l_visc        kinematic viscosity
+ * \param[in]     t_visc        turbulent kinematic viscosity
+ * \param[in]     vel           wall projected cell center velocity
+ * \param[in]     y             wall distance
+ * \param[in]     rough_d       roughness length scale, or nullptr
+ * \param[in]     rnnb          \f$\vec{n}.(\tens{R}\vec{n})\f$
+ * \param[in]     kinetic_en    turbulent kinetic energy (cell center)
+ * \param[out]    iuntur        indicator: 0 in the viscous sublayer
+ * \param[in,out] nsubla        counter of cell in the viscous sublayer
+ * \param[in,out] nlogla        counter of cell in the log-layer
+ * \param[out]    ustar         friction velocity
+ * \param[out]    uk            friction velocity
+ * \param[out]    yplus         dimensionless distance to the wall
+ * \param[out]    ypup          yplus projected vel ratio
+ * \param[out]    cofimp        \f$\frac{|U_F|}{|U_I^p|}\f$ to ensure a good
+ *                              turbulence production
+ * \param[out]    dplus         dimensionless shift to the wall for scalable
+ *                              wall functions
+ */
+/*----------------------------------------------------------------------------*/
 
-  /* Sand Grain roughness */
-  cs_real_t sg_rough = rough_d * exp(cs_turb_xkappa*cs_turb_cstlog_rough);
+void
+cs_wall_functions_velocity_faces(cs_wall_f_type_t  iwallf,
+                                 cs_lnum_t         n_faces,
+                                 const cs_lnum_t   face_ids[],
+                                 const cs_real_t   l_visc[],
+                                 const cs_real_t   t_visc[],
+                                 const cs_real_t   vel[],
+                                 const cs_real_t   y[],
+                                 const cs_real_t   rough_d[],
+                                 const cs_real_t   rnnb[],
+                                 const cs_real_t   kinetic_en[],
+                                 int               iuntur[],
+                                 cs_gnum_t        *nsubla,
+                                 cs_gnum_t        *nlogla,
+                                 cs_real_t         ustar[],
+                                 cs_real_t         uk[],
+                                 cs_real_t         yplus[],
+                                 cs_real_t         ypup[],
+                                 cs_real_t         cofimp[],
+                                 cs_real_t         dplus[])
+{
+  if (n_faces < 1)
+    return;
 
   switch (iwallf) {
   case CS_WALL_F_DISABLED:
-    cs_wall_functions_disabled(l_visc,
-                               t_visc,
-                               vel,
-                               y,
-                               iuntur,
-                               nsubla,
-                               nlogla,
-                               ustar,
-                               uk,
-                               yplus,
-                               dplus,
-                               ypup,
-                               cofimp);
+    _velocity_faces<CS_WALL_F_DISABLED>
+      (n_faces, face_ids, l_visc, t_visc, vel, y, rough_d, rnnb, kinetic_en,
+       iuntur, nsubla, nlogla, ustar, uk, yplus, ypup, cofimp, dplus);
     break;
   case CS_WALL_F_1SCALE_POWER:
-    cs_wall_functions_1scale_power(l_visc,
-                                   vel,
-                                   y,
-                                   iuntur,
-                                   nsubla,
-                                   nlogla,
-                                   ustar,
-                                   uk,
-                                   yplus,
-                                   ypup,
-                                   cofimp);
+    _velocity_faces<CS_WALL_F_1SCALE_POWER>
+      (n_faces, face_ids, l_visc, t_visc, vel, y, rough_d, rnnb, kinetic_en,
+       iuntur, nsubla, nlogla, ustar, uk, yplus, ypup, cofimp, dplus);
     break;
   case CS_WALL_F_1SCALE_LOG:
-    cs_wall_functions_1scale_log(l_visc,
-                                 vel,
-                                 y,
-                                 iuntur,
-                                 nsubla,
-                                 nlogla,
-                                 ustar,
-                                 uk,
-                                 yplus,
-                                 ypup,
-                                 cofimp);
+    _velocity_faces<CS_WALL_F_1SCALE_LOG>
+      (n_faces, face_ids, l_visc, t_visc, vel, y, rough_d, rnnb, kinetic_en,
+       iuntur, nsubla, nlogla, ustar, uk, yplus, ypup, cofimp, dplus);
     break;
   case CS_WALL_F_2SCALES_LOG:
-    cs_wall_functions_2scales_log(l_visc,
-                                  t_visc,
-                                  vel,
-                                  y,
-                                  kinetic_en,
-                                  iuntur,
-                                  nsubla,
-                                  nlogla,
-                                  ustar,
-                                  uk,
-                                  yplus,
-                                  ypup,
-                                  cofimp);
+    _velocity_faces<CS_WALL_F_2SCALES_LOG>
+      (n_faces, face_ids, l_visc, t_visc, vel, y, rough_d, rnnb, kinetic_en,
+       iuntur, nsubla, nlogla, ustar, uk, yplus, ypup, cofimp, dplus);
     break;
   case CS_WALL_F_SCALABLE_2SCALES_LOG:
-    cs_wall_functions_2scales_scalable(l_visc,
-                                       t_visc,
-                                       vel,
-                                       y,
-                                       kinetic_en,
-                                       iuntur,
-                                       nsubla,
-                                       nlogla,
-                                       ustar,
-                                       uk,
-                                       yplus,
-                                       dplus,
-                                       ypup,
-                                       cofimp);
+    _velocity_faces<CS_WALL_F_SCALABLE_2SCALES_LOG>
+      (n_faces, face_ids, l_visc, t_visc, vel, y, rough_d, rnnb, kinetic_en,
+       iuntur, nsubla, nlogla, ustar, uk, yplus, ypup, cofimp, dplus);
     break;
   case CS_WALL_F_2SCALES_VDRIEST:
-   cs_wall_functions_2scales_vdriest(rnnb,
-                                      l_visc,
-                                      vel,
-                                      y,
-                                      kinetic_en,
-                                      iuntur,
-                                      nsubla,
-                                      nlogla,
-                                      ustar,
-                                      uk,
-                                      yplus,
-                                      ypup,
-                                      cofimp,
-                                      &lmk,
-                                      sg_rough,
-                                      wf);
+    _velocity_faces<CS_WALL_F_2SCALES_VDRIEST>
+      (n_faces, face_ids, l_visc, t_visc, vel, y, rough_d, rnnb, kinetic_en,
+       iuntur, nsubla, nlogla, ustar, uk, yplus, ypup, cofimp, dplus);
     break;
   case CS_WALL_F_2SCALES_SMOOTH_ROUGH:
-    cs_wall_functions_2scales_smooth_rough(l_visc,
-                                           t_visc,
-                                           vel,
-                                           y,
-                                           rough_d,
-                                           kinetic_en,
-                                           iuntur,
-                                           nsubla,
-                                           nlogla,
-                                           ustar,
-                                           uk,
-                                           yplus,
-                                           dplus,
-                                           ypup,
-                                           cofimp);
+    _velocity_faces<CS_WALL_F_2SCALES_SMOOTH_ROUGH>
+      (n_faces, face_ids, l_visc, t_visc, vel, y, rough_d, rnnb, kinetic_en,
+       iuntur, nsubla, nlogla, ustar, uk, yplus, ypup, cofimp, dplus);
     break;
   case CS_WALL_F_2SCALES_CONTINUOUS:
-    cs_wall_functions_2scales_continuous(rnnb,
-                                         l_visc,
-                                         t_visc,
-                                         vel,
-                                         y,
-                                         kinetic_en,
-                                         iuntur,
-                                         nsubla,
-                                         nlogla,
-                                         ustar,
-                                         uk,
-                                         yplus,
-                                         ypup,
-                                         cofimp);
+    _velocity_faces<CS_WALL_F_2SCALES_CONTINUOUS>
+      (n_faces, face_ids, l_visc, t_visc, vel, y, rough_d, rnnb, kinetic_en,
+       iuntur, nsubla, nlogla, ustar, uk, yplus, ypup, cofimp, dplus);
     break;
   default:
     break;
   }
-
-  /* To be coherent with a wall function, clip it to 0 */
-  *cofimp = cs::max(*cofimp, 0.);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -295,6 +295,8 @@ _compute_unsteady_user_equations(cs_domain_t   *domain,
 static void
 _solve_steady_state_domain(cs_domain_t  *domain)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_CDO);
+
   if (cs_param_cdo_has_cdo_only()) {
     /* Otherwise log is called from the FORTRAN part */
 
@@ -498,6 +500,8 @@ _define_current_time_step(cs_time_step_t           *ts,
 static void
 _solve_domain(cs_domain_t  *domain)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_CDO);
+
   const cs_time_step_t  *ts = domain->time_step;
   const int  nt_cur = ts->nt_cur;
 
@@ -801,6 +805,8 @@ cs_cdo_initialize_structures(cs_domain_t           *domain,
                              cs_mesh_t             *m,
                              cs_mesh_quantities_t  *mq)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_CDO);
+
   if (domain == nullptr)
     bft_error(__FILE__, __LINE__, 0,
               " %s: cs_domain_t structure is not allocated.\n", __func__);
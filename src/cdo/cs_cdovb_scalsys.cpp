@@ -454,7 +454,8 @@ _solve_mumps(int                               n_eqs,
   /* Set the input monitoring state */
 
   cs_solving_info_t sinfo = {
-    .n_it = 0, .rhs_norm = 1, .res_norm = 1e16, .derive = 0., .l2residual = 0.
+    .n_it = 0, .rhs_norm = 1, .res_norm = 1e16, .derive = 0., .l2residual = 0.,
+    .res_norm_ini = 0.
   };
   cs_real_t eps = 1e-6; /* useless in case of a direct solver */
 
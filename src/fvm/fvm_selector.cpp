@@ -43,6 +43,7 @@
 #include "bft/bft_error.h"
 #include "bft/bft_printf.h"
 
+#include "base/cs_math.h"
 #include "base/cs_mem.h"
 #include "base/cs_timer.h"
 
@@ -66,6 +67,10 @@ BEGIN_C_DECLS
  * Macro definitions
  *============================================================================*/
 
+/* Number of elements per block for evaluation of geometric criteria */
+
+#define _EVAL_BLOCK_SIZE 256
+
 /*============================================================================
  * Local type definitions
  *============================================================================*/
@@ -1013,24 +1018,87 @@ fvm_selector_get_list(fvm_selector_t  *this_selector,
                     "for 3 spatial dimension."),
                   str, dim);
 
-    /* Loop on all elements */
-
-    for (i = 0; i < ts->n_elements; i++) {
-
-      gc_id = ts->group_class_id[i] - ts->group_class_id_base;
+    /* Evaluate group class terms once, then evaluate expression
+       by blocks of elements; as element numbering is usually
+       spatially coherent, block extents allow skipping per-element
+       evaluation of most geometric tests. */
+
+    int n_class_terms = 0, max_depth = 0;
+    fvm_selector_postfix_block_info(pf, &n_class_terms, &max_depth);
+
+    const int n_gc = ts->n_group_classes;
+    const bool coords_dep = fvm_selector_postfix_coords_dep(pf);
+
+    bool *class_term_val, *work, *result;
+    int *b_gc_id;
+    CS_MALLOC(class_term_val, n_class_terms*n_gc + 1, bool);
+    CS_MALLOC(work, (max_depth + 1)*_EVAL_BLOCK_SIZE, bool);
+    CS_MALLOC(result, _EVAL_BLOCK_SIZE, bool);
+    CS_MALLOC(b_gc_id, _EVAL_BLOCK_SIZE, int);
+
+    fvm_selector_postfix_eval_class_terms(pf,
+                                          n_gc,
+                                          ts->n_class_groups,
+                                          ts->n_class_attributes,
+                                          const_cast<const char **>
+                                            (ts->group_name),
+                                          ts->group_ids,
+                                          ts->attribute_ids,
+                                          class_term_val);
+
+    /* Loop on element blocks */
+
+    for (cs_lnum_t s_id = 0; s_id < ts->n_elements; s_id += _EVAL_BLOCK_SIZE) {
+
+      const cs_lnum_t n_b_elts
+        = cs::min((cs_lnum_t)_EVAL_BLOCK_SIZE, ts->n_elements - s_id);
+
+      for (i = 0; i < n_b_elts; i++)
+        b_gc_id[i] = ts->group_class_id[s_id + i] - ts->group_class_id_base;
+
+      /* Block coordinate extents (coordinates may be updated between
+         calls, so they are not cached) */
+
+      double extents[6];
+      const double *b_extents = nullptr;
+      if (coords_dep) {
+        const cs_real_3_t *b_coords = ts->coords + s_id;
+        for (int k = 0; k < 3; k++) {
+          extents[k] = b_coords[0][k];
+          extents[3+k] = b_coords[0][k];
+        }
+        for (i = 1; i < n_b_elts; i++) {
+          for (int k = 0; k < 3; k++) {
+            extents[k] = cs::min(extents[k], b_coords[i][k]);
+            extents[3+k] = cs::max(extents[3+k], b_coords[i][k]);
+          }
+        }
+        b_extents = extents;
+      }
 
-      if (fvm_selector_postfix_eval(pf,
-                                    ts->n_class_groups[gc_id],
-                                    ts->n_class_attributes[gc_id],
-                                    const_cast<const char **>
-                                      (ts->group_name),
-                                    ts->group_ids[gc_id],
-                                    ts->attribute_ids[gc_id],
-                                    ts->coords[i],
-                                    ts->u_normals[i]))
-        selected_elements[(*n_selected_elements)++] = i + elt_id_base;
+      fvm_selector_postfix_eval_block
+        (pf,
+         n_b_elts,
+         n_gc,
+         b_gc_id,
+         class_term_val,
+         (ts->coords != nullptr) ? ts->coords + s_id : nullptr,
+         (ts->u_normals != nullptr) ? ts->u_normals + s_id : nullptr,
+         b_extents,
+         work,
+         result);
+
+      for (i = 0; i < n_b_elts; i++) {
+        if (result[i])
+          selected_elements[(*n_selected_elements)++] = s_id + i + elt_id_base;
+      }
 
     }
+
+    CS_FREE(b_gc_id);
+    CS_FREE(result);
+    CS_FREE(work);
+    CS_FREE(class_term_val);
   }
 
   ts->n_evals += 1;
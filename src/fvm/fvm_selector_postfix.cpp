@@ -2912,6 +2912,459 @@ _eval_coord_le(const fvm_selector_postfix_t  *pf,
   return (coords[coord_id] <= cmp_val ? true : false);
 }
 
+/*----------------------------------------------------------------------------
+ * Check if a postfix element is a group class term (i.e. its evaluation
+ * only depends on the element's group class).
+ *
+ * parameters:
+ *   pf   <-- pointer to postfix structure
+ *   type <-- postfix element type
+ *   i    <-- current position in expression (after type)
+ *
+ * returns:
+ *   true if the element is a group class term
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_is_class_term(const fvm_selector_postfix_t  *pf,
+               _postfix_type_t                type,
+               size_t                         i)
+{
+  if (type == PF_GROUP_ID || type == PF_ATTRIBUTE_ID)
+    return true;
+
+  if (type == PF_OPCODE) {
+    _operator_code_t oc = *((_operator_code_t *)(pf->elements + i));
+    if (oc >= OC_ALL && oc <= OC_CONTAINS)
+      return true;
+  }
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------
+ * Skip a postfix element and its arguments, if any.
+ *
+ * parameters:
+ *   pf   <-- pointer to postfix structure
+ *   type <-- postfix element type
+ *   i    <-> current position in expression (after type)
+ *----------------------------------------------------------------------------*/
+
+static void
+_skip_element(const fvm_selector_postfix_t  *pf,
+              _postfix_type_t                type,
+              size_t                        *i)
+{
+  switch(type) {
+  case PF_OPCODE:
+    {
+      _operator_code_t oc = *((_operator_code_t *)(pf->elements + *i));
+      *i += _postfix_opcode_size;
+      /* Range arguments are group or attribute ids, not class terms */
+      if (oc == OC_RANGE)
+        *i += 2*(_postfix_type_size + _postfix_int_size);
+      /* Contains argument is a string, following its type */
+      else if (oc == OC_CONTAINS) {
+        *i += _postfix_type_size;
+        *i += strlen((const char *)(pf->elements + *i)) + 1;
+      }
+    }
+    break;
+  case PF_GROUP_ID:
+  case PF_ATTRIBUTE_ID:
+  case PF_INT:
+    *i += _postfix_int_size;
+    break;
+  case PF_FLOAT:
+    *i += _postfix_float_size;
+    break;
+  case PF_STRING:
+    *i += strlen((const char *)(pf->elements + *i)) + 1;
+    break;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Evaluate a group class term in a postfix expression.
+ *
+ * parameters:
+ *   pf           <-- pointer to postfix structure
+ *   type         <-- postfix element type
+ *   n_groups     <-- number of groups associated with group class
+ *   n_attributes <-- number of attributes associated with group class
+ *   group_name   <-- array of group names (ordered)
+ *   group_id     <-- array group ids associated with group class
+ *   attribute_id <-- array of attribute ids associated with group class
+ *   i            <-> current position in expression (after type)
+ *
+ * returns:
+ *   true or false depending on evaluation
+ *----------------------------------------------------------------------------*/
+
+static bool
+_eval_class_term(const fvm_selector_postfix_t  *pf,
+                 _postfix_type_t                type,
+                 int                            n_groups,
+                 int                            n_attributes,
+                 const char                    *group_name[],
+                 const int                      group_id[],
+                 const int                      attribute_id[],
+                 size_t                        *i)
+{
+  bool retval = false;
+
+  if (type == PF_GROUP_ID || type == PF_ATTRIBUTE_ID) {
+    int val = *((int *)(pf->elements + *i));
+    *i += _postfix_int_size;
+    if (type == PF_GROUP_ID) {
+      for (int j = 0; j < n_groups && retval == false; j++)
+        retval = (val == group_id[j]);
+    }
+    else {
+      for (int j = 0; j < n_attributes && retval == false; j++)
+        retval = (val == attribute_id[j]);
+    }
+    return retval;
+  }
+
+  _operator_code_t oc = *((_operator_code_t *)(pf->elements + *i));
+  *i += _postfix_opcode_size;
+
+  switch(oc) {
+
+  case OC_ALL:
+    retval = true;
+    break;
+
+  case OC_NO_GROUP:
+    retval = (n_groups == 0 && n_attributes == 0);
+    break;
+
+  case OC_RANGE:
+    {
+      _postfix_type_t type1 = *((_postfix_type_t *)(pf->elements + *i));
+      *i += _postfix_type_size;
+      int val1 = *((int *)(pf->elements + *i));
+      *i += _postfix_int_size + _postfix_type_size;
+      int val2 = *((int *)(pf->elements + *i));
+      *i += _postfix_int_size;
+      if (type1 == PF_GROUP_ID) {
+        for (int j = 0; j < n_groups && retval == false; j++)
+          retval = (group_id[j] >= val1 && group_id[j] <= val2);
+      }
+      else {
+        for (int j = 0; j < n_attributes && retval == false; j++)
+          retval = (attribute_id[j] >= val1 && attribute_id[j] <= val2);
+      }
+    }
+    break;
+
+  case OC_CONTAINS:
+    {
+      *i += _postfix_type_size;
+      const char *val = (const char *)(pf->elements + *i);
+      *i += strlen(val) + 1;
+      for (int j = 0; j < n_groups && retval == false; j++)
+        retval = (strstr(group_name[group_id[j]], val) != nullptr);
+    }
+    break;
+
+  default:
+    assert(0);
+
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Read floating-point arguments of a function in a postfix expression.
+ *
+ * parameters:
+ *   pf  <-- pointer to postfix structure
+ *   i   <-> current position in expression being evaluated
+ *   val --> argument values
+ *
+ * returns:
+ *   number of arguments read
+ *----------------------------------------------------------------------------*/
+
+static inline int
+_get_float_args(const fvm_selector_postfix_t  *pf,
+                size_t                        *i,
+                double                         val[])
+{
+  assert(*((_postfix_type_t *)(pf->elements + *i)) == PF_INT);
+  int n_vals = *((int *)(pf->elements + *i + _postfix_type_size));
+
+  *i += _postfix_type_size + _postfix_int_size + _postfix_type_size;
+  for (int j = 0; j < n_vals; j++) {
+    assert(*((_postfix_type_t *)(pf->elements + *i - _postfix_type_size))
+           == PF_FLOAT);
+    val[j] = *((double *)(pf->elements + *i));
+    *i += _postfix_float_size + _postfix_type_size;
+  }
+  *i -= _postfix_type_size;
+
+  return n_vals;
+}
+
+/*----------------------------------------------------------------------------
+ * Evaluate a geometric function or coordinate condition for a block
+ * of elements.
+ *
+ * When block extents are provided, functions whose result is uniform
+ * over the block's bounding box are not evaluated per element.
+ *
+ * parameters:
+ *   pf        <-- pointer to postfix structure
+ *   oc        <-- operator code
+ *   n_elts    <-- number of elements in block
+ *   coords    <-- coordinates associated with block elements
+ *   u_normals <-- unit normals associated with block elements
+ *   extents   <-- block coordinate extents (min, max), or nullptr
+ *   i         <-> current position in expression being evaluated
+ *   r         --> evaluation result for each element
+ *----------------------------------------------------------------------------*/
+
+static void
+_eval_geometric_block(const fvm_selector_postfix_t  *pf,
+                      _operator_code_t               oc,
+                      cs_lnum_t                      n_elts,
+                      const cs_real_3_t              coords[],
+                      const cs_nreal_3_t             u_normals[],
+                      const double                   extents[],
+                      size_t                        *i,
+                      bool                           r[])
+{
+  double val[12];
+  int uniform = -1; /* -1: evaluate per element, 0: all false, 1: all true */
+
+  switch(oc) {
+
+  case OC_NORMAL:
+    {
+      _get_float_args(pf, i, val);
+      for (cs_lnum_t e = 0; e < n_elts; e++) {
+        const cs_nreal_t *n = u_normals[e];
+        double dotp = n[0]*val[0] + n[1]*val[1] + n[2]*val[2];
+        r[e] = (dotp > 0 && dotp*dotp > val[3]);
+      }
+    }
+    break;
+
+  case OC_PLANE:
+    {
+      /* 4 first arguments are plane equation coefficients,
+         last one is an integer (side) or floating-point (tolerance) */
+
+      assert(*((int *)(pf->elements + *i + _postfix_type_size)) == 5);
+      *i += _postfix_type_size + _postfix_int_size + _postfix_type_size;
+      for (int j = 0; j < 4; j++) {
+        val[j] = *((double *)(pf->elements + *i));
+        *i += _postfix_float_size + _postfix_type_size;
+      }
+      *i -= _postfix_type_size;
+
+      _postfix_type_t pf_type = *((_postfix_type_t *)(pf->elements + *i));
+      *i += _postfix_type_size;
+
+      if (pf_type == PF_INT) {
+        int inout = *((int *)(pf->elements + *i));
+        *i += _postfix_int_size;
+
+        /* Plane function extrema over block bounding box */
+        if (extents != nullptr) {
+          double p_min = val[3], p_max = val[3];
+          for (int k = 0; k < 3; k++) {
+            double v0 = val[k]*extents[k], v1 = val[k]*extents[3+k];
+            p_min += cs::min(v0, v1);
+            p_max += cs::max(v0, v1);
+          }
+          double eps = 1e-10*(cs::abs(p_min) + cs::abs(p_max));
+          if (p_max < -eps)
+            uniform = (inout == -1) ? 1 : 0;
+          else if (p_min > eps)
+            uniform = (inout == -1) ? 0 : 1;
+        }
+
+        if (uniform < 0) {
+          for (cs_lnum_t e = 0; e < n_elts; e++) {
+            const cs_real_t *c = coords[e];
+            double pfunc = val[0]*c[0] + val[1]*c[1] + val[2]*c[2] + val[3];
+            r[e] = (inout == -1) ? (pfunc <= 0) : (pfunc >= 0);
+          }
+        }
+      }
+      else {
+        double epsilon = *((double *)(pf->elements + *i));
+        *i += _postfix_float_size;
+        for (cs_lnum_t e = 0; e < n_elts; e++) {
+          const cs_real_t *c = coords[e];
+          double pfunc = val[0]*c[0] + val[1]*c[1] + val[2]*c[2] + val[3];
+          r[e] = (cs::abs(pfunc) < epsilon);
+        }
+      }
+    }
+    break;
+
+  case OC_BOX:
+    {
+      int n_vals = _get_float_args(pf, i, val);
+
+      if (n_vals == 6) {
+        if (extents != nullptr) {
+          if (   extents[0] >= val[0] && extents[1] >= val[1]
+              && extents[2] >= val[2] && extents[3] <= val[3]
+              && extents[4] <= val[4] && extents[5] <= val[5])
+            uniform = 1;
+          else if (   extents[3] < val[0] || extents[4] < val[1]
+                   || extents[5] < val[2] || extents[0] > val[3]
+                   || extents[1] > val[4] || extents[2] > val[5])
+            uniform = 0;
+        }
+        if (uniform < 0) {
+          for (cs_lnum_t e = 0; e < n_elts; e++) {
+            const cs_real_t *c = coords[e];
+            r[e] = (   val[0] <= c[0] && val[1] <= c[1] && val[2] <= c[2]
+                    && val[3] >= c[0] && val[4] >= c[1] && val[5] >= c[2]);
+          }
+        }
+      }
+      else {
+        const double d1[] = {val[3], val[4], val[5]};
+        const double d2[] = {val[6], val[7], val[8]};
+        const double d3[] = {val[9], val[10], val[11]};
+        const double vol = _mixed_product(d1, d2, d3);
+        assert(fabs(vol) > 0.);
+        for (cs_lnum_t e = 0; e < n_elts; e++) {
+          const cs_real_t *c = coords[e];
+          const double v[] = {c[0] - val[0], c[1] - val[1], c[2] - val[2]};
+          double a = _mixed_product(v,  d2, d3)/vol;
+          double b = _mixed_product(d1, v,  d3)/vol;
+          double cc = _mixed_product(d1, d2, v )/vol;
+          r[e] = (   a >= 0. && b >= 0. && cc >= 0.
+                  && a <= 1. && b <= 1. && cc <= 1.);
+        }
+      }
+    }
+    break;
+
+  case OC_CYLINDER:
+    {
+      _get_float_args(pf, i, val);
+      const double axis[] = {val[3] - val[0], val[4] - val[1], val[5] - val[2]};
+      const double len2 = axis[0]*axis[0] + axis[1]*axis[1] + axis[2]*axis[2];
+      const double r2_max = val[6]*val[6];
+      for (cs_lnum_t e = 0; e < n_elts; e++) {
+        const cs_real_t *c = coords[e];
+        const double v[] = {c[0] - val[0], c[1] - val[1], c[2] - val[2]};
+        double dotp = v[0]*axis[0] + v[1]*axis[1] + v[2]*axis[2];
+        bool in = false;
+        if (dotp >= 0 && dotp <= len2) {
+          double mult = dotp / len2;
+          double p[] = {v[0] - mult*axis[0],
+                        v[1] - mult*axis[1],
+                        v[2] - mult*axis[2]};
+          in = (p[0]*p[0] + p[1]*p[1] + p[2]*p[2] <= r2_max);
+        }
+        r[e] = in;
+      }
+    }
+    break;
+
+  case OC_SPHERE:
+    {
+      _get_float_args(pf, i, val);
+      const double r2_max = val[3]*val[3];
+
+      /* Nearest and farthest distance to block bounding box */
+      if (extents != nullptr) {
+        double d2_min = 0, d2_max = 0;
+        for (int k = 0; k < 3; k++) {
+          double d0 = extents[k] - val[k], d1 = val[k] - extents[3+k];
+          double d_min = cs::max(cs::max(d0, d1), 0.);
+          double d_max = cs::max(cs::abs(d0), cs::abs(d1));
+          d2_min += d_min*d_min;
+          d2_max += d_max*d_max;
+        }
+        if (d2_min > r2_max*(1. + 1e-10))
+          uniform = 0;
+        else if (d2_max < r2_max*(1. - 1e-10))
+          uniform = 1;
+      }
+
+      if (uniform < 0) {
+        for (cs_lnum_t e = 0; e < n_elts; e++) {
+          const cs_real_t *c = coords[e];
+          const double v[] = {c[0] - val[0], c[1] - val[1], c[2] - val[2]};
+          r[e] = (v[0]*v[0] + v[1]*v[1] + v[2]*v[2] <= r2_max);
+        }
+      }
+    }
+    break;
+
+  case OC_GT:
+  case OC_LT:
+  case OC_GE:
+  case OC_LE:
+    {
+      assert(*((_postfix_type_t *)(pf->elements + *i)) == PF_INT);
+      *i += _postfix_type_size;
+      const int k = *((int *)(pf->elements + *i));
+      *i += _postfix_int_size + _postfix_type_size;
+      const double cmp_val = *((double *)(pf->elements + *i));
+      *i += _postfix_float_size;
+
+      /* Comparisons with block extents are exact */
+      if (extents != nullptr) {
+        const double c_min = extents[k], c_max = extents[3+k];
+        if (oc == OC_GT)
+          uniform = (c_min > cmp_val) ? 1 : ((c_max <= cmp_val) ? 0 : -1);
+        else if (oc == OC_LT)
+          uniform = (c_max < cmp_val) ? 1 : ((c_min >= cmp_val) ? 0 : -1);
+        else if (oc == OC_GE)
+          uniform = (c_min >= cmp_val) ? 1 : ((c_max < cmp_val) ? 0 : -1);
+        else
+          uniform = (c_max <= cmp_val) ? 1 : ((c_min > cmp_val) ? 0 : -1);
+      }
+
+      if (uniform < 0) {
+        if (oc == OC_GT) {
+          for (cs_lnum_t e = 0; e < n_elts; e++)
+            r[e] = (coords[e][k] > cmp_val);
+        }
+        else if (oc == OC_LT) {
+          for (cs_lnum_t e = 0; e < n_elts; e++)
+            r[e] = (coords[e][k] < cmp_val);
+        }
+        else if (oc == OC_GE) {
+          for (cs_lnum_t e = 0; e < n_elts; e++)
+            r[e] = (coords[e][k] >= cmp_val);
+        }
+        else {
+          for (cs_lnum_t e = 0; e < n_elts; e++)
+            r[e] = (coords[e][k] <= cmp_val);
+        }
+      }
+    }
+    break;
+
+  default:
+    bft_error(__FILE__, __LINE__, 0,
+              _("Operator %s not currently implemented."),
+              _operator_name[oc]);
+
+  }
+
+  if (uniform > -1) {
+    const bool v = (uniform == 1);
+    for (cs_lnum_t e = 0; e < n_elts; e++)
+      r[e] = v;
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -3344,6 +3797,235 @@ fvm_selector_postfix_eval(const fvm_selector_postfix_t  *pf,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Return information required for block evaluation of a postfix expression.
+ *
+ * Group class terms are operands whose evaluation only depends on an
+ * element's group class (group or attribute names, ranges, "all", ...).
+ *
+ * parameters:
+ *   pf            <-- pointer to postfix structure
+ *   n_class_terms --> number of group class terms
+ *   max_depth     --> maximum evaluation stack depth
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_selector_postfix_block_info(const fvm_selector_postfix_t  *pf,
+                                int                           *n_class_terms,
+                                int                           *max_depth)
+{
+  int n_terms = 0, depth = 0;
+  *max_depth = 0;
+
+  size_t i = 0;
+
+  while (i < pf->size) {
+
+    _postfix_type_t type = *((_postfix_type_t *)(pf->elements + i));
+    i += _postfix_type_size;
+
+    if (_is_class_term(pf, type, i))
+      n_terms += 1;
+
+    if (type == PF_OPCODE) {
+      _operator_code_t oc = *((_operator_code_t *)(pf->elements + i));
+      if (oc >= OC_AND && oc <= OC_XOR)
+        depth -= 1;
+      else if (oc >= OC_ALL)
+        depth += 1;
+    }
+    else if (type == PF_GROUP_ID || type == PF_ATTRIBUTE_ID)
+      depth += 1;
+
+    *max_depth = cs::max(*max_depth, depth);
+
+    _skip_element(pf, type, &i);
+
+  }
+
+  *n_class_terms = n_terms;
+}
+
+/*----------------------------------------------------------------------------
+ * Evaluate the group class terms of a postfix expression for all
+ * group classes.
+ *
+ * parameters:
+ *   pf                 <-- pointer to postfix structure
+ *   n_group_classes    <-- number of group classes
+ *   n_class_groups     <-- number of groups per group class
+ *   n_class_attributes <-- number of attributes per group class
+ *   group_name         <-- array of group names (ordered)
+ *   group_ids          <-- group ids per group class
+ *   attribute_ids      <-- attribute ids per group class
+ *   class_term_val     --> value of each term for each group class
+ *                          (size: n_class_terms*n_group_classes)
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_selector_postfix_eval_class_terms(const fvm_selector_postfix_t  *pf,
+                                      int                     n_group_classes,
+                                      const int               n_class_groups[],
+                                      const int          n_class_attributes[],
+                                      const char             *group_name[],
+                                      int             *const  group_ids[],
+                                      int             *const  attribute_ids[],
+                                      bool                    class_term_val[])
+{
+  size_t i = 0;
+  int t_id = 0;
+
+  while (i < pf->size) {
+
+    _postfix_type_t type = *((_postfix_type_t *)(pf->elements + i));
+    i += _postfix_type_size;
+
+    if (_is_class_term(pf, type, i)) {
+      size_t j = i;
+      for (int gc_id = 0; gc_id < n_group_classes; gc_id++) {
+        j = i;
+        class_term_val[t_id*n_group_classes + gc_id]
+          = _eval_class_term(pf,
+                             type,
+                             n_class_groups[gc_id],
+                             n_class_attributes[gc_id],
+                             group_name,
+                             group_ids[gc_id],
+                             attribute_ids[gc_id],
+                             &j);
+      }
+      if (n_group_classes == 0)
+        _skip_element(pf, type, &j);
+      i = j;
+      t_id += 1;
+    }
+    else
+      _skip_element(pf, type, &i);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Evaluate a postfix expression for a block of elements.
+ *
+ * The expression is interpreted once for the whole block, with group
+ * class terms (precomputed using fvm_selector_postfix_eval_class_terms)
+ * gathered based on each element's group class, and geometric functions
+ * or conditions evaluated in loops over the block's elements.
+ *
+ * If block extents are provided, geometric functions or conditions
+ * whose result is uniform over the block's bounding box are not
+ * evaluated per element.
+ *
+ * parameters:
+ *   pf              <-- pointer to postfix structure
+ *   n_elts          <-- number of elements in block
+ *   n_group_classes <-- number of group classes
+ *   gc_id           <-- group class id (0 to n-1) of block elements
+ *   class_term_val  <-- value of each group class term for each group class
+ *   coords          <-- coordinates of block elements, or nullptr
+ *   u_normals       <-- unit normals of block elements, or nullptr
+ *   extents         <-- block coordinate extents (min, max), or nullptr
+ *   work            --- work array (size: max_depth*n_elts)
+ *   result          --> evaluation result for each element
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_selector_postfix_eval_block(const fvm_selector_postfix_t  *pf,
+                                cs_lnum_t                      n_elts,
+                                int                            n_group_classes,
+                                const int                      gc_id[],
+                                const bool                     class_term_val[],
+                                const cs_real_3_t              coords[],
+                                const cs_nreal_3_t             u_normals[],
+                                const double                   extents[],
+                                bool                           work[],
+                                bool                           result[])
+{
+  size_t i = 0;
+  int t_id = 0, eval_size = 0;
+
+  while (i < pf->size) {
+
+    _postfix_type_t type = *((_postfix_type_t *)(pf->elements + i));
+    i += _postfix_type_size;
+
+    if (_is_class_term(pf, type, i)) {
+      bool *r = work + eval_size*n_elts;
+      const bool *t_val = class_term_val + t_id*n_group_classes;
+      for (cs_lnum_t e = 0; e < n_elts; e++)
+        r[e] = t_val[gc_id[e]];
+      _skip_element(pf, type, &i);
+      eval_size += 1;
+      t_id += 1;
+      continue;
+    }
+
+    if (type != PF_OPCODE) {
+      fvm_selector_postfix_dump(pf, 0, 0, nullptr, nullptr);
+      bft_error(__FILE__, __LINE__, 0,
+                _("Postfix evaluation error."));
+    }
+
+    _operator_code_t oc = *((_operator_code_t *)(pf->elements + i));
+    i += _postfix_opcode_size;
+
+    int min_eval_size = 0;
+    if (oc == OC_NOT)
+      min_eval_size = 1;
+    else if (oc >= OC_AND && oc <= OC_XOR)
+      min_eval_size = 2;
+
+    if (eval_size < min_eval_size) {
+      fvm_selector_postfix_dump(pf, 0, 0, nullptr, nullptr);
+      bft_error(__FILE__, __LINE__, 0,
+                _("Postfix evaluation error."));
+    }
+
+    bool *r0 = work + (eval_size-2)*n_elts;
+    bool *r1 = work + (eval_size-1)*n_elts;
+
+    switch(oc) {
+
+    case OC_NOT:
+      for (cs_lnum_t e = 0; e < n_elts; e++)
+        r1[e] = !r1[e];
+      break;
+    case OC_AND:
+      for (cs_lnum_t e = 0; e < n_elts; e++)
+        r0[e] = (r0[e] && r1[e]);
+      eval_size--;
+      break;
+    case OC_OR:
+      for (cs_lnum_t e = 0; e < n_elts; e++)
+        r0[e] = (r0[e] || r1[e]);
+      eval_size--;
+      break;
+    case OC_XOR:
+      for (cs_lnum_t e = 0; e < n_elts; e++)
+        r0[e] = (r0[e] != r1[e]);
+      eval_size--;
+      break;
+
+    default:
+      _eval_geometric_block(pf, oc, n_elts, coords, u_normals, extents,
+                            &i, work + eval_size*n_elts);
+      eval_size++;
+
+    }
+
+  } /* End of loop on postfix elements */
+
+  if (eval_size != 1) {
+    fvm_selector_postfix_dump(pf, 0, 0, nullptr, nullptr);
+    bft_error(__FILE__, __LINE__, 0,
+              _("Postfix evaluation error."));
+  }
+
+  for (cs_lnum_t e = 0; e < n_elts; e++)
+    result[e] = work[e];
+}
+
 /*----------------------------------------------------------------------------
  * Dump the contents of a postfix structure in human readable form
  *
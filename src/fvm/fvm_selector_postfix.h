@@ -181,6 +181,86 @@ fvm_selector_postfix_eval(const fvm_selector_postfix_t  *pf,
                           const cs_real_t                coords[],
                           const cs_nreal_t               u_normal[]);
 
+/*----------------------------------------------------------------------------
+ * Return information required for block evaluation of a postfix expression.
+ *
+ * Group class terms are operands whose evaluation only depends on an
+ * element's group class (group or attribute names, ranges, "all", ...).
+ *
+ * parameters:
+ *   pf            <-- pointer to postfix structure
+ *   n_class_terms --> number of group class terms
+ *   max_depth     --> maximum evaluation stack depth
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_selector_postfix_block_info(const fvm_selector_postfix_t  *pf,
+                                int                           *n_class_terms,
+                                int                           *max_depth);
+
+/*----------------------------------------------------------------------------
+ * Evaluate the group class terms of a postfix expression for all
+ * group classes.
+ *
+ * parameters:
+ *   pf                 <-- pointer to postfix structure
+ *   n_group_classes    <-- number of group classes
+ *   n_class_groups     <-- number of groups per group class
+ *   n_class_attributes <-- number of attributes per group class
+ *   group_name         <-- array of group names (ordered)
+ *   group_ids          <-- group ids per group class
+ *   attribute_ids      <-- attribute ids per group class
+ *   class_term_val     --> value of each term for each group class
+ *                          (size: n_class_terms*n_group_classes)
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_selector_postfix_eval_class_terms(const fvm_selector_postfix_t  *pf,
+                                      int                     n_group_classes,
+                                      const int               n_class_groups[],
+                                      const int          n_class_attributes[],
+                                      const char             *group_name[],
+                                      int             *const  group_ids[],
+                                      int             *const  attribute_ids[],
+                                      bool                    class_term_val[]);
+
+/*----------------------------------------------------------------------------
+ * Evaluate a postfix expression for a block of elements.
+ *
+ * The expression is interpreted once for the whole block, with group
+ * class terms (precomputed using fvm_selector_postfix_eval_class_terms)
+ * gathered based on each element's group class, and geometric functions
+ * or conditions evaluated in loops over the block's elements.
+ *
+ * If block extents are provided, geometric functions or conditions
+ * whose result is uniform over the block's bounding box are not
+ * evaluated per element.
+ *
+ * parameters:
+ *   pf              <-- pointer to postfix structure
+ *   n_elts          <-- number of elements in block
+ *   n_group_classes <-- number of group classes
+ *   gc_id           <-- group class id (0 to n-1) of block elements
+ *   class_term_val  <-- value of each group class term for each group class
+ *   coords          <-- coordinates of block elements, or nullptr
+ *   u_normals       <-- unit normals of block elements, or nullptr
+ *   extents         <-- block coordinate extents (min, max), or nullptr
+ *   work            --- work array (size: max_depth*n_elts)
+ *   result          --> evaluation result for each element
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_selector_postfix_eval_block(const fvm_selector_postfix_t  *pf,
+                                cs_lnum_t                      n_elts,
+                                int                            n_group_classes,
+                                const int                      gc_id[],
+                                const bool                     class_term_val[],
+                                const cs_real_3_t              coords[],
+                                const cs_nreal_3_t             u_normals[],
+                                const double                   extents[],
+                                bool                           work[],
+                                bool                           result[]);
+
 /*----------------------------------------------------------------------------
  * Dump the contents of a postfix structure in human readable form
  *
@@ -632,6 +632,90 @@ _physical_property(cs_field_t          *c_prop,
   }
 }
 
+/*-----------------------------------------------------------------------------
+ * use MEG for several physical properties over a given zone
+ *
+ * Properties are computed in the given order. Formulas of consecutive
+ * properties with a user law over the zone are evaluated in a single
+ * MEG call, so that the generated code may use a single loop over the
+ * zone's cells (falling back to separate evaluations otherwise).
+ * Other properties end the current group, so that properties following
+ * them see their updated values.
+ *
+ * parameters:
+ *   z        <-- pointer to volume zone
+ *   n_props  <-- number of candidate properties
+ *   c_props  <-- candidate property fields (or NULL)
+ *   done     <-> true for properties evaluated here
+ *----------------------------------------------------------------------------*/
+
+static void
+_physical_properties_by_zone(const cs_zone_t   *z,
+                             int                n_props,
+                             cs_field_t        *c_props[],
+                             bool               done[])
+{
+  int n_laws = 0;
+  char fields_names[512] = "";
+  cs_real_t **fvals = NULL;
+  int *prop_ids = NULL;
+
+  CS_MALLOC(fvals, n_props, cs_real_t *);
+  CS_MALLOC(prop_ids, n_props, int);
+
+  /* Loop up to n_props, so that the last group is also evaluated */
+
+  for (int i = 0; i <= n_props; i++) {
+    cs_field_t *c_prop = (i < n_props) ? c_props[i] : NULL;
+    if (i < n_props && (c_prop == NULL || done[i]))
+      continue;
+
+    if (c_prop != NULL) {
+      const char *prop_choice = _properties_choice(c_prop->name, NULL);
+      if (   (   cs_gui_strcmp(prop_choice, "user_law")
+              || (z->id > 1 && z->type & CS_VOLUME_ZONE_PHYSICAL_PROPERTIES))
+          && _property_formula(c_prop->name, z->name) != NULL
+          && strlen(fields_names) + strlen(c_prop->name) + 2 <= 512) {
+        if (n_laws > 0)
+          strcat(fields_names, "+");
+        strcat(fields_names, c_prop->name);
+        fvals[n_laws] = c_prop->val;
+        prop_ids[n_laws] = i;
+        n_laws++;
+        continue;
+      }
+    }
+
+    /* Evaluate pending user laws before any other property */
+
+    if (n_laws > 1) {
+      const cs_real_3_t *restrict cell_cen = cs_glob_mesh_quantities->cell_cen;
+      cs_meg_volume_function(z->name,
+                             z->n_elts,
+                             z->elt_ids,
+                             cell_cen,
+                             fields_names,
+                             fvals);
+    }
+    else if (n_laws == 1)
+      _physical_property(c_props[prop_ids[0]], z);
+
+    for (int j = 0; j < n_laws; j++)
+      done[prop_ids[j]] = true;
+
+    n_laws = 0;
+    fields_names[0] = '\0';
+
+    if (c_prop != NULL) {
+      _physical_property(c_prop, z);
+      done[i] = true;
+    }
+  }
+
+  CS_FREE(prop_ids);
+  CS_FREE(fvals);
+}
+
 /*-----------------------------------------------------------------------------
  * Return the value of choice for user scalar's property
  *
@@ -5227,25 +5311,70 @@ void
 cs_gui_balance_by_zone(void)
 {
   const char path0[] = "/analysis_control/scalar_balances/scalar_balance";
+  const char _default_criteria[] = "all[]";
+
+  /* Group zones by scalar, so that all zones of a given scalar
+     are handled in a single pass */
+
+  int n_scalars = 0, n_zones_max = 0;
+  const char **scalar_names = nullptr;
 
   for (cs_tree_node_t *tn = cs_tree_get_node(cs_glob_tree, path0);
        tn != NULL;
        tn = cs_tree_node_get_next_of_name(tn)) {
 
-    const char _default_criteria[] = "all[]";
-
-    const char *criteria = cs_tree_node_get_child_value_str(tn, "criteria");
-    if (criteria == NULL) criteria = _default_criteria;
+    n_zones_max++;
 
     for (cs_tree_node_t *tn_v = cs_tree_node_get_child(tn, "var_prop");
          tn_v != NULL;
          tn_v = cs_tree_node_get_next_of_name(tn_v)) {
 
       const char *name = cs_gui_node_get_tag(tn_v, "name");
-      cs_balance_by_zone(criteria, name);
+
+      int s_id = 0;
+      while (s_id < n_scalars && strcmp(scalar_names[s_id], name) != 0)
+        s_id++;
+      if (s_id == n_scalars) {
+        n_scalars++;
+        CS_REALLOC(scalar_names, n_scalars, const char *);
+        scalar_names[s_id] = name;
+      }
 
     }
   }
+
+  const char **criteria_list;
+  CS_MALLOC(criteria_list, n_zones_max, const char *);
+
+  for (int s_id = 0; s_id < n_scalars; s_id++) {
+
+    int n_zones = 0;
+
+    for (cs_tree_node_t *tn = cs_tree_get_node(cs_glob_tree, path0);
+         tn != NULL;
+         tn = cs_tree_node_get_next_of_name(tn)) {
+
+      const char *criteria = cs_tree_node_get_child_value_str(tn, "criteria");
+      if (criteria == NULL) criteria = _default_criteria;
+
+      for (cs_tree_node_t *tn_v = cs_tree_node_get_child(tn, "var_prop");
+           tn_v != NULL;
+           tn_v = cs_tree_node_get_next_of_name(tn_v)) {
+
+        const char *name = cs_gui_node_get_tag(tn_v, "name");
+        if (strcmp(name, scalar_names[s_id]) == 0) {
+          criteria_list[n_zones++] = criteria;
+          break;
+        }
+
+      }
+    }
+
+    cs_balance_by_zones(n_zones, criteria_list, 1, scalar_names + s_id, false);
+  }
+
+  CS_FREE(criteria_list);
+  CS_FREE(scalar_names);
 }
 
 /*----------------------------------------------------------------------------
@@ -5256,18 +5385,26 @@ void
 cs_gui_pressure_drop_by_zone(void)
 {
   const char path0[] = "/analysis_control/scalar_balances/pressure_drop";
+  const char _default_criteria[] = "all[]";
+
+  int n_zones = 0;
+  const char **criteria_list = nullptr;
 
   for (cs_tree_node_t *tn = cs_tree_get_node(cs_glob_tree, path0);
        tn != NULL;
        tn = cs_tree_node_get_next_of_name(tn)) {
 
-    const char _default_criteria[] = "all[]";
-
     const char *criteria = cs_tree_node_get_child_value_str(tn, "criteria");
     if (criteria == NULL) criteria = _default_criteria;
 
-    cs_pressure_drop_by_zone(criteria);
+    CS_REALLOC(criteria_list, n_zones + 1, const char *);
+    criteria_list[n_zones++] = criteria;
   }
+
+  if (n_zones > 0)
+    cs_pressure_drop_by_zones(n_zones, criteria_list, false);
+
+  CS_FREE(criteria_list);
 }
 
 /*----------------------------------------------------------------------------
@@ -5872,47 +6009,26 @@ cs_gui_physical_variable(void)
   int n_zones_pp
     = cs_volume_zone_n_type_zones(CS_VOLUME_ZONE_PHYSICAL_PROPERTIES);
   int n_zones = cs_volume_zone_n_zones();
+
   /* law for density (built-in for all current integrated physical models) */
-  if (cs_glob_fluid_properties->irovar == 1) {
-    cs_field_t *c_rho = CS_F_(rho);
-    if (n_zones_pp > 0) {
-      for (int z_id = 0; z_id < n_zones; z_id++) {
-        const cs_zone_t *z = cs_volume_zone_by_id(z_id);
-        if (z->type & CS_VOLUME_ZONE_PHYSICAL_PROPERTIES)
-          _physical_property(c_rho, z);
-      }
-    }
-  }
+  cs_field_t *c_rho = NULL;
+  if (cs_glob_fluid_properties->irovar == 1)
+    c_rho = CS_F_(rho);
 
   /* law for molecular viscosity */
-  if (cs_glob_fluid_properties->ivivar == 1) {
-    cs_field_t *c_mu = CS_F_(mu);
-    if (n_zones_pp > 0) {
-      for (int z_id = 0; z_id < n_zones; z_id++) {
-        const cs_zone_t *z = cs_volume_zone_by_id(z_id);
-        if (z->type & CS_VOLUME_ZONE_PHYSICAL_PROPERTIES)
-          _physical_property(c_mu, z);
-      }
-    }
-  }
+  cs_field_t *c_mu = NULL;
+  if (cs_glob_fluid_properties->ivivar == 1)
+    c_mu = CS_F_(mu);
 
   /* law for specific heat */
-  if (cs_glob_fluid_properties->icp > 0) {
-    cs_field_t *c_cp = CS_F_(cp);
-    if (n_zones_pp > 0) {
-      for (int z_id = 0; z_id < n_zones; z_id++) {
-        const cs_zone_t *z = cs_volume_zone_by_id(z_id);
-        if (z->type & CS_VOLUME_ZONE_PHYSICAL_PROPERTIES)
-          _physical_property(c_cp, z);
-      }
-    }
-  }
+  cs_field_t *c_cp = NULL;
+  if (cs_glob_fluid_properties->icp > 0)
+    c_cp = CS_F_(cp);
 
   /* law for thermal conductivity */
+  cs_field_t  *cond_dif = NULL;
   if (cs_glob_thermal_model->thermal_variable != CS_THERMAL_MODEL_NONE) {
 
-    cs_field_t  *cond_dif = NULL;
-
     cs_field_t *_th_f[] = {CS_F_(t), CS_F_(h), CS_F_(e_tot)};
 
     for (int i = 0; i < 3; i++)
@@ -5920,31 +6036,49 @@ cs_gui_physical_variable(void)
         if ((_th_f[i])->type & CS_FIELD_VARIABLE) {
           int k = cs_field_key_id("diffusivity_id");
           int cond_diff_id = cs_field_get_key_int(_th_f[i], k);
-          if (cond_diff_id > -1) {
+          if (cond_diff_id > -1)
             cond_dif = cs_field_by_id(cond_diff_id);
-            if (n_zones_pp > 0) {
-              for (int z_id = 0; z_id < n_zones; z_id++) {
-                const cs_zone_t *z = cs_volume_zone_by_id(z_id);
-                if (z->type & CS_VOLUME_ZONE_PHYSICAL_PROPERTIES)
-                  _physical_property(cond_dif, z);
-              }
-            }
-          }
           break;
         }
       }
   }
 
   /* law for volumic viscosity (compressible model) */
+  cs_field_t *c_viscv = NULL;
   if (cs_glob_physical_model_flag[CS_COMPRESSIBLE] > -1) {
-    if (cs_glob_fluid_properties->iviscv > 0) {
-      cs_field_t *c = cs_field_by_name_try("volume_viscosity");
-      if (n_zones_pp > 0 && c != NULL) {
-        for (int z_id = 0; z_id < n_zones; z_id++) {
-          const cs_zone_t *z = cs_volume_zone_by_id(z_id);
-          if (z->type & CS_VOLUME_ZONE_PHYSICAL_PROPERTIES)
-            _physical_property(c, z);
-        }
+    if (cs_glob_fluid_properties->iviscv > 0)
+      c_viscv = cs_field_by_name_try("volume_viscosity");
+  }
+
+  /* Properties are computed in this order, which is also that
+     used for grouped MEG formulas (see cs_meg_to_c.py). */
+
+  const int n_props = 5;
+  cs_field_t *c_props[] = {c_rho, c_mu, c_cp, cond_dif, c_viscv};
+  bool done[] = {false, false, false, false, false};
+
+  /* With a single physical properties zone, properties are computed
+     zone by zone just as property by property, so consecutive user laws
+     may be grouped in a single evaluation (a property computed otherwise,
+     such as a thermal law density, is evaluated before the user laws
+     following it). */
+
+  if (n_zones_pp == 1) {
+    for (int z_id = 0; z_id < n_zones; z_id++) {
+      const cs_zone_t *z = cs_volume_zone_by_id(z_id);
+      if (z->type & CS_VOLUME_ZONE_PHYSICAL_PROPERTIES)
+        _physical_properties_by_zone(z, n_props, c_props, done);
+    }
+  }
+
+  if (n_zones_pp > 0) {
+    for (int i = 0; i < n_props; i++) {
+      if (c_props[i] == NULL || done[i])
+        continue;
+      for (int z_id = 0; z_id < n_zones; z_id++) {
+        const cs_zone_t *z = cs_volume_zone_by_id(z_id);
+        if (z->type & CS_VOLUME_ZONE_PHYSICAL_PROPERTIES)
+          _physical_property(c_props[i], z);
       }
     }
   }
@@ -5979,10 +6113,10 @@ cs_gui_physical_variable(void)
               if (law != NULL) {
                 _physical_property(c_prop, z);
                 if (cs_glob_fluid_properties->irovar == 1) {
-                  cs_real_t *c_rho = CS_F_(rho)->val;
+                  const cs_real_t *rho_vals = CS_F_(rho)->val;
                   for (cs_lnum_t e_id = 0; e_id < z->n_elts; e_id++) {
                     cs_lnum_t c_id = z->elt_ids[e_id];
-                    c_prop->val[c_id] *= c_rho[c_id];
+                    c_prop->val[c_id] *= rho_vals[c_id];
                   }
                 }
                 else {
@@ -61,6 +61,7 @@
 
 #include "base/cs_boundary_conditions.h"
 #include "base/cs_boundary_zone.h"
+#include "base/cs_comm_profile.h"
 #include "base/cs_volume_zone.h"
 
 #include "base/cs_parameters.h"
@@ -1717,6 +1718,9 @@ void
 cs_lagr_solve_time_step(const int         itypfb[],
                         const cs_real_t  *dt)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_LAGRANGIAN);
+  cs_comm_profile_scope comm_scope(CS_COMM_PROFILE_CAT_LAGRANGIAN);
+
   static int ipass = 0;
   const cs_time_step_t *ts = cs_glob_time_step;
   const cs_mesh_t *mesh = cs_glob_mesh;
@@ -57,11 +57,16 @@ BEGIN_C_DECLS
  *        a given volume zone. The mathematical expression is defined in the
  *        GUI.
  *
- * \param[in]      zone_name  name of a volume zone
- * \param[in]      n_elts     number of elements related to the zone
- * \param[in]      elt_ids    list of element ids related to the zone
- * \param[in]      xyz        list of coordinates related to the zone
- * \param[in, out] f          array of pointers to cs_field_t structures
+ * Several fields may be requested at once, by joining their names with
+ * '+' in fields_names; formulas over the same zone are then evaluated
+ * in a single loop when possible.
+ *
+ * \param[in]      zone_name     name of a volume zone
+ * \param[in]      n_elts        number of elements related to the zone
+ * \param[in]      elt_ids       list of element ids related to the zone
+ * \param[in]      xyz           list of coordinates related to the zone
+ * \param[in]      fields_names  field name, or '+'-separated field names
+ * \param[in, out] fvals         array of pointers to values of each field
  */
 /*----------------------------------------------------------------------------*/
 
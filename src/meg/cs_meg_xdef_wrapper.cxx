@@ -195,9 +195,10 @@ cs_meg_xdef_wrapper(cs_real_t         time,
   const cs_real_3_t *_coords = (const cs_real_3_t *)coords;
 
   cs_real_t *meg_vals = NULL;
-  /* Volume function takes as an input arrays over the entire domain */
+  /* Volume function takes as an input arrays over the entire domain,
+     other functions return dense arrays (of size n_elts). */
   if (_input->type == CS_MEG_VOLUME_FUNC) {
-    if (dense_output) {
+    if (dense_output && elt_ids != NULL) {
       cs_lnum_t n_elts_alloc = _meg_alloc_size_from_location(_input->location);
       CS_MALLOC(meg_vals, n_elts_alloc * _input->stride, cs_real_t);
     }
@@ -205,12 +206,10 @@ cs_meg_xdef_wrapper(cs_real_t         time,
       meg_vals = retval;
   }
   else {
-    if (dense_output)
+    if (dense_output || elt_ids == NULL)
       meg_vals = retval;
-    else {
-      cs_lnum_t n_elts_alloc = _meg_alloc_size_from_location(_input->location);
-      CS_MALLOC(meg_vals, n_elts_alloc * _input->stride, cs_real_t);
-    }
+    else
+      CS_MALLOC(meg_vals, n_elts * _input->stride, cs_real_t);
   }
 
   switch(_input->type) {
@@ -226,7 +225,7 @@ cs_meg_xdef_wrapper(cs_real_t         time,
                                meg_vals);
 
       /* Copy values to retval, knowing that "meg_vals" is dense! */
-      if (!dense_output) {
+      if (meg_vals != retval) {
         cs_array_real_copy_subset(n_elts,
                                   _input->stride,
                                   elt_ids,
@@ -246,7 +245,7 @@ cs_meg_xdef_wrapper(cs_real_t         time,
                              _coords,
                              _input->name,
                              &(meg_vals));
-      if (dense_output) {
+      if (meg_vals != retval) {
         cs_array_real_copy_subset(n_elts,
                                   _input->stride,
                                   elt_ids,
@@ -268,7 +267,7 @@ cs_meg_xdef_wrapper(cs_real_t         time,
                             meg_vals);
 
       /* Copy values to retval, knowing that "meg_vals" is dense! */
-      if (!dense_output) {
+      if (meg_vals != retval) {
         cs_array_real_copy_subset(n_elts,
                                   _input->stride,
                                   elt_ids,
@@ -291,7 +290,7 @@ cs_meg_xdef_wrapper(cs_real_t         time,
                           meg_vals);
 
       /* Copy values to retval, knowing that "meg_vals" is dense! */
-      if (!dense_output) {
+      if (meg_vals != retval) {
         cs_array_real_copy_subset(n_elts,
                                   _input->stride,
                                   elt_ids,
@@ -310,7 +309,7 @@ cs_meg_xdef_wrapper(cs_real_t         time,
                              elt_ids,
                              _coords,
                              meg_vals);
-      if (!dense_output) {
+      if (meg_vals != retval) {
         cs_array_real_copy_subset(n_elts,
                                   _input->stride,
                                   elt_ids,
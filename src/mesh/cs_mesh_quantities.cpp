@@ -3026,6 +3026,8 @@ void
 cs_mesh_quantities_compute_preprocess(const cs_mesh_t       *m,
                                       cs_mesh_quantities_t  *mq)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_QUANTITIES);
+
   cs_lnum_t  n_i_faces = m->n_i_faces;
   cs_lnum_t  n_b_faces = cs::max(m->n_b_faces, m->n_b_faces_all);
   cs_lnum_t  n_cells_with_ghosts = m->n_cells_with_ghosts;
@@ -4476,6 +4478,8 @@ void
 cs_mesh_quantities_compute(const cs_mesh_t       *m,
                            cs_mesh_quantities_t  *mq)
 {
+  cs_mem_tag_scope mem_tag(CS_MEM_TAG_QUANTITIES);
+
   cs_lnum_t  dim = m->dim;
   cs_lnum_t  n_i_faces = m->n_i_faces;
   cs_lnum_t  n_b_faces = m->n_b_faces;
@@ -50,13 +50,14 @@
 #include "base/cs_post.h"
 
 #include "fvm/fvm_nodal_append.h"
-#include "fvm/fvm_neighborhood.h"
 
 #include "base/cs_math.h"
 #include "mesh/cs_mesh_headers.h"
+#include "base/cs_ale.h"
 #include "base/cs_order.h"
 #include "base/cs_parall.h"
 #include "base/cs_rotation.h"
+#include "base/cs_sort.h"
 
 /*----------------------------------------------------------------------------
  * Header of the current file
@@ -70,6 +71,57 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/* Maximum number of triangles in a bounding volume hierarchy leaf */
+
+#define _BVH_LEAF_SIZE 4
+
+/*=============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+/* Bounding volume hierarchy node */
+
+typedef struct {
+
+  cs_lnum_t  child;      /* id of first child (second child follows),
+                            or -1 for leaves */
+  cs_lnum_t  start;      /* start of node triangles in tria_ids */
+  cs_lnum_t  end;        /* end of node triangles in tria_ids */
+
+} _bvh_node_t;
+
+/* Triangle search structure and state kept between successive
+   intersection computations */
+
+struct _cs_stl_cache_t {
+
+  /* Bounding volume hierarchy; its topology is built once, and node
+     extents are refit to the current triangle coordinates at each query */
+
+  cs_lnum_t       n_tria;             /* number of triangles */
+  cs_lnum_t       n_nodes;            /* number of hierarchy nodes */
+  _bvh_node_t    *nodes;              /* hierarchy nodes (children always
+                                         have higher ids than parents) */
+  cs_lnum_t      *tria_ids;           /* triangle ids, ordered by leaf */
+  cs_real_6_t    *tria_extents;       /* current triangle extents */
+  cs_real_6_t    *node_extents;       /* current node extents */
+
+  /* State of the previous porosity computation */
+
+  cs_lnum_t       n_cells_ext;        /* number of cells with ghosts
+                                         (0 if no state is available) */
+  cs_real_6_t    *cell_extents;       /* main mesh cell extents */
+  cs_real_t       cell_size_min;      /* smallest cell extent (global) */
+  cs_real_3_t    *tria_coords_prev;   /* triangle vertex coordinates */
+  int            *cell_tag;           /* cell tag (see porosity
+                                         computation) */
+
+};
+
 /*=============================================================================
  * Static global variables
  *============================================================================*/
@@ -1075,6 +1127,478 @@ _update_init_mesh(cs_stl_mesh_t *stl_mesh)
 
 }
 
+/*----------------------------------------------------------------------------
+ * Check if two bounding boxes overlap.
+ *
+ * parameters:
+ *   a <-- extents of first box (xmin, ymin, zmin, xmax, ymax, zmax)
+ *   b <-- extents of second box
+ *
+ * returns:
+ *   true if boxes overlap (including contact), false otherwise
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_boxes_overlap(const cs_real_t  a[6],
+               const cs_real_t  b[6])
+{
+  return (   a[0] <= b[3] && b[0] <= a[3]
+          && a[1] <= b[4] && b[1] <= a[4]
+          && a[2] <= b[5] && b[2] <= a[5]);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the extents of each triangle of an STL mesh.
+ *
+ * parameters:
+ *   stl_mesh <-- pointer to STL mesh structure
+ *   extents  --> triangle extents (size: n_faces)
+ *----------------------------------------------------------------------------*/
+
+static void
+_compute_tria_extents(const cs_stl_mesh_t  *stl_mesh,
+                      cs_real_6_t           extents[])
+{
+  const cs_real_3_t *coords = stl_mesh->coords;
+
+  for (cs_lnum_t i = 0; i < stl_mesh->n_faces; i++) {
+    for (int j = 0; j < 3; j++) {
+      extents[i][j]   = coords[3*i][j];
+      extents[i][j+3] = coords[3*i][j];
+    }
+    for (int vtx_id = 1; vtx_id < 3; vtx_id++) {
+      for (int j = 0; j < 3; j++) {
+        extents[i][j]   = cs::min(extents[i][j],   coords[3*i + vtx_id][j]);
+        extents[i][j+3] = cs::max(extents[i][j+3], coords[3*i + vtx_id][j]);
+      }
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build the topology of a triangle bounding volume hierarchy.
+ *
+ * Triangles are recursively split at the middle of the longest side of
+ * the bounding box of their centers.
+ *
+ * parameters:
+ *   c <-> pointer to cache structure, with triangle extents defined
+ *----------------------------------------------------------------------------*/
+
+static void
+_bvh_build(cs_stl_cache_t  *c)
+{
+  const cs_lnum_t n_tria = c->n_tria;
+
+  c->n_nodes = 0;
+  if (n_tria < 1)
+    return;
+
+  CS_MALLOC(c->tria_ids, n_tria, cs_lnum_t);
+  CS_MALLOC(c->nodes, 2*n_tria, _bvh_node_t);
+
+  for (cs_lnum_t i = 0; i < n_tria; i++)
+    c->tria_ids[i] = i;
+
+  cs_lnum_t *stack = nullptr;
+  CS_MALLOC(stack, 2*n_tria, cs_lnum_t);
+
+  c->nodes[0].child = -1;
+  c->nodes[0].start = 0;
+  c->nodes[0].end = n_tria;
+  c->n_nodes = 1;
+
+  cs_lnum_t n_stack = 1;
+  stack[0] = 0;
+
+  while (n_stack > 0) {
+
+    _bvh_node_t *node = c->nodes + stack[--n_stack];
+    const cs_lnum_t s_id = node->start, e_id = node->end;
+
+    if (e_id - s_id <= _BVH_LEAF_SIZE)
+      continue;
+
+    /* Bounds of triangle centers (twice the actual values) */
+
+    cs_real_t lo[3] = {HUGE_VAL, HUGE_VAL, HUGE_VAL};
+    cs_real_t hi[3] = {-HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
+
+    for (cs_lnum_t i = s_id; i < e_id; i++) {
+      const cs_real_t *e = c->tria_extents[c->tria_ids[i]];
+      for (int j = 0; j < 3; j++) {
+        lo[j] = cs::min(lo[j], e[j] + e[j+3]);
+        hi[j] = cs::max(hi[j], e[j] + e[j+3]);
+      }
+    }
+
+    int axis = 0;
+    for (int j = 1; j < 3; j++) {
+      if (hi[j] - lo[j] > hi[axis] - lo[axis])
+        axis = j;
+    }
+
+    /* Coincident centers: keep as (larger) leaf */
+
+    if (!(hi[axis] > lo[axis]))
+      continue;
+
+    const cs_real_t mid = 0.5*(lo[axis] + hi[axis]);
+
+    cs_lnum_t i = s_id, j = e_id - 1;
+    while (i <= j) {
+      const cs_real_t *e = c->tria_extents[c->tria_ids[i]];
+      if (e[axis] + e[axis+3] < mid)
+        i++;
+      else {
+        cs_lnum_t t_id = c->tria_ids[i];
+        c->tria_ids[i] = c->tria_ids[j];
+        c->tria_ids[j] = t_id;
+        j--;
+      }
+    }
+
+    if (i == s_id || i == e_id)
+      i = s_id + (e_id - s_id)/2;
+
+    const cs_lnum_t child = c->n_nodes;
+    c->n_nodes += 2;
+
+    node->child = child;
+
+    c->nodes[child].child = -1;
+    c->nodes[child].start = s_id;
+    c->nodes[child].end = i;
+    c->nodes[child+1].child = -1;
+    c->nodes[child+1].start = i;
+    c->nodes[child+1].end = e_id;
+
+    stack[n_stack++] = child;
+    stack[n_stack++] = child + 1;
+
+  }
+
+  CS_FREE(stack);
+
+  CS_REALLOC(c->nodes, c->n_nodes, _bvh_node_t);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute bounding volume hierarchy node extents from triangle extents.
+ *
+ * parameters:
+ *   c            <-- pointer to cache structure
+ *   tria_extents <-- triangle extents
+ *   node_extents --> node extents
+ *----------------------------------------------------------------------------*/
+
+static void
+_bvh_refit(const cs_stl_cache_t  *c,
+           const cs_real_6_t      tria_extents[],
+           cs_real_6_t            node_extents[])
+{
+  for (cs_lnum_t n_id = c->n_nodes - 1; n_id >= 0; n_id--) {
+
+    const _bvh_node_t *node = c->nodes + n_id;
+    cs_real_t *ne = node_extents[n_id];
+
+    for (int j = 0; j < 3; j++) {
+      ne[j] = HUGE_VAL;
+      ne[j+3] = -HUGE_VAL;
+    }
+
+    if (node->child < 0) {
+      for (cs_lnum_t i = node->start; i < node->end; i++) {
+        const cs_real_t *e = tria_extents[c->tria_ids[i]];
+        for (int j = 0; j < 3; j++) {
+          ne[j] = cs::min(ne[j], e[j]);
+          ne[j+3] = cs::max(ne[j+3], e[j+3]);
+        }
+      }
+    }
+    else {
+      for (cs_lnum_t k = node->child; k < node->child + 2; k++) {
+        const cs_real_t *e = node_extents[k];
+        for (int j = 0; j < 3; j++) {
+          ne[j] = cs::min(ne[j], e[j]);
+          ne[j+3] = cs::max(ne[j+3], e[j+3]);
+        }
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Find triangles whose extents overlap a given box.
+ *
+ * If n_max is null, the search stops at the first overlapping triangle.
+ *
+ * parameters:
+ *   c            <-- pointer to cache structure
+ *   tria_extents <-- triangle extents
+ *   node_extents <-- associated node extents
+ *   box          <-- searched box extents
+ *   stack        <-> work array (size: c->n_nodes)
+ *   n_max        <-> allocated size of tria_ids, or nullptr
+ *   tria_ids     <-> ids of overlapping triangles, or nullptr
+ *
+ * returns:
+ *   number of overlapping triangles (0 or 1 if n_max is null)
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_bvh_query(const cs_stl_cache_t  *c,
+           const cs_real_6_t      tria_extents[],
+           const cs_real_6_t      node_extents[],
+           const cs_real_t        box[6],
+           cs_lnum_t             *stack,
+           cs_lnum_t             *n_max,
+           cs_lnum_t            **tria_ids)
+{
+  cs_lnum_t n_found = 0;
+
+  if (c->n_nodes < 1)
+    return n_found;
+
+  cs_lnum_t n_stack = 1;
+  stack[0] = 0;
+
+  while (n_stack > 0) {
+
+    const cs_lnum_t n_id = stack[--n_stack];
+
+    if (!_boxes_overlap(node_extents[n_id], box))
+      continue;
+
+    const _bvh_node_t *node = c->nodes + n_id;
+
+    if (node->child > -1) {
+      stack[n_stack++] = node->child;
+      stack[n_stack++] = node->child + 1;
+      continue;
+    }
+
+    for (cs_lnum_t i = node->start; i < node->end; i++) {
+      const cs_lnum_t t_id = c->tria_ids[i];
+      if (_boxes_overlap(tria_extents[t_id], box)) {
+        if (n_max == nullptr)
+          return 1;
+        if (n_found >= *n_max) {
+          *n_max = cs::max(2*(*n_max), (cs_lnum_t)16);
+          CS_REALLOC(*tria_ids, *n_max, cs_lnum_t);
+        }
+        (*tria_ids)[n_found++] = t_id;
+      }
+    }
+
+  }
+
+  return n_found;
+}
+
+/*----------------------------------------------------------------------------
+ * Free the state of the previous porosity computation.
+ *
+ * parameters:
+ *   c <-> pointer to cache structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_cache_reset_porosity(cs_stl_cache_t  *c)
+{
+  c->n_cells_ext = 0;
+  CS_FREE(c->cell_extents);
+  CS_FREE(c->tria_coords_prev);
+  CS_FREE(c->cell_tag);
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a cache structure.
+ *
+ * parameters:
+ *   c <-> pointer to cache structure pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_cache_destroy(cs_stl_cache_t  **c)
+{
+  cs_stl_cache_t *_c = *c;
+
+  if (_c == nullptr)
+    return;
+
+  _cache_reset_porosity(_c);
+
+  CS_FREE(_c->nodes);
+  CS_FREE(_c->tria_ids);
+  CS_FREE(_c->tria_extents);
+  CS_FREE(_c->node_extents);
+
+  CS_FREE(*c);
+}
+
+/*----------------------------------------------------------------------------
+ * Update the search structure of an STL mesh to its current coordinates.
+ *
+ * The hierarchy is built if needed, and refit otherwise.
+ *
+ * parameters:
+ *   stl_mesh <-> pointer to STL mesh structure
+ *
+ * returns:
+ *   pointer to updated cache structure
+ *----------------------------------------------------------------------------*/
+
+static cs_stl_cache_t *
+_update_cache(cs_stl_mesh_t  *stl_mesh)
+{
+  cs_stl_cache_t *c = stl_mesh->cache;
+
+  if (c != nullptr && c->n_tria != stl_mesh->n_faces)
+    _cache_destroy(&(stl_mesh->cache));
+
+  if (stl_mesh->cache == nullptr) {
+    CS_MALLOC(c, 1, cs_stl_cache_t);
+
+    c->n_tria = stl_mesh->n_faces;
+    c->n_nodes = 0;
+    c->nodes = nullptr;
+    c->tria_ids = nullptr;
+    c->node_extents = nullptr;
+    CS_MALLOC(c->tria_extents, c->n_tria, cs_real_6_t);
+
+    c->n_cells_ext = 0;
+    c->cell_extents = nullptr;
+    c->cell_size_min = 0.;
+    c->tria_coords_prev = nullptr;
+    c->cell_tag = nullptr;
+
+    _compute_tria_extents(stl_mesh, c->tria_extents);
+    _bvh_build(c);
+    CS_MALLOC(c->node_extents, c->n_nodes, cs_real_6_t);
+
+    stl_mesh->cache = c;
+  }
+  else
+    _compute_tria_extents(stl_mesh, c->tria_extents);
+
+  _bvh_refit(c, c->tria_extents, c->node_extents);
+
+  return c;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute intersection between a STL mesh and the main mesh, given
+ * main mesh cell extents.
+ *
+ * The search structure must have been updated.
+ *
+ * parameters:
+ *   stl_mesh         <-- pointer to the associated STL mesh structure
+ *   cell_extents     <-- main mesh cell extents
+ *   n_input          <-- number of cells on which intersection is done
+ *   input_idx        <-- ids of input cells (size: n_input)
+ *   n_selected_cells --> number of output intersecting cells
+ *   selected_cells   --> ids of output cells
+ *   tria_in_cell_idx --> start index of triangles intersecting each cell,
+ *                        or nullptr
+ *   tria_in_cell_lst <-> list of triangles in intersecting cells, or nullptr
+ *   max_size         <-> maximum size of tria_in_cell_lst array
+ *----------------------------------------------------------------------------*/
+
+static void
+_stl_intersection(const cs_stl_mesh_t  *stl_mesh,
+                  const cs_real_6_t     cell_extents[],
+                  cs_lnum_t             n_input,
+                  const cs_lnum_t      *input_idx,
+                  cs_lnum_t            *n_selected_cells,
+                  cs_lnum_t            *selected_cells,
+                  cs_lnum_t            *tria_in_cell_idx,
+                  cs_lnum_t           **tria_in_cell_lst,
+                  cs_lnum_t            *max_size)
+{
+  const cs_stl_cache_t *c = stl_mesh->cache;
+
+  cs_lnum_t *_tria_in_cell_lst = nullptr;
+  if (tria_in_cell_lst != nullptr)
+    _tria_in_cell_lst = *tria_in_cell_lst;
+
+  cs_lnum_t n_cand_max = 0;
+  cs_lnum_t *cand = nullptr, *stack = nullptr;
+  CS_MALLOC(stack, c->n_nodes, cs_lnum_t);
+
+  cs_lnum_t _n_selected_cells = 0;
+  cs_lnum_t idx_num = 0;
+
+  /* Init of list if needed */
+  if (tria_in_cell_idx != nullptr)
+    tria_in_cell_idx[_n_selected_cells] = 0;
+
+  for (cs_lnum_t i = 0; i < n_input; i++) {
+
+    const cs_lnum_t cell_id = input_idx[i];
+    const cs_real_t *box = cell_extents[cell_id];
+
+    cs_lnum_t n_cand = _bvh_query(c,
+                                  c->tria_extents,
+                                  c->node_extents,
+                                  box,
+                                  stack,
+                                  &n_cand_max,
+                                  &cand);
+
+    if (n_cand == 0)
+      continue;
+
+    cs_sort_lnum(cand, n_cand);
+
+    cs_lnum_t nb_tri_in_cell = 0;
+
+    for (cs_lnum_t j = 0; j < n_cand; j++) {
+
+      cs_lnum_t ntria_id = cand[j];
+
+      cs_real_t tri_coords[3][3];
+      for (cs_lnum_t k = 0; k < 3; k++) {
+        for (cs_lnum_t l = 0; l < 3; l++)
+          tri_coords[k][l] = stl_mesh->coords[3*ntria_id + k][l];
+      }
+
+      // Additional tests to know weather the triangle
+      // overlap the cell bounding box
+      if (_triangle_box_intersect(box, tri_coords)) {
+        nb_tri_in_cell++;
+        if (tria_in_cell_lst != nullptr) {
+          if (idx_num >= *max_size) {
+            *max_size = cs::max(2*(*max_size), (cs_lnum_t)16);
+            CS_REALLOC(_tria_in_cell_lst, *max_size, cs_lnum_t);
+          }
+          _tria_in_cell_lst[idx_num] = ntria_id;
+          idx_num ++;
+        }
+      }
+
+    }
+
+    // If at least one triangle was found, tag the cell.
+    if (nb_tri_in_cell > 0) {
+      selected_cells[_n_selected_cells] = cell_id;
+      if (tria_in_cell_idx != nullptr)
+        tria_in_cell_idx[_n_selected_cells + 1] = idx_num;
+      _n_selected_cells ++;
+    }
+
+  }
+
+  *n_selected_cells  = _n_selected_cells;
+  if (tria_in_cell_lst != nullptr)
+    *tria_in_cell_lst = _tria_in_cell_lst;
+
+  CS_FREE(cand);
+  CS_FREE(stack);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -1125,6 +1649,7 @@ cs_stl_mesh_add(const char  *name)
     stl_mesh->seed_coords = nullptr;
     stl_mesh->is_porous = false;
     stl_mesh->ext_mesh = nullptr;
+    stl_mesh->cache = nullptr;
 
     _stl_meshes.mesh_list[_stl_meshes.n_meshes - 1] = stl_mesh;
   }
@@ -1173,6 +1698,7 @@ cs_stl_mesh_destroy_all(void)
     CS_FREE(ptr->coords);
     CS_FREE(ptr->coords_ini);
     CS_FREE(ptr->seed_coords);
+    _cache_destroy(&(ptr->cache));
     CS_FREE(ptr);
   }
 
@@ -1611,6 +2137,9 @@ cs_stl_set_porosity_seed(cs_stl_mesh_t  *stl_mesh,
 
   for (int i = 0; i < 3*n_points; i++)
     stl_mesh->seed_coords[i] = coords[i];
+
+  if (stl_mesh->cache != nullptr)
+    _cache_reset_porosity(stl_mesh->cache);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1797,6 +2326,10 @@ cs_stl_file_write(cs_stl_mesh_t  *stl_mesh,
 /*!
  * \brief Compute intersection between a STL mesh and the main mesh.
  *
+ * Candidate triangles are found using a bounding volume hierarchy which is
+ * kept with the STL mesh and refit to its current coordinates, so repeated
+ * calls for a moving STL mesh do not rebuild a global search structure.
+ *
  * \param[in]     stl_mesh         pointer to the associated STL mesh structure
  * \param[in]     n_input          number of cells on which intersection is done
  * \param[in]     input_idx        index of input cells (size: input_idx)
@@ -1821,181 +2354,21 @@ cs_stl_intersection(cs_stl_mesh_t *stl_mesh,
 {
   cs_mesh_t *m = cs_glob_mesh;
 
-  cs_lnum_t  n_cells = n_input;// Local number of cells of the main mesh
-  cs_lnum_t  n_tria_stl = stl_mesh->n_faces; // Local number of triangles of the STL
-  cs_lnum_t  n_boxes = n_cells + n_tria_stl;
-  int dim = 3;
+  _update_cache(stl_mesh);
 
-  cs_lnum_t *_tria_in_cell_lst = nullptr;
-  if (tria_in_cell_lst != nullptr)
-    _tria_in_cell_lst = *tria_in_cell_lst;
-
-  cs_gnum_t *box_gnum = nullptr;
-  cs_coord_t *extents = nullptr;
-
-  CS_MALLOC(box_gnum, n_boxes, cs_gnum_t);
-  CS_MALLOC(extents , 2*dim*n_boxes, cs_coord_t);
-
-  /* Global numbering construction */
-  for (cs_lnum_t i = 0; i < n_cells; i++)
-    box_gnum[i] = i + 1;
-
-  for (cs_lnum_t i = 0; i < n_tria_stl; i++)
-    box_gnum[i + n_cells] = n_cells + i + 1;
-
-
-  /* Compute extents */
-
-  // For the main mesh
-  cs_real_6_t *bbox = nullptr;
-  bbox = cs_mesh_quantities_cell_extents(m, 0.0);
-
-  for (cs_lnum_t i = 0; i < n_cells; i++)
-    for (int id = 0; id < 6; id ++)
-      extents[6*i + id] = bbox[input_idx[i]][id];
-
-  CS_FREE(bbox);
-
-  // For the STL mesh
-  CS_MALLOC(bbox, n_tria_stl, cs_real_6_t);
-
-  for (cs_lnum_t i = 0; i < n_tria_stl; i++) {
-    bbox[i][0] = HUGE_VAL;
-    bbox[i][1] = HUGE_VAL;
-    bbox[i][2] = HUGE_VAL;
-    bbox[i][3] = -HUGE_VAL;
-    bbox[i][4] = -HUGE_VAL;
-    bbox[i][5] = -HUGE_VAL;
-  }
-
-  for (cs_lnum_t i = 0; i < n_tria_stl; i++) {
-    for (int vtx_id = 0; vtx_id < 3; vtx_id ++) {
-      bbox[i][0] = cs::min(bbox[i][0], stl_mesh->coords[3*i + vtx_id][0]);
-      bbox[i][3] = cs::max(bbox[i][3], stl_mesh->coords[3*i + vtx_id][0]);
-      bbox[i][1] = cs::min(bbox[i][1], stl_mesh->coords[3*i + vtx_id][1]);
-      bbox[i][4] = cs::max(bbox[i][4], stl_mesh->coords[3*i + vtx_id][1]);
-      bbox[i][2] = cs::min(bbox[i][2], stl_mesh->coords[3*i + vtx_id][2]);
-      bbox[i][5] = cs::max(bbox[i][5], stl_mesh->coords[3*i + vtx_id][2]);
-    }
-  }
+  cs_real_6_t *bbox = cs_mesh_quantities_cell_extents(m, 0.0);
 
-  for (cs_lnum_t i = 0; i < n_tria_stl; i++) {
-    for (cs_lnum_t id = 0; id < 6; id ++)
-      extents[6*(i+n_cells) + id] = bbox[i][id];
-  }
+  _stl_intersection(stl_mesh,
+                    bbox,
+                    n_input,
+                    input_idx,
+                    n_selected_cells,
+                    selected_cells,
+                    tria_in_cell_idx,
+                    tria_in_cell_lst,
+                    max_size);
 
   CS_FREE(bbox);
-
-  fvm_neighborhood_t  *cell_neighborhood = nullptr;
-
-#if defined HAVE_MPI
-  cell_neighborhood = fvm_neighborhood_create(MPI_COMM_NULL);
-#else
-  cell_neighborhood = fvm_neighborhood_create();
-#endif
-
-  // Compute intersections by boxes (transfer ownership)
-  fvm_neighborhood_by_boxes( cell_neighborhood,
-                             dim,
-                             n_boxes,
-                             box_gnum,
-                             extents,
-                             nullptr,
-                             nullptr );
-
-  cs_lnum_t  n_elts = 0;
-  cs_gnum_t *elt_num = nullptr;
-  cs_lnum_t *neighbor_index = nullptr;
-  cs_gnum_t *neighbor_num = nullptr;
-
-  // Get the data back
-  fvm_neighborhood_transfer_data( cell_neighborhood,
-                                  &n_elts,
-                                  &elt_num,
-                                  &neighbor_index,
-                                  &neighbor_num );
-
-  cs_gnum_t _n_cells = n_cells;
-  cs_lnum_t _n_selected_cells = 0;
-  cs_lnum_t idx_num = 0;
-
-  /* Init of list if needed */
-  if (tria_in_cell_idx != nullptr)
-    tria_in_cell_idx[_n_selected_cells] = 0;
-
-  /* Loop on the elements that have neighbors */
-  for (cs_lnum_t i = 0; i < n_elts; i++) {
-
-    // Check if the element is a box from the main mesh
-    if (elt_num[i] <= _n_cells) {
-
-      cs_lnum_t cell_id = elt_num[i] - 1;
-      cs_lnum_t nb_tri_in_cell = 0;
-
-      // Loop on the neighbors
-      for (cs_lnum_t j = neighbor_index[i]; j < neighbor_index[i+1]; j++) {
-
-        // If the current neighbor is a box from the STL,
-        // -> the BB from the cell intersects the BB from
-        // the STL
-        if (neighbor_num[j] > _n_cells) {
-
-          // Local number of the triangle
-          cs_lnum_t ntria_id = neighbor_num[j] - n_cells - 1;
-
-          cs_real_t tri_coords[3][3];
-          for (cs_lnum_t k = 0; k < 3; k++) {
-            for (cs_lnum_t l = 0; l < 3; l++)
-              tri_coords[k][l] = stl_mesh->coords[3*ntria_id + k][l];
-          }
-
-          // Additional tests to know weather the triangle
-          // overlap the cell bounding box
-          bool triangle_box_intersect
-            = _triangle_box_intersect(&extents[6*cell_id],
-                                      tri_coords);
-
-
-          if (triangle_box_intersect) {
-            nb_tri_in_cell++;
-            if (tria_in_cell_lst != nullptr) {
-              if (idx_num >= *max_size) {
-                *max_size *= 2;
-                CS_REALLOC(_tria_in_cell_lst, *max_size, cs_lnum_t);
-              }
-              _tria_in_cell_lst[idx_num] = ntria_id;
-              idx_num ++;
-            }
-
-          }
-
-        }
-
-      } // End loop on neighbors
-
-      // If at least one time a triangle neigbor was found in the
-      // previous loop, tag the cell.
-      if (nb_tri_in_cell > 0) {
-        selected_cells[_n_selected_cells] = input_idx[cell_id];
-        if (tria_in_cell_idx != nullptr)
-          tria_in_cell_idx[_n_selected_cells + 1] = idx_num;
-        _n_selected_cells ++;
-      }
-
-    }
-  }
-
-  *n_selected_cells  = _n_selected_cells;
-  if (tria_in_cell_lst != nullptr)
-    *tria_in_cell_lst = _tria_in_cell_lst;
-
-  fvm_neighborhood_destroy(&cell_neighborhood);
-
-  CS_FREE(elt_num);
-  CS_FREE(neighbor_index);
-  CS_FREE(neighbor_num);
-  CS_FREE(box_gnum);
-  CS_FREE(extents);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2075,12 +2448,10 @@ cs_stl_refine(cs_stl_mesh_t *stl_mesh,
       int *cell_tag;
       CS_MALLOC(cell_tag, m->n_cells_with_ghosts, int);
 
-      for (cs_lnum_t c_id = 0; c_id < m->n_cells; c_id ++) {
+      for (cs_lnum_t c_id = 0; c_id < m->n_cells; c_id ++)
         cell_tag[c_id] = 0;
-        for (cs_lnum_t i = 0; i < n_selected_cells; i++) {
-          if (c_id == selected_cells[i]) cell_tag[c_id] = 1;
-        }
-      }
+      for (cs_lnum_t i = 0; i < n_selected_cells; i++)
+        cell_tag[selected_cells[i]] = 1;
 
       if (m->halo!=nullptr) {
         cs_halo_set_use_barrier(1);
@@ -2150,6 +2521,14 @@ cs_stl_refine(cs_stl_mesh_t *stl_mesh,
 /*!
  * \brief Compute porosity field according to a given STL mesh
  *
+ * When the main mesh is fixed, the result of the previous call is reused,
+ * and intersections and inside/outside propagation are only recomputed
+ * for cells overlapping the region swept by the STL triangles since
+ * that call. As the path followed by the STL vertices between calls
+ * is not known, this is only done when their displacement does not
+ * exceed the smallest cell size; otherwise, the porosity is fully
+ * recomputed.
+ *
  * \param[in]  stl_mesh      pointer to the associated STL mesh structure
  * \param[out] porosity      interpolated porosity field
  * \param[out] indic         indicator of the STL location
@@ -2166,6 +2545,9 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
 
   cs_stl_mesh_t *stl = stl_mesh;
 
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+
   const cs_real_t *volume   = mq->cell_vol;
   const cs_real_3_t *xyzcen = mq->cell_cen;
   const cs_real_3_t *cdgfac = mq->i_face_cog;
@@ -2180,10 +2562,141 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
               _("Error in STL porosity computation: no seed points"
                 "for STL mesh %s is given."), stl_mesh->name);
 
+  /* Update triangle search structure, and check if the state
+   * of the previous computation may be reused
+   * ============================================= */
+
+  cs_stl_cache_t *c = _update_cache(stl_mesh);
+
+  int reuse_prev = (   c->n_cells_ext == n_cells_ext
+                    && m->time_dep == CS_MESH_FIXED
+                    && cs_glob_ale == CS_ALE_NONE) ? 1 : 0;
+  cs_parall_min(1, CS_INT_TYPE, &reuse_prev);
+
+  /* Vertex displacement since previous computation; cells outside the
+     swept region keep their previous inside/outside tag, which is only
+     safe for displacements smaller than a cell */
+
+  cs_real_t *vtx_disp = nullptr;
+
+  if (reuse_prev) {
+    CS_MALLOC(vtx_disp, 3*c->n_tria, cs_real_t);
+
+    cs_real_t d_max = 0.;
+    for (cs_lnum_t i = 0; i < 3*c->n_tria; i++) {
+      vtx_disp[i] = cs_math_3_distance(stl->coords[i],
+                                       c->tria_coords_prev[i]);
+      d_max = cs::max(d_max, vtx_disp[i]);
+    }
+    cs_parall_max(1, CS_REAL_TYPE, &d_max);
+
+    if (d_max > c->cell_size_min) {
+      reuse_prev = 0;
+      CS_FREE(vtx_disp);
+    }
+  }
+
+  if (reuse_prev == 0) {
+    _cache_reset_porosity(c);
+    c->n_cells_ext = n_cells_ext;
+    c->cell_extents = cs_mesh_quantities_cell_extents(m, 0.0);
+    c->cell_size_min = HUGE_VAL;
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+      for (int j = 0; j < 3; j++)
+        c->cell_size_min = cs::min(c->cell_size_min,
+                                   (  c->cell_extents[cell_id][j+3]
+                                    - c->cell_extents[cell_id][j]));
+    }
+    cs_parall_min(1, CS_REAL_TYPE, &(c->cell_size_min));
+    CS_MALLOC(c->tria_coords_prev, 3*c->n_tria, cs_real_3_t);
+    CS_MALLOC(c->cell_tag, n_cells_ext, int);
+  }
+
+  const cs_real_6_t *bbox = c->cell_extents;
+
+  /* Select cells in which the STL may have moved (all cells if
+   * no previous state is available)
+   * =============================== */
+
+  cs_lnum_t n_input_cells = 0;
+  cs_lnum_t *input_cells = nullptr;
+  int *band = nullptr;
+
+  CS_MALLOC(input_cells, n_cells, cs_lnum_t);
+  CS_MALLOC(band, n_cells_ext, int);
+
+  if (reuse_prev) {
+
+    /* Triangle extents swept between previous and current positions;
+       extents of both positions are enlarged by half the vertex
+       displacement, which bounds any circular arc of up to a half turn
+       (such as rotations) between these positions */
+
+    cs_real_6_t *s_tria_extents = nullptr, *s_node_extents = nullptr;
+    cs_lnum_t *stack = nullptr;
+    CS_MALLOC(s_tria_extents, c->n_tria, cs_real_6_t);
+    CS_MALLOC(s_node_extents, c->n_nodes, cs_real_6_t);
+    CS_MALLOC(stack, c->n_nodes, cs_lnum_t);
+
+    for (cs_lnum_t i = 0; i < c->n_tria; i++) {
+      const cs_real_3_t *x_prev = c->tria_coords_prev + 3*i;
+      cs_real_t d = 0.;
+      for (int vtx_id = 0; vtx_id < 3; vtx_id++)
+        d = cs::max(d, 0.5*vtx_disp[3*i + vtx_id]);
+      for (int j = 0; j < 3; j++) {
+        cs_real_t x_min = c->tria_extents[i][j];
+        cs_real_t x_max = c->tria_extents[i][j+3];
+        for (int vtx_id = 0; vtx_id < 3; vtx_id++) {
+          x_min = cs::min(x_min, x_prev[vtx_id][j]);
+          x_max = cs::max(x_max, x_prev[vtx_id][j]);
+        }
+        s_tria_extents[i][j] = x_min - d;
+        s_tria_extents[i][j+3] = x_max + d;
+      }
+    }
+
+    _bvh_refit(c, s_tria_extents, s_node_extents);
+
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+      band[cell_id] = _bvh_query(c, s_tria_extents, s_node_extents,
+                                 bbox[cell_id], stack, nullptr, nullptr);
+      if (band[cell_id])
+        input_cells[n_input_cells++] = cell_id;
+    }
+
+    CS_FREE(stack);
+    CS_FREE(s_node_extents);
+    CS_FREE(s_tria_extents);
+    CS_FREE(vtx_disp);
+
+  }
+  else {
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+      band[cell_id] = 1;
+      input_cells[cell_id] = cell_id;
+    }
+    n_input_cells = n_cells;
+  }
+
+  for (cs_lnum_t cell_id = n_cells; cell_id < n_cells_ext; cell_id++)
+    band[cell_id] = 0;
+
+  if (m->halo != nullptr)
+    cs_halo_sync_num(m->halo, CS_HALO_STANDARD, band);
+
+  /* Interior faces adjacent to selected cells */
+
+  cs_lnum_t n_band_faces = 0;
+  cs_lnum_t *band_faces = nullptr;
+  CS_MALLOC(band_faces, m->n_i_faces, cs_lnum_t);
+
+  for (cs_lnum_t face_id = 0; face_id < m->n_i_faces; face_id++) {
+    if (band[ifacel[face_id][0]] || band[ifacel[face_id][1]])
+      band_faces[n_band_faces++] = face_id;
+  }
+
   /* Initialisation */
-  cs_lnum_t n_input_cells      = m->n_cells;
   cs_lnum_t n_selected_cells   = 0;
-  cs_lnum_t *input_cells       = nullptr;
   cs_lnum_t *selected_cells    = nullptr;
   cs_lnum_t *tria_in_cell_lst  = nullptr;
   cs_lnum_t *tria_in_cell_idx  = nullptr;
@@ -2193,17 +2706,13 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
 
   cs_lnum_t max_size = stl->n_faces;
 
-  CS_MALLOC(input_cells      , m->n_cells      , cs_lnum_t);
-  CS_MALLOC(selected_cells   , m->n_cells      , cs_lnum_t);
-  CS_MALLOC(tria_in_cell_idx , m->n_cells      , cs_lnum_t);
-  CS_MALLOC(tria_in_cell_lst , max_size        , cs_lnum_t);
-  CS_MALLOC(cell_selected_idx, m->n_cells      , cs_lnum_t);
-  CS_MALLOC(stl_normals      , stl->n_faces*3  , cs_real_t);
-  CS_MALLOC(mean_plane_def   , m->n_cells*6    , cs_real_t);
+  CS_MALLOC(selected_cells   , n_input_cells    , cs_lnum_t);
+  CS_MALLOC(tria_in_cell_idx , n_input_cells + 1, cs_lnum_t);
+  CS_MALLOC(tria_in_cell_lst , max_size         , cs_lnum_t);
+  CS_MALLOC(cell_selected_idx, n_cells          , cs_lnum_t);
+  CS_MALLOC(stl_normals      , stl->n_faces*3   , cs_real_t);
 
-  /* Input cells are all[] cells and initialisation */
-  for (cs_lnum_t i = 0; i < m->n_cells; i++) {
-    input_cells[i] = i;
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
     cell_selected_idx[i] = -1;
     porosity[i] = 0.0;
   }
@@ -2214,18 +2723,17 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
 
   /* Get the intersection
    * ==================== */
-  cs_stl_intersection(stl_mesh,
-                      n_input_cells,
-                      input_cells,
-                      &n_selected_cells,
-                      selected_cells,
-                      tria_in_cell_idx,
-                      &tria_in_cell_lst,
-                      &max_size);
-
-  /* Compute the bounding boxes of the main mesh */
-  cs_real_6_t *bbox = nullptr;
-  bbox = cs_mesh_quantities_cell_extents(m, 0.0);
+  _stl_intersection(stl_mesh,
+                    bbox,
+                    n_input_cells,
+                    input_cells,
+                    &n_selected_cells,
+                    selected_cells,
+                    tria_in_cell_idx,
+                    &tria_in_cell_lst,
+                    &max_size);
+
+  CS_MALLOC(mean_plane_def, n_selected_cells*6, cs_real_t);
 
   /* If a cell is overlaped by more than 1 triangle,
    * replace those triangles by a mean plane
@@ -2256,7 +2764,7 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
 
         cs_real_3_t *coords  = stl_mesh->coords + (3*f_tria_id);
         cs_real_t *n         = stl_normals + (3*f_tria_id);
-        cs_real_t *aabb      = &bbox[cell_id][0];
+        const cs_real_t *aabb = &bbox[cell_id][0];
         const cs_real_t *cog = xyzcen[cell_id];
 
         /* Compute the surface of the triangle in the box */
@@ -2316,8 +2824,10 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
 
   cs_real_t vol;
 
-  /* Loop on internal faces */
-  for (cs_lnum_t face_id = 0; face_id < m->n_i_faces; face_id ++) {
+  /* Loop on internal faces (intersecting cells are all selected) */
+  for (cs_lnum_t f_idx = 0; f_idx < n_band_faces; f_idx ++) {
+
+    cs_lnum_t face_id = band_faces[f_idx];
 
     /* Loop on adjacent cells */
     for (int k = 0; k < 2; k++) {
@@ -2325,7 +2835,7 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
       cs_lnum_t idx;
 
       /* Test if the cell is ghost cell */
-      if (cell_id < m->n_cells) {
+      if (cell_id < n_cells) {
         idx = cell_selected_idx[cell_id];
 
         /* Test if the cell was a previously selected
@@ -2378,7 +2888,7 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
     cs_lnum_t idx;
 
     /* Test if the cell is ghost cell */
-    if (cell_id < m->n_cells) {
+    if (cell_id < n_cells) {
       idx = cell_selected_idx[cell_id];
 
       /* Test if the cell was a previously selected
@@ -2440,22 +2950,24 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
   /* Porosity : filling the entire domain
    * ==================================== */
 
-  int *cell_tag = nullptr;
-  CS_MALLOC(cell_tag, m->n_cells_with_ghosts, int);
+  int *cell_tag = c->cell_tag;
 
   /*-------------------------
    * cell_tag is :
    *  - 1 inside solid
    *  -  0 on the solid border
    *  - -1 outside the solid
+   * Cells outside the selected band keep their previous tag.
    *  ------------------------*/
 
-  for (cs_lnum_t cell_id = 0; cell_id < m->n_cells_with_ghosts; cell_id ++) {
-    cell_tag[cell_id] = 1;
-    if (cell_id < m->n_cells)
-      /* If the cell in a border of the STL mesh */
-      if (cell_selected_idx[cell_id] > -1)
-        cell_tag[cell_id] = 0;
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id ++) {
+    if (band[cell_id]) {
+      cell_tag[cell_id] = 1;
+      if (cell_id < n_cells)
+        /* If the cell in a border of the STL mesh */
+        if (cell_selected_idx[cell_id] > -1)
+          cell_tag[cell_id] = 0;
+    }
   }
 
 
@@ -2466,13 +2978,13 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
     cs_lnum_t ref_id;
     int ref_rank;
 
-    cs_geom_closest_point(m->n_cells,
+    cs_geom_closest_point(n_cells,
                           mq->cell_cen,
                           xyz_ref,
                           &ref_id,
                           &ref_rank);
 
-    if (ref_rank == cs_glob_rank_id)
+    if (ref_rank == cs_glob_rank_id && band[ref_id])
       cell_tag[ref_id] = -1;
   }
 
@@ -2488,7 +3000,9 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
 
     cs_gnum_t cpt = 0;
 
-    for (cs_lnum_t face_id = 0; face_id < m->n_i_faces; face_id ++) {
+    for (cs_lnum_t f_idx = 0; f_idx < n_band_faces; f_idx ++) {
+
+      cs_lnum_t face_id = band_faces[f_idx];
 
       cs_lnum_t ii = ifacel[face_id][0];
       cs_lnum_t jj = ifacel[face_id][1];
@@ -2496,12 +3010,12 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
       int ti = cell_tag[ii];
       int tj = cell_tag[jj];
 
-      if (ti == 1 && tj == -1) {
+      if (ti == 1 && tj == -1 && band[ii]) {
         cell_tag[ii] = -1;
         cpt ++;
       }
 
-      if (ti == -1 && tj == 1) {
+      if (ti == -1 && tj == 1 && band[jj]) {
         cell_tag[jj] = -1;
         cpt ++;
       }
@@ -2517,18 +3031,22 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
       cs_halo_sync_num(m->halo, CS_HALO_STANDARD, cell_tag);
   }
 
-  for (cs_lnum_t cell_id = 0; cell_id < m->n_cells; cell_id ++) {
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id ++) {
     if (indic != nullptr)
       indic[cell_id] = cell_tag[cell_id];
     if (cell_tag[cell_id] == -1)
       porosity[cell_id] = 1.0;
   }
 
-  CS_FREE(cell_tag);
+  /* Keep triangle positions for next computation */
+  memcpy(c->tria_coords_prev, stl->coords,
+         3*c->n_tria*sizeof(cs_real_3_t));
+
+  CS_FREE(band);
+  CS_FREE(band_faces);
   CS_FREE(cell_selected_idx);
   CS_FREE(mean_plane_def);
   CS_FREE(stl_normals);
-  CS_FREE(bbox);
   CS_FREE(input_cells);
   CS_FREE(selected_cells);
   CS_FREE(tria_in_cell_lst);
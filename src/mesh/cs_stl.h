@@ -47,6 +47,12 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Opaque structure for triangle search and reuse of intersection results
+ *----------------------------------------------------------------------------*/
+
+typedef struct _cs_stl_cache_t  cs_stl_cache_t;
+
 /*----------------------------------------------------------------------------
  * Structure defining an STL mesh
  *----------------------------------------------------------------------------*/
@@ -76,6 +82,11 @@ typedef struct {
 
   fvm_nodal_t    *ext_mesh;         /*!< Associated external mesh */
 
+  cs_stl_cache_t *cache;            /*!< Triangle bounding volume hierarchy
+                                     *  (refit when the STL mesh moves) and
+                                     *  state of the previous porosity
+                                     *  computation (private) */
+
 } cs_stl_mesh_t ;
 
 /*----------------------------------------------------------------------------
@@ -330,6 +341,10 @@ cs_stl_refine(cs_stl_mesh_t *stl_mesh,
 /*----------------------------------------------------------------------------
  * Compute porosity field according to a given STL mesh
  *
+ * When the main mesh is fixed, the result of the previous call is reused,
+ * and only cells overlapping the region swept by the STL triangles since
+ * that call are recomputed.
+ *
  * parameters:
  *   stl_mesh    <-- pointer to the associated STL mesh structure
  *   n_ref_point <-- number of prescribed points outside the STL
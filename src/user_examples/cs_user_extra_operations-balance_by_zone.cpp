@@ -166,6 +166,21 @@ cs_user_extra_operations(cs_domain_t     *domain)
                balance[rhou_out_idx]);
   }
   /*! [example_6] */
+
+  /* Balances of several scalars on several zones, in a single pass */
+
+  /*! [example_7] */
+  {
+    const char *zone_criteria[] = {"zone_group", "x < 0.5", "x >= 0.5"};
+    const char *scalar_names[] = {"scalar1", "temperature"};
+
+    cs_balance_by_zones(3, zone_criteria,
+                        2, scalar_names,
+                        true);  /* also output time plots */
+
+    cs_pressure_drop_by_zones(3, zone_criteria, true);
+  }
+  /*! [example_7] */
 }
 
 /*----------------------------------------------------------------------------*/
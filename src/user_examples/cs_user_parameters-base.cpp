@@ -750,6 +750,10 @@ cs_user_model(void)
    * The file contains lines with x,y,z (in meters) format */
   cs_ibm_add_sources_by_file_name("sources.csv");
 
+  /* Cache results, so that later computations with the same scan,
+   * options and mesh do not need to read the points again */
+  cs_porosity_from_scan_set_cache_dir("scan_cache");
+
   /* Example: reading a different format of pts file
    * ------------------------------------------------*/
 
@@ -560,6 +560,23 @@ cs_user_postprocess_probes(void)
   }
   /*! [post_set_probes_interpolate] */
 
+  /*! [post_define_probes_spectra] */
+  {
+    /* Spectra of the velocity x component at probes of the "Monitoring"
+       set, using 1024-sample windows, output every 5000 time steps;
+       correlations relative to the first probe for 64 time lags */
+
+    int s_id = cs_probe_spectra_define("u_monitoring", // name
+                                       "Monitoring",   // probe set name
+                                       "velocity",     // field name
+                                       0,              // component id
+                                       1024,           // window size
+                                       5000);          // output interval
+
+    cs_probe_spectra_set_correlation(s_id, 0, 64);
+  }
+  /*! [post_define_probes_spectra] */
+
   /* Add a first profile */
 
   /*! [post_define_profile_1] */
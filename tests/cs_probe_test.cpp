@@ -0,0 +1,266 @@
+/*============================================================================
+ * Unit test for cached P1 interpolation at probes.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2025 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "base/cs_defs.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bft/bft_error.h"
+#include "bft/bft_mem.h"
+#include "bft/bft_printf.h"
+
+#include "base/cs_interpolate.h"
+#include "base/cs_math.h"
+#include "base/cs_preprocessor_data.h"
+#include "base/cs_probe.h"
+#include "mesh/cs_mesh.h"
+#include "mesh/cs_mesh_adjacencies.h"
+#include "mesh/cs_mesh_builder.h"
+#include "mesh/cs_mesh_cartesian.h"
+#include "mesh/cs_mesh_location.h"
+#include "mesh/cs_mesh_quantities.h"
+
+/*---------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Build a small cartesian mesh as the global mesh.
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_mesh(void)
+{
+  int n_cells[3] = {7, 6, 5};
+  cs_real_t xyz[6] = {0., 0., 0., 1.4, 1.0, 0.75};
+
+  cs_mesh_location_initialize();
+  cs_glob_mesh = cs_mesh_create();
+  cs_glob_mesh_builder = cs_mesh_builder_create();
+  cs_glob_mesh_quantities_g = cs_mesh_quantities_create();
+  cs_glob_mesh_quantities = cs_glob_mesh_quantities_g;
+
+  cs_mesh_t *m = cs_glob_mesh;
+
+  cs_mesh_cartesian_define_simple("probe_test", n_cells, xyz);
+  cs_mesh_cartesian_finalize_definition();
+
+  cs_preprocessor_data_read_headers(m, cs_glob_mesh_builder, false);
+  cs_preprocessor_data_read_mesh(m, cs_glob_mesh_builder, false);
+
+  cs_mesh_init_halo(m, cs_glob_mesh_builder, CS_HALO_EXTENDED, 0, true);
+  cs_mesh_update_auxiliary(m);
+
+  cs_mesh_builder_destroy(&cs_glob_mesh_builder);
+  cs_mesh_cartesian_params_destroy();
+
+  cs_mesh_init_group_classes(m);
+
+  cs_mesh_quantities_compute(m, cs_glob_mesh_quantities);
+
+  cs_mesh_init_selectors();
+  cs_mesh_location_build(m, -1);
+
+  cs_mesh_adjacencies_initialize();
+  cs_mesh_adjacencies_update_mesh();
+}
+
+/*----------------------------------------------------------------------------
+ * Free the global mesh.
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_mesh(void)
+{
+  cs_mesh_adjacencies_finalize();
+  cs_mesh_location_finalize();
+  cs_mesh_quantities_destroy(cs_glob_mesh_quantities_g);
+  cs_glob_mesh_quantities = nullptr;
+  cs_mesh_destroy(cs_glob_mesh);
+}
+
+/*----------------------------------------------------------------------------
+ * Compare cached and generic P1 interpolation at probe points.
+ *
+ * parameters:
+ *   pset     <-- pointer to probe set
+ *   val_dim  <-- dimension of values
+ *   c_vals   <-- cell values
+ *   shift    <-- shift applied to probe coordinates
+ *----------------------------------------------------------------------------*/
+
+static void
+_compare_p1(cs_probe_set_t   *pset,
+            int               val_dim,
+            const cs_real_t   c_vals[],
+            cs_real_t         shift)
+{
+  const cs_lnum_t n_loc = cs_probe_set_get_n_local(pset);
+  const cs_lnum_t *loc_id = cs_probe_set_get_loc_ids(pset);
+  const cs_lnum_t *elt_ids
+    = cs_probe_set_get_elt_ids(pset, CS_MESH_LOCATION_CELLS);
+
+  cs_real_3_t *p_coords = nullptr;
+  cs_probe_set_get_members(pset, nullptr, nullptr, &p_coords);
+
+  /* Shifted points remain inside their cells */
+
+  cs_real_3_t *coords;
+  cs_real_t *vals_c, *vals_g;
+  CS_MALLOC(coords, n_loc, cs_real_3_t);
+  CS_MALLOC(vals_c, n_loc*val_dim, cs_real_t);
+  CS_MALLOC(vals_g, n_loc*val_dim, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_loc; i++) {
+    for (int k = 0; k < 3; k++)
+      coords[i][k] = p_coords[loc_id[i]][k] + shift;
+  }
+
+  /* Call twice, so that cached stencils are used */
+
+  for (int call_id = 0; call_id < 2; call_id++)
+    cs_probe_set_interpolate_p1(pset,
+                                nullptr,
+                                CS_REAL_TYPE,
+                                val_dim,
+                                n_loc,
+                                elt_ids,
+                                (const cs_real_3_t *)coords,
+                                c_vals,
+                                vals_c);
+
+  cs_interpolate_from_location_p1(nullptr,
+                                  CS_REAL_TYPE,
+                                  val_dim,
+                                  n_loc,
+                                  elt_ids,
+                                  (const cs_real_3_t *)coords,
+                                  c_vals,
+                                  vals_g);
+
+  double max_diff = 0;
+  for (cs_lnum_t i = 0; i < n_loc*val_dim; i++)
+    max_diff = cs::max(max_diff, cs::abs(vals_c[i] - vals_g[i]));
+
+  bft_printf("P1 interpolation (dim %d, shift %g), %d probes: "
+             "max. difference %g\n",
+             val_dim, shift, (int)n_loc, max_diff);
+
+  if (max_diff > 1e-12)
+    bft_error(__FILE__, __LINE__, 0,
+              "Cached P1 interpolation does not match "
+              "cs_interpolate_from_location_p1.");
+
+  CS_FREE(vals_g);
+  CS_FREE(vals_c);
+  CS_FREE(coords);
+}
+
+/*----------------------------------------------------------------------------
+ * Test cached P1 interpolation with interior and boundary cell probes.
+ *----------------------------------------------------------------------------*/
+
+static void
+_test_p1(void)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_real_3_t *cell_cen = cs_glob_mesh_quantities->cell_cen;
+
+  /* Probes at scattered positions, some in boundary cells,
+     none on cell faces */
+
+  const int n_probes = 40;
+  cs_real_3_t *p_coords;
+  CS_MALLOC(p_coords, n_probes, cs_real_3_t);
+
+  for (int i = 0; i < n_probes; i++) {
+    p_coords[i][0] = 0.013 + 1.37 * fmod(0.618034*(i+1), 1.);
+    p_coords[i][1] = 0.011 + 0.97 * fmod(0.414214*(i+1), 1.);
+    p_coords[i][2] = 0.007 + 0.73 * fmod(0.732051*(i+1), 1.);
+  }
+
+  cs_probe_set_t *pset
+    = cs_probe_set_create_from_array("p1_test",
+                                     n_probes,
+                                     (const cs_real_3_t *)p_coords,
+                                     nullptr);
+
+  CS_FREE(p_coords);
+
+  cs_probe_set_locate(pset, nullptr);
+
+  /* Smooth non-linear values */
+
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+
+  cs_real_t *c_vals;
+  CS_MALLOC(c_vals, n_cells_ext*3, cs_real_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+    const cs_real_t *c = cell_cen[c_id];
+    c_vals[c_id*3]     = sin(3.*c[0]) + c[1]*c[2];
+    c_vals[c_id*3 + 1] = cos(2.*c[1]) * c[0];
+    c_vals[c_id*3 + 2] = exp(c[2]) - c[0]*c[0];
+  }
+
+  _compare_p1(pset, 1, c_vals, 0.);
+  _compare_p1(pset, 3, c_vals, 0.);
+
+  /* Different coordinates must not reuse previous weights, and
+     alternating between coordinate sets must select matching ones
+     (including after the least recently used stencil is replaced) */
+
+  _compare_p1(pset, 1, c_vals, 1e-3);
+  _compare_p1(pset, 3, c_vals, 0.);
+  _compare_p1(pset, 1, c_vals, 1e-3);
+  _compare_p1(pset, 3, c_vals, -1e-3);
+  _compare_p1(pset, 1, c_vals, 0.);
+
+  CS_FREE(c_vals);
+}
+
+/*---------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  cs_mem_init(getenv("CS_MEM_LOG"));
+
+  _build_mesh();
+
+  _test_p1();
+
+  cs_probe_finalize();
+
+  _free_mesh();
+
+  cs_mem_end();
+
+  exit(EXIT_SUCCESS);
+}
@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+
+#-------------------------------------------------------------------------------
+# This file is part of code_saturne, a general-purpose CFD tool.
+#
+# Copyright (C) 1998-2025 EDF S.A.
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 2 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+# Street, Fifth Floor, Boston, MA 02110-1301, USA.
+#-------------------------------------------------------------------------------
+
+"""
+Round-trip test for binary time plot files: run the cs_time_plot_test
+writer, then read its output with extras/script/cs_time_plot_bin.py,
+with and without the chunk index.
+
+usage: cs_time_plot_bin_test.py [path to cs_time_plot_test]
+"""
+
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                '..', 'extras', 'script'))
+
+from cs_time_plot_bin import time_plot_file
+
+#-------------------------------------------------------------------------------
+
+n_probes = 3
+n_steps = 1000
+n_buffer_steps = 64
+
+#-------------------------------------------------------------------------------
+
+def check_rows(tp, t_min, t_max):
+    """
+    Check rows read in a given range against values written by
+    cs_time_plot_test, and return the number of chunks read.
+    """
+
+    chunks_read = []
+    read_chunk = tp.read_chunk
+
+    def counting_read_chunk(chunk_id):
+        chunks_read.append(chunk_id)
+        return read_chunk(chunk_id)
+
+    tp.read_chunk = counting_read_chunk
+
+    rows = list(tp.rows(t_min, t_max))
+
+    tn_s = 1 if t_min is None else t_min
+    tn_e = n_steps if t_max is None else t_max
+    expected = [(tn, 0.125*tn, [0.5*tn + j for j in range(n_probes)])
+                for tn in range(tn_s, tn_e + 1)]
+
+    for r, e in zip(rows, expected):
+        if r[0] != e[0] or r[1] != e[1] or list(r[2]) != e[2]:
+            raise AssertionError('row ' + str(r) + ' expected ' + str(e))
+    if len(rows) != len(expected):
+        raise AssertionError('%d rows read, %d expected'
+                             % (len(rows), len(expected)))
+
+    del tp.read_chunk
+
+    return len(chunks_read)
+
+#-------------------------------------------------------------------------------
+
+def check_file(file_name):
+
+    tp = time_plot_file(file_name)
+
+    if tp.n_cols != n_probes or tp.labels != ['p_a', 'p_b', 'p_c']:
+        raise AssertionError('unexpected header: %d columns, labels %s'
+                             % (tp.n_cols, str(tp.labels)))
+    if tp.coords[2] != (0., 1., 0.5):
+        raise AssertionError('unexpected coordinates: ' + str(tp.coords))
+
+    n_chunks = (n_steps + n_buffer_steps - 1) // n_buffer_steps
+    if len(tp.chunks) != n_chunks:
+        raise AssertionError('%d chunks, %d expected'
+                             % (len(tp.chunks), n_chunks))
+
+    # Full read, then ranges starting and ending inside chunks, which
+    # should only read the chunks containing requested time steps.
+
+    for t_min, t_max in ((None, None), (1, None), (700, None),
+                         (129, 200), (None, 100), (1000, 1000)):
+        n_read = check_rows(tp, t_min, t_max)
+        c_s = 0 if t_min is None else (t_min - 1) // n_buffer_steps
+        c_e = n_chunks - 1 if t_max is None else (t_max - 1) // n_buffer_steps
+        if n_read != c_e - c_s + 1:
+            raise AssertionError('t_min=%s, t_max=%s: %d chunks read, %d used'
+                                 % (t_min, t_max, n_read, c_e - c_s + 1))
+
+#-------------------------------------------------------------------------------
+
+def main():
+
+    writer = 'cs_time_plot_test'
+    if len(sys.argv) > 1:
+        writer = sys.argv[1]
+    writer = os.path.abspath(writer)
+
+    w_dir = tempfile.mkdtemp(prefix='cs_time_plot_bin_test_')
+
+    try:
+        subprocess.check_call([writer], cwd=w_dir)
+
+        file_name = os.path.join(w_dir, 'time_plot_test.ctp')
+        check_file(file_name)
+
+        # Remove index and footer, as for an interrupted computation
+
+        with open(file_name, 'rb') as f:
+            data = f.read()
+        tp = time_plot_file(file_name)
+        idx_pos = tp.chunks[-1]
+        idx_pos = data.index(b'CIDX', idx_pos)
+        del tp
+
+        file_name = os.path.join(w_dir, 'time_plot_test_no_index.ctp')
+        with open(file_name, 'wb') as f:
+            f.write(data[:idx_pos])
+        check_file(file_name)
+
+    finally:
+        shutil.rmtree(w_dir)
+
+    print('binary time plot round trip: OK')
+
+    return 0
+
+#-------------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,86 @@
+/*============================================================================
+ * Unit test for binary time plot output; the produced file is checked
+ * by cs_time_plot_bin_test.py.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2025 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "base/cs_defs.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bft/bft_mem.h"
+#include "bft/bft_printf.h"
+
+#include "base/cs_time_plot.h"
+
+/*---------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  cs_mem_init(getenv("CS_MEM_LOG"));
+
+  /* Values are exactly representable, so that the reader's output may
+     be compared exactly; see cs_time_plot_bin_test.py */
+
+  const int n_probes = 3;
+  const int n_steps = 1000;
+  const int n_buffer_steps = 64;
+
+  const cs_real_t probe_coords[] = {0., 0., 0.,
+                                    1., 0., 0.,
+                                    0., 1., 0.5};
+  const char *probe_names[] = {"p_a", "p_b", "p_c"};
+
+  cs_time_plot_t *p = cs_time_plot_init_probe("time_plot_test",
+                                              "",
+                                              CS_TIME_PLOT_BIN,
+                                              false,
+                                              -1.,
+                                              n_buffer_steps,
+                                              n_probes,
+                                              nullptr,
+                                              probe_coords,
+                                              probe_names);
+
+  for (int tn = 1; tn <= n_steps; tn++) {
+    cs_real_t vals[3];
+    for (int j = 0; j < n_probes; j++)
+      vals[j] = 0.5*tn + j;
+    cs_time_plot_vals_write(p, tn, 0.125*tn, n_probes, vals);
+  }
+
+  cs_time_plot_finalize(&p);
+
+  bft_printf("time_plot_test.ctp: %d steps of %d values written\n",
+             n_steps, n_probes);
+
+  cs_mem_end();
+
+  exit(EXIT_SUCCESS);
+}
@@ -0,0 +1,251 @@
+/*============================================================================
+ * Unit test for face list velocity wall functions.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2025 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "base/cs_defs.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bft/bft_error.h"
+#include "bft/bft_mem.h"
+#include "bft/bft_printf.h"
+
+#include "base/cs_math.h"
+#include "base/cs_wall_functions.h"
+#include "turb/cs_turbulence_model.h"
+
+/*---------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Return relative difference of two values.
+ *----------------------------------------------------------------------------*/
+
+static double
+_rel_diff(double  a,
+          double  b)
+{
+  double d = cs::abs(a - b);
+  double s = cs::abs(a) + cs::abs(b);
+
+  return (s > 0) ? d/s : 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Compare face list and per-face velocity wall functions for a given
+ * wall function type.
+ *
+ * Faces span the viscous sub-layer and the log layer; only every other
+ * face (in reverse order) is in the face list, to check indexing.
+ *
+ * parameters:
+ *   iwallf <-- wall function type
+ *----------------------------------------------------------------------------*/
+
+static void
+_compare_velocity(cs_wall_f_type_t  iwallf)
+{
+  const cs_lnum_t n_b_faces = 203;
+
+  cs_real_t *l_visc, *t_visc, *vel, *y, *rough_d, *rnnb, *kinetic_en;
+  CS_MALLOC(l_visc, n_b_faces, cs_real_t);
+  CS_MALLOC(t_visc, n_b_faces, cs_real_t);
+  CS_MALLOC(vel, n_b_faces, cs_real_t);
+  CS_MALLOC(y, n_b_faces, cs_real_t);
+  CS_MALLOC(rough_d, n_b_faces, cs_real_t);
+  CS_MALLOC(rnnb, n_b_faces, cs_real_t);
+  CS_MALLOC(kinetic_en, n_b_faces, cs_real_t);
+
+  int *iuntur;
+  cs_real_t *ustar, *uk, *yplus, *ypup, *cofimp, *dplus;
+  CS_MALLOC(iuntur, n_b_faces, int);
+  CS_MALLOC(ustar, n_b_faces, cs_real_t);
+  CS_MALLOC(uk, n_b_faces, cs_real_t);
+  CS_MALLOC(yplus, n_b_faces, cs_real_t);
+  CS_MALLOC(ypup, n_b_faces, cs_real_t);
+  CS_MALLOC(cofimp, n_b_faces, cs_real_t);
+  CS_MALLOC(dplus, n_b_faces, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_b_faces; i++) {
+    const double r = (double)i / (double)(n_b_faces - 1);
+    l_visc[i] = 1e-6 * (1. + r);
+    t_visc[i] = 1e-4 * (1. + 10.*r*r);
+    vel[i] = 1e-4 * pow(10., 5.*r);
+    y[i] = 1e-5 * pow(10., 3.*(1. - r));
+    rough_d[i] = 1e-6 * (1. + (i%5));
+    rnnb[i] = 1e-4 * (1. + (i%7));
+    kinetic_en[i] = 1e-4 * pow(10., 4.*r);
+    iuntur[i] = -1;
+    ustar[i] = -1; uk[i] = -1; yplus[i] = -1;
+    ypup[i] = -1; cofimp[i] = -1; dplus[i] = -1;
+  }
+
+  cs_lnum_t n_faces = 0;
+  cs_lnum_t *face_ids;
+  CS_MALLOC(face_ids, n_b_faces, cs_lnum_t);
+  for (cs_lnum_t i = n_b_faces - 1; i >= 0; i -= 2)
+    face_ids[n_faces++] = i;
+
+  cs_gnum_t nsubla = 0, nlogla = 0;
+
+  cs_wall_functions_velocity_faces(iwallf,
+                                   n_faces,
+                                   face_ids,
+                                   l_visc,
+                                   t_visc,
+                                   vel,
+                                   y,
+                                   rough_d,
+                                   rnnb,
+                                   kinetic_en,
+                                   iuntur,
+                                   &nsubla,
+                                   &nlogla,
+                                   ustar,
+                                   uk,
+                                   yplus,
+                                   ypup,
+                                   cofimp,
+                                   dplus);
+
+  cs_gnum_t nsubla_ref = 0, nlogla_ref = 0;
+  double max_diff = 0;
+  int n_iuntur_diff = 0;
+
+  for (cs_lnum_t i = 0; i < n_faces; i++) {
+    const cs_lnum_t f_id = face_ids[i];
+
+    int iuntur_ref = -1;
+    cs_real_t ustar_ref, uk_ref, yplus_ref, ypup_ref, cofimp_ref, dplus_ref;
+
+    cs_wall_functions_velocity(iwallf,
+                               l_visc[f_id],
+                               t_visc[f_id],
+                               vel[f_id],
+                               y[f_id],
+                               rough_d[f_id],
+                               rnnb[f_id],
+                               kinetic_en[f_id],
+                               &iuntur_ref,
+                               &nsubla_ref,
+                               &nlogla_ref,
+                               &ustar_ref,
+                               &uk_ref,
+                               &yplus_ref,
+                               &ypup_ref,
+                               &cofimp_ref,
+                               &dplus_ref);
+
+    if (iuntur_ref != iuntur[f_id])
+      n_iuntur_diff++;
+
+    const double d[] = {_rel_diff(ustar_ref, ustar[f_id]),
+                        _rel_diff(uk_ref, uk[f_id]),
+                        _rel_diff(yplus_ref, yplus[f_id]),
+                        _rel_diff(ypup_ref, ypup[f_id]),
+                        _rel_diff(cofimp_ref, cofimp[f_id]),
+                        _rel_diff(dplus_ref, dplus[f_id])};
+    for (int j = 0; j < 6; j++)
+      max_diff = cs::max(max_diff, d[j]);
+  }
+
+  /* Faces not in list must not be modified */
+
+  int n_modified = 0;
+  for (cs_lnum_t i = n_b_faces - 2; i >= 0; i -= 2) {
+    if (iuntur[i] != -1 || ustar[i] > -1 || cofimp[i] > -1)
+      n_modified++;
+  }
+
+  bft_printf("Wall function type %d, %d faces (%llu sub-layer, "
+             "%llu log layer): max. relative difference %g\n",
+             (int)iwallf, (int)n_faces,
+             (unsigned long long)nsubla, (unsigned long long)nlogla,
+             max_diff);
+
+  if (   max_diff > 1e-12
+      || n_iuntur_diff > 0
+      || n_modified > 0
+      || nsubla != nsubla_ref
+      || nlogla != nlogla_ref)
+    bft_error(__FILE__, __LINE__, 0,
+              "Face list velocity wall function (type %d) does not match "
+              "cs_wall_functions_velocity.", (int)iwallf);
+
+  CS_FREE(face_ids);
+
+  CS_FREE(dplus);
+  CS_FREE(cofimp);
+  CS_FREE(ypup);
+  CS_FREE(yplus);
+  CS_FREE(uk);
+  CS_FREE(ustar);
+  CS_FREE(iuntur);
+
+  CS_FREE(kinetic_en);
+  CS_FREE(rnnb);
+  CS_FREE(rough_d);
+  CS_FREE(y);
+  CS_FREE(vel);
+  CS_FREE(t_visc);
+  CS_FREE(l_visc);
+}
+
+/*---------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  cs_mem_init(getenv("CS_MEM_LOG"));
+
+  /* Constants usually set by cs_turb_compute_constants and
+     cs_parameters_*_complete */
+
+  cs_turb_dpow = 1./(1. + cs_turb_bpow);
+  cs_turb_cstlog_alpha = exp(-cs_turb_xkappa
+                             * (cs_turb_cstlog_rough - cs_turb_cstlog));
+  cs_get_glob_wall_functions()->ypluli = 1. / cs_turb_xkappa;
+
+  const cs_wall_f_type_t wall_f_types[]
+    = {CS_WALL_F_DISABLED,
+       CS_WALL_F_1SCALE_POWER,
+       CS_WALL_F_1SCALE_LOG,
+       CS_WALL_F_2SCALES_LOG,
+       CS_WALL_F_SCALABLE_2SCALES_LOG,
+       CS_WALL_F_2SCALES_VDRIEST,
+       CS_WALL_F_2SCALES_SMOOTH_ROUGH,
+       CS_WALL_F_2SCALES_CONTINUOUS};
+
+  for (int i = 0; i < 8; i++)
+    _compare_velocity(wall_f_types[i]);
+
+  cs_mem_end();
+
+  exit(EXIT_SUCCESS);
+}
@@ -126,8 +126,8 @@ test_2 (void)
                           gcset,
                           f_gc_id,
                           1,
-                          coords,
-                          norms);
+                          (const cs_real_3_t *)coords,
+                          (const cs_nreal_3_t *)norms);
 
   fvm_selector_dump(s);
 
@@ -445,8 +445,8 @@ test_3 (void)
                           gcset,
                           f_gc_id,
                           1,
-                          coords,
-                          norms);
+                          (const cs_real_3_t *)coords,
+                          (const cs_nreal_3_t *)norms);
 
   fvm_selector_dump(s);
 
@@ -461,6 +461,161 @@ test_3 (void)
   bft_printf("\n\n");
 }
 
+/*----------------------------------------------------------------------------
+ * Check a selection against expected element flags.
+ *
+ * parameters:
+ *   criteria <-- selection criteria
+ *   n_elts   <-- number of elements
+ *   n_se     <-- number of selected elements
+ *   se       <-- selected element ids (1 to n)
+ *   expected <-- expected selection flag for each element
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_selection(const char  *criteria,
+                 cs_lnum_t    n_elts,
+                 cs_lnum_t    n_se,
+                 const cs_lnum_t  se[],
+                 const bool   expected[])
+{
+  cs_lnum_t n_expected = 0, n_errors = 0;
+
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    if (expected[i])
+      n_expected++;
+  }
+
+  if (n_se != n_expected)
+    n_errors++;
+
+  for (cs_lnum_t i = 0; i < n_se; i++) {
+    if (expected[se[i] - 1] == false)
+      n_errors++;
+  }
+
+  bft_printf("criteria \"%s\": %d elements selected (%d expected)\n",
+             criteria, (int)n_se, (int)n_expected);
+
+  if (n_errors > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              "Selection with criteria \"%s\" does not match expected one.",
+              criteria);
+}
+
+static void
+test_4 (void)
+{
+  /* Elements aligned along x, with several blocks of evaluation
+     (256 elements) and group classes varying inside blocks */
+
+  const cs_lnum_t n_elts = 1000;
+
+  const char *grp_1[] = {"inlet_1"};
+  const char *grp_2[] = {"inlet_2"};
+  const char *grp_3[] = {"outlet"};
+  const char *grp_4[] = {"wall"};
+
+  int *f_gc_id;
+  cs_real_3_t *coords;
+  cs_nreal_3_t *norms;
+  cs_lnum_t *se;
+  bool *expected;
+
+  CS_MALLOC(f_gc_id, n_elts, int);
+  CS_MALLOC(coords, n_elts, cs_real_3_t);
+  CS_MALLOC(norms, n_elts, cs_nreal_3_t);
+  CS_MALLOC(se, n_elts, cs_lnum_t);
+  CS_MALLOC(expected, n_elts, bool);
+
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    f_gc_id[i] = 1 + (i/50)%4;
+    coords[i][0] = i*0.01;
+    coords[i][1] = (i%7)*0.1;
+    coords[i][2] = 0.;
+    norms[i][0] = 1.;
+    norms[i][1] = 0.;
+    norms[i][2] = 0.;
+  }
+
+  fvm_group_class_set_t *gcset = fvm_group_class_set_create();
+
+  fvm_group_class_set_add(gcset, 1, grp_1);
+  fvm_group_class_set_add(gcset, 1, grp_2);
+  fvm_group_class_set_add(gcset, 1, grp_3);
+  fvm_group_class_set_add(gcset, 1, grp_4);
+
+  fvm_selector_t *s = fvm_selector_create(3,
+                                          n_elts,
+                                          gcset,
+                                          f_gc_id,
+                                          1,
+                                          coords,
+                                          norms);
+
+  const int n_criteria = 7;
+  const char *criteria[] = {
+    "contains[inlet] and x < 2",
+    "range[inlet_2, outlet, group] and x >= 5",
+    "(not wall) xor (x > 3.3)",
+    "plane[1, 0, 0, -3.005, inside] or contains[out]",
+    "plane[0, 1, 0, -0.25, outside] and not contains[let]",
+    "box[2.005, -1, -1, 7.685, 0.25, 1]",
+    "box[-1, -1, -1, 5.125, 1, 1] and not range[inlet_1, inlet_2]"};
+
+  for (int c_id = 0; c_id < n_criteria; c_id++) {
+
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+      const int gc_id = f_gc_id[i];
+      const double x = coords[i][0], y = coords[i][1];
+      bool inlet = (gc_id == 1 || gc_id == 2);
+      switch(c_id) {
+      case 0:
+        expected[i] = (inlet && x < 2);
+        break;
+      case 1:
+        expected[i] = ((gc_id == 2 || gc_id == 3) && x >= 5);
+        break;
+      case 2:
+        expected[i] = ((gc_id != 4) != (x > 3.3));
+        break;
+      case 3:
+        expected[i] = (x <= 3.005 || gc_id == 3);
+        break;
+      case 4:
+        expected[i] = (y >= 0.25 && gc_id == 4);
+        break;
+      case 5:
+        expected[i] = (x >= 2.005 && x <= 7.685 && y <= 0.25);
+        break;
+      case 6:
+        expected[i] = (x <= 5.125 && inlet == false);
+        break;
+      default:
+        expected[i] = false;
+      }
+    }
+
+    cs_lnum_t n_se = 0;
+    fvm_selector_get_list(s, criteria[c_id], 1, &n_se, se);
+
+    _check_selection(criteria[c_id], n_elts, n_se, se, expected);
+
+  }
+
+  bft_printf("\n");
+
+  s = fvm_selector_destroy(s);
+
+  gcset = fvm_group_class_set_destroy(gcset);
+
+  CS_FREE(expected);
+  CS_FREE(se);
+  CS_FREE(norms);
+  CS_FREE(coords);
+  CS_FREE(f_gc_id);
+}
+
 /*---------------------------------------------------------------------------*/
 
 int
@@ -477,6 +632,8 @@ main (int argc, char *argv[])
 
   test_3();
 
+  test_4();
+
   cs_mem_end();
 
   exit (EXIT_SUCCESS);
@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+#-------------------------------------------------------------------------------
+
+# This file is part of code_saturne, a general-purpose CFD tool.
+#
+# Copyright (C) 1998-2025 EDF S.A.
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 2 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+# Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#-------------------------------------------------------------------------------
+
+"""
+Compare two performance reports (performance.json files) written by
+code_saturne at the end of a computation, and flag regressions, that is
+values (times, iteration counts, memory) which increased by more than a
+given relative threshold between the reference and the new report.
+
+The exit status is 1 if regressions are detected, 0 otherwise, so this
+script may be used directly in continuous integration.
+"""
+
+#-------------------------------------------------------------------------------
+# Library modules import
+#-------------------------------------------------------------------------------
+
+import argparse
+import json
+import sys
+
+#-------------------------------------------------------------------------------
+# Functions
+#-------------------------------------------------------------------------------
+
+def process_cmd_line(argv):
+    """
+    Process the passed command line arguments.
+    """
+
+    parser = argparse.ArgumentParser(description=__doc__)
+
+    parser.add_argument("reference",
+                        help="reference performance report")
+    parser.add_argument("new",
+                        help="new performance report")
+    parser.add_argument("-t", "--threshold", type=float, default=0.1,
+                        help="relative increase flagged as a regression "
+                        + "(default: 0.1)")
+    parser.add_argument("--min-time", type=float, default=0.01,
+                        help="ignore times (in s) below this value in "
+                        + "both reports (default: 0.01)")
+    parser.add_argument("--stat", choices=["min", "max", "mean"],
+                        default="max",
+                        help="statistic over ranks used for comparison "
+                        + "(default: max)")
+    parser.add_argument("-s", "--section", action="append", default=None,
+                        help="only compare the given section "
+                        + "(may be repeated)")
+    parser.add_argument("-a", "--all", action="store_true",
+                        help="also list values which did not regress")
+
+    return parser.parse_args(argv)
+
+#-------------------------------------------------------------------------------
+
+def load_report(path):
+    """
+    Load a performance report, returning a dictionary of values indexed
+    by (section, record name, key) tuples.
+    """
+
+    with open(path) as f:
+        report = json.load(f)
+
+    values = {}
+
+    for section, records in report["sections"].items():
+        # Records with identical names are numbered in order of appearance
+        count = {}
+        for r in records:
+            name = r["name"]
+            n = count.get(name, 0)
+            count[name] = n + 1
+            if n > 0:
+                name += " #" + str(n)
+            for key, v in r.items():
+                if key != "name" and isinstance(v, dict):
+                    values[(section, name, key)] = v
+
+    return values
+
+#-------------------------------------------------------------------------------
+
+def compare(ref, new, options):
+    """
+    Compare reports, returning lists of regressions and other compared
+    values, as (section, name, key, ref_value, new_value, ratio) tuples.
+    """
+
+    regressions = []
+    others = []
+
+    for k in ref:
+        if k not in new:
+            continue
+        section, name, key = k
+        if options.section and section not in options.section:
+            continue
+
+        v_ref = ref[k].get(options.stat)
+        v_new = new[k].get(options.stat)
+        if v_ref is None or v_new is None:
+            continue
+
+        if key.endswith("_time") \
+           and max(v_ref, v_new) < options.min_time:
+            continue
+
+        if v_ref > 0:
+            ratio = v_new / v_ref
+        elif v_new > 0:
+            ratio = float("inf")
+        else:
+            ratio = 1.0
+
+        t = (section, name, key, v_ref, v_new, ratio)
+        if ratio > 1.0 + options.threshold:
+            regressions.append(t)
+        else:
+            others.append(t)
+
+    return regressions, others
+
+#-------------------------------------------------------------------------------
+
+def print_table(title, rows):
+    """
+    Print a list of compared values.
+    """
+
+    print("")
+    print(title)
+    print("-"*len(title))
+
+    if not rows:
+        print("  (none)")
+        return
+
+    for section, name, key, v_ref, v_new, ratio in rows:
+        print("  %-16s %-48s %-20s %12.5g %12.5g %+8.1f %%"
+              % (section, name[:48], key, v_ref, v_new, (ratio - 1.0)*100))
+
+#-------------------------------------------------------------------------------
+
+def main(argv):
+    """
+    Main function.
+    """
+
+    options = process_cmd_line(argv)
+
+    ref = load_report(options.reference)
+    new = load_report(options.new)
+
+    missing = [k for k in ref if k not in new]
+    added = [k for k in new if k not in ref]
+
+    regressions, others = compare(ref, new, options)
+
+    key_f = lambda t: -t[5]
+    regressions.sort(key=key_f)
+
+    print_table("Regressions (%s over ranks, threshold %g %%)"
+                % (options.stat, options.threshold*100), regressions)
+
+    if options.all:
+        others.sort(key=key_f)
+        print_table("Other compared values", others)
+
+    if missing or added:
+        print("")
+        print("%d values only in reference, %d only in new report."
+              % (len(missing), len(added)))
+
+    if regressions:
+        return 1
+    return 0
+
+#-------------------------------------------------------------------------------
+# Main program
+#-------------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
+
+#-------------------------------------------------------------------------------
+# End
+#-------------------------------------------------------------------------------